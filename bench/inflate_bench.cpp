@@ -0,0 +1,129 @@
+// Microseconds and heap allocations per message to inflate gzip-compressed
+// order book messages: a z_stream built per message into a fresh string, as
+// gzip::decompress does, against the per-connection Inflater.
+//
+//   ccxt_inflate_bench [seconds per case]
+
+#include <ccxt/base/inflater.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <zlib.h>
+
+namespace {
+std::size_t globalAllocations = 0;
+} // namespace
+
+void* operator new(std::size_t size) {
+    ++globalAllocations;
+    if (void* pointer = std::malloc(size ? size : 1)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+namespace {
+
+std::string depthSnapshot(int levels) {
+    std::string bids;
+    std::string asks;
+    for (int i = 0; i < levels; ++i) {
+        char level[64];
+        std::snprintf(level, sizeof(level), "%s[\"%.2f\",\"%.8f\"]", i ? "," : "", 43250.10 - i * 0.01, 0.0125 + i * 0.001);
+        bids += level;
+        std::snprintf(level, sizeof(level), "%s[\"%.2f\",\"%.8f\"]", i ? "," : "", 43250.11 + i * 0.01, 0.0310 + i * 0.002);
+        asks += level;
+    }
+    return R"({"ch":"market.btcusdt.depth.step0","ts":1700000000123,"tick":{"bids":[)" + bids + R"(],"asks":[)" + asks +
+           R"(],"version":40168412998,"ts":1700000000120}})";
+}
+
+std::string gzip(const std::string& text) {
+    z_stream stream{};
+    deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+    std::string result(deflateBound(&stream, text.size()), '\0');
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(text.data()));
+    stream.avail_in = text.size();
+    stream.next_out = reinterpret_cast<Bytef*>(result.data());
+    stream.avail_out = result.size();
+    deflate(&stream, Z_FINISH);
+    result.resize(stream.total_out);
+    deflateEnd(&stream);
+    return result;
+}
+
+// gzip::decompress: a new z_stream and a growing std::string per message
+std::string decompress(const std::string& data) {
+    z_stream stream{};
+    inflateInit2(&stream, 16 + MAX_WBITS);
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    stream.avail_in = data.size();
+    std::string output;
+    std::size_t produced = 0;
+    int result = Z_OK;
+    do {
+        output.resize(produced + 2 * data.size());
+        stream.next_out = reinterpret_cast<Bytef*>(output.data() + produced);
+        stream.avail_out = output.size() - produced;
+        result = inflate(&stream, Z_FINISH);
+        produced = stream.total_out;
+    } while (result == Z_BUF_ERROR || result == Z_OK);
+    inflateEnd(&stream);
+    if (result != Z_STREAM_END) {
+        throw std::runtime_error("corrupt input");
+    }
+    output.resize(produced);
+    return output;
+}
+
+template <typename Inflate>
+void measure(const char* name, const std::string& compressed, Inflate&& inflate, double seconds) {
+    inflate(compressed);
+    std::size_t before = globalAllocations;
+    for (int i = 0; i < 100; ++i) {
+        inflate(compressed);
+    }
+    double allocations = (globalAllocations - before) / 100.0;
+
+    using Clock = std::chrono::steady_clock;
+    auto deadline = Clock::now() + std::chrono::duration<double>(seconds);
+    auto start = Clock::now();
+    std::size_t count = 0;
+    std::size_t checksum = 0;
+    while (Clock::now() < deadline) {
+        for (int i = 0; i < 16; ++i) {
+            checksum += inflate(compressed);
+        }
+        count += 16;
+    }
+    double elapsed = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+    std::printf("%-22s %10.2f %10.1f\n", name, checksum ? elapsed / count : 0, allocations);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    double seconds = argc > 1 ? std::atof(argv[1]) : 1.0;
+    std::printf("%-22s %10s %10s\n", "payload", "us/msg", "alloc/msg");
+    for (int levels : {20, 150, 1000}) {
+        std::string compressed = gzip(depthSnapshot(levels));
+        char name[32];
+        std::snprintf(name, sizeof(name), "depth%d per-message", levels);
+        measure(name, compressed, [](const std::string& data) { return decompress(data).size(); }, seconds);
+        ccxt::Inflater inflater(ccxt::FrameCompression::Gzip);
+        std::snprintf(name, sizeof(name), "depth%d Inflater", levels);
+        measure(name, compressed, [&](const std::string& data) { return inflater.inflate(data).size(); }, seconds);
+    }
+    return 0;
+}
@@ -0,0 +1,79 @@
+// Nanoseconds from createOrder arguments to a signed Binance order request:
+// building a json request, url-encoding it, signing and concatenating, as
+// Binance::sign does, against a PreparedOrder rendered in place.
+//
+//   ccxt_order_entry_bench [seconds per case]
+
+#include <ccxt/exchanges/binance.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+namespace {
+
+class BenchBinance : public ccxt::Binance {
+public:
+    using ccxt::Binance::Binance;
+    using ccxt::Exchange::loadMarkets;
+    json fetchMarkets(const json& params = json::object()) override {
+        return json::array({{{"id", "BTCUSDT"}, {"symbol", "BTC/USDT"}, {"base", "BTC"}, {"quote", "USDT"},
+                             {"precision", {{"price", 0.01}, {"amount", 0.00001}}}}});
+    }
+};
+
+template <typename Render>
+double nanosecondsPerOrder(Render&& render, double seconds) {
+    using Clock = std::chrono::steady_clock;
+    auto deadline = Clock::now() + std::chrono::duration<double>(seconds);
+    auto start = Clock::now();
+    std::size_t count = 0;
+    std::size_t checksum = 0;
+    while (Clock::now() < deadline) {
+        for (int i = 0; i < 256; ++i) {
+            checksum += render(i);
+        }
+        count += 256;
+    }
+    double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    return checksum ? elapsed / count : 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    double seconds = argc > 1 ? std::atof(argv[1]) : 1.0;
+    boost::asio::io_context context;
+    ccxt::Config config;
+    config.apiKey = "vmPUZE6mv9SD5VNHk4HlWFsOr6aKE2zvsw0MuIgwCIPy6utIco14y7Ju91duEh8A";
+    config.secret = "NhqPtmdSJYdKjVHjA7PZj4Mge3R5YNiP1e3UZjInClVN65XAbvqqM6A7H5fATj0j";
+    BenchBinance exchange(context, config);
+    exchange.loadMarkets();
+    ccxt::Exchange& base = exchange;
+
+    std::printf("%-22s %10s\n", "path", "ns/order");
+    std::printf("%-22s %10.0f\n", "json + urlencode", nanosecondsPerOrder([&](int i) {
+        json request = json::object();
+        request["symbol"] = "BTCUSDT";
+        request["side"] = "BUY";
+        request["type"] = "LIMIT";
+        request["timeInForce"] = "GTC";
+        request["quantity"] = base.amountToPrecision("BTC/USDT", 0.001 + i * 1e-5);
+        request["price"] = base.priceToPrecision("BTC/USDT", 43250.1 + i * 0.01);
+        request["timestamp"] = std::to_string(exchange.milliseconds());
+        std::string query = base.urlencode(request);
+        std::string signature = base.hmac(query, config.secret, "sha256", "hex");
+        std::map<std::string, std::string> headers;
+        headers["X-MBX-APIKEY"] = config.apiKey;
+        headers["Content-Type"] = "application/x-www-form-urlencoded";
+        std::string body = query + "&signature=" + signature;
+        std::string url = "https://api.binance.com/api/v3/order";
+        return body.size() + url.size() + headers.size();
+    }, seconds));
+
+    auto order = exchange.prepareOrder("BTC/USDT", "limit", "buy");
+    std::printf("%-22s %10.0f\n", "PreparedOrder", nanosecondsPerOrder([&](int i) {
+        return exchange.renderOrder(order, 0.001 + i * 1e-5, 43250.1 + i * 0.01).body().size();
+    }, seconds));
+    return 0;
+}
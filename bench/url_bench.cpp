@@ -0,0 +1,123 @@
+// Nanoseconds per call of the REST URL helpers: the regex implodeParams and
+// extractParams and the ostringstream encode and urlencode they replaced,
+// against UrlTemplate and the table-driven percent-encoder.
+//
+//   ccxt_url_bench [seconds per case]
+
+#include <ccxt/base/url_template.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::string regexImplodeParams(const std::string& path, const json& params) {
+    std::string result = path;
+    for (const auto& [key, value] : params.items()) {
+        result = std::regex_replace(result, std::regex("\\{" + key + "\\}"), value.get<std::string>());
+    }
+    return result;
+}
+
+std::vector<std::string> regexExtractParams(const std::string& path) {
+    std::vector<std::string> result;
+    std::regex pattern("\\{([^}]+)\\}");
+    for (std::sregex_iterator i(path.begin(), path.end(), pattern), end; i != end; ++i) {
+        result.push_back((*i)[1].str());
+    }
+    return result;
+}
+
+std::string streamEncode(const std::string& string) {
+    std::ostringstream escaped;
+    escaped.fill('0');
+    escaped << std::hex;
+    for (char c : string) {
+        if (isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~') {
+            escaped << c;
+            continue;
+        }
+        escaped << std::uppercase << '%' << std::setw(2) << int((unsigned char)c) << std::nouppercase;
+    }
+    return escaped.str();
+}
+
+std::string streamUrlencode(const json& params) {
+    std::ostringstream result;
+    bool first = true;
+    for (const auto& [key, value] : params.items()) {
+        if (!first) {
+            result << "&";
+        }
+        first = false;
+        result << streamEncode(key) << "=" << streamEncode(value.get<std::string>());
+    }
+    return result.str();
+}
+
+std::string tableUrlencode(const json& params) {
+    std::string result;
+    for (const auto& [key, value] : params.items()) {
+        if (!result.empty()) {
+            result += '&';
+        }
+        ccxt::appendPercentEncoded(result, key);
+        result += '=';
+        ccxt::appendPercentEncoded(result, value.get_ref<const std::string&>());
+    }
+    return result;
+}
+
+template <typename Call>
+double nanosecondsPerCall(Call&& call, double seconds) {
+    using Clock = std::chrono::steady_clock;
+    auto deadline = Clock::now() + std::chrono::duration<double>(seconds);
+    auto start = Clock::now();
+    std::size_t count = 0;
+    std::size_t checksum = 0;
+    while (Clock::now() < deadline) {
+        for (int i = 0; i < 256; ++i) {
+            checksum += call();
+        }
+        count += 256;
+    }
+    double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    return checksum ? elapsed / count : 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    double seconds = argc > 1 ? std::atof(argv[1]) : 1.0;
+    const std::string path = "/sapi/v1/sub-account/{email}/futures/{type}/positionRisk";
+    const json pathParams = {{"email", "trader@example.com"}, {"type", "usdt"}};
+    const json query = {{"symbol", "BTCUSDT"}, {"side", "BUY"}, {"type", "LIMIT"}, {"timeInForce", "GTC"},
+                        {"quantity", "0.00125"}, {"price", "43250.10"}, {"newClientOrderId", "x-R4BD3S82/7f3a"},
+                        {"timestamp", "1700000000123"}};
+    ccxt::UrlTemplate compiled(path);
+    std::string buffer;
+
+    std::printf("%-26s %10s %10s\n", "call", "before ns", "after ns");
+    std::printf("%-26s %10.0f %10.0f\n", "implodeParams (2 slots)",
+                nanosecondsPerCall([&] { return regexImplodeParams(path, pathParams).size(); }, seconds),
+                nanosecondsPerCall([&] {
+                    buffer.clear();
+                    compiled.render(pathParams, buffer, false);
+                    return buffer.size();
+                }, seconds));
+    std::printf("%-26s %10.0f %10.0f\n", "extractParams",
+                nanosecondsPerCall([&] { return regexExtractParams(path).size(); }, seconds),
+                nanosecondsPerCall([&] { return std::vector<std::string>(compiled.params()).size(); }, seconds));
+    std::printf("%-26s %10.0f %10.0f\n", "encode",
+                nanosecondsPerCall([&] { return streamEncode("x-R4BD3S82/7f3a+order id").size(); }, seconds),
+                nanosecondsPerCall([&] { return ccxt::percentEncode("x-R4BD3S82/7f3a+order id").size(); }, seconds));
+    std::printf("%-26s %10.0f %10.0f\n", "urlencode (8 params)",
+                nanosecondsPerCall([&] { return streamUrlencode(query).size(); }, seconds),
+                nanosecondsPerCall([&] { return tableUrlencode(query).size(); }, seconds));
+    return 0;
+}
@@ -0,0 +1,139 @@
+// Messages per second per core of BinanceWS message handling on captured
+// combined-stream payloads, with the json DOM, the DOM in a per-connection
+// arena, and lazy parsing, plus global heap allocations per message once the
+// connection has warmed up. The "copied" columns repeat lazy parsing with each
+// message first copied out of the read buffer, as onRead used to.
+//
+//   ccxt_ws_parse_bench [seconds per case]
+
+#include <ccxt/exchanges/ws/binance_ws.h>
+#include <boost/asio/ssl/context.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace {
+std::size_t globalAllocations = 0;
+} // namespace
+
+void* operator new(std::size_t size) {
+    ++globalAllocations;
+    if (void* pointer = std::malloc(size ? size : 1)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+namespace {
+
+class BenchBinanceWS : public ccxt::BinanceWS {
+public:
+    using ccxt::BinanceWS::BinanceWS;
+    using ccxt::BinanceWS::dispatch;
+};
+
+enum class Mode { Dom, Arena, Lazy };
+
+void select(BenchBinanceWS& ws, Mode mode) {
+    ws.setLazyParsing(mode == Mode::Lazy);
+    ws.setJsonArena(mode == Mode::Arena);
+}
+
+struct Payload {
+    const char* name;
+    std::string message;
+};
+
+std::string depthSnapshot(int levels) {
+    std::string bids;
+    std::string asks;
+    for (int i = 0; i < levels; ++i) {
+        char level[64];
+        std::snprintf(level, sizeof(level), "%s[\"%.2f\",\"%.8f\"]", i ? "," : "", 43250.10 - i * 0.01, 0.0125 + i * 0.001);
+        bids += level;
+        std::snprintf(level, sizeof(level), "%s[\"%.2f\",\"%.8f\"]", i ? "," : "", 43250.11 + i * 0.01, 0.0310 + i * 0.002);
+        asks += level;
+    }
+    return R"({"stream":"btcusdt@depth","data":{"e":"depthUpdate","E":1700000000123,"s":"BTCUSDT","U":40168412837,"u":40168412998,"b":[)" +
+           bids + R"(],"a":[)" + asks + "]}}";
+}
+
+std::vector<Payload> payloads() {
+    return {
+        {"ticker", R"({"stream":"btcusdt@ticker","data":{"e":"24hrTicker","E":1700000000123,"s":"BTCUSDT","p":"-152.31000000","P":"-0.351","w":"43312.84315120","x":"43402.41000000","c":"43250.10000000","Q":"0.00125000","b":"43250.10000000","B":"4.21805000","a":"43250.11000000","A":"2.01336000","o":"43402.41000000","h":"43849.00000000","l":"42766.00000000","v":"28473.48117000","q":"1233288014.98345250","O":1699913600123,"C":1700000000123,"F":3291441020,"L":3292491112,"n":1050093}})"},
+        {"trade", R"({"stream":"btcusdt@trade","data":{"e":"trade","E":1700000000123,"s":"BTCUSDT","t":3292491112,"p":"43250.11000000","q":"0.00125000","b":22145566187,"a":22145566210,"T":1700000000122,"m":true,"M":true}})"},
+        {"kline", R"({"stream":"btcusdt@kline_1m","data":{"e":"kline","E":1700000000123,"s":"BTCUSDT","k":{"t":1699999980000,"T":1700000039999,"s":"BTCUSDT","i":"1m","f":3292490010,"L":3292491112,"o":"43241.02000000","c":"43250.10000000","h":"43262.00000000","l":"43238.51000000","v":"12.80341000","n":1103,"x":false,"q":"553731.41622970","V":"6.17620000","Q":"267110.11287760","B":"0"}}})"},
+        {"depth20", depthSnapshot(20)},
+        {"depth1000", depthSnapshot(1000)},
+    };
+}
+
+void receive(BenchBinanceWS& ws, const std::string& message, bool copy) {
+    if (copy) {
+        ws.dispatch(std::string(message.data(), message.size()));
+    } else {
+        ws.dispatch(message);
+    }
+}
+
+double messagesPerSecond(BenchBinanceWS& ws, const std::string& message, double seconds, bool copy = false) {
+    using Clock = std::chrono::steady_clock;
+    auto deadline = Clock::now() + std::chrono::duration<double>(seconds);
+    auto start = Clock::now();
+    std::size_t count = 0;
+    while (Clock::now() < deadline) {
+        for (int i = 0; i < 64; ++i) {
+            receive(ws, message, copy);
+        }
+        count += 64;
+    }
+    return count / std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// After a warm-up message; counts parsing and the handlers' unified structs alike
+double allocationsPerMessage(BenchBinanceWS& ws, const std::string& message, bool copy = false) {
+    receive(ws, message, copy);
+    std::size_t before = globalAllocations;
+    for (int i = 0; i < 100; ++i) {
+        receive(ws, message, copy);
+    }
+    return (globalAllocations - before) / 100.0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    double seconds = argc > 1 ? std::atof(argv[1]) : 1.0;
+    boost::asio::io_context context;
+    boost::asio::ssl::context ssl(boost::asio::ssl::context::tlsv12_client);
+    ccxt::Binance exchange(context);
+    BenchBinanceWS ws(context, ssl, exchange);
+
+    std::printf("%-10s %12s %12s %12s %12s %10s %10s %10s %10s\n", "payload", "dom msg/s", "arena msg/s",
+                "lazy msg/s", "copied msg/s", "dom alloc", "arena alloc", "lazy alloc", "copied alloc");
+    for (const auto& payload : payloads()) {
+        double rate[4];
+        double allocations[4];
+        for (Mode mode : {Mode::Dom, Mode::Arena, Mode::Lazy}) {
+            select(ws, mode);
+            rate[int(mode)] = messagesPerSecond(ws, payload.message, seconds);
+            allocations[int(mode)] = allocationsPerMessage(ws, payload.message);
+        }
+        rate[3] = messagesPerSecond(ws, payload.message, seconds, true);
+        allocations[3] = allocationsPerMessage(ws, payload.message, true);
+        std::printf("%-10s %12.0f %12.0f %12.0f %12.0f %10.1f %10.1f %10.1f %10.1f\n", payload.name, rate[0], rate[1],
+                    rate[2], rate[3], allocations[0], allocations[1], allocations[2], allocations[3]);
+    }
+    return 0;
+}
@@ -2,9 +2,10 @@
 
 #include <string>
 #include <map>
+#include <memory>
 #include <nlohmann/json.hpp>
-#include <fstream>
 #include <boost/coroutine2/coroutine.hpp>
+#include "ccxt/base/descriptor.h"
 using json = nlohmann::json;
 using AsyncPullType = boost::coroutines2::coroutine<json>::pull_type;
 namespace ccxt {
@@ -16,20 +17,25 @@ struct Config {
     std::string hostname;
     int rateLimit;  // default 50
     bool pro;       // default false    
+    // Per-host limit of the process-wide HTTP pool, not of this instance: the
+    // pool keeps the largest limit any instance asked for. 0 keeps the default
+    int maxConnectionsPerHost = 0;
+    int executorThreads = 0;        // shared async executor workers, 0 keeps the default
+    int executorQueueCapacity = 0;  // shared async executor queue bound, 0 keeps the default
+    // Descriptors come from the process-wide cache, so every instance of an
+    // exchange shares one immutable, lazily parsed copy
     void loadRest(const std::string& filename)
     {
-        std::ifstream file(filename);
-        json_rest = json::parse(file);
+        json_rest = Descriptor::load(filename);
     }
 
     void loadWs(const std::string& filename)
     {
-        std::ifstream file(filename);
-        json_ws = json::parse(file);
+        json_ws = Descriptor::load(filename);
     }
     
-    json json_rest;
-    json json_ws;
+    std::shared_ptr<const Descriptor> json_rest;
+    std::shared_ptr<const Descriptor> json_ws;
     Config() = default;
 };
 
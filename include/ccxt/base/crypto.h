@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+typedef struct evp_mac_ctx_st EVP_MAC_CTX;
+
+namespace ccxt {
+
+// Table-driven encoders for request signing. The pointer forms write into a
+// caller buffer and return the end of the output, so a signature can be
+// rendered without allocating.
+char* hexEncode(const unsigned char* data, std::size_t size, char* out);
+std::string hexEncode(std::string_view bytes);
+// Accepts either case and an optional 0x prefix; throws std::invalid_argument
+std::string hexDecode(std::string_view text);
+
+constexpr std::size_t base64EncodedSize(std::size_t size, bool padding = true) {
+    return padding ? (size + 2) / 3 * 4 : (size * 4 + 2) / 3;
+}
+// Standard alphabet with '=' padding, or the URL-safe alphabet ('-', '_')
+// without padding as JWTs use it
+char* base64Encode(const unsigned char* data, std::size_t size, char* out);
+char* base64UrlEncode(const unsigned char* data, std::size_t size, char* out);
+std::string base64Encode(std::string_view bytes);
+std::string base64UrlEncode(std::string_view bytes);
+// Accepts both alphabets, with or without padding; throws std::invalid_argument
+std::string base64Decode(std::string_view text);
+
+enum class HashAlgorithm { Sha1, Sha256, Sha384, Sha512, Md5 };
+
+// Throws NotSupported for names other than sha1, sha256, sha384, sha512 and md5
+HashAlgorithm hashAlgorithm(std::string_view name);
+
+// Ethereum's Keccak-256: the original Keccak padding, not the SHA3-256 one
+std::array<unsigned char, 32> keccak256(std::string_view data);
+
+// HMAC context keyed once with a secret. Every signature works on a copy of
+// the keyed context, so the digest lookup and key schedule are paid once per
+// secret instead of once per request, and one key can sign from any thread.
+class HmacKey {
+public:
+    static constexpr std::size_t maxDigestSize = 64;
+
+    HmacKey(HashAlgorithm algorithm, std::string_view secret);
+    ~HmacKey();
+    HmacKey(const HmacKey&) = delete;
+    HmacKey& operator=(const HmacKey&) = delete;
+
+    HashAlgorithm algorithm() const noexcept { return algorithm_; }
+    std::size_t digestSize() const noexcept { return digestSize_; }
+
+    // Raw digest into out, which must hold maxDigestSize bytes; returns its size
+    std::size_t sign(std::string_view message, unsigned char* out) const;
+    std::string hex(std::string_view message) const;
+    std::string base64(std::string_view message) const;
+
+private:
+    HashAlgorithm algorithm_;
+    std::size_t digestSize_ = 0;
+    EVP_MAC_CTX* context_ = nullptr;
+};
+
+} // namespace ccxt
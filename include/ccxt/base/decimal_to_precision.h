@@ -0,0 +1,41 @@
+#pragma once
+
+#include <string>
+#include "ccxt/base/precise.h"
+
+namespace ccxt {
+
+// Rounding kernels behind the *ToPrecision methods, following ccxt's
+// decimalToPrecision: the same rounding, counting and padding modes, computed
+// exactly on Precise's scaled integers and written into a caller buffer.
+
+// Values are ccxt's constants, as the descriptors' precisionMode and
+// paddingMode carry them
+enum class RoundingMode { Truncate = 0, Round = 1 };
+enum class CountingMode { DecimalPlaces = 2, SignificantDigits = 3, TickSize = 4 };
+enum class PaddingMode { NoPadding = 5, PadWithZero = 6 };
+
+struct PrecisionRule {
+    CountingMode counting = CountingMode::DecimalPlaces;
+    int digits = 8;         // decimal places or significant digits
+    Precise tick;           // step for CountingMode::TickSize
+    PaddingMode padding = PaddingMode::NoPadding;
+
+    static PrecisionRule decimalPlaces(int digits, PaddingMode padding = PaddingMode::NoPadding);
+    static PrecisionRule significantDigits(int digits, PaddingMode padding = PaddingMode::NoPadding);
+    static PrecisionRule tickSize(const Precise& tick, PaddingMode padding = PaddingMode::NoPadding);
+};
+
+// Rounded value, exact
+Precise decimalToPrecision(const Precise& value, RoundingMode rounding, const PrecisionRule& rule);
+
+// Formats the rounded value into [first, last) without allocating and returns
+// the end of the text, nullptr when the buffer is too small (64 bytes fit any
+// double with up to 20 decimals). Doubles go through their shortest
+// round-trip representation, so 0.1 is rounded as 0.1 and not 0.1000000000000000055.
+char* decimalToPrecision(char* first, char* last, const Precise& value, RoundingMode rounding, const PrecisionRule& rule);
+char* decimalToPrecision(char* first, char* last, double value, RoundingMode rounding, const PrecisionRule& rule);
+
+std::string decimalToPrecision(double value, RoundingMode rounding, const PrecisionRule& rule);
+
+} // namespace ccxt
@@ -0,0 +1,48 @@
+#ifndef CCXT_DESCRIPTOR_H
+#define CCXT_DESCRIPTOR_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace ccxt {
+
+// Immutable exchange descriptor (config/<exchange>_rest.json, _ws.json) shared
+// by every instance in the process. The file is read once and only its list of
+// top-level keys is scanned up front; each section ("has", "api", "fees", ...)
+// is parsed the first time it is asked for and then kept for the process.
+class Descriptor {
+public:
+    // Loads filename through the process-wide cache. Relative names that do not
+    // exist from the working directory are looked up in $CCXT_CONFIG_DIR and in
+    // the config directory the library was built with.
+    static std::shared_ptr<const Descriptor> load(const std::string& filename);
+    static std::string resolve(const std::string& filename);
+
+    explicit Descriptor(std::string source, std::string path = "");
+
+    Descriptor(const Descriptor&) = delete;
+    Descriptor& operator=(const Descriptor&) = delete;
+
+    bool contains(const std::string& section) const;
+    // Returns the section, or a null json when the descriptor has no such key
+    const nlohmann::json& operator[](const std::string& section) const;
+    const std::vector<std::string>& sections() const { return keys_; }
+    const std::string& path() const { return path_; }
+    // Number of sections materialized so far
+    std::size_t loadedSections() const;
+
+private:
+    std::string source_;
+    std::string path_;
+    std::vector<std::string> keys_;
+    mutable std::mutex mutex_;
+    mutable std::map<std::string, std::unique_ptr<nlohmann::json>> sections_;
+};
+
+} // namespace ccxt
+
+#endif // CCXT_DESCRIPTOR_H
@@ -0,0 +1,76 @@
+#ifndef CCXT_DESCRIPTOR_TABLES_H
+#define CCXT_DESCRIPTOR_TABLES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include "ccxt/base/decimal_to_precision.h"
+#include "ccxt/generated/capabilities.h"
+
+namespace ccxt {
+
+// Compile-time view of config/<exchange>_rest.json and _ws.json. The data is
+// generated at build time by tools/descriptor_gen.cpp, so looking up
+// capabilities, endpoint weights or timeframes needs neither file I/O nor a
+// particular working directory.
+
+struct CapabilitySet {
+    static constexpr std::size_t Words = (static_cast<std::size_t>(Capability::Count) + 63) / 64;
+    std::uint64_t bits[Words];
+
+    constexpr bool test(Capability capability) const {
+        auto index = static_cast<std::size_t>(capability);
+        return (bits[index / 64] >> (index % 64)) & 1u;
+    }
+};
+
+struct LimitCost {
+    double limit;
+    double cost;
+};
+
+struct EndpointEntry {
+    std::string_view api;       // dotted section path, e.g. "public" or "v1.private"
+    std::string_view method;    // lowercase verb
+    std::string_view path;
+    double cost;
+    std::string_view altParam;  // cost becomes altCost when this param is absent (noSymbol, noCoin, ...)
+    double altCost;
+    std::size_t byLimitOffset;  // tiers in ExchangeTable::limits, ordered by limit
+    std::size_t byLimitCount;
+};
+
+struct TimeframeEntry {
+    std::string_view unified;
+    std::string_view exchange;
+};
+
+struct ExchangeTable {
+    std::string_view id;
+    double rateLimit;
+    bool enableRateLimit;
+    CountingMode precisionMode;   // how market precision values are read
+    PaddingMode paddingMode;
+    CapabilitySet declared;   // listed in "has"
+    CapabilitySet has;        // true or "emulated"
+    CapabilitySet emulated;
+    CapabilitySet unknown;    // listed as null
+    CapabilitySet wsHas;      // true or "emulated" in the _ws.json descriptor
+    const EndpointEntry* endpoints;  // sorted by (api, method, path)
+    std::size_t endpointCount;
+    const LimitCost* limits;
+    const TimeframeEntry* timeframes;
+    std::size_t timeframeCount;
+
+    constexpr bool supports(Capability capability) const { return has.test(capability); }
+
+    const EndpointEntry* findEndpoint(std::string_view api, std::string_view method, std::string_view path) const;
+};
+
+// Table for an exchange id ("binance"), nullptr when there is no descriptor
+const ExchangeTable* exchangeTable(std::string_view id);
+std::size_t exchangeTableCount();
+
+} // namespace ccxt
+
+#endif // CCXT_DESCRIPTOR_TABLES_H
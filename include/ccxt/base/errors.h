@@ -40,6 +40,11 @@ public:
     explicit BadRequest(const std::string& message) : ExchangeError(message) {}
 };
 
+class BadSymbol : public BadRequest {
+public:
+    explicit BadSymbol(const std::string& message) : BadRequest(message) {}
+};
+
 class BadResponse : public ExchangeError {
 public:
     explicit BadResponse(const std::string& message) : ExchangeError(message) {}
@@ -2,14 +2,34 @@
 
 #include <string>
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <optional>
 #include <future>
+#include <functional>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <chrono>
 #include <nlohmann/json.hpp>
-#include <boost/coroutine2/coroutine.hpp>
+#include <boost/asio.hpp>
 #include "ccxt/base/exchange_base.h"
+#include "ccxt/base/rate_limiter.h"
+#include "ccxt/base/descriptor_tables.h"
+#include "ccxt/base/market_registry.h"
+#include "ccxt/base/json_arena.h"
+#include "ccxt/base/signer.h"
+#include "ccxt/base/url_template.h"
 
 namespace ccxt {
+struct HttpResponse;
+
+// Completion callback of the asynchronous REST API. Exactly one of the
+// arguments is meaningful: a non-null exception_ptr carries the error,
+// otherwise the json holds the parsed response.
+using FetchHandler = std::function<void(std::exception_ptr, json)>;
+
 class Exchange : public ExchangeBase {
 public:
     Exchange(boost::asio::io_context& context, const Config& config = Config());
@@ -18,25 +38,57 @@ public:
     // Common methods
     virtual void init();
     virtual void describe() const;
-    virtual AsyncPullType performHttpRequest(const std::string& host, const std::string& target, const std::string& method);
     // Usually methods
     virtual std::string implodeParams(const std::string& path, const json& params);
     virtual json omit(const json& params, const std::vector<std::string>& keys);
     virtual std::vector<std::string> extractParams(const std::string& path);
     virtual std::string urlencode(const json& params);
     virtual std::string encode(const std::string& string);
+    // digest is "hex", "base64" or "binary"
     virtual std::string hmac(const std::string& message, const std::string& secret,
                      const std::string& algorithm, const std::string& digest);
+    // Rounded with the market's precision as ccxt does: prices and fees round,
+    // amounts and costs truncate. Unknown symbols throw BadSymbol.
     virtual std::string costToPrecision(const std::string& symbol, double cost);
     virtual std::string priceToPrecision(const std::string& symbol, double price);
     virtual std::string amountToPrecision(const std::string& symbol, double amount);
     virtual std::string currencyToPrecision(const std::string& currency, double fee);
     virtual std::string feeToPrecision(const std::string& symbol, double fee);
+    // Allocation-free variants for order entry: write into [first, last) and
+    // return the end of the text, nullptr when the buffer is too small
+    char* priceToPrecision(std::string_view symbol, double price, char* first, char* last) const;
+    char* amountToPrecision(std::string_view symbol, double amount, char* first, char* last) const;
     virtual long long parse8601(const std::string& datetime);
     virtual long long milliseconds() const;
     virtual std::string uuid();
     virtual std::string iso8601(long long timestamp) const;
+    // Throws BadSymbol when the symbol is not listed. Markets are published as
+    // immutable snapshots that a reload replaces, so the market is a copy;
+    // marketBySymbol() reads it in place.
     virtual Market market(const std::string& symbol);
+    // Market of a unified symbol without copying it; the pointer keeps its
+    // snapshot alive. Unknown symbols return nullptr.
+    std::shared_ptr<const Market> marketBySymbol(std::string_view symbol) const noexcept;
+    // Allocation-free lookup of an exchange market id through the perfect-hash
+    // index; the pointer keeps its snapshot alive. Unknown ids return nullptr
+    // and count in marketRegistry()->misses().
+    std::shared_ptr<const Market> marketById(std::string_view marketId) const noexcept;
+    // Snapshot published by the last loadMarkets(), never null
+    std::shared_ptr<const MarketRegistry> marketRegistry() const;
+    // Called after a loadMarkets() that added, removed or modified markets, with
+    // only those markets; returns an id for removeMarketsListener()
+    using MarketsListener = std::function<void(const MarketChanges&)>;
+    std::size_t onMarketsChanged(MarketsListener listener);
+    void removeMarketsListener(std::size_t id);
+    // Capability check against the generated descriptor table, false when there is none
+    bool supports(Capability capability) const { return table_ && table_->supports(capability); }
+    const ExchangeTable* table() const { return table_; }
+    // Weight of an endpoint from the descriptor "api" section, e.g. endpointCost("public", "GET", "depth", {{"limit", 500}});
+    // nested api sections are separated by dots ("v1.public")
+    virtual double endpointCost(const std::string& api, const std::string& method,
+                                const std::string& path, const json& params = json::object()) const;
+    // Token bucket throttling this exchange, shared with instances that use the same API key
+    RateLimiter& rateLimiter();
     virtual std::string marketId(const std::string& symbol);
 
     // Synchronous REST API methods
@@ -58,35 +110,168 @@ public:
     virtual void loadMarkets(bool reload = false);
     std::string symbol(const std::string& marketId);
 
+    // Typed market data: the raw response body is decoded straight into the
+    // caller's structs, with no json DOM and no unified json result in between.
+    // Passing the same structs again reuses their storage. Exchanges without a
+    // typed path throw NotSupported.
+    virtual void fetchTickerTyped(const std::string& symbol, Ticker& ticker);
+    virtual void fetchOrderBookTyped(const std::string& symbol, OrderBook& orderBook, int limit = 0);
+    virtual void fetchTradesTyped(const std::string& symbol, std::vector<Trade>& trades, int since = 0, int limit = 0);
+    // The decoders behind them, also usable on bodies received elsewhere
+    virtual void parseTickerInto(std::string_view body, const Market& market, Ticker& ticker) const;
+    virtual void parseOrderBookInto(std::string_view body, const Market& market, OrderBook& orderBook) const;
+    virtual void parseTradesInto(std::string_view body, const Market& market, std::vector<Trade>& trades) const;
+
     // Asynchronous REST API methods
-    virtual AsyncPullType fetchMarketsAsync(const json& params = json::object());
-    virtual AsyncPullType fetchTickerAsync(const std::string& symbol, const json& params = json::object());
-    virtual AsyncPullType fetchTickersAsync(const std::vector<std::string>& symbols = {}, const json& params = json::object());
-    virtual AsyncPullType fetchOrderBookAsync(const std::string& symbol, int limit = 0, const json& params = json::object());
-    virtual AsyncPullType fetchTradesAsync(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object());
-    virtual AsyncPullType fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe = "1m",
-                                           int since = 0, int limit = 0, const json& params = json::object());
-    virtual AsyncPullType fetchBalanceAsync(const json& params = json::object());
-    virtual AsyncPullType createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
-                                           double amount, double price = 0, const json& params = json::object());
-    virtual AsyncPullType cancelOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
-    virtual AsyncPullType fetchOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
-    virtual AsyncPullType fetchOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
-    virtual AsyncPullType fetchOpenOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
-    virtual AsyncPullType fetchClosedOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    // Handlers are invoked on the Exchange's io_context, which is kept busy
+    // while requests are in flight so that context.run() drives them to completion.
+    // Methods with a request builder (fetchTickerRequest, ...) go out through
+    // fetchAsyncImpl and never block the io_context; the others run their
+    // synchronous method on the shared Executor. The exchange must outlive the
+    // requests it has in flight.
+    virtual void fetchMarketsAsync(const json& params, FetchHandler handler);
+    virtual void fetchTickerAsync(const std::string& symbol, const json& params, FetchHandler handler);
+    virtual void fetchTickersAsync(const std::vector<std::string>& symbols, const json& params, FetchHandler handler);
+    virtual void fetchOrderBookAsync(const std::string& symbol, int limit, const json& params, FetchHandler handler);
+    virtual void fetchTradesAsync(const std::string& symbol, int since, int limit, const json& params, FetchHandler handler);
+    virtual void fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe,
+                                 int since, int limit, const json& params, FetchHandler handler);
+    virtual void fetchBalanceAsync(const json& params, FetchHandler handler);
+    virtual void createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
+                                  double amount, double price, const json& params, FetchHandler handler);
+    virtual void cancelOrderAsync(const std::string& id, const std::string& symbol, const json& params, FetchHandler handler);
+    virtual void fetchOrderAsync(const std::string& id, const std::string& symbol, const json& params, FetchHandler handler);
+    virtual void fetchOrdersAsync(const std::string& symbol, int since, int limit, const json& params, FetchHandler handler);
+    virtual void fetchOpenOrdersAsync(const std::string& symbol, int since, int limit, const json& params, FetchHandler handler);
+    virtual void fetchClosedOrdersAsync(const std::string& symbol, int since, int limit, const json& params, FetchHandler handler);
 
 protected:
     // Synchronous HTTP methods
     virtual json fetch(const std::string& url,
                       const std::string& method = "GET",
                       const std::map<std::string, std::string>& headers = {},
-                      const std::string& body = "");
+                      const std::string& body = "",
+                      double cost = 1.0);
 
     // Asynchronous HTTP methods
-    virtual AsyncPullType fetchAsync(const std::string& url,
-                                     const std::string& method = "GET",
-                                     const std::map<std::string, std::string>& headers = {},
-                                     const std::string& body = "");
+    // Accepts any asio completion token (callback, use_future, yield_context,
+    // use_awaitable) with the signature void(std::exception_ptr, json). The
+    // request runs on the shared HTTP pool and never blocks the io_context.
+    // cost is the endpoint weight charged against the rate limiter.
+    template <typename CompletionToken>
+    auto fetchAsync(const std::string& url, const std::string& method,
+                    const std::map<std::string, std::string>& headers,
+                    const std::string& body, CompletionToken&& token) {
+        return fetchAsync(url, method, headers, body, 1.0, std::forward<CompletionToken>(token));
+    }
+
+    template <typename CompletionToken>
+    auto fetchAsync(const std::string& url, const std::string& method,
+                    const std::map<std::string, std::string>& headers,
+                    const std::string& body, double cost, CompletionToken&& token) {
+        return boost::asio::async_initiate<CompletionToken, void(std::exception_ptr, json)>(
+            [this, url, method, headers, body, cost](auto handler) {
+                auto executor = boost::asio::get_associated_executor(handler, context_.get_executor());
+                auto owner = std::make_shared<decltype(handler)>(std::move(handler));
+                fetchAsyncImpl(url, method, headers, body, cost,
+                    [executor, owner](std::exception_ptr error, json result) {
+                        boost::asio::dispatch(executor, [owner, error, result = std::move(result)]() mutable {
+                            (*owner)(error, std::move(result));
+                        });
+                    });
+            }, token);
+    }
+
+    virtual void fetchAsyncImpl(const std::string& url, const std::string& method,
+                                const std::map<std::string, std::string>& headers,
+                                const std::string& body, double cost, FetchHandler handler);
+    // Sends the request on the shared pool once the rate limiter lets it go
+    void sendAsync(const std::string& url, const std::string& method,
+                   const std::map<std::string, std::string>& headers,
+                   const std::string& body, FetchHandler handler);
+
+    // Same as fetch() but returns the body unparsed, for the typed decoders
+    std::string fetchBody(const std::string& url,
+                          const std::string& method = "GET",
+                          const std::map<std::string, std::string>& headers = {},
+                          const std::string& body = "",
+                          double cost = 1.0);
+
+    // Same as fetch() with the response DOM built in arena and handed to
+    // consume(const ArenaJson&); the arena is rewound once consume returns, so
+    // nothing may keep references into the DOM
+    template <typename Consumer>
+    void fetchArena(JsonArena& arena, Consumer&& consume, const std::string& url,
+                    const std::string& method = "GET",
+                    const std::map<std::string, std::string>& headers = {},
+                    const std::string& body = "",
+                    double cost = 1.0) {
+        std::string text = fetchBody(url, method, headers, body, cost);
+        JsonArena::Scope scope(arena);
+        consume(parseArenaJson(text));
+    }
+
+    // Maps a transport response onto the parsed body or the matching ccxt error
+    json handleResponse(const std::string& method, const std::string& url, const HttpResponse& response);
+    // Throws the ccxt error matching a failed response
+    void checkResponse(const std::string& method, const std::string& url, const HttpResponse& response);
+    // Feeds rate-limit response headers into the limiter; the base class honours
+    // Retry-After, exchanges override it for their used-weight headers
+    virtual void updateRateLimits(const HttpResponse& response);
+
+    // One call of the asynchronous REST API, laid out up front so it can be
+    // sent without blocking: parse turns the response into the unified result
+    // on the io_context, an empty one passes the response through
+    struct AsyncRequest {
+        std::string url;
+        std::string method = "GET";
+        std::map<std::string, std::string> headers;
+        std::string body;
+        double cost = 1.0;
+        std::function<json(const json&)> parse;
+    };
+    // Request builders of the public *Async methods; std::nullopt, the default,
+    // falls back to the synchronous method on the Executor
+    virtual std::optional<AsyncRequest> fetchMarketsRequest(const json& params);
+    virtual std::optional<AsyncRequest> fetchTickerRequest(const std::string& symbol, const json& params);
+    virtual std::optional<AsyncRequest> fetchTickersRequest(const std::vector<std::string>& symbols, const json& params);
+    virtual std::optional<AsyncRequest> fetchOrderBookRequest(const std::string& symbol, int limit, const json& params);
+    virtual std::optional<AsyncRequest> fetchTradesRequest(const std::string& symbol, int since, int limit, const json& params);
+    virtual std::optional<AsyncRequest> fetchOHLCVRequest(const std::string& symbol, const std::string& timeframe,
+                                                          int since, int limit, const json& params);
+    virtual std::optional<AsyncRequest> fetchBalanceRequest(const json& params);
+    virtual std::optional<AsyncRequest> createOrderRequest(const std::string& symbol, const std::string& type,
+                                                           const std::string& side, double amount, double price,
+                                                           const json& params);
+    virtual std::optional<AsyncRequest> cancelOrderRequest(const std::string& id, const std::string& symbol, const json& params);
+    virtual std::optional<AsyncRequest> fetchOrderRequest(const std::string& id, const std::string& symbol, const json& params);
+    virtual std::optional<AsyncRequest> fetchOrdersRequest(const std::string& symbol, int since, int limit, const json& params);
+    virtual std::optional<AsyncRequest> fetchOpenOrdersRequest(const std::string& symbol, int since, int limit, const json& params);
+    virtual std::optional<AsyncRequest> fetchClosedOrdersRequest(const std::string& symbol, int since, int limit, const json& params);
+    // Sends the request build() returns through fetchAsyncImpl, or runs call on
+    // the Executor when there is none, and hands the result or exception to
+    // handler on the io_context
+    void deliver(FetchHandler handler, const std::function<std::optional<AsyncRequest>()>& build,
+                 std::function<json()> call);
+
+    // Binds the generated descriptor table of exchangeId and fills id, rateLimit,
+    // has and timeframes from it
+    void useTable(std::string_view exchangeId);
+    // Formats value with the price or amount rule of symbol's market
+    char* formatToPrecision(std::string_view symbol, double value, RoundingMode rounding,
+                            bool amount, char* first, char* last) const;
+
+    // Path compiled into a UrlTemplate on first use and kept for the exchange's
+    // lifetime; implodeParams and extractParams go through it
+    const UrlTemplate& urlTemplate(const std::string& path) const;
+    // HMAC context keyed with secret, created on first use and kept for the
+    // exchange's lifetime
+    const HmacKey& hmacKey(HashAlgorithm algorithm, const std::string& secret) const;
+    // Signer for the configured secret, made by createSigner() on first use and
+    // again whenever the secret changes
+    const Signer& signer() const;
+    // HMAC-SHA256 with a hex signature unless the exchange signs differently
+    virtual std::unique_ptr<Signer> createSigner(const std::string& secret) const;
 
     // Utility methods
     virtual std::string sign(const std::string& path, const std::string& api = "public",
@@ -183,6 +368,26 @@ protected:
                           const std::string& method = "GET", const json& params = json::object(),
                           const std::map<std::string, std::string>& headers = {},
                           const json& body = nullptr) const = 0;
+
+private:
+    std::once_flag rateLimiterOnce_;
+    std::shared_ptr<RateLimiter> rateLimiter_;
+    bool enableRateLimit_ = true;
+    const ExchangeTable* table_ = nullptr;
+    // RCU-style market snapshots: readers take their own reference with
+    // std::atomic_load and never lock, reloads publish a new registry with
+    // std::atomic_store under marketsMutex_. A snapshot lives until its last
+    // reader lets go of it.
+    mutable std::mutex marketsMutex_;
+    std::shared_ptr<const MarketRegistry> markets_;
+    std::mutex listenersMutex_;
+    std::map<std::size_t, MarketsListener> marketsListeners_;
+    std::size_t nextListenerId_ = 0;
+    mutable std::mutex keysMutex_;
+    mutable std::map<std::pair<HashAlgorithm, std::string>, std::unique_ptr<const HmacKey>> hmacKeys_;
+    mutable std::map<std::string, std::unique_ptr<const Signer>> signers_;
+    mutable std::mutex templatesMutex_;
+    mutable std::unordered_map<std::string, std::unique_ptr<const UrlTemplate>> urlTemplates_;
 };
 
 } // namespace ccxt
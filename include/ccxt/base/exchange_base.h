@@ -7,7 +7,6 @@
 #include <ccxt/base/types.h>
 #include <ccxt/base/config.h>
 #include <boost/asio.hpp>
-#include <curl/curl.h>
 
 namespace ccxt {
 class ExchangeBase {
@@ -40,8 +39,6 @@ public:
 protected:
     Config config_;
     boost::asio::io_context& context_;
-    CURL* curl_ = nullptr;
-    
 };
 
 } // namespace ccxt
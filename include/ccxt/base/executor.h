@@ -0,0 +1,124 @@
+#ifndef CCXT_EXECUTOR_H
+#define CCXT_EXECUTOR_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace ccxt {
+
+// Bounded work-stealing thread pool shared by the exchanges' future-returning
+// *Async wrappers. Each worker owns a deque and runs its own tasks LIFO, idle
+// workers steal from the front of their peers. At most queueCapacity tasks may
+// wait at once; further submitters block until a slot frees up, except when
+// they already run on a worker, in which case the task runs inline.
+// Unlike std::async, a future dropped without get() does not wait for its
+// task: whatever a task captures by reference or pointer, such as the
+// exchange behind an *Async wrapper's [this], must outlive the task.
+class Executor {
+public:
+    struct Options {
+        std::size_t threads = 0;           // 0 = std::thread::hardware_concurrency()
+        std::size_t queueCapacity = 1024;  // tasks waiting across all workers
+    };
+
+    struct Metrics {
+        std::size_t threads = 0;
+        std::size_t queueDepth = 0;
+        std::size_t maxQueueDepth = 0;
+        std::uint64_t submitted = 0;
+        std::uint64_t completed = 0;
+        std::uint64_t stolen = 0;
+        std::uint64_t inlined = 0;          // tasks run on the submitting worker because the queue was full
+        std::uint64_t rejected = 0;         // tryPost() calls refused because the queue was full
+        double avgQueueLatencyUs = 0.0;     // submit until a worker picks the task up
+        double maxQueueLatencyUs = 0.0;
+        double avgRunLatencyUs = 0.0;       // time spent executing the task
+    };
+
+    // Process-wide executor, created with the options last passed to configure()
+    static Executor& instance();
+    // Sets the options of the shared executor; returns false once it has started
+    static bool configure(const Options& options);
+
+    Executor();
+    explicit Executor(const Options& options);
+    ~Executor();
+
+    Executor(const Executor&) = delete;
+    Executor& operator=(const Executor&) = delete;
+
+    template <typename F>
+    auto submit(F&& f) -> std::future<std::invoke_result_t<std::decay_t<F>>> {
+        using Result = std::invoke_result_t<std::decay_t<F>>;
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(f));
+        auto future = task->get_future();
+        post([task]() { (*task)(); });
+        return future;
+    }
+
+    void post(std::function<void()> fn);
+    // Like post(), but for callers that must not block, such as an
+    // io_context thread: when the queue is full it returns false and leaves
+    // fn untouched instead of waiting for a slot
+    bool tryPost(std::function<void()>& fn);
+
+    std::size_t threadCount() const { return workers_.size(); }
+    std::size_t queueDepth() const { return pending_.load(); }
+    Metrics metrics() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Task {
+        std::function<void()> fn;
+        Clock::time_point enqueued;
+    };
+
+    struct Worker {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+        std::thread thread;
+    };
+
+    // Queues task, waiting for a slot when blocking and the queue is full;
+    // false when it neither queued nor ran the task
+    bool enqueue(Task& task, bool blocking);
+    void run(std::size_t index);
+    bool tryPop(std::size_t index, Task& task);
+    void execute(Task& task);
+    bool onWorkerThread(std::size_t* index = nullptr) const;
+
+    Options options_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+
+    std::mutex mutex_;
+    std::condition_variable workAvailable_;
+    std::condition_variable spaceAvailable_;
+    std::atomic<std::size_t> pending_{0};
+    std::atomic<std::size_t> nextWorker_{0};
+    bool stopping_ = false;
+
+    std::atomic<std::size_t> maxQueueDepth_{0};
+    std::atomic<std::uint64_t> submitted_{0};
+    std::atomic<std::uint64_t> completed_{0};
+    std::atomic<std::uint64_t> stolen_{0};
+    std::atomic<std::uint64_t> inlined_{0};
+    std::atomic<std::uint64_t> rejected_{0};
+    std::atomic<std::uint64_t> queueNanos_{0};
+    std::atomic<std::uint64_t> maxQueueNanos_{0};
+    std::atomic<std::uint64_t> runNanos_{0};
+};
+
+} // namespace ccxt
+
+#endif // CCXT_EXECUTOR_H
@@ -0,0 +1,92 @@
+#ifndef CCXT_HTTP_CLIENT_H
+#define CCXT_HTTP_CLIENT_H
+
+#include <string>
+#include <map>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <functional>
+#include <vector>
+#include <curl/curl.h>
+
+namespace ccxt {
+
+struct HttpRequest {
+    std::string method = "GET";
+    std::string url;
+    std::map<std::string, std::string> headers;
+    std::string body;
+    long timeoutMs = 30000;
+};
+
+struct HttpResponse {
+    long status = 0;
+    std::map<std::string, std::string> headers;  // names lowercased, final response only
+    std::string body;
+    std::string error;  // transport error, empty on success
+};
+
+// Process-wide HTTP transport built on a single curl multi handle.
+// Connections are cached per host and kept alive between requests, HTTP/2
+// streams are multiplexed over one connection where the server supports it,
+// and all Exchange instances share the same pool.
+class HttpClient {
+public:
+    using Callback = std::function<void(HttpResponse)>;
+
+    struct Options {
+        long maxConnectionsPerHost = 6;
+        long maxTotalConnections = 0;  // 0 = unlimited
+        bool http2 = true;
+    };
+
+    static HttpClient& instance();
+
+    HttpClient();
+    explicit HttpClient(const Options& options);
+    ~HttpClient();
+
+    HttpClient(const HttpClient&) = delete;
+    HttpClient& operator=(const HttpClient&) = delete;
+
+    // Queues the request on the pool; callback runs on the transport thread.
+    void asyncPerform(HttpRequest request, Callback callback);
+    // Blocks the calling thread until the response is available.
+    HttpResponse perform(HttpRequest request);
+
+    void setMaxConnectionsPerHost(long maxConnections);
+    // Raises the per-host limit to maxConnections unless an earlier call asked
+    // for more. Every Exchange shares the pool, so each instance's
+    // Config::maxConnectionsPerHost goes through here and the largest wins.
+    void raiseMaxConnectionsPerHost(long maxConnections);
+    std::size_t inFlight() const { return inFlight_.load(); }
+
+private:
+    struct Transfer;
+
+    void run();
+    void start(Transfer* transfer);
+    void finish(CURL* easy, CURLcode result);
+    CURL* acquireHandle();
+    void releaseHandle(CURL* easy);
+    void wakeup();
+
+    Options options_;
+    CURLM* multi_ = nullptr;
+    std::thread worker_;
+    std::atomic<bool> stopping_{false};
+    std::atomic<std::size_t> inFlight_{0};
+
+    std::mutex mutex_;
+    std::deque<Transfer*> pending_;
+    long pendingMaxConnectionsPerHost_ = -1;
+    long raisedMaxConnectionsPerHost_ = 0;
+
+    std::vector<CURL*> idleHandles_;
+};
+
+} // namespace ccxt
+
+#endif // CCXT_HTTP_CLIENT_H
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+
+struct z_stream_s;
+
+namespace ccxt {
+
+// Compression of the payload of each received message, for exchanges that
+// compress frames themselves rather than through permessage-deflate
+enum class FrameCompression { None, Gzip, Deflate, Zlib };
+
+// Per-connection decompressor for self-contained compressed messages. The
+// z_stream is reset rather than rebuilt between messages and the output
+// buffer only ever grows, up to maxOutput, so a warmed-up inflater does not
+// allocate.
+class Inflater {
+public:
+    // Beyond any exchange message, but small enough that a compression bomb
+    // cannot exhaust memory
+    static constexpr std::size_t defaultMaxOutput = 64 * 1024 * 1024;
+
+    explicit Inflater(FrameCompression format, std::size_t maxOutput = defaultMaxOutput);
+    ~Inflater();
+    Inflater(const Inflater&) = delete;
+    Inflater& operator=(const Inflater&) = delete;
+
+    FrameCompression format() const noexcept { return format_; }
+    std::size_t maxOutput() const noexcept { return maxOutput_; }
+
+    // Inflates one message; the view points into the inflater and is valid
+    // until the next call. Throws BadResponse on corrupt or truncated input
+    // and on messages that inflate to more than maxOutput bytes.
+    // Raw deflate input may stop at a flush point instead of a final block.
+    std::string_view inflate(std::string_view input);
+
+private:
+    struct StreamDeleter {
+        void operator()(z_stream_s* stream) const noexcept;
+    };
+
+    FrameCompression format_;
+    std::size_t maxOutput_;
+    std::unique_ptr<z_stream_s, StreamDeleter> stream_;
+    std::string output_;
+};
+
+} // namespace ccxt
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace ccxt {
+
+// Monotonic arena for the json DOM of one message. Allocation bumps a pointer
+// in the current block and freeing is a no-op; reset() rewinds to the first
+// block and keeps every block, so once the arena has grown to the largest
+// message it serves the following ones without touching the global heap.
+class JsonArena {
+public:
+    explicit JsonArena(std::size_t blockSize = 64 * 1024);
+    JsonArena(const JsonArena&) = delete;
+    JsonArena& operator=(const JsonArena&) = delete;
+
+    void* allocate(std::size_t size, std::size_t alignment);
+    bool owns(const void* pointer) const noexcept;
+    void reset() noexcept;
+
+    // Bytes handed out since the last reset
+    std::size_t used() const noexcept { return used_; }
+    // Bytes held in blocks
+    std::size_t capacity() const noexcept;
+    // Blocks taken from the global heap over the arena's lifetime
+    std::uint64_t heapAllocations() const noexcept { return heapAllocations_; }
+
+    // Arena of the innermost Scope on this thread, nullptr outside of one
+    static JsonArena* current() noexcept;
+
+    // Makes arena the current one for this thread and rewinds it on exit. An
+    // ArenaJson built inside a scope must not be used or destroyed after it.
+    class Scope {
+    public:
+        explicit Scope(JsonArena& arena) noexcept;
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        JsonArena& arena_;
+        JsonArena* previous_;
+    };
+
+private:
+    struct Block {
+        std::unique_ptr<char[]> data;
+        std::size_t size;
+    };
+
+    std::size_t blockSize_;
+    std::vector<Block> blocks_;
+    std::size_t block_ = 0;   // index of the block being filled
+    std::size_t offset_ = 0;  // first free byte in it
+    std::size_t used_ = 0;
+    std::uint64_t heapAllocations_ = 0;
+};
+
+// Stateless allocator for nlohmann::basic_json: takes memory from the current
+// JsonArena and falls back to the global heap outside of a JsonArena::Scope.
+template <typename T>
+struct ArenaAllocator {
+    using value_type = T;
+
+    ArenaAllocator() noexcept = default;
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        if (JsonArena* arena = JsonArena::current()) {
+            return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+        }
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* pointer, std::size_t) noexcept {
+        JsonArena* arena = JsonArena::current();
+        if (arena && arena->owns(pointer)) {
+            return;
+        }
+        ::operator delete(pointer);
+    }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>&) const noexcept { return true; }
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>&) const noexcept { return false; }
+};
+
+using ArenaString = std::basic_string<char, std::char_traits<char>, ArenaAllocator<char>>;
+using ArenaJson = nlohmann::basic_json<std::map, std::vector, ArenaString, bool, std::int64_t,
+                                       std::uint64_t, double, ArenaAllocator>;
+
+// Builds the DOM of text with every node, string and container in the current
+// arena and returns its root, which stays valid until the scope ends. The
+// document is never destroyed, the arena simply forgets it: nlohmann's parser
+// and destructor both keep their work stacks in std::vectors, so this builds
+// the DOM itself to stay off the global heap. Throws BadResponse on malformed
+// text and std::logic_error outside of a JsonArena::Scope.
+const ArenaJson& parseArenaJson(std::string_view text);
+
+// Numeric field sent either as a json string or as a json number
+double jsonDouble(const ArenaJson& value);
+
+} // namespace ccxt
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace ccxt {
+
+// On-demand reader over the raw text of a JSON message. Nothing is parsed up
+// front: operator[] scans the enclosing object or array for the requested
+// member, skipping unrelated values without materializing them, and the
+// accessors decode scalars straight from the buffer. A view is only as
+// long-lived as the text it points into.
+//
+// Meant for hot WS paths that read a handful of fields per message; anything
+// that walks a whole document is better served by nlohmann::json.
+class JsonView {
+public:
+    JsonView() = default;
+    // text must hold one JSON value, surrounding whitespace is allowed
+    explicit JsonView(std::string_view text);
+
+    bool valid() const noexcept { return !raw_.empty(); }
+    explicit operator bool() const noexcept { return valid(); }
+
+    bool isObject() const noexcept { return valid() && raw_.front() == '{'; }
+    bool isArray() const noexcept { return valid() && raw_.front() == '['; }
+    bool isString() const noexcept { return valid() && raw_.front() == '"'; }
+    bool isNull() const noexcept { return raw_ == "null"; }
+    bool isBool() const noexcept { return raw_ == "true" || raw_ == "false"; }
+    bool isNumber() const noexcept;
+
+    // Member of an object or element of an array; an invalid view when the
+    // key or index is missing or this is not a container
+    JsonView operator[](std::string_view key) const;
+    JsonView operator[](std::size_t index) const;
+    bool contains(std::string_view key) const { return (*this)[key].valid(); }
+
+    // Raw JSON text of the value
+    std::string_view raw() const noexcept { return raw_; }
+    // Contents of a string without the quotes; escapes are left as they are
+    std::string_view stringView() const;
+    // Contents of a string with escapes decoded
+    std::string string() const;
+    // Numbers and numeric strings alike, as exchanges send both
+    double number() const;
+    std::int64_t integer() const;
+    bool boolean() const;
+
+    // Calls f(JsonView) for each element of an array
+    template <typename F>
+    void forEach(F&& f) const {
+        if (!isArray()) {
+            return;
+        }
+        const char* cursor = raw_.data() + 1;
+        const char* end = raw_.data() + raw_.size() - 1;
+        for (std::string_view value; next(cursor, end, nullptr, value);) {
+            f(JsonView(value, Trusted{}));
+        }
+    }
+
+    // Calls f(std::string_view key, JsonView value) for each member of an object
+    template <typename F>
+    void forEachMember(F&& f) const {
+        if (!isObject()) {
+            return;
+        }
+        const char* cursor = raw_.data() + 1;
+        const char* end = raw_.data() + raw_.size() - 1;
+        std::string_view key;
+        for (std::string_view value; next(cursor, end, &key, value);) {
+            f(key, JsonView(value, Trusted{}));
+        }
+    }
+
+private:
+    struct Trusted {};
+    JsonView(std::string_view raw, Trusted) noexcept : raw_(raw) {}
+
+    // Reads the next element (or key/value pair when key is set) between
+    // cursor and end, the container's closing bracket; false when exhausted
+    static bool next(const char*& cursor, const char* end, std::string_view* key, std::string_view& value);
+
+    std::string_view raw_;
+};
+
+} // namespace ccxt
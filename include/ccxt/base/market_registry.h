@@ -0,0 +1,104 @@
+#ifndef CCXT_MARKET_REGISTRY_H
+#define CCXT_MARKET_REGISTRY_H
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string_view>
+#include <vector>
+#include "ccxt/base/types.h"
+#include "ccxt/base/decimal_to_precision.h"
+
+namespace ccxt {
+
+// Rounding descriptors of a market, derived once when the registry is built
+struct MarketPrecision {
+    PrecisionRule price;
+    PrecisionRule amount;
+};
+
+// Immutable, contiguous table of the markets returned by loadMarkets(). Every
+// market gets a dense 32-bit handle (its index in the table) that doubles as
+// the interned id of both its unified symbol and its exchange market id.
+// Symbols go through an open-addressing hash index and exchange ids through a
+// perfect hash (hash-and-displace), both over string_views into the table, so
+// lookups neither allocate nor copy a Market. The id index resolves a market
+// id with one hash, one seed load and a single string compare, which is what
+// WS handlers need to demultiplex streams.
+class MarketRegistry {
+public:
+    using Handle = std::uint32_t;
+    static constexpr Handle npos = std::numeric_limits<Handle>::max();
+
+    MarketRegistry() = default;
+    // Symbols are unique; when several markets share an exchange id (spot and
+    // margin listings of the same pair) the first one wins the id lookup.
+    // Precision is read with the exchange's precisionMode and paddingMode;
+    // markets without one keep 8 decimal places.
+    explicit MarketRegistry(std::vector<Market> markets,
+                            CountingMode precisionMode = CountingMode::DecimalPlaces,
+                            PaddingMode paddingMode = PaddingMode::NoPadding);
+
+    MarketRegistry(const MarketRegistry&) = delete;
+    MarketRegistry& operator=(const MarketRegistry&) = delete;
+
+    Handle findSymbol(std::string_view symbol) const noexcept { return find(symbolIndex_, symbol, &Market::symbol); }
+    // Unknown ids are counted in misses() rather than reported as errors
+    Handle findId(std::string_view id) const noexcept;
+
+    const Market* bySymbol(std::string_view symbol) const noexcept;
+    const Market* byId(std::string_view id) const noexcept;
+
+    const Market& operator[](Handle handle) const { return markets_[handle]; }
+    const MarketPrecision& precision(Handle handle) const { return precisions_[handle]; }
+    std::size_t size() const noexcept { return markets_.size(); }
+    bool empty() const noexcept { return markets_.empty(); }
+    std::vector<Market>::const_iterator begin() const noexcept { return markets_.begin(); }
+    std::vector<Market>::const_iterator end() const noexcept { return markets_.end(); }
+    // Number of findId()/byId() calls with an id this snapshot does not list
+    std::uint64_t misses() const noexcept { return misses_.load(std::memory_order_relaxed); }
+
+private:
+    struct Slot {
+        std::uint32_t hash = 0;   // upper bits of the key hash, skips most string compares
+        Handle handle = npos;
+    };
+
+    static std::uint64_t hash(std::string_view key) noexcept;
+    static std::size_t displace(std::uint64_t hash, std::uint32_t seed, std::size_t mask) noexcept;
+    void insert(std::vector<Slot>& index, const std::string Market::*field, Handle handle);
+    Handle find(const std::vector<Slot>& index, std::string_view key, const std::string Market::*field) const noexcept;
+    void buildIdIndex();
+
+    std::vector<Market> markets_;
+    std::vector<MarketPrecision> precisions_;
+    std::vector<Slot> symbolIndex_;
+    std::size_t mask_ = 0;
+
+    // Perfect hash over the distinct market ids: the key hash picks a bucket,
+    // the bucket's seed picks the slot
+    std::vector<std::uint32_t> idSeeds_;
+    std::vector<Handle> idSlots_;
+    std::size_t idMask_ = 0;
+    mutable std::atomic<std::uint64_t> misses_{0};
+};
+
+// Difference between two registry snapshots, keyed by unified symbol. Handles
+// of added and changed markets index current, handles of removed ones index
+// previous; both snapshots are kept alive for as long as the diff is.
+struct MarketChanges {
+    std::shared_ptr<const MarketRegistry> previous;
+    std::shared_ptr<const MarketRegistry> current;
+    std::vector<MarketRegistry::Handle> added;
+    std::vector<MarketRegistry::Handle> removed;
+    std::vector<MarketRegistry::Handle> changed;   // precision, limits, status or any other field
+
+    static MarketChanges between(std::shared_ptr<const MarketRegistry> previous,
+                                 std::shared_ptr<const MarketRegistry> current);
+    bool empty() const noexcept { return added.empty() && removed.empty() && changed.empty(); }
+};
+
+} // namespace ccxt
+
+#endif // CCXT_MARKET_REGISTRY_H
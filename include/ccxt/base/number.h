@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <nlohmann/json.hpp>
+
+namespace ccxt {
+
+// Locale-independent decimal parsing on string_views, for price and amount
+// fields that exchanges send as strings. Unlike std::stod nothing is copied
+// out of the message: parse straight from the json's own string storage.
+//
+// Leading whitespace and '+' are skipped and trailing text is ignored, like
+// std::stod; text without a number throws std::invalid_argument and values
+// out of range throw std::out_of_range, so existing error handling still holds.
+double parseDouble(std::string_view text);
+bool tryParseDouble(std::string_view text, double& value) noexcept;
+
+// Decodes a decimal directly into integer units of 10^-decimals, truncating
+// any further digits: parseScaled("0.00123", 8) == 123000. Unlike parseDouble
+// the whole text must be the number: exponents and trailing text throw
+// std::invalid_argument, values out of range std::out_of_range.
+std::int64_t parseScaled(std::string_view text, int decimals);
+
+// Numeric field sent either as a json string or as a json number
+double jsonDouble(const nlohmann::json& value);
+
+} // namespace ccxt
@@ -1,17 +1,27 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 namespace ccxt {
 
+// Exact decimal arithmetic on a scaled 128-bit integer: the value is
+// integer * 10^-decimals. add/sub/mul/mod are exact and div truncates to the
+// requested number of decimals, as in ccxt's Precise. Everything up to 38
+// significant digits stays on the stack; results that would not fit throw
+// std::overflow_error instead of silently losing digits.
 class Precise {
 public:
+    using Integer = __int128;
+
     Precise(const std::string& str = "0");
     Precise(const char* str);
+    Precise(std::string_view str);
     Precise(int value);
     Precise(long value);
     Precise(double value);
-    
+    Precise(Integer integer, int decimals);
+
     static Precise string_mul(const std::string& string1, const std::string& string2);
     static Precise string_div(const std::string& string1, const std::string& string2, int precision = 18);
     static Precise string_add(const std::string& string1, const std::string& string2);
@@ -23,7 +33,7 @@ public:
     static int string_ge(const std::string& string1, const std::string& string2);
     static int string_lt(const std::string& string1, const std::string& string2);
     static int string_le(const std::string& string1, const std::string& string2);
-    
+
     Precise mul(const Precise& other) const;
     Precise div(const Precise& other, int precision = 18) const;
     Precise add(const Precise& other) const;
@@ -35,13 +45,27 @@ public:
     bool ge(const Precise& other) const;
     bool lt(const Precise& other) const;
     bool le(const Precise& other) const;
-    
+
     std::string toString() const;
+    // Writes the normalized decimal into [first, last) and returns the end of
+    // the written text, nullptr when the buffer is too small
+    char* toChars(char* first, char* last) const;
     double toDouble() const;
-    
+
+    Integer integer() const { return integer_; }
+    int decimals() const { return decimals_; }
+
 private:
-    std::string value;
-    static std::string normalize(const std::string& string);
+    Integer integer_ = 0;
+    int decimals_ = 0;
+
+    // Drops trailing zero decimals so that equal values compare bitwise
+    void normalize();
+    static Precise parse(std::string_view string);
+    // integer scaled up by 10^digits, throws on overflow
+    static Integer scale(Integer integer, int digits);
+    // Compares after bringing both operands to the same number of decimals
+    static int compare(const Precise& a, const Precise& b);
 };
 
 } // namespace ccxt
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "ccxt/base/signer.h"
+
+namespace ccxt {
+
+// Request for a hot endpoint with everything that stays the same between
+// calls laid out once: method, URL, headers and the parameter text around the
+// variable fields. Rendering writes the fields into buffers kept from the
+// previous call and signs the text in place, so once warmed up a request
+// renders without allocating. A PreparedRequest serves one thread at a time.
+class PreparedRequest {
+public:
+    // params is the parameter text with {name} placeholders, for example
+    // "symbol=BTCUSDT&quantity={quantity}&timestamp={timestamp}". A {name?}
+    // placeholder is optional: while its value is empty the "&key=" in front
+    // of it is left out as well. The text goes into the body when inBody is
+    // set and into the query string otherwise; signer, when given, appends
+    // "&<signatureKey>=<signature of the text>". Throws std::invalid_argument
+    // for malformed params.
+    PreparedRequest(std::string method, std::string url, std::map<std::string, std::string> headers,
+                    std::string_view params, const Signer* signer = nullptr, bool inBody = false,
+                    std::string signatureKey = "signature");
+
+    // Index of the placeholder name; throws std::invalid_argument when there is none
+    std::size_t field(std::string_view name) const;
+    // Values go into the text as they are, so they must not need percent-encoding
+    void set(std::size_t field, std::string_view value);
+    void set(std::size_t field, long long value);
+    // Lays out the text from the current values and signs it
+    void render();
+
+    const std::string& method() const noexcept { return method_; }
+    const std::string& url() const noexcept { return url_; }
+    const std::map<std::string, std::string>& headers() const noexcept { return headers_; }
+    const std::string& body() const noexcept { return body_; }
+
+private:
+    struct Field {
+        std::string prefix;  // text between the previous field and this one
+        std::string key;     // "&key=" of an optional field, dropped with an empty value
+        std::string name;
+        std::string value;
+        bool optional = false;
+    };
+
+    std::string method_;
+    std::string url_;
+    std::map<std::string, std::string> headers_;
+    std::string body_;
+    std::vector<Field> fields_;
+    std::string suffix_;         // text after the last field
+    std::size_t textStart_ = 0;  // where the parameter text starts in url_ or body_
+    const Signer* signer_;
+    bool inBody_;
+    std::string signatureKey_;
+};
+
+} // namespace ccxt
@@ -0,0 +1,82 @@
+#ifndef CCXT_RATE_LIMITER_H
+#define CCXT_RATE_LIMITER_H
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace ccxt {
+
+// Token bucket in the style of upstream ccxt's throttler. Tokens refill at one
+// per rateLimit milliseconds up to capacity; a request may go once the bucket
+// is non-negative and then pays its endpoint cost, which can drive the bucket
+// into debt for heavy endpoints. reserve() never blocks: it books the request
+// and returns how long the caller has to wait, so async callers arm a timer on
+// their own io_context while sync callers simply sleep.
+//
+// The bucket also adapts to the server's own accounting: reportUsage() feeds
+// used-weight headers such as X-MBX-USED-WEIGHT-1M, spreading what is left of
+// the window's budget over the rest of the window, and pause() honours
+// Retry-After on 429/418 responses.
+class RateLimiter {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Options {
+        double rateLimit = 50.0;      // milliseconds per unit of cost
+        double capacity = 1.0;        // tokens that may accumulate while idle
+        std::size_t maxQueue = 2000;  // delayed requests before RateLimitExceeded
+        double minRateLimit = 0.0;    // fastest pace reportUsage may relax to, 0 = rateLimit
+    };
+
+    // Bucket shared by every caller using the same key, e.g. exchange id + API key
+    static std::shared_ptr<RateLimiter> shared(const std::string& key, const Options& options);
+
+    RateLimiter();
+    explicit RateLimiter(const Options& options);
+
+    // Books cost tokens and returns the delay before the request may be sent
+    Clock::duration reserve(double cost = 1.0);
+
+    // Holds every request back for duration, e.g. from a Retry-After header
+    void pause(Clock::duration duration);
+    // Server-reported usage of a fixed window aligned to the wall clock (Binance
+    // style). When pace is set the send rate follows the remaining budget,
+    // otherwise the bucket only pauses once the window is exhausted.
+    void reportUsage(const std::string& window, double used, double limit,
+                     std::chrono::milliseconds interval, bool pace = true);
+
+    double tokens() const;
+    std::size_t queueDepth() const;
+    // Effective milliseconds per unit of cost after adaptation
+    double rateLimit() const;
+    void setRateLimit(double rateLimit);
+
+private:
+    struct Window {
+        double rateLimit;
+        Clock::time_point expires;
+    };
+
+    void refill(Clock::time_point now) const;
+    void prune(Clock::time_point now) const;
+    void adapt(Clock::time_point now) const;
+
+    Options options_;
+    mutable std::mutex mutex_;
+    mutable double tokens_;
+    mutable double rateLimit_;
+    mutable Clock::time_point updated_;
+    Clock::time_point pausedUntil_;
+    mutable std::map<std::string, Window> windows_;
+    // Release times of booked but not yet released requests, non-decreasing
+    mutable std::deque<Clock::time_point> queue_;
+};
+
+} // namespace ccxt
+
+#endif // CCXT_RATE_LIMITER_H
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace ccxt {
+
+// High frames (order entry) are written before any queued Normal ones
+// (subscriptions, pings); each priority is first in, first out.
+enum class SendPriority { Normal, High };
+
+// Outbound frames of one connection. The queue owns every frame until it
+// has been written, holds at most one frame in flight, and refuses frames
+// that would take it over its byte limit so the producer can back off.
+class SendQueue {
+public:
+    // Folds next into queued, which has not been written yet, and returns
+    // true; false leaves both untouched and next is queued on its own. A
+    // merged frame must not be longer than the two frames together.
+    using Merger = std::function<bool(std::string& queued, const std::string& next)>;
+
+    explicit SendQueue(std::size_t limit = 4 * 1024 * 1024);
+
+    void setLimit(std::size_t bytes) { limit_ = bytes; }
+    std::size_t limit() const noexcept { return limit_; }
+    // Frames no larger than this are offered to the merger
+    void setMerger(Merger merger, std::size_t coalesceLimit = 4096);
+
+    // Queues frame behind the others of its priority, merged into the last of
+    // them when both are small and the merger accepts. False when the queue
+    // would go over its limit; the frame is then dropped.
+    bool push(std::string frame, SendPriority priority = SendPriority::Normal);
+    // Queues frames, in order, ahead of the Normal frames already waiting and
+    // whatever the limit: state a new connection needs before anything else,
+    // such as subscriptions replayed after a reconnect
+    void pushFront(std::vector<std::string> frames);
+
+    // Moves the next frame in flight and returns it, nullptr when there is
+    // none or one is already in flight. The frame stays valid until pop().
+    const std::string* next();
+    // Releases the frame in flight once it has been written
+    void pop();
+    // Puts the frame in flight back at the front of its priority after a
+    // failed write, to go out again on the next connection
+    void requeue();
+    bool inFlight() const noexcept { return inFlight_; }
+
+    // Bytes held, the frame in flight included
+    std::size_t bytes() const noexcept { return bytes_; }
+    // Frames held, the frame in flight included
+    std::size_t size() const noexcept { return high_.size() + normal_.size() + inFlight_; }
+    bool empty() const noexcept { return size() == 0; }
+    void clear();
+
+private:
+    std::deque<std::string> high_;
+    std::deque<std::string> normal_;
+    std::string writing_;
+    bool inFlight_ = false;
+    SendPriority inFlightPriority_ = SendPriority::Normal;
+    std::size_t bytes_ = 0;
+    std::size_t limit_;
+    Merger merger_;
+    std::size_t coalesceLimit_ = 0;
+};
+
+} // namespace ccxt
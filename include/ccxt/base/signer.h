@@ -0,0 +1,124 @@
+#pragma once
+
+#include <array>
+#include <string>
+#include <string_view>
+#include "ccxt/base/config.h"
+#include "ccxt/base/crypto.h"
+
+typedef struct evp_pkey_st EVP_PKEY;
+
+namespace ccxt {
+
+// Request signer. Keys are parsed and prepared once, at construction; sign()
+// is const and may be called from any number of threads at once.
+class Signer {
+public:
+    virtual ~Signer() = default;
+    // Signature of message in the encoding the exchange puts on the wire
+    virtual std::string sign(std::string_view message) const = 0;
+    // Appends sign(message) to out; message may point into out. Signers that
+    // can encode straight into the buffer override it to skip the temporary.
+    virtual void appendSignature(std::string_view message, std::string& out) const { out += sign(message); }
+};
+
+enum class SignatureEncoding { Hex, Base64 };
+
+class HmacSigner : public Signer {
+public:
+    HmacSigner(HashAlgorithm algorithm, std::string_view secret,
+               SignatureEncoding encoding = SignatureEncoding::Hex);
+
+    std::string sign(std::string_view message) const override;
+    void appendSignature(std::string_view message, std::string& out) const override;
+    const HmacKey& key() const noexcept { return key_; }
+
+private:
+    HmacKey key_;
+    SignatureEncoding encoding_;
+};
+
+// Owner of an OpenSSL private key for the public-key signers
+class KeySigner : public Signer {
+public:
+    ~KeySigner() override;
+    KeySigner(const KeySigner&) = delete;
+    KeySigner& operator=(const KeySigner&) = delete;
+
+protected:
+    explicit KeySigner(EVP_PKEY* key) : key_(key) {}
+    EVP_PKEY* key_;
+};
+
+class Ed25519Signer : public KeySigner {
+public:
+    static constexpr std::size_t signatureSize = 64;
+
+    // privateKey is a PKCS#8 PEM or the 32-byte seed, raw, hex or base64 encoded
+    explicit Ed25519Signer(std::string_view privateKey);
+
+    // Base64 of the signature, as Binance expects it
+    std::string sign(std::string_view message) const override;
+    void appendSignature(std::string_view message, std::string& out) const override;
+    void sign(std::string_view message, unsigned char* out) const;
+    // Raw 32-byte public key
+    std::string publicKey() const;
+};
+
+// ECDSA over P-256 with SHA-256, as JWTs and Coinbase Advanced API keys use it
+class Es256Signer : public KeySigner {
+public:
+    // pem holds a SEC1 or PKCS#8 private key; literal "\n" sequences, as key
+    // files downloaded from Coinbase contain them, are accepted
+    explicit Es256Signer(std::string_view pem);
+
+    // Base64url of r || s, the JWS form of the signature
+    std::string sign(std::string_view message) const override;
+    // Compact JWT of claims; alg and typ are added to header when missing
+    std::string jwt(json header, const json& claims) const;
+};
+
+struct EthSignature {
+    std::array<unsigned char, 32> r;
+    std::array<unsigned char, 32> s;
+    int v;  // 27 or 28
+
+    // 0x-prefixed r || s || v
+    std::string hex() const;
+};
+
+// ECDSA over secp256k1 with Ethereum's conventions, for DEX order signing:
+// deterministic RFC 6979 nonces, low-s signatures with a recovery id,
+// keccak256 digests and EIP-712 typed data
+class Secp256k1Signer : public Signer {
+public:
+    // privateKey is 32 bytes hex encoded, with or without a 0x prefix
+    explicit Secp256k1Signer(std::string_view privateKey);
+    ~Secp256k1Signer() override;
+    Secp256k1Signer(const Secp256k1Signer&) = delete;
+    Secp256k1Signer& operator=(const Secp256k1Signer&) = delete;
+
+    EthSignature signDigest(const std::array<unsigned char, 32>& digest) const;
+    EthSignature signTypedData(const json& typedData) const;
+    // EthSignature::hex() of keccak256(message)
+    std::string sign(std::string_view message) const override;
+    // 0x-prefixed lowercase hex
+    const std::string& address() const noexcept { return address_; }
+
+private:
+    std::array<unsigned char, 32> secret_;
+    std::string address_;
+};
+
+// EIP-712 signing digest keccak256(0x1901 || domainSeparator || hashStruct(message))
+// of a typed-data document {types, primaryType, domain, message}. The
+// EIP712Domain type is derived from the domain's fields when types omits it.
+// Throws NotSupported for unknown types and std::invalid_argument for values
+// that do not fit their type.
+std::array<unsigned char, 32> eip712Hash(const json& typedData);
+
+// Address of the key that made signature over digest; throws std::invalid_argument
+// when the signature does not recover to a point
+std::string recoverAddress(const std::array<unsigned char, 32>& digest, const EthSignature& signature);
+
+} // namespace ccxt
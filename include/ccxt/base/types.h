@@ -3,7 +3,11 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <cstdlib>
+#include <optional>
+#include <tuple>
 #include <ccxt/base/config.h>
+#include <ccxt/base/decimal_to_precision.h>
 
 namespace ccxt {
 struct Fee {
@@ -27,31 +31,88 @@ struct Market {
     std::string swap;
     std::string future;
     std::string option;
-    int precision;
-    int pricePrecision;
-    int amountPrecision;
-    double limits_amount_min;
-    double limits_amount_max;
-    double limits_price_min;
-    double limits_price_max;
-    double limits_cost_min;
-    double limits_cost_max;
+    int precision = 0;
+    // Price and amount precision as reported, as decimal text, unset when the
+    // market has none. Read as decimal places, significant digits or a tick
+    // size according to precisionMode, or the exchange's when that is unset.
+    std::optional<std::string> pricePrecision;
+    std::optional<std::string> amountPrecision;
+    std::optional<CountingMode> precisionMode;
+    double limits_amount_min = 0;
+    double limits_amount_max = 0;
+    double limits_price_min = 0;
+    double limits_price_max = 0;
+    double limits_cost_min = 0;
+    double limits_cost_max = 0;
     std::map<std::string, std::string> info;
 
     Market& operator=(const json& j) {
+        // Flags come as booleans in unified markets and are kept as text
+        auto text = [](const json& value) {
+            if (value.is_boolean()) return std::string(value.get<bool>() ? "true" : "false");
+            return value.is_string() ? value.get<std::string>() : std::string();
+        };
         if (j.contains("id")) id = j["id"].get<std::string>();
         if (j.contains("symbol")) symbol = j["symbol"].get<std::string>();
         if (j.contains("base")) base = j["base"].get<std::string>();
         if (j.contains("quote")) quote = j["quote"].get<std::string>();
+        if (j.contains("baseId")) baseId = text(j["baseId"]);
+        if (j.contains("quoteId")) quoteId = text(j["quoteId"]);
+        if (j.contains("active")) active = text(j["active"]);
         if (j.contains("type")) type = j["type"].get<std::string>();
-        if (j.contains("spot")) spot = j["spot"].get<std::string>();
-        if (j.contains("margin")) margin = j["margin"].get<std::string>();
-        if (j.contains("swap")) swap = j["swap"].get<std::string>();
-        if (j.contains("future")) future = j["future"].get<std::string>();
-        if (j.contains("option")) option = j["option"].get<std::string>();
+        if (j.contains("spot")) spot = text(j["spot"]);
+        if (j.contains("margin")) margin = text(j["margin"]);
+        if (j.contains("swap")) swap = text(j["swap"]);
+        if (j.contains("future")) future = text(j["future"]);
+        if (j.contains("option")) option = text(j["option"]);
+        if (j.contains("limits") && j["limits"].is_object()) {
+            // Bounds are numbers or decimal strings, null when there is none
+            auto read = [](const json& limits, const char* name, double& min, double& max) {
+                if (!limits.contains(name) || !limits[name].is_object()) {
+                    return;
+                }
+                auto bound = [](const json& value) {
+                    if (value.is_number()) return value.get<double>();
+                    if (value.is_string()) return std::strtod(value.get_ref<const std::string&>().c_str(), nullptr);
+                    return 0.0;
+                };
+                if (limits[name].contains("min")) min = bound(limits[name]["min"]);
+                if (limits[name].contains("max")) max = bound(limits[name]["max"]);
+            };
+            read(j["limits"], "amount", limits_amount_min, limits_amount_max);
+            read(j["limits"], "price", limits_price_min, limits_price_max);
+            read(j["limits"], "cost", limits_cost_min, limits_cost_max);
+        }
+        if (j.contains("precision") && j["precision"].is_object()) {
+            // Numbers keep their shortest decimal form, null means not reported
+            auto read = [](const json& value, std::optional<std::string>& precision) {
+                if (value.is_string()) {
+                    precision = value.get<std::string>();
+                } else if (value.is_number()) {
+                    precision = value.dump();
+                }
+            };
+            if (j["precision"].contains("price")) read(j["precision"]["price"], pricePrecision);
+            if (j["precision"].contains("amount")) read(j["precision"]["amount"], amountPrecision);
+        }
+        if (j.contains("precisionMode") && j["precisionMode"].is_number_integer()) {
+            precisionMode = static_cast<CountingMode>(j["precisionMode"].get<int>());
+        }
         return *this;
     }
 
+    bool operator==(const Market& other) const {
+        auto fields = [](const Market& m) {
+            return std::tie(m.id, m.symbol, m.base, m.quote, m.baseId, m.quoteId, m.active, m.type,
+                            m.spot, m.margin, m.swap, m.future, m.option,
+                            m.precision, m.pricePrecision, m.amountPrecision, m.precisionMode,
+                            m.limits_amount_min, m.limits_amount_max, m.limits_price_min,
+                            m.limits_price_max, m.limits_cost_min, m.limits_cost_max, m.info);
+        };
+        return fields(*this) == fields(other);
+    }
+    bool operator!=(const Market& other) const { return !(*this == other); }
+
     const std::string& operator[](const std::string& key) const {
         if (key == "id") return id;
         if (key == "symbol") return symbol;
@@ -181,7 +242,7 @@ struct OrderBook {
     long long timestamp;
     std::string datetime;
     std::string symbol;
-    int nonce;
+    long long nonce;
     std::vector<std::vector<double>> bids;
     std::vector<std::vector<double>> asks;
 };
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "ccxt/base/config.h"
+
+namespace ccxt {
+
+// Table-driven percent-encoding: everything but ALPHA, DIGIT and "-._~" is
+// written as %XX. The pointer form writes at most 3 * text.size() bytes.
+char* percentEncode(std::string_view text, char* out);
+void appendPercentEncoded(std::string& out, std::string_view text);
+std::string percentEncode(std::string_view text);
+
+// Path such as "/api/v3/order/{id}" split once into literal segments and
+// named slots, so filling it is a single pass over the pieces instead of a
+// regex per placeholder.
+class UrlTemplate {
+public:
+    explicit UrlTemplate(std::string_view path);
+
+    // Placeholder names in order of appearance, repeats included
+    const std::vector<std::string>& params() const noexcept { return names_; }
+
+    // Appends the path with each slot taken from the member of params with its
+    // name; strings go in as they are and other values as their json text.
+    // Values are percent-encoded when encode is set. Slots without a member
+    // keep their "{name}".
+    void render(const json& params, std::string& out, bool encode = true) const;
+    std::string render(const json& params, bool encode = true) const;
+
+private:
+    std::vector<std::string> literals_;  // one more than names_: the text around the slots
+    std::vector<std::string> names_;
+    std::size_t size_ = 0;               // length of the literal text
+};
+
+} // namespace ccxt
@@ -10,38 +10,208 @@
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/ssl/context.hpp>
 #include <boost/asio/ssl/stream.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <chrono>
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <random>
+#include <utility>
+#include <vector>
+#include <ccxt/base/inflater.h>
+#include <ccxt/base/json_arena.h>
+#include <ccxt/base/send_queue.h>
 
 namespace ccxt {
 
+// How a lost connection is re-established
+struct ReconnectPolicy {
+    bool enabled = true;
+    std::chrono::milliseconds initialDelay{250};
+    std::chrono::milliseconds maxDelay{30000};
+    double multiplier = 2.0;
+    // Each delay is drawn uniformly from [delay * (1 - jitter), delay]
+    double jitter = 0.5;
+    // Attempts in a row before giving up, 0 for no limit
+    std::uint32_t maxAttempts = 0;
+    // A connection with no message or ping/pong for this long is treated as
+    // lost, 0 disables the watchdog
+    std::chrono::milliseconds staleAfter{0};
+};
+
+// Keepalive of a connection: a ping every interval, a WebSocket ping frame or
+// the exchange's own ping message (see WebSocketClient::heartbeatMessage).
+// Every connection pings by default, so idle streams are neither dropped by
+// the server nor left dead without notice.
+struct HeartbeatPolicy {
+    std::chrono::milliseconds interval{30000};   // 0 disables pings
+    // A ping without a reply for this long is a lost connection, 0 waits forever
+    std::chrono::milliseconds timeout{10000};
+};
+
+// Backoff before reconnect attempt number attempt (1 for the first), given a
+// uniform random number in [0, 1)
+std::chrono::milliseconds reconnectDelay(const ReconnectPolicy& policy, std::uint32_t attempt, double random);
+
 class WebSocketClient : public std::enable_shared_from_this<WebSocketClient> {
 public:
-    using MessageHandler = std::function<void(const std::string&)>;
+    // Handlers see each message as a view into the read buffer, valid only
+    // until they return; one that keeps the text copies it.
+    using MessageHandler = std::function<void(std::string_view)>;
+
+    struct Metrics {
+        bool connected = false;
+        std::uint64_t connects = 0;        // completed handshakes, reconnects included
+        std::uint64_t disconnects = 0;     // connections lost after a handshake
+        std::uint64_t staleFeeds = 0;      // of which closed by the watchdog
+        std::uint32_t attempts = 0;        // failed attempts since the last handshake
+        double lastRecoveryMs = 0.0;       // connection lost until the next handshake
+        double maxRecoveryMs = 0.0;
+        double lastGapMs = 0.0;            // last message before the loss until the first after
+        double maxGapMs = 0.0;
+        std::uint64_t pings = 0;           // heartbeats sent
+        std::uint64_t heartbeatTimeouts = 0;   // stale feeds with a ping left unanswered
+        double lastRttMs = 0.0;            // heartbeat round trip
+        double smoothedRttMs = 0.0;        // moving average of it, 1/8 weight per sample
+        std::uint64_t badFrames = 0;       // messages dropped because they failed to inflate
+        std::uint64_t requeuedFrames = 0;  // failed writes kept for the next connection
+    };
 
     WebSocketClient(boost::asio::io_context& ioc, boost::asio::ssl::context& ctx);
     ~WebSocketClient();
 
+    // Connects and keeps the connection up according to the reconnect policy
+    // until close()
     void connect(const std::string& host, const std::string& port, const std::string& path);
-    void send(const std::string& message);
+    // Queues message for writing and returns at once; frames go out one at a
+    // time in priority order. Returns false, dropping the message, when the
+    // send queue is full. A frame whose write fails is sent again after the
+    // reconnect, so the server may see it twice. Safe to call from any thread.
+    bool send(std::string message, SendPriority priority = SendPriority::Normal);
     void close();
 
     void setMessageHandler(MessageHandler handler);
+    // Opt-in on-demand parsing: handlers read market data fields straight from
+    // the message text (see JsonView) instead of building a json DOM first
+    void setLazyParsing(bool enabled) { lazyParsing_ = enabled; }
+    bool lazyParsing() const { return lazyParsing_; }
+    // Opt-in per-message arena: handlers that build a DOM with parseArenaJson
+    // allocate it from this connection's arena, which is rewound after every
+    // message. Disabling it releases the arena.
+    void setJsonArena(bool enabled, std::size_t blockSize = 64 * 1024);
+    JsonArena* jsonArena() const { return arena_.get(); }
+    // Capacity kept in the read buffer between messages, so frames up to this
+    // size are read without growing it
+    void setReadBufferReserve(std::size_t bytes);
+    std::size_t readBufferReserve() const { return readBufferReserve_; }
+    // Bytes the send queue may hold before send() refuses messages
+    void setSendQueueLimit(std::size_t bytes);
+    std::size_t sendQueueBytes() const;
+    // Takes effect from the next connection attempt
+    void setReconnectPolicy(const ReconnectPolicy& policy);
+    // Takes effect from the next connection
+    void setHeartbeat(const HeartbeatPolicy& policy);
+    // Offers permessage-deflate in the handshake of the next connection; the
+    // stream then inflates messages itself, keeping its window between them
+    void setPermessageDeflate(bool enabled) { permessageDeflate_ = enabled; }
+    // Inflates each message before it is dispatched, for exchanges that send
+    // gzip, zlib or raw deflate payloads. Messages that fail to inflate or
+    // inflate to more than maxMessageSize bytes are dropped and counted in
+    // Metrics::badFrames.
+    void setFrameCompression(FrameCompression format, std::size_t maxMessageSize = Inflater::defaultMaxOutput);
+    FrameCompression frameCompression() const;
+    Metrics metrics() const;
 protected:
-    virtual void handleMessage(const std::string& message) {}
+    // message points into the read buffer and is only valid during the call
+    virtual void handleMessage(std::string_view message) {}
+    // Runs one received message through the heartbeat hooks, then through
+    // handleMessage and the message handler inside the arena scope when there
+    // is one
+    void dispatch(std::string_view message);
+    // Coalescing hook for small Normal frames waiting in the send queue: an
+    // exchange that accepts batched requests folds next into queued and
+    // returns true (see SendQueue::Merger)
+    virtual bool mergeFrames(std::string& queued, const std::string& next) const { return false; }
+
+    // Subscription frames are sent again, in the order they were first added,
+    // after every reconnect, ahead of Normal frames queued meanwhile and past
+    // the send queue limit. Adding a key again replaces its frame.
+    void addSubscription(const std::string& key, std::string frame);
+    void removeSubscription(const std::string& key);
+    // Called when an established connection is lost, before reconnecting:
+    // state built from the stream, such as order books, is stale from here
+    virtual void handleDisconnect() {}
+    // Called after a reconnect, once the subscriptions have been queued
+    virtual void handleReconnect() {}
+
+    // Exchange-level keepalive, for exchanges that want a message rather than
+    // a WebSocket ping frame; empty sends a ping frame
+    virtual std::string heartbeatMessage() { return {}; }
+    // True for the reply to heartbeatMessage(); checked while a ping is
+    // outstanding, and replies are not dispatched
+    virtual bool isHeartbeatReply(std::string_view message) const { return false; }
+    // Reply to a ping message from the server, empty for any other message.
+    // Pings answered here are not dispatched. Ping frames are answered by
+    // the stream itself.
+    virtual std::string pingReply(std::string_view message) const { return {}; }
 private:
-    void onResolve(boost::beast::error_code ec, boost::asio::ip::tcp::resolver::results_type results);
-    void onConnect(const boost::system::error_code& ec, const boost::asio::ip::tcp::endpoint& endpoint);
-    void onHandshake(boost::beast::error_code ec);
-    void onWrite(boost::beast::error_code ec, std::size_t bytes_transferred);
-    void onRead(boost::beast::error_code ec, std::size_t bytes_transferred);
+    using Stream = boost::beast::websocket::stream<boost::asio::ssl::stream<boost::asio::ip::tcp::socket>>;
+
+    // Each attempt runs on a fresh stream; completions of a stream that is no
+    // longer ws_ are ignored
+    void open();
+    void onResolve(const std::shared_ptr<Stream>& ws, boost::asio::ip::tcp::resolver::results_type results);
+    void onConnect(const std::shared_ptr<Stream>& ws);
+    void onHandshake(const std::shared_ptr<Stream>& ws);
+    void fail(const std::shared_ptr<Stream>& ws, bool stale = false);
+    void armWatchdog(const std::shared_ptr<Stream>& ws);
+    void armHeartbeat(const std::shared_ptr<Stream>& ws, std::chrono::steady_clock::time_point at);
+    void sendPing(const std::shared_ptr<Stream>& ws);
+    void onHeartbeatReply();
+    void scheduleWrite();   // with sendMutex_ held
+    void startWrite();
+    void onWrite(const std::shared_ptr<Stream>& ws, boost::beast::error_code ec, std::size_t bytes_transferred);
+    void onRead(const std::shared_ptr<Stream>& ws, boost::beast::error_code ec, std::size_t bytes_transferred);
     void onClose(boost::beast::error_code ec);
 
-    boost::beast::websocket::stream<boost::asio::ssl::stream<boost::asio::ip::tcp::socket>> ws_;
+    boost::asio::io_context& ioc_;
+    boost::asio::ssl::context& ctx_;
+    std::shared_ptr<Stream> ws_;
     boost::beast::flat_buffer buffer_;
     boost::asio::ip::tcp::resolver resolver_;
     MessageHandler messageHandler_;
+    bool lazyParsing_ = false;
+    std::size_t readBufferReserve_ = 64 * 1024;
+    bool permessageDeflate_ = false;
+    std::unique_ptr<Inflater> inflater_;
+    std::unique_ptr<JsonArena> arena_;
+    mutable std::mutex sendMutex_;
+    SendQueue sendQueue_;
+    bool writing_ = false;   // a write is scheduled or in flight
+    std::vector<std::pair<std::string, std::string>> subscriptions_;   // guarded by sendMutex_
+
+    std::string host_;
+    std::string port_;
+    std::string path_;
+    bool closing_ = false;
+    ReconnectPolicy policy_;
+    boost::asio::steady_timer reconnectTimer_;
+    boost::asio::steady_timer watchdog_;
+    HeartbeatPolicy heartbeat_;
+    boost::asio::steady_timer heartbeatTimer_;
+    std::chrono::steady_clock::time_point pingSentAt_;
+    bool pingOutstanding_ = false;
+    bool pingIsMessage_ = false;   // the outstanding ping is heartbeatMessage(), not a ping frame
+    std::minstd_rand random_;
+    std::chrono::steady_clock::time_point lastActivity_;   // last message or control frame
+    std::chrono::steady_clock::time_point lastMessage_;
+    std::chrono::steady_clock::time_point lostAt_;
+    bool gapOpen_ = false;   // lost since lastMessage_, closed by the next message
+    mutable std::mutex metricsMutex_;
+    Metrics metrics_;
 };
 
 } // namespace ccxt
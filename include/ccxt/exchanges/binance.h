@@ -1,6 +1,7 @@
 #pragma once
 
 #include <ccxt/base/exchange.h>
+#include <ccxt/base/prepared_request.h>
 #include <boost/beast/ssl.hpp>
 #include <boost/asio/ssl.hpp>
 #include <openssl/evp.h>
@@ -20,6 +21,36 @@ public:
     void init() override;
     void describe() const override;
 
+    // Typed market data, decoded from the raw body with JsonView
+    void fetchTickerTyped(const std::string& symbol, Ticker& ticker) override;
+    void fetchOrderBookTyped(const std::string& symbol, OrderBook& orderBook, int limit = 0) override;
+    void fetchTradesTyped(const std::string& symbol, std::vector<Trade>& trades, int since = 0, int limit = 0) override;
+    void parseTickerInto(std::string_view body, const Market& market, Ticker& ticker) const override;
+    void parseOrderBookInto(std::string_view body, const Market& market, OrderBook& orderBook) const override;
+    void parseTradesInto(std::string_view body, const Market& market, std::vector<Trade>& trades) const override;
+
+    // Order entry fast path: POST /api/v3/order for one market, type and side,
+    // laid out and costed once, then filled with quantity, price, client order
+    // id and timestamp for each order. Spot LIMIT, LIMIT_MAKER and MARKET
+    // orders only; anything else throws NotSupported.
+    struct PreparedOrder {
+        std::string symbol;
+        PreparedRequest request;
+        double cost;
+        std::size_t quantity;
+        std::size_t price;  // npos for market orders
+        std::size_t clientOrderId;
+        std::size_t timestamp;
+    };
+    PreparedOrder prepareOrder(const std::string& symbol, const std::string& type, const std::string& side,
+                               const std::string& timeInForce = "GTC");
+    // Writes the order's fields with the market's precision and signs it,
+    // leaving the request ready for the wire; price is ignored by market orders
+    const PreparedRequest& renderOrder(PreparedOrder& order, double amount, double price = 0,
+                                       std::string_view clientOrderId = {}) const;
+    json createPreparedOrder(PreparedOrder& order, double amount, double price = 0,
+                             std::string_view clientOrderId = {});
+
 protected:
     std::string getMarketType(const std::string& symbol) const;
     std::string getEndpoint(const std::string& path, const std::string& type) const;
@@ -90,6 +121,13 @@ protected:
     json parseOrderBook(const json& orderbook, const std::string& symbol, const Market& market) const override;
     json parseOHLCV(const json& ohlcv, const Market& market, const std::string& timeframe) const override;
     json parseTicker(const json& ticker, const Market& market) const override;
+    void updateRateLimits(const HttpResponse& response) override;
+
+    // Asynchronous API: public market data goes out without blocking the io_context
+    std::optional<AsyncRequest> fetchTickerRequest(const std::string& symbol, const json& params) override;
+    std::optional<AsyncRequest> fetchOrderBookRequest(const std::string& symbol, int limit, const json& params) override;
+    std::optional<AsyncRequest> fetchOHLCVRequest(const std::string& symbol, const std::string& timeframe,
+                                                  int since, int limit, const json& params) override;
 
     json loadMarkets() const;
 
@@ -104,7 +142,11 @@ private:
                   const std::map<std::string, std::string>& headers = {},
                   const json& body = nullptr) const override;
     std::string getTimestamp() const;
+    // https://<hostname>/api/v3/<path>
+    std::string publicUrl(const std::string& path) const;
     std::string createSignature(const std::string& queryString) const;
+    // Ed25519 for API keys registered with a PEM private key, HMAC-SHA256 otherwise
+    std::unique_ptr<Signer> createSigner(const std::string& secret) const override;
     std::string parseSymbol(const std::string& symbol) const;
     std::string parseTimeInForce(const std::string& timeInForce) const;
     std::string parseOrderType(const std::string& type) const;
@@ -127,7 +169,6 @@ private:
     mutable bool markets_loaded{false};
 
     // Member variables
-    std::map<std::string, std::string> timeframes;
     std::map<std::string, std::string> marketTypes;
     std::map<std::string, std::string> options;
     std::map<int, std::string> errorCodes;
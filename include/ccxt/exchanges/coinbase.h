@@ -52,6 +52,8 @@ protected:
     std::string sign(const std::string& path, const std::string& api = "public",
                const std::string& method = "GET", const json& params = json::object(),
                const std::map<std::string, std::string>& headers = {}, const json& body = nullptr) override;
+    // ES256 JWTs for Advanced Trade keys (PEM), base64 HMAC-SHA256 for legacy secrets
+    std::unique_ptr<Signer> createSigner(const std::string& secret) const override;
 
 private:
     void initializeApiEndpoints();
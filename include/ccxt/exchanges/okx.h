@@ -18,6 +18,14 @@ public:
     json fetchOHLCV(const std::string& symbol, const std::string& timeframe = "1m",
                     int since = 0, int limit = 0, const json& params = json::object()) override;
 
+    // Typed market data, decoded from the raw body with JsonView
+    void fetchTickerTyped(const std::string& symbol, Ticker& ticker) override;
+    void fetchOrderBookTyped(const std::string& symbol, OrderBook& orderBook, int limit = 0) override;
+    void fetchTradesTyped(const std::string& symbol, std::vector<Trade>& trades, int since = 0, int limit = 0) override;
+    void parseTickerInto(std::string_view body, const Market& market, Ticker& ticker) const override;
+    void parseOrderBookInto(std::string_view body, const Market& market, OrderBook& orderBook) const override;
+    void parseTradesInto(std::string_view body, const Market& market, std::vector<Trade>& trades) const override;
+
     // Trading API
     json fetchBalance(const json& params = json::object()) override;
     json createOrder(const std::string& symbol, const std::string& type, const std::string& side,
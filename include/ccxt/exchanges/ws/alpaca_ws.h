@@ -31,7 +31,7 @@ public:
 
 protected:
     void authenticate();
-    void handleMessage(const std::string& message) override;
+    void handleMessage(std::string_view message) override;
 
 private:
     Alpaca& exchange_;
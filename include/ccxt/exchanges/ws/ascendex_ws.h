@@ -30,15 +30,16 @@ public:
 
 protected:
     void authenticate();
-    void handleMessage(const std::string& message) override;
+    void handleMessage(std::string_view message) override;
+    std::string heartbeatMessage() override;
+    bool isHeartbeatReply(std::string_view message) const override;
+    std::string pingReply(std::string_view message) const override;
 
 private:
     Ascendex& exchange_;
     std::string apiKey_;
     std::string apiSecret_;
     std::map<std::string, std::string> subscriptions_;
-    int64_t lastPingTimestamp_;
-    int64_t pingInterval_;
     bool authenticated_;
 
     // Message Handlers
@@ -56,8 +57,6 @@ private:
     void unsubscribe(const std::string& channel, const std::vector<std::string>& symbols = {}, bool isPrivate = false);
     std::string getStreamUrl(bool isPrivate = false) const;
     std::string sign(const std::string& message) const;
-    void ping();
-    void startPingLoop();
 };
 
 } // namespace ccxt
@@ -29,7 +29,7 @@ public:
 
 protected:
     void authenticate();
-    void handleMessage(const std::string& message) override;
+    void handleMessage(std::string_view message) override;
 
 private:
     Bequant& exchange_;
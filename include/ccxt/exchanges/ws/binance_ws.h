@@ -3,6 +3,7 @@
 
 #include <ccxt/base/websocket_client.h>
 #include <ccxt/exchanges/binance.h>
+#include <ccxt/base/json_view.h>
 #include <nlohmann/json.hpp>
 #include <string>
 #include <unordered_map>
@@ -31,7 +32,10 @@ public:
     void watchMarkPrice(const std::string& symbol);
 
 protected:
-    void handleMessage(const std::string& message) override;
+    void handleMessage(std::string_view message) override;
+    // Folds queued SUBSCRIBE/UNSUBSCRIBE requests into one: a connection may
+    // send at most 5 messages per second
+    bool mergeFrames(std::string& queued, const std::string& next) const override;
     void checkSubscriptionLimit(const std::string& type, const std::string& stream, int numSubscriptions);
     std::string getStream(const std::string& type, const std::string& subscriptionHash, int numSubscriptions);
     void handlePosition(const nlohmann::json& data);
@@ -48,14 +52,33 @@ private:
     int streamIndex_ = -1;
     std::unordered_map<std::string, std::string> streamBySubscriptionsHash_;
 
-    // Message Handlers
-    void handleTicker(const nlohmann::json& data);
-    void handleOrderBook(const nlohmann::json& data);
-    void handleTrade(const nlohmann::json& data);
-    void handleOHLCV(const nlohmann::json& data);
+    // Sends a SUBSCRIBE for stream and keeps it for replay after a reconnect
+    void subscribe(const std::string& stream);
+
+    // Lowercase market id of symbol followed by channel, e.g. "btcusdt@trade";
+    // throws BadSymbol for a symbol that is not listed
+    std::string streamName(const std::string& symbol, std::string_view channel) const;
+    // Unified symbol of a stream's market id, the id itself before loadMarkets()
+    std::string resolveSymbol(std::string_view marketId) const;
+
+    // Message Handlers; the market data ones read nlohmann::json, or ArenaJson
+    // when the connection has a json arena
+    template <typename Json> bool handleMarketData(const Json& message);
+    template <typename Json> void handleTicker(const Json& data);
+    template <typename Json> void handleOrderBook(const Json& data);
+    template <typename Json> void handleTrade(const Json& data);
+    template <typename Json> void handleOHLCV(const Json& data);
     void handleBalance(const nlohmann::json& data);
     void handleOrder(const nlohmann::json& data);
     void handleMyTrade(const nlohmann::json& data);
+
+    // On-demand variants used when lazyParsing() is on; handleMessageLazy
+    // returns false for messages it leaves to the json DOM path
+    bool handleMessageLazy(std::string_view message);
+    void handleTicker(const JsonView& data);
+    void handleOrderBook(const JsonView& data);
+    void handleTrade(const JsonView& data);
+    void handleOHLCV(const JsonView& data);
 };
 
 } // namespace ccxt
@@ -6,6 +6,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <boost/asio/steady_timer.hpp>
 #include <nlohmann/json.hpp>
 
 namespace ccxt {
@@ -30,7 +31,7 @@ public:
 
 protected:
     void authenticate();
-    void handleMessage(const std::string& message) override;
+    void handleMessage(std::string_view message) override;
     void listenKey();
     void startListenKeyTimer();
 
@@ -41,8 +42,7 @@ private:
     std::map<std::string, std::string> subscriptions_;
     std::string listenKey_;
     bool authenticated_;
-    int64_t lastPingTimestamp_;
-    int64_t pingInterval_;
+    boost::asio::steady_timer listenKeyTimer_;
 
     // Message Handlers
     void handleTicker(const nlohmann::json& data);
@@ -60,8 +60,6 @@ private:
     void unsubscribe(const std::string& channel, const std::string& symbol = "");
     std::string getStreamUrl(bool isPrivate = false) const;
     std::string sign(const std::string& path, const std::string& method = "GET", const nlohmann::json& params = nlohmann::json::object()) const;
-    void ping();
-    void startPingLoop();
     std::string getSymbol(const std::string& market) const;
 };
 
@@ -4,8 +4,10 @@
 #include "websocket_client.h"
 #include "../bitfinex.h"
 #include <nlohmann/json.hpp>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace ccxt {
 
@@ -32,17 +34,26 @@ public:
     void cancelAllOrders();
 
 protected:
-    void handleMessage(const std::string& message) override;
+    void handleMessage(std::string_view message) override;
+    // Channel ids and the login last one connection: the map is cleared on a
+    // loss, so no frame of the new connection is routed by a stale id
+    void handleDisconnect() override;
+    void handleReconnect() override;
 
 private:
     Bitfinex& exchange_;
     bool authenticated_ = false;
     std::unordered_map<std::string, nlohmann::json> options_;
     std::unordered_map<int, std::string> channelMap_;
+    std::mutex privateMutex_;
+    std::vector<std::string> privateSubscriptions_;   // guarded by privateMutex_
+    bool resubscribeOnAuth_ = false;
 
-    // Subscription Methods
+    // Subscription Methods; public channels are replayed by WebSocketClient
+    // after a reconnect, private ones after the next auth
     void subscribe(const std::string& channel, const std::string& symbol,
                   const nlohmann::json& params = nlohmann::json::object());
+    void subscribePrivate(const std::string& channel);
 
     // Message Handlers
     void handleTicker(int channelId, const nlohmann::json& data);
@@ -31,7 +31,7 @@ public:
     void watchPositions();
 
 protected:
-    void handleMessage(const std::string& message) override;
+    void handleMessage(std::string_view message) override;
 
 private:
     Bitget& exchange_;
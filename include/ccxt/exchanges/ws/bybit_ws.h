@@ -30,7 +30,7 @@ public:
     void watchMarkPrice(const std::string& symbol);
 
 protected:
-    void handleMessage(const std::string& message) override;
+    void handleMessage(std::string_view message) override;
 
 private:
     Bybit& exchange_;
@@ -32,7 +32,7 @@ private:
     void subscribe(const std::string& channel, const std::string& symbol = "", bool isPrivate = false);
     void subscribeMultiple(const std::string& channel, const std::vector<std::string>& symbols, bool isPrivate = false);
     void authenticate(const std::string& channel, const std::vector<std::string>& productIds);
-    void handleMessage(const std::string& message);
+    void handleMessage(std::string_view message);
     void handleTickerMessage(const nlohmann::json& data);
     void handleOrderBookMessage(const nlohmann::json& data);
     void handleTradeMessage(const nlohmann::json& data);
@@ -201,7 +201,7 @@ std::string CoincatchWS::getInstId(const std::string& symbol) {
 }
 
 // Message handlers
-void CoincatchWS::handleMessage(const std::string& message) {
+void CoincatchWS::handleMessage(std::string_view message) {
     auto data = nlohmann::json::parse(message);
     
     if (data.contains("event")) {
@@ -36,7 +36,7 @@ private:
     std::string getChannel(const std::string& channel, const std::string& symbol);
 
     // Message handlers
-    void handleMessage(const std::string& message);
+    void handleMessage(std::string_view message);
     void handleOrderBookMessage(const nlohmann::json& data);
     void handleTradeMessage(const nlohmann::json& data);
     void handleErrorMessage(const nlohmann::json& data);
@@ -61,7 +61,7 @@ private:
     void pong(const nlohmann::json& message);
 
     // Message handlers
-    void handleMessage(const std::string& message);
+    void handleMessage(std::string_view message);
     void handleTickerMessage(const nlohmann::json& data);
     void handleOrderBookMessage(const nlohmann::json& data);
     void handleTradeMessage(const nlohmann::json& data);
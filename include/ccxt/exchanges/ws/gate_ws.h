@@ -45,7 +45,7 @@ private:
     void subscribe(const std::string& channel, const std::string& symbol, const std::string& settle = "");
     void subscribePrivate(const std::string& channel, const std::string& settle = "");
     void authenticate(const std::string& channel);
-    void handleMessage(const std::string& message);
+    void handleMessage(std::string_view message);
     void handleTickerMessage(const nlohmann::json& data);
     void handleOrderBookMessage(const nlohmann::json& data);
     void handleTradeMessage(const nlohmann::json& data);
@@ -32,7 +32,7 @@ private:
     bool newUpdates_;
 
     void authenticate();
-    void handleMessage(const std::string& message);
+    void handleMessage(std::string_view message);
     std::string getEndpoint();
     void subscribe(const std::string& channel, const nlohmann::json& params = nlohmann::json::object());
     void unsubscribe(const std::string& channel, const nlohmann::json& params = nlohmann::json::object());
@@ -28,7 +28,8 @@ public:
     void watchMyTrades();
 
 protected:
-    void handleMessage(const std::string& message) override;
+    void handleMessage(std::string_view message) override;
+    std::string pingReply(std::string_view message) const override;
 
 private:
     HTX& exchange_;
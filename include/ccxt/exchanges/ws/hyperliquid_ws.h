@@ -32,7 +32,8 @@ public:
     void watchLeverage(const std::string& symbol = "");
 
 protected:
-    void handleMessage(const std::string& message) override;
+    void handleMessage(std::string_view message) override;
+    std::string pingReply(std::string_view message) const override;
 
 private:
     Hyperliquid& exchange_;
@@ -31,7 +31,7 @@ public:
     void watchMyTrades(const std::string& symbol = "");
 
 protected:
-    void handleMessage(const std::string& message) override;
+    void handleMessage(std::string_view message) override;
 
 private:
     IDEX& exchange_;
@@ -28,7 +28,7 @@ public:
     void watchMyTrades(const std::string& symbol = "");
 
 protected:
-    void handleMessage(const std::string& message) override;
+    void handleMessage(std::string_view message) override;
 
 private:
     IndependentReserve& exchange_;
@@ -36,7 +36,7 @@ public:
     void cancelAllOrders();
 
 protected:
-    void handleMessage(const std::string& message) override;
+    void handleMessage(std::string_view message) override;
 
 private:
     Kraken& exchange_;
@@ -40,7 +40,7 @@ public:
     void cancelAllOrders();
 
 protected:
-    void handleMessage(const std::string& message) override;
+    void handleMessage(std::string_view message) override;
 
 private:
     KrakenFutures& exchange_;
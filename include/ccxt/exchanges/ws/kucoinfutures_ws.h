@@ -43,8 +43,10 @@ private:
     int64_t pingTimeout_;
 
     void authenticate();
-    void handleMessage(const std::string& message);
-    void ping();
+    void handleMessage(std::string_view message);
+    std::string heartbeatMessage() override;
+    bool isHeartbeatReply(std::string_view message) const override;
+    std::string pingReply(std::string_view message) const override;
     void negotiate(bool privateChannel);
     std::string getEndpoint(bool privateChannel);
     void subscribe(const std::string& topic, const nlohmann::json& params = nlohmann::json::object());
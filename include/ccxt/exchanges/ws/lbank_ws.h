@@ -32,8 +32,9 @@ private:
     bool authenticated_;
 
     void authenticate();
-    void handleMessage(const std::string& message);
-    void ping();
+    void handleMessage(std::string_view message);
+    std::string heartbeatMessage() override;
+    bool isHeartbeatReply(std::string_view message) const override;
     void subscribe(const std::string& channel, const std::string& symbol);
     void unsubscribe(const std::string& channel, const std::string& symbol);
 
@@ -40,7 +40,7 @@ private:
     void authenticate();
     void createListenKey();
     void extendListenKey();
-    void handleMessage(const std::string& message);
+    void handleMessage(std::string_view message);
     void handleTickerMessage(const nlohmann::json& data);
     void handleOrderBookMessage(const nlohmann::json& data);
     void handleTradeMessage(const nlohmann::json& data);
@@ -48,7 +48,8 @@ private:
     void handleBalanceMessage(const nlohmann::json& data);
     void handleOrderMessage(const nlohmann::json& data);
     void handleMyTradeMessage(const nlohmann::json& data);
-    void ping();
+    std::string heartbeatMessage() override;
+    bool isHeartbeatReply(std::string_view message) const override;
 };
 
 } // namespace ccxt
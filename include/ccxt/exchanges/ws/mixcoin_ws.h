@@ -32,9 +32,10 @@ private:
     bool authenticated_;
 
     void authenticate();
-    void handleMessage(const std::string& message) override;
+    void handleMessage(std::string_view message) override;
     std::string getEndpoint(const std::string& type = "public") override;
-    void ping();
+    std::string heartbeatMessage() override;
+    bool isHeartbeatReply(std::string_view message) const override;
 
     void subscribe(const std::string& channel, const std::string& symbol = "", bool isPrivate = false);
     void unsubscribe(const std::string& channel, const std::string& symbol = "");
@@ -29,7 +29,7 @@ public:
 
 protected:
     void authenticate();
-    void handleMessage(const std::string& message) override;
+    void handleMessage(std::string_view message) override;
     std::string getEndpoint(const std::string& type = "public") override;
 
 private:
@@ -4,8 +4,10 @@
 #include "websocket_client.h"
 #include "../okx.h"
 #include <nlohmann/json.hpp>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace ccxt {
 
@@ -46,18 +48,26 @@ public:
     void cancelAllOrders(const std::string& symbol);
 
 protected:
-    void handleMessage(const std::string& message) override;
+    void handleMessage(std::string_view message) override;
+    // A login lasts one connection: private channels are subscribed again
+    // once the new login succeeds
+    void handleDisconnect() override;
+    void handleReconnect() override;
 
 private:
     OKX& exchange_;
     bool authenticated_ = false;
     std::unordered_map<std::string, nlohmann::json> options_;
-    std::unordered_map<std::string, std::string> subscriptions_;
+    std::mutex privateMutex_;
+    std::vector<std::string> privateSubscriptions_;   // guarded by privateMutex_
+    bool resubscribeOnLogin_ = false;
 
-    // Subscription Methods
+    // Subscription Methods; public channels are replayed by WebSocketClient
+    // after a reconnect, private ones after the next login
     void subscribe(const std::string& channel, const std::string& instId,
                   const nlohmann::json& args = nlohmann::json::object());
     void unsubscribe(const std::string& channel, const std::string& instId);
+    void subscribePrivate(const nlohmann::json& arg);
     std::string sign(const std::string& timestamp, const std::string& method,
                     const std::string& path, const std::string& body = "");
 
@@ -30,14 +30,15 @@ protected:
     // WebSocket connection management
     std::string getEndpoint(const std::string& type = "public");
     void authenticate();
-    void ping();
+    std::string heartbeatMessage() override;
+    bool isHeartbeatReply(std::string_view message) const override;
 
     // Subscription management
     void subscribe(const std::string& channel, const std::string& symbol = "", bool isPrivate = false);
     void unsubscribe(const std::string& channel, const std::string& symbol = "");
 
     // Message handlers
-    void handleMessage(const std::string& message);
+    void handleMessage(std::string_view message);
     void handleTickerMessage(const nlohmann::json& data);
     void handleOrderBookMessage(const nlohmann::json& data);
     void handleTradeMessage(const nlohmann::json& data);
@@ -18,7 +18,7 @@ public:
 private:
     Vertex& exchange_;
 
-    void handleMessage(const std::string& message);
+    void handleMessage(std::string_view message);
 };
 
 } // namespace ccxt
@@ -29,13 +29,15 @@ protected:
     std::string getEndpoint(const std::string& type = "");
     void authenticate();
     std::string generateSignature(const std::string& timestamp);
-    void ping();
+    std::string heartbeatMessage() override;
+    bool isHeartbeatReply(std::string_view message) const override;
+    std::string pingReply(std::string_view message) const override;
 
     void subscribe(const std::string& channel, const std::string& symbol = "", bool isPrivate = false);
     void unsubscribe(const std::string& channel, const std::string& symbol = "");
 
     // Message handlers
-    void handleMessage(const std::string& message);
+    void handleMessage(std::string_view message);
     void handleTickerMessage(const nlohmann::json& data);
     void handleOrderBookMessage(const nlohmann::json& data);
     void handleTradeMessage(const nlohmann::json& data);
@@ -45,7 +47,6 @@ protected:
     void handleMyTradeMessage(const nlohmann::json& data);
     void handleErrorMessage(const nlohmann::json& data);
     void handleAuthMessage(const nlohmann::json& data);
-    void handlePongMessage(const nlohmann::json& data);
 
 private:
     Woo& exchange_;
@@ -55,7 +56,6 @@ private:
 
     int64_t getNextSequenceNumber();
     std::string normalizeSymbol(const std::string& symbol);
-    void startPingLoop();
 };
 
 } // namespace ccxt
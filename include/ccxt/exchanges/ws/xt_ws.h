@@ -30,13 +30,14 @@ protected:
     void authenticate();
     std::string generateSignature(const std::string& timestamp, const std::string& method,
                                 const std::string& path, const std::string& body = "");
-    void ping();
+    std::string heartbeatMessage() override;
+    bool isHeartbeatReply(std::string_view message) const override;
 
     void subscribe(const std::string& channel, const std::string& symbol = "", bool isPrivate = false);
     void unsubscribe(const std::string& channel, const std::string& symbol = "");
 
     // Message handlers
-    void handleMessage(const std::string& message);
+    void handleMessage(std::string_view message);
     void handleTickerMessage(const nlohmann::json& data);
     void handleOrderBookMessage(const nlohmann::json& data);
     void handleTradeMessage(const nlohmann::json& data);
@@ -46,7 +47,6 @@ protected:
     void handleMyTradeMessage(const nlohmann::json& data);
     void handleErrorMessage(const nlohmann::json& data);
     void handleAuthMessage(const nlohmann::json& data);
-    void handlePongMessage(const nlohmann::json& data);
 
 private:
     XT& exchange_;
@@ -56,7 +56,6 @@ private:
 
     int64_t getNextSequenceNumber();
     std::string normalizeSymbol(const std::string& symbol);
-    void startPingLoop();
 };
 
 } // namespace ccxt
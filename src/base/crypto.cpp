@@ -0,0 +1,307 @@
+#include "ccxt/base/crypto.h"
+#include "ccxt/base/errors.h"
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <openssl/core_names.h>
+#include <openssl/evp.h>
+#include <openssl/params.h>
+
+namespace ccxt {
+
+namespace {
+
+// Two output characters per input byte
+constexpr std::array<char, 512> makeHexTable() {
+    constexpr char digits[] = "0123456789abcdef";
+    std::array<char, 512> table{};
+    for (int i = 0; i < 256; ++i) {
+        table[2 * i] = digits[i >> 4];
+        table[2 * i + 1] = digits[i & 15];
+    }
+    return table;
+}
+
+constexpr std::array<char, 512> hexTable = makeHexTable();
+
+constexpr char base64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+constexpr char base64UrlAlphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+// Sextet of each character of either alphabet, 0xFF for anything else
+constexpr std::array<unsigned char, 256> makeBase64Table() {
+    std::array<unsigned char, 256> table{};
+    for (auto& value : table) {
+        value = 0xFF;
+    }
+    for (unsigned char i = 0; i < 64; ++i) {
+        table[static_cast<unsigned char>(base64Alphabet[i])] = i;
+        table[static_cast<unsigned char>(base64UrlAlphabet[i])] = i;
+    }
+    return table;
+}
+
+constexpr std::array<unsigned char, 256> base64Table = makeBase64Table();
+
+char* encodeBase64(const unsigned char* data, std::size_t size, char* out, const char* alphabet, bool padding) {
+    std::size_t i = 0;
+    for (; i + 3 <= size; i += 3) {
+        unsigned group = (data[i] << 16) | (data[i + 1] << 8) | data[i + 2];
+        *out++ = alphabet[group >> 18];
+        *out++ = alphabet[(group >> 12) & 63];
+        *out++ = alphabet[(group >> 6) & 63];
+        *out++ = alphabet[group & 63];
+    }
+    if (std::size_t rest = size - i) {
+        unsigned group = (data[i] << 16) | (rest == 2 ? data[i + 1] << 8 : 0);
+        *out++ = alphabet[group >> 18];
+        *out++ = alphabet[(group >> 12) & 63];
+        if (rest == 2) {
+            *out++ = alphabet[(group >> 6) & 63];
+        }
+        if (padding) {
+            *out++ = '=';
+            if (rest == 1) {
+                *out++ = '=';
+            }
+        }
+    }
+    return out;
+}
+
+constexpr std::uint64_t keccakRoundConstants[24] = {
+    0x0000000000000001, 0x0000000000008082, 0x800000000000808a, 0x8000000080008000,
+    0x000000000000808b, 0x0000000080000001, 0x8000000080008081, 0x8000000000008009,
+    0x000000000000008a, 0x0000000000000088, 0x0000000080008009, 0x000000008000000a,
+    0x000000008000808b, 0x800000000000008b, 0x8000000000008089, 0x8000000000008003,
+    0x8000000000008002, 0x8000000000000080, 0x000000000000800a, 0x800000008000000a,
+    0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008
+};
+constexpr int keccakRotations[24] = {1, 3, 6, 10, 15, 21, 28, 36, 45, 55, 2, 14, 27, 41, 56, 8, 25, 43, 62, 18, 39, 61, 20, 44};
+constexpr int keccakLanes[24] = {10, 7, 11, 17, 18, 3, 5, 16, 8, 21, 24, 4, 15, 23, 19, 13, 12, 2, 20, 14, 22, 9, 6, 1};
+
+std::uint64_t rotateLeft(std::uint64_t value, int shift) {
+    return (value << shift) | (value >> (64 - shift));
+}
+
+void keccakPermute(std::uint64_t state[25]) {
+    for (std::uint64_t roundConstant : keccakRoundConstants) {
+        std::uint64_t columns[5];
+        for (int i = 0; i < 5; ++i) {
+            columns[i] = state[i] ^ state[i + 5] ^ state[i + 10] ^ state[i + 15] ^ state[i + 20];
+        }
+        for (int i = 0; i < 5; ++i) {
+            std::uint64_t theta = columns[(i + 4) % 5] ^ rotateLeft(columns[(i + 1) % 5], 1);
+            for (int j = 0; j < 25; j += 5) {
+                state[j + i] ^= theta;
+            }
+        }
+        std::uint64_t carried = state[1];
+        for (int i = 0; i < 24; ++i) {
+            std::uint64_t next = state[keccakLanes[i]];
+            state[keccakLanes[i]] = rotateLeft(carried, keccakRotations[i]);
+            carried = next;
+        }
+        for (int j = 0; j < 25; j += 5) {
+            std::uint64_t row[5];
+            std::memcpy(row, state + j, sizeof(row));
+            for (int i = 0; i < 5; ++i) {
+                state[j + i] = row[i] ^ (~row[(i + 1) % 5] & row[(i + 2) % 5]);
+            }
+        }
+        state[0] ^= roundConstant;
+    }
+}
+
+// Lanes are little-endian
+void keccakAbsorb(std::uint64_t state[25], const unsigned char* block, std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+        state[i / 8] ^= std::uint64_t(block[i]) << (8 * (i % 8));
+    }
+}
+
+int hexDigit(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+const unsigned char* bytes(std::string_view text) {
+    return reinterpret_cast<const unsigned char*>(text.data());
+}
+
+const char* digestName(HashAlgorithm algorithm) {
+    switch (algorithm) {
+        case HashAlgorithm::Sha1: return "SHA1";
+        case HashAlgorithm::Sha256: return "SHA256";
+        case HashAlgorithm::Sha384: return "SHA384";
+        case HashAlgorithm::Sha512: return "SHA512";
+        case HashAlgorithm::Md5: return "MD5";
+    }
+    return "SHA256";
+}
+
+} // namespace
+
+char* hexEncode(const unsigned char* data, std::size_t size, char* out) {
+    for (std::size_t i = 0; i < size; ++i) {
+        const char* pair = &hexTable[2 * data[i]];
+        *out++ = pair[0];
+        *out++ = pair[1];
+    }
+    return out;
+}
+
+std::string hexEncode(std::string_view bytes) {
+    std::string result(bytes.size() * 2, '\0');
+    hexEncode(reinterpret_cast<const unsigned char*>(bytes.data()), bytes.size(), result.data());
+    return result;
+}
+
+std::string hexDecode(std::string_view text) {
+    if (text.size() >= 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X')) {
+        text.remove_prefix(2);
+    }
+    if (text.size() % 2) {
+        throw std::invalid_argument("hexDecode: odd number of digits");
+    }
+    std::string result(text.size() / 2, '\0');
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        int high = hexDigit(text[2 * i]);
+        int low = hexDigit(text[2 * i + 1]);
+        if (high < 0 || low < 0) {
+            throw std::invalid_argument("hexDecode: invalid character");
+        }
+        result[i] = static_cast<char>(high << 4 | low);
+    }
+    return result;
+}
+
+char* base64Encode(const unsigned char* data, std::size_t size, char* out) {
+    return encodeBase64(data, size, out, base64Alphabet, true);
+}
+
+char* base64UrlEncode(const unsigned char* data, std::size_t size, char* out) {
+    return encodeBase64(data, size, out, base64UrlAlphabet, false);
+}
+
+std::string base64Encode(std::string_view text) {
+    std::string result(base64EncodedSize(text.size()), '\0');
+    base64Encode(bytes(text), text.size(), result.data());
+    return result;
+}
+
+std::string base64UrlEncode(std::string_view text) {
+    std::string result(base64EncodedSize(text.size(), false), '\0');
+    base64UrlEncode(bytes(text), text.size(), result.data());
+    return result;
+}
+
+std::string base64Decode(std::string_view text) {
+    while (!text.empty() && text.back() == '=') {
+        text.remove_suffix(1);
+    }
+    if (text.size() % 4 == 1) {
+        throw std::invalid_argument("base64Decode: truncated input");
+    }
+    std::string result;
+    result.reserve(text.size() * 3 / 4);
+    unsigned group = 0;
+    int bits = 0;
+    for (char c : text) {
+        unsigned char sextet = base64Table[static_cast<unsigned char>(c)];
+        if (sextet == 0xFF) {
+            throw std::invalid_argument("base64Decode: invalid character");
+        }
+        group = (group << 6) | sextet;
+        bits += 6;
+        if (bits >= 8) {
+            bits -= 8;
+            result += static_cast<char>((group >> bits) & 0xFF);
+        }
+    }
+    return result;
+}
+
+HashAlgorithm hashAlgorithm(std::string_view name) {
+    if (name == "sha256") return HashAlgorithm::Sha256;
+    if (name == "sha512") return HashAlgorithm::Sha512;
+    if (name == "sha384") return HashAlgorithm::Sha384;
+    if (name == "sha1") return HashAlgorithm::Sha1;
+    if (name == "md5") return HashAlgorithm::Md5;
+    throw NotSupported("Unsupported hash algorithm: " + std::string(name));
+}
+
+std::array<unsigned char, 32> keccak256(std::string_view data) {
+    constexpr std::size_t rate = 136;
+    std::uint64_t state[25] = {};
+    for (; data.size() >= rate; data.remove_prefix(rate)) {
+        keccakAbsorb(state, bytes(data), rate);
+        keccakPermute(state);
+    }
+    unsigned char last[rate] = {};
+    std::memcpy(last, data.data(), data.size());
+    last[data.size()] ^= 0x01;
+    last[rate - 1] ^= 0x80;
+    keccakAbsorb(state, last, rate);
+    keccakPermute(state);
+
+    std::array<unsigned char, 32> digest;
+    for (std::size_t i = 0; i < digest.size(); ++i) {
+        digest[i] = static_cast<unsigned char>(state[i / 8] >> (8 * (i % 8)));
+    }
+    return digest;
+}
+
+HmacKey::HmacKey(HashAlgorithm algorithm, std::string_view secret) : algorithm_(algorithm) {
+    EVP_MAC* mac = EVP_MAC_fetch(nullptr, "HMAC", nullptr);
+    if (!mac) {
+        throw ExchangeError("HMAC is not available");
+    }
+    context_ = EVP_MAC_CTX_new(mac);
+    EVP_MAC_free(mac);
+    OSSL_PARAM params[] = {
+        OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, const_cast<char*>(digestName(algorithm)), 0),
+        OSSL_PARAM_construct_end()
+    };
+    if (!context_ || !EVP_MAC_init(context_, bytes(secret), secret.size(), params)) {
+        EVP_MAC_CTX_free(context_);
+        throw ExchangeError("HMAC initialization failed");
+    }
+    digestSize_ = EVP_MAC_CTX_get_mac_size(context_);
+}
+
+HmacKey::~HmacKey() {
+    EVP_MAC_CTX_free(context_);
+}
+
+std::size_t HmacKey::sign(std::string_view message, unsigned char* out) const {
+    EVP_MAC_CTX* context = EVP_MAC_CTX_dup(context_);
+    std::size_t size = 0;
+    bool ok = context && EVP_MAC_update(context, bytes(message), message.size()) &&
+              EVP_MAC_final(context, out, &size, maxDigestSize);
+    EVP_MAC_CTX_free(context);
+    if (!ok) {
+        throw ExchangeError("HMAC failed");
+    }
+    return size;
+}
+
+std::string HmacKey::hex(std::string_view message) const {
+    unsigned char digest[maxDigestSize];
+    std::size_t size = sign(message, digest);
+    std::string result(size * 2, '\0');
+    hexEncode(digest, size, result.data());
+    return result;
+}
+
+std::string HmacKey::base64(std::string_view message) const {
+    unsigned char digest[maxDigestSize];
+    std::size_t size = sign(message, digest);
+    std::string result(base64EncodedSize(size), '\0');
+    base64Encode(digest, size, result.data());
+    return result;
+}
+
+} // namespace ccxt
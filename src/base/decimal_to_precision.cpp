@@ -0,0 +1,163 @@
+#include "ccxt/base/decimal_to_precision.h"
+#include <charconv>
+#include <cmath>
+#include <stdexcept>
+
+namespace ccxt {
+
+namespace {
+
+using Integer = Precise::Integer;
+
+constexpr int maxDigits = 38;
+
+Integer power10(int digits) {
+    Integer result = 1;
+    for (int i = 0; i < digits; ++i) {
+        result *= 10;
+    }
+    return result;
+}
+
+int digitCount(Integer value) {
+    int count = 1;
+    for (value = value < 0 ? -value : value; value >= 10; value /= 10) {
+        ++count;
+    }
+    return count;
+}
+
+// value rounded to a multiple of 10^-scale
+Precise roundToScale(const Precise& value, RoundingMode rounding, int scale) {
+    int drop = value.decimals() - scale;
+    if (drop <= 0) {
+        return value;
+    }
+    if (drop > maxDigits) {
+        // Every significant digit is below the last kept place
+        return Precise(Integer(0), 0);
+    }
+    Integer divisor = power10(drop);
+    Integer quotient = value.integer() / divisor;
+    Integer remainder = value.integer() % divisor;
+    if (rounding == RoundingMode::Round) {
+        Integer magnitude = remainder < 0 ? -remainder : remainder;
+        // Half away from zero, as ccxt's ROUND
+        if (magnitude >= divisor - magnitude) {
+            quotient += value.integer() < 0 ? -1 : 1;
+        }
+    }
+    return Precise(quotient, scale);
+}
+
+Precise roundToTick(const Precise& value, RoundingMode rounding, const Precise& tick) {
+    if (tick.integer() <= 0) {
+        throw std::invalid_argument("decimalToPrecision: tick size must be positive");
+    }
+    Precise remainder = value.mod(tick);
+    Precise truncated = value.sub(remainder);
+    if (rounding == RoundingMode::Round && remainder.integer() != 0) {
+        Precise twice = remainder.add(remainder);
+        bool negative = remainder.integer() < 0;
+        if (negative ? !twice.gt(Precise(-tick.integer(), tick.decimals())) : twice.ge(tick)) {
+            return negative ? truncated.sub(tick) : truncated.add(tick);
+        }
+    }
+    return truncated;
+}
+
+} // namespace
+
+PrecisionRule PrecisionRule::decimalPlaces(int digits, PaddingMode padding) {
+    PrecisionRule rule;
+    rule.counting = CountingMode::DecimalPlaces;
+    rule.digits = digits;
+    rule.padding = padding;
+    return rule;
+}
+
+PrecisionRule PrecisionRule::significantDigits(int digits, PaddingMode padding) {
+    PrecisionRule rule;
+    rule.counting = CountingMode::SignificantDigits;
+    rule.digits = digits;
+    rule.padding = padding;
+    return rule;
+}
+
+PrecisionRule PrecisionRule::tickSize(const Precise& tick, PaddingMode padding) {
+    PrecisionRule rule;
+    rule.counting = CountingMode::TickSize;
+    rule.tick = tick;
+    rule.digits = tick.decimals();
+    rule.padding = padding;
+    return rule;
+}
+
+Precise decimalToPrecision(const Precise& value, RoundingMode rounding, const PrecisionRule& rule) {
+    switch (rule.counting) {
+        case CountingMode::DecimalPlaces:
+            return roundToScale(value, rounding, rule.digits);
+        case CountingMode::SignificantDigits: {
+            if (value.integer() == 0) {
+                return value;
+            }
+            if (rule.digits <= 0) {
+                throw std::invalid_argument("decimalToPrecision: significant digits must be positive");
+            }
+            // Exponent of the leading digit is digitCount - decimals - 1
+            int scale = rule.digits - digitCount(value.integer()) + value.decimals();
+            Precise rounded = roundToScale(value, rounding, scale);
+            // 9.99 -> 10.0 gains a digit; one more pass trims it
+            return roundToScale(rounded, rounding, rule.digits - digitCount(rounded.integer()) + rounded.decimals());
+        }
+        case CountingMode::TickSize:
+            return roundToTick(value, rounding, rule.tick);
+    }
+    return value;
+}
+
+char* decimalToPrecision(char* first, char* last, const Precise& value, RoundingMode rounding, const PrecisionRule& rule) {
+    Precise rounded = decimalToPrecision(value, rounding, rule);
+    char* end = rounded.toChars(first, last);
+    if (!end || rule.padding == PaddingMode::NoPadding) {
+        return end;
+    }
+    int decimals = rule.digits;
+    if (rule.counting == CountingMode::SignificantDigits) {
+        decimals = rule.digits - digitCount(rounded.integer()) + rounded.decimals();
+    }
+    if (decimals <= rounded.decimals()) {
+        return end;
+    }
+    int pad = decimals - rounded.decimals();
+    if (last - end < pad + (rounded.decimals() == 0)) {
+        return nullptr;
+    }
+    if (rounded.decimals() == 0) {
+        *end++ = '.';
+    }
+    for (int i = 0; i < pad; ++i) {
+        *end++ = '0';
+    }
+    return end;
+}
+
+char* decimalToPrecision(char* first, char* last, double value, RoundingMode rounding, const PrecisionRule& rule) {
+    if (!std::isfinite(value)) {
+        throw std::invalid_argument("decimalToPrecision: non-finite number");
+    }
+    char shortest[32];
+    auto result = std::to_chars(shortest, shortest + sizeof(shortest), value);
+    return decimalToPrecision(first, last, Precise(std::string_view(shortest, result.ptr - shortest)), rounding, rule);
+}
+
+std::string decimalToPrecision(double value, RoundingMode rounding, const PrecisionRule& rule) {
+    char buffer[128];
+    char* end = decimalToPrecision(buffer, buffer + sizeof(buffer), value, rounding, rule);
+    if (!end) {
+        throw std::length_error("decimalToPrecision: formatted value is too long");
+    }
+    return std::string(buffer, end);
+}
+
+} // namespace ccxt
@@ -0,0 +1,129 @@
+#include "ccxt/base/descriptor.h"
+#include "ccxt/base/errors.h"
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace ccxt {
+
+namespace {
+
+using json = nlohmann::json;
+
+// Collects the top-level keys of an object without building a DOM
+class TopLevelKeys : public nlohmann::json_sax<json> {
+public:
+    explicit TopLevelKeys(std::vector<std::string>& keys) : keys_(keys) {}
+
+    bool null() override { return true; }
+    bool boolean(bool) override { return true; }
+    bool number_integer(number_integer_t) override { return true; }
+    bool number_unsigned(number_unsigned_t) override { return true; }
+    bool number_float(number_float_t, const string_t&) override { return true; }
+    bool string(string_t&) override { return true; }
+    bool binary(binary_t&) override { return true; }
+    bool start_object(std::size_t) override { ++depth_; return true; }
+    bool end_object() override { --depth_; return true; }
+    bool start_array(std::size_t) override { ++depth_; return true; }
+    bool end_array() override { --depth_; return true; }
+    bool key(string_t& value) override {
+        if (depth_ == 1) {
+            keys_.push_back(value);
+        }
+        return true;
+    }
+    bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& e) override {
+        throw BadResponse(std::string("invalid exchange descriptor: ") + e.what());
+    }
+
+private:
+    std::vector<std::string>& keys_;
+    int depth_ = 0;
+};
+
+std::mutex cacheMutex;
+std::map<std::string, std::shared_ptr<const Descriptor>> cache;
+
+} // namespace
+
+std::string Descriptor::resolve(const std::string& filename) {
+    namespace fs = std::filesystem;
+    std::error_code ec;
+    fs::path path(filename);
+    if (path.is_absolute() || fs::exists(path, ec)) {
+        return fs::weakly_canonical(path, ec).string();
+    }
+    std::vector<fs::path> roots;
+    if (const char* dir = std::getenv("CCXT_CONFIG_DIR")) {
+        roots.emplace_back(dir);
+    }
+#ifdef CCXT_CONFIG_DIR
+    roots.emplace_back(CCXT_CONFIG_DIR);
+#endif
+    for (const auto& root : roots) {
+        fs::path candidate = root / path.filename();
+        if (fs::exists(candidate, ec)) {
+            return fs::weakly_canonical(candidate, ec).string();
+        }
+    }
+    return filename;
+}
+
+std::shared_ptr<const Descriptor> Descriptor::load(const std::string& filename) {
+    std::string path = resolve(filename);
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    auto it = cache.find(path);
+    if (it != cache.end()) {
+        return it->second;
+    }
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        throw Error("cannot open exchange descriptor " + filename);
+    }
+    std::ostringstream source;
+    source << file.rdbuf();
+    auto descriptor = std::make_shared<const Descriptor>(source.str(), path);
+    cache.emplace(path, descriptor);
+    return descriptor;
+}
+
+Descriptor::Descriptor(std::string source, std::string path)
+    : source_(std::move(source)), path_(std::move(path)) {
+    TopLevelKeys scanner(keys_);
+    json::sax_parse(source_, &scanner);
+}
+
+bool Descriptor::contains(const std::string& section) const {
+    for (const auto& key : keys_) {
+        if (key == section) {
+            return true;
+        }
+    }
+    return false;
+}
+
+const json& Descriptor::operator[](const std::string& section) const {
+    static const json missing;
+    if (!contains(section)) {
+        return missing;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& slot = sections_[section];
+    if (!slot) {
+        // Keep only the requested top-level key; every other subtree is skipped
+        json::parser_callback_t keep = [&section](int depth, json::parse_event_t event, json& parsed) {
+            return !(depth == 1 && event == json::parse_event_t::key && parsed != section);
+        };
+        json filtered = json::parse(source_, keep);
+        slot = std::make_unique<json>(std::move(filtered[section]));
+    }
+    return *slot;
+}
+
+std::size_t Descriptor::loadedSections() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return sections_.size();
+}
+
+} // namespace ccxt
@@ -0,0 +1,19 @@
+#include "ccxt/base/descriptor_tables.h"
+#include <algorithm>
+#include <tuple>
+
+namespace ccxt {
+
+const EndpointEntry* ExchangeTable::findEndpoint(std::string_view api, std::string_view method, std::string_view path) const {
+    auto key = std::make_tuple(api, method, path);
+    auto end = endpoints + endpointCount;
+    auto it = std::lower_bound(endpoints, end, key, [](const EndpointEntry& entry, const auto& value) {
+        return std::tie(entry.api, entry.method, entry.path) < value;
+    });
+    if (it == end || std::tie(it->api, it->method, it->path) != key) {
+        return nullptr;
+    }
+    return it;
+}
+
+} // namespace ccxt
@@ -1,13 +1,17 @@
 #include "ccxt/base/exchange.h"
 #include "ccxt/base/errors.h"
+#include "ccxt/base/http_client.h"
+#include "ccxt/base/executor.h"
+#include "ccxt/base/number.h"
+#include <thread>
+#include <algorithm>
+#include <cstdlib>
 #include <chrono>
 #include <random>
 #include <sstream>
 #include <iomanip>
-#include <regex>
 #include <openssl/hmac.h>
 #include <openssl/sha.h>
-#include <curl/curl.h>
 #include <iostream>
 #include <map>
 #include <string>
@@ -15,23 +19,31 @@
 #include <optional>
 #include <stdexcept>
 #include <future>
-#include <boost/beast/version.hpp>
-#include <boost/beast/core.hpp>
-#include <boost/beast/http.hpp>
-#include <boost/asio/ip/tcp.hpp>
-#include <boost/asio/ssl/error.hpp>
-#include <boost/asio/ssl/stream.hpp>
-#include <boost/coroutine2/coroutine.hpp>
 
 
 namespace ccxt {
 
-Exchange::Exchange(boost::asio::io_context& context, const Config& config) : ExchangeBase(context, config) {
+Exchange::Exchange(boost::asio::io_context& context, const Config& config)
+    : ExchangeBase(context, config),
+      markets_(std::make_shared<const MarketRegistry>()) {
     rateLimit= 2000;
     pro = false;
     certified = false;
     lastRestRequestTimestamp = 0;
-    curl_ = curl_easy_init();
+    if (config_.maxConnectionsPerHost > 0) {
+        HttpClient::instance().raiseMaxConnectionsPerHost(config_.maxConnectionsPerHost);
+    }
+    if (config_.executorThreads > 0 || config_.executorQueueCapacity > 0) {
+        Executor::Options options;
+        if (config_.executorThreads > 0) {
+            options.threads = config_.executorThreads;
+        }
+        if (config_.executorQueueCapacity > 0) {
+            options.queueCapacity = config_.executorQueueCapacity;
+        }
+        // Only the first configuration before the executor starts takes effect
+        Executor::configure(options);
+    }
     init();
 }
 
@@ -43,47 +55,6 @@ void Exchange::describe() const {
     
 }
 
-AsyncPullType Exchange::performHttpRequest(const std::string& host, const std::string& target, const std::string& method) {
-            return AsyncPullType(
-            [this, host, target, method](boost::coroutines2::coroutine<json>::push_type& yield) {
-                try {
-                    boost::asio::ip::tcp::resolver resolver(context_);
-                    boost::beast::tcp_stream stream(context_);
-
-                    auto const results = resolver.resolve(host, "443");
-                    stream.connect(results);
-
-                    boost::beast::http::request<boost::beast::http::string_body> req{
-                        boost::beast::http::string_to_verb(method), target, 11};
-                    req.set(boost::beast::http::field::host, host);
-                    req.set(boost::beast::http::field::user_agent, BOOST_BEAST_VERSION_STRING);
-
-                    boost::beast::http::write(stream, req);
-
-                    boost::beast::flat_buffer buffer;
-                    boost::beast::http::response<boost::beast::http::dynamic_body> res;
-
-                    boost::beast::http::read(stream, buffer, res);
-
-                    auto body = boost::beast::buffers_to_string(res.body().data());
-                    json response = json::parse(body);
-
-                    yield(response);
-
-                    boost::beast::error_code ec;
-                    stream.socket().shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
-
-                    if (ec && ec != boost::beast::errc::not_connected)
-                        throw boost::beast::system_error{ec};
-
-                } catch (const std::exception& e) {
-                    // Handle exceptions
-                    throw;
-                }
-            });
-           
-}
-
 // Synchronous REST API methods
 json Exchange::fetchMarkets(const json& params) {
     return json::object();
@@ -139,205 +110,410 @@ json Exchange::fetchClosedOrders(const std::string& symbol, int since, int limit
     return json::object();
 }
 
+// Typed market data
+void Exchange::fetchTickerTyped(const std::string& symbol, Ticker& ticker) {
+    throw NotSupported(id + " does not support fetchTickerTyped()");
+}
+
+void Exchange::fetchOrderBookTyped(const std::string& symbol, OrderBook& orderBook, int limit) {
+    throw NotSupported(id + " does not support fetchOrderBookTyped()");
+}
+
+void Exchange::fetchTradesTyped(const std::string& symbol, std::vector<Trade>& trades, int since, int limit) {
+    throw NotSupported(id + " does not support fetchTradesTyped()");
+}
+
+void Exchange::parseTickerInto(std::string_view body, const Market& market, Ticker& ticker) const {
+    throw NotSupported(id + " does not support parseTickerInto()");
+}
+
+void Exchange::parseOrderBookInto(std::string_view body, const Market& market, OrderBook& orderBook) const {
+    throw NotSupported(id + " does not support parseOrderBookInto()");
+}
+
+void Exchange::parseTradesInto(std::string_view body, const Market& market, std::vector<Trade>& trades) const {
+    throw NotSupported(id + " does not support parseTradesInto()");
+}
+
 // Asynchronous REST API methods
-AsyncPullType Exchange::fetchMarketsAsync(const json& params) {
-    return AsyncPullType(
-        [this](boost::coroutines2::coroutine<json>::push_type& yield) {
-            try {
-                // Call the synchronous fetchOrder method
-                
-                yield(json::object()); // Yield the result to the caller
-            } catch (const std::exception& e) {
-                // Handle exceptions and yield an error response if needed
-                throw; // or yield an error response
-            }
-        });
+void Exchange::fetchMarketsAsync(const json& params, FetchHandler handler) {
+    deliver(std::move(handler), [&]() { return fetchMarketsRequest(params); },
+            [this, params]() { return fetchMarkets(params); });
 }
 
-AsyncPullType Exchange::fetchTickerAsync(const std::string& symbol, const json& params) {
-    return AsyncPullType(
-        [this, symbol, params](boost::coroutines2::coroutine<json>::push_type& yield) {
-            try {
-                // Call the synchronous fetchOrder method
-                
-                yield(json::object()); // Yield the result to the caller
-            } catch (const std::exception& e) {
-                // Handle exceptions and yield an error response if needed
-                throw; // or yield an error response
-            }
-        });
+void Exchange::fetchTickerAsync(const std::string& symbol, const json& params, FetchHandler handler) {
+    deliver(std::move(handler), [&]() { return fetchTickerRequest(symbol, params); },
+            [this, symbol, params]() { return fetchTicker(symbol, params); });
 }
 
-AsyncPullType Exchange::fetchTickersAsync(const std::vector<std::string>& symbols, const json& params) {
-    return AsyncPullType(
-        [this](boost::coroutines2::coroutine<json>::push_type& yield) {
-            try {
-                // Call the synchronous fetchOrder method
-                
-                yield(json::object()); // Yield the result to the caller
-            } catch (const std::exception& e) {
-                // Handle exceptions and yield an error response if needed
-                throw; // or yield an error response
-            }
-        });
+void Exchange::fetchTickersAsync(const std::vector<std::string>& symbols, const json& params, FetchHandler handler) {
+    deliver(std::move(handler), [&]() { return fetchTickersRequest(symbols, params); },
+            [this, symbols, params]() { return fetchTickers(symbols, params); });
 }
 
-AsyncPullType Exchange::fetchOrderBookAsync(const std::string& symbol, int limit, const json& params) {
-    return AsyncPullType(
-        [this](boost::coroutines2::coroutine<json>::push_type& yield) {
-            try {
-                // Call the synchronous fetchOrder method
-                
-                yield(json::object()); // Yield the result to the caller
-            } catch (const std::exception& e) {
-                // Handle exceptions and yield an error response if needed
-                throw; // or yield an error response
-            }
-        });
+void Exchange::fetchOrderBookAsync(const std::string& symbol, int limit, const json& params, FetchHandler handler) {
+    deliver(std::move(handler), [&]() { return fetchOrderBookRequest(symbol, limit, params); },
+            [this, symbol, limit, params]() { return fetchOrderBook(symbol, limit, params); });
 }
 
-AsyncPullType Exchange::fetchTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return AsyncPullType(
-        [this](boost::coroutines2::coroutine<json>::push_type& yield) {
-            try {
-                // Call the synchronous fetchOrder method
-                
-                yield(json::object()); // Yield the result to the caller
-            } catch (const std::exception& e) {
-                // Handle exceptions and yield an error response if needed
-                throw; // or yield an error response
-            }
-        });
+void Exchange::fetchTradesAsync(const std::string& symbol, int since, int limit, const json& params, FetchHandler handler) {
+    deliver(std::move(handler), [&]() { return fetchTradesRequest(symbol, since, limit, params); },
+            [this, symbol, since, limit, params]() { return fetchTrades(symbol, since, limit, params); });
 }
 
-AsyncPullType Exchange::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe,
-                                         int since, int limit, const json& params) {
-    return AsyncPullType(
-        [this](boost::coroutines2::coroutine<json>::push_type& yield) {
-            try {
-                // Call the synchronous fetchOrder method
-                
-                yield(json::object()); // Yield the result to the caller
-            } catch (const std::exception& e) {
-                // Handle exceptions and yield an error response if needed
-                throw; // or yield an error response
-            }
-        });
+void Exchange::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe,
+                               int since, int limit, const json& params, FetchHandler handler) {
+    deliver(std::move(handler), [&]() { return fetchOHLCVRequest(symbol, timeframe, since, limit, params); },
+            [this, symbol, timeframe, since, limit, params]() {
+                return fetchOHLCV(symbol, timeframe, since, limit, params);
+            });
 }
 
-AsyncPullType Exchange::fetchBalanceAsync(const json& params) {
-    return AsyncPullType(
-        [this](boost::coroutines2::coroutine<json>::push_type& yield) {
-            try {
-                // Call the synchronous fetchOrder method
-                
-                yield(json::object()); // Yield the result to the caller
-            } catch (const std::exception& e) {
-                // Handle exceptions and yield an error response if needed
-                throw; // or yield an error response
-            }
-        });
+void Exchange::fetchBalanceAsync(const json& params, FetchHandler handler) {
+    deliver(std::move(handler), [&]() { return fetchBalanceRequest(params); },
+            [this, params]() { return fetchBalance(params); });
 }
 
-AsyncPullType Exchange::createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
-                                         double amount, double price, const json& params) {
-    return AsyncPullType(
-        [this](boost::coroutines2::coroutine<json>::push_type& yield) {
-            try {
-                // Call the synchronous fetchOrder method
-                
-                yield(json::object()); // Yield the result to the caller
-            } catch (const std::exception& e) {
-                // Handle exceptions and yield an error response if needed
-                throw; // or yield an error response
-            }
-        });
+void Exchange::createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
+                                double amount, double price, const json& params, FetchHandler handler) {
+    deliver(std::move(handler), [&]() { return createOrderRequest(symbol, type, side, amount, price, params); },
+            [this, symbol, type, side, amount, price, params]() {
+                return createOrder(symbol, type, side, amount, price, params);
+            });
 }
 
-AsyncPullType Exchange::cancelOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
-    return AsyncPullType(
-        [this](boost::coroutines2::coroutine<json>::push_type& yield) {
-            try {
-                // Call the synchronous fetchOrder method
-                
-                yield(json::object()); // Yield the result to the caller
-            } catch (const std::exception& e) {
-                // Handle exceptions and yield an error response if needed
-                throw; // or yield an error response
-            }
-        });
+void Exchange::cancelOrderAsync(const std::string& id, const std::string& symbol, const json& params, FetchHandler handler) {
+    deliver(std::move(handler), [&]() { return cancelOrderRequest(id, symbol, params); },
+            [this, id, symbol, params]() { return cancelOrder(id, symbol, params); });
 }
 
-AsyncPullType Exchange::fetchOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
-    return AsyncPullType(
-        [this](boost::coroutines2::coroutine<json>::push_type& yield) {
-            try {
-                // Call the synchronous fetchOrder method
-                
-                yield(json::object()); // Yield the result to the caller
-            } catch (const std::exception& e) {
-                // Handle exceptions and yield an error response if needed
-                throw; // or yield an error response
-            }
-        });
+void Exchange::fetchOrderAsync(const std::string& id, const std::string& symbol, const json& params, FetchHandler handler) {
+    deliver(std::move(handler), [&]() { return fetchOrderRequest(id, symbol, params); },
+            [this, id, symbol, params]() { return fetchOrder(id, symbol, params); });
 }
 
-AsyncPullType Exchange::fetchOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return AsyncPullType(
-        [this](boost::coroutines2::coroutine<json>::push_type& yield) {
-            try {
-                // Call the synchronous fetchOrder method
-                
-                yield(json::object()); // Yield the result to the caller
-            } catch (const std::exception& e) {
-                // Handle exceptions and yield an error response if needed
-                throw; // or yield an error response
-            }
+void Exchange::fetchOrdersAsync(const std::string& symbol, int since, int limit, const json& params, FetchHandler handler) {
+    deliver(std::move(handler), [&]() { return fetchOrdersRequest(symbol, since, limit, params); },
+            [this, symbol, since, limit, params]() { return fetchOrders(symbol, since, limit, params); });
+}
+
+void Exchange::fetchOpenOrdersAsync(const std::string& symbol, int since, int limit, const json& params, FetchHandler handler) {
+    deliver(std::move(handler), [&]() { return fetchOpenOrdersRequest(symbol, since, limit, params); },
+            [this, symbol, since, limit, params]() { return fetchOpenOrders(symbol, since, limit, params); });
+}
+
+void Exchange::fetchClosedOrdersAsync(const std::string& symbol, int since, int limit, const json& params, FetchHandler handler) {
+    deliver(std::move(handler), [&]() { return fetchClosedOrdersRequest(symbol, since, limit, params); },
+            [this, symbol, since, limit, params]() { return fetchClosedOrders(symbol, since, limit, params); });
+}
+
+// No request builders by default: the *Async methods fall back to the executor
+std::optional<Exchange::AsyncRequest> Exchange::fetchMarketsRequest(const json& params) {
+    return std::nullopt;
+}
+
+std::optional<Exchange::AsyncRequest> Exchange::fetchTickerRequest(const std::string& symbol, const json& params) {
+    return std::nullopt;
+}
+
+std::optional<Exchange::AsyncRequest> Exchange::fetchTickersRequest(const std::vector<std::string>& symbols,
+                                                                    const json& params) {
+    return std::nullopt;
+}
+
+std::optional<Exchange::AsyncRequest> Exchange::fetchOrderBookRequest(const std::string& symbol, int limit,
+                                                                      const json& params) {
+    return std::nullopt;
+}
+
+std::optional<Exchange::AsyncRequest> Exchange::fetchTradesRequest(const std::string& symbol, int since, int limit,
+                                                                   const json& params) {
+    return std::nullopt;
+}
+
+std::optional<Exchange::AsyncRequest> Exchange::fetchOHLCVRequest(const std::string& symbol, const std::string& timeframe,
+                                                                  int since, int limit, const json& params) {
+    return std::nullopt;
+}
+
+std::optional<Exchange::AsyncRequest> Exchange::fetchBalanceRequest(const json& params) {
+    return std::nullopt;
+}
+
+std::optional<Exchange::AsyncRequest> Exchange::createOrderRequest(const std::string& symbol, const std::string& type,
+                                                                   const std::string& side, double amount, double price,
+                                                                   const json& params) {
+    return std::nullopt;
+}
+
+std::optional<Exchange::AsyncRequest> Exchange::cancelOrderRequest(const std::string& id, const std::string& symbol,
+                                                                   const json& params) {
+    return std::nullopt;
+}
+
+std::optional<Exchange::AsyncRequest> Exchange::fetchOrderRequest(const std::string& id, const std::string& symbol,
+                                                                  const json& params) {
+    return std::nullopt;
+}
+
+std::optional<Exchange::AsyncRequest> Exchange::fetchOrdersRequest(const std::string& symbol, int since, int limit,
+                                                                   const json& params) {
+    return std::nullopt;
+}
+
+std::optional<Exchange::AsyncRequest> Exchange::fetchOpenOrdersRequest(const std::string& symbol, int since, int limit,
+                                                                       const json& params) {
+    return std::nullopt;
+}
+
+std::optional<Exchange::AsyncRequest> Exchange::fetchClosedOrdersRequest(const std::string& symbol, int since, int limit,
+                                                                         const json& params) {
+    return std::nullopt;
+}
+
+void Exchange::deliver(FetchHandler handler, const std::function<std::optional<AsyncRequest>()>& build,
+                       std::function<json()> call) {
+    std::optional<AsyncRequest> request;
+    try {
+        request = build();
+    } catch (...) {
+        boost::asio::post(context_, [handler = std::move(handler), error = std::current_exception()]() {
+            handler(error, json());
+        });
+        return;
+    }
+    if (request) {
+        fetchAsyncImpl(request->url, request->method, request->headers, request->body, request->cost,
+            [handler = std::move(handler), parse = std::move(request->parse)](std::exception_ptr error, json result) {
+                if (error || !parse) {
+                    handler(error, std::move(result));
+                    return;
+                }
+                json parsed;
+                try {
+                    parsed = parse(result);
+                } catch (...) {
+                    handler(std::current_exception(), json());
+                    return;
+                }
+                handler(nullptr, std::move(parsed));
+            });
+        return;
+    }
+    // The synchronous method blocks on the transport and the rate limiter, so
+    // it runs on the executor; the work guard keeps context_.run() alive until
+    // the result is posted back
+    auto work = boost::asio::make_work_guard(context_);
+    std::function<void()> task = [this, work, handler, call = std::move(call)]() {
+        json result;
+        std::exception_ptr error;
+        try {
+            result = call();
+        } catch (...) {
+            error = std::current_exception();
+        }
+        boost::asio::post(context_, [work, handler, error, result = std::move(result)]() mutable {
+            handler(error, std::move(result));
         });
+    };
+    // This may run on the io_context thread, which must never wait for an
+    // executor slot: a full queue fails the call instead
+    if (!Executor::instance().tryPost(task)) {
+        auto error = std::make_exception_ptr(RateLimitExceeded("executor queue is full"));
+        boost::asio::post(context_, [handler = std::move(handler), error]() { handler(error, json()); });
+    }
 }
 
-AsyncPullType Exchange::fetchOpenOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
-     return AsyncPullType(
-        [this](boost::coroutines2::coroutine<json>::push_type& yield) {
-            try {
-                // Call the synchronous fetchOrder method
-                
-                yield(json::object()); // Yield the result to the caller
-            } catch (const std::exception& e) {
-                // Handle exceptions and yield an error response if needed
-                throw; // or yield an error response
-            }
+void Exchange::fetchAsyncImpl(const std::string& url, const std::string& method,
+                              const std::map<std::string, std::string>& headers,
+                              const std::string& body, double cost, FetchHandler handler) {
+    RateLimiter::Clock::duration delay{};
+    try {
+        RateLimiter& limiter = rateLimiter();
+        if (enableRateLimit_) {
+            delay = limiter.reserve(cost);
+        }
+    } catch (...) {
+        boost::asio::post(context_, [handler = std::move(handler), error = std::current_exception()]() {
+            handler(error, json());
+        });
+        return;
+    }
+    if (delay <= RateLimiter::Clock::duration::zero()) {
+        sendAsync(url, method, headers, body, std::move(handler));
+        return;
+    }
+    // Wait on the io_context instead of blocking a thread until the bucket allows the request
+    auto timer = std::make_shared<boost::asio::steady_timer>(context_, delay);
+    timer->async_wait([this, timer, url, method, headers, body, handler = std::move(handler)](const boost::system::error_code&) {
+        sendAsync(url, method, headers, body, handler);
+    });
+}
+
+void Exchange::sendAsync(const std::string& url, const std::string& method,
+                         const std::map<std::string, std::string>& headers,
+                         const std::string& body, FetchHandler handler) {
+    HttpRequest request;
+    request.url = url;
+    request.method = method;
+    request.headers = headers;
+    request.body = body;
+    lastRestRequestTimestamp = milliseconds();
+
+    // The work guard keeps context_.run() alive until the transport answers;
+    // the body is parsed on the io_context rather than the transport thread.
+    auto work = boost::asio::make_work_guard(context_);
+    HttpClient::instance().asyncPerform(std::move(request),
+        [this, work, method, url, handler = std::move(handler)](HttpResponse response) {
+            boost::asio::post(context_, [this, work, method, url, handler, response = std::move(response)]() {
+                json result;
+                try {
+                    result = handleResponse(method, url, response);
+                } catch (...) {
+                    handler(std::current_exception(), json());
+                    return;
+                }
+                handler(nullptr, std::move(result));
+            });
         });
 }
 
-AsyncPullType Exchange::fetchClosedOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
-   return AsyncPullType(
-        [this](boost::coroutines2::coroutine<json>::push_type& yield) {
-            try {
-                // Call the synchronous fetchOrder method
-                
-                yield(json::object()); // Yield the result to the caller
-            } catch (const std::exception& e) {
-                // Handle exceptions and yield an error response if needed
-                throw; // or yield an error response
+void Exchange::updateRateLimits(const HttpResponse& response) {
+    auto retryAfter = response.headers.find("retry-after");
+    if (retryAfter == response.headers.end()) {
+        return;
+    }
+    // Only the delay-seconds form is used by the exchanges; HTTP dates are ignored
+    char* end = nullptr;
+    double seconds = std::strtod(retryAfter->second.c_str(), &end);
+    if (end != retryAfter->second.c_str() && seconds > 0) {
+        rateLimiter().pause(std::chrono::duration_cast<RateLimiter::Clock::duration>(
+            std::chrono::duration<double>(seconds)));
+    }
+}
+
+RateLimiter& Exchange::rateLimiter() {
+    std::call_once(rateLimiterOnce_, [this]() {
+        const auto& descriptor = config_.json_rest;
+        RateLimiter::Options options;
+        options.rateLimit = rateLimit;
+        std::string exchangeId = id;
+        if (table_) {
+            options.rateLimit = table_->rateLimit;
+            enableRateLimit_ = table_->enableRateLimit;
+            if (exchangeId.empty()) {
+                exchangeId = std::string(table_->id);
             }
-        });
+        } else if (descriptor) {
+            if ((*descriptor)["rateLimit"].is_number()) {
+                options.rateLimit = (*descriptor)["rateLimit"].get<double>();
+            }
+            if ((*descriptor)["enableRateLimit"].is_boolean()) {
+                enableRateLimit_ = (*descriptor)["enableRateLimit"].get<bool>();
+            }
+            if (exchangeId.empty() && (*descriptor)["id"].is_string()) {
+                exchangeId = (*descriptor)["id"].get<std::string>();
+            }
+        }
+        rateLimiter_ = RateLimiter::shared(exchangeId + "|" + config_.apiKey, options);
+    });
+    return *rateLimiter_;
 }
 
-AsyncPullType Exchange::fetchAsync(const std::string& url, const std::string& method,
-                                   const std::map<std::string, std::string>& headers,
-                                   const std::string& body) {
-     return AsyncPullType(
-        [this](boost::coroutines2::coroutine<json>::push_type& yield) {
-            try {
-                // Call the synchronous fetchOrder method
-                
-                yield(json::object()); // Yield the result to the caller
-            } catch (const std::exception& e) {
-                // Handle exceptions and yield an error response if needed
-                throw; // or yield an error response
+void Exchange::useTable(std::string_view exchangeId) {
+    table_ = exchangeTable(exchangeId);
+    if (!table_) {
+        throw NotSupported("no descriptor table for " + std::string(exchangeId));
+    }
+    if (id.empty()) {
+        id = std::string(table_->id);
+    }
+    rateLimit = static_cast<int>(table_->rateLimit);
+    for (std::size_t i = 0; i < static_cast<std::size_t>(Capability::Count); ++i) {
+        auto capability = static_cast<Capability>(i);
+        if (!table_->declared.test(capability)) {
+            continue;
+        }
+        std::string name(capabilityNames[i]);
+        if (table_->unknown.test(capability)) {
+            has[name] = std::nullopt;
+        } else {
+            has[name] = table_->has.test(capability);
+        }
+    }
+    for (std::size_t i = 0; i < table_->timeframeCount; ++i) {
+        timeframes[std::string(table_->timeframes[i].unified)] = std::string(table_->timeframes[i].exchange);
+    }
+}
+
+double Exchange::endpointCost(const std::string& api, const std::string& method,
+                              const std::string& path, const json& params) const {
+    if (table_) {
+        std::string verb = method;
+        std::transform(verb.begin(), verb.end(), verb.begin(), ::tolower);
+        const EndpointEntry* entry = table_->findEndpoint(api, verb, path);
+        if (!entry) {
+            return 1.0;
+        }
+        double cost = entry->cost;
+        if (!entry->altParam.empty() && !params.contains(std::string(entry->altParam))) {
+            cost = entry->altCost;
+        }
+        if (entry->byLimitCount > 0 && params.contains("limit") && params["limit"].is_number()) {
+            double limit = params["limit"].get<double>();
+            for (std::size_t i = 0; i < entry->byLimitCount; ++i) {
+                const LimitCost& tier = table_->limits[entry->byLimitOffset + i];
+                if (limit <= tier.limit) {
+                    cost = tier.cost;
+                    break;
+                }
             }
-        });
+        }
+        return cost;
+    }
+    if (!config_.json_rest || !config_.json_rest->contains("api")) {
+        return 1.0;
+    }
+    const json* node = &(*config_.json_rest)["api"];
+    std::size_t start = 0;
+    while (start <= api.size()) {
+        std::size_t end = api.find('.', start);
+        std::string section = api.substr(start, end == std::string::npos ? std::string::npos : end - start);
+        if (!node->is_object() || !node->contains(section)) {
+            return 1.0;
+        }
+        node = &(*node)[section];
+        if (end == std::string::npos) {
+            break;
+        }
+        start = end + 1;
+    }
+    std::string verb = method;
+    std::transform(verb.begin(), verb.end(), verb.begin(), ::tolower);
+    if (!node->is_object() || !node->contains(verb) || !(*node)[verb].contains(path)) {
+        return 1.0;
+    }
+    const json& entry = (*node)[verb][path];
+    if (entry.is_number()) {
+        return entry.get<double>();
+    }
+    if (!entry.is_object()) {
+        return 1.0;
+    }
+    double cost = entry.contains("cost") ? entry["cost"].get<double>() : 1.0;
+    if (entry.contains("noSymbol") && !params.contains("symbol")) {
+        cost = entry["noSymbol"].get<double>();
+    }
+    if (entry.contains("byLimit") && params.contains("limit") && params["limit"].is_number()) {
+        double limit = params["limit"].get<double>();
+        for (const auto& tier : entry["byLimit"]) {
+            if (limit <= tier[0].get<double>()) {
+                cost = tier[1].get<double>();
+                break;
+            }
+        }
+    }
+    return cost;
 }
 
 // Utility methods
@@ -348,92 +524,76 @@ std::string Exchange::sign(const std::string& path, const std::string& api,
 }
 
 std::string Exchange::implodeParams(const std::string& path, const json& params) {
-    std::string result = path;
-    for (const auto& [key, value] : params.items()) {
-        result = std::regex_replace(result, std::regex("\\{" + key + "\\}"),
-                                  value.get<std::string>());
-    }
-    return result;
+    // Path values go in unescaped, as ccxt's implodeParams does
+    return urlTemplate(path).render(params, false);
 }
 
 std::vector<std::string> Exchange::extractParams(const std::string& path) {
-    std::vector<std::string> result;
-    std::regex pattern("\\{([^}]+)\\}");
-    auto words_begin = std::sregex_iterator(path.begin(), path.end(), pattern);
-    auto words_end = std::sregex_iterator();
-    for (std::sregex_iterator i = words_begin; i != words_end; ++i) {
-        std::smatch match = *i;
-        result.push_back(match[1].str());
-    }
-    return result;
+    return urlTemplate(path).params();
 }
 
 std::string Exchange::urlencode(const json& params) {
-    std::ostringstream result;
-    bool first = true;
+    std::string result;
     for (const auto& [key, value] : params.items()) {
-        if (!first) {
-            result << "&";
+        if (!result.empty()) {
+            result += '&';
         }
-        first = false;
-        result << encode(key) << "=" << encode(value.get<std::string>());
+        appendPercentEncoded(result, key);
+        result += '=';
+        appendPercentEncoded(result, value.is_string() ? value.get_ref<const std::string&>() : value.dump());
     }
-    return result.str();
+    return result;
 }
 
 std::string Exchange::encode(const std::string& string) {
-    std::ostringstream escaped;
-    escaped.fill('0');
-    escaped << std::hex;
+    return percentEncode(string);
+}
 
-    for (char c : string) {
-        if (isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~') {
-            escaped << c;
-            continue;
-        }
-        escaped << std::uppercase;
-        escaped << '%' << std::setw(2) << int((unsigned char)c);
-        escaped << std::nouppercase;
+const UrlTemplate& Exchange::urlTemplate(const std::string& path) const {
+    std::lock_guard<std::mutex> lock(templatesMutex_);
+    auto& compiled = urlTemplates_[path];
+    if (!compiled) {
+        compiled = std::make_unique<const UrlTemplate>(path);
     }
-
-    return escaped.str();
+    return *compiled;
 }
 
 std::string Exchange::hmac(const std::string& message, const std::string& secret,
                      const std::string& algorithm, const std::string& digest) {
-    unsigned char* digest_value = nullptr;
-    unsigned int digest_len = 0;
-
-    if (algorithm == "sha256") {
-        digest_value = HMAC(EVP_sha256(), secret.c_str(), secret.length(),
-                          (unsigned char*)message.c_str(), message.length(),
-                          nullptr, &digest_len);
-    } else if (algorithm == "sha512") {
-        digest_value = HMAC(EVP_sha512(), secret.c_str(), secret.length(),
-                          (unsigned char*)message.c_str(), message.length(),
-                          nullptr, &digest_len);
-    } else {
-        throw NotSupported("Unsupported hash algorithm: " + algorithm);
+    const HmacKey& key = hmacKey(hashAlgorithm(algorithm), secret);
+    if (digest == "hex") {
+        return key.hex(message);
+    }
+    if (digest == "base64") {
+        return key.base64(message);
+    }
+    if (digest == "binary") {
+        unsigned char raw[HmacKey::maxDigestSize];
+        return std::string(reinterpret_cast<const char*>(raw), key.sign(message, raw));
     }
+    throw NotSupported("Unsupported digest format: " + digest);
+}
 
-    if (!digest_value) {
-        throw ExchangeError("HMAC failed");
+const HmacKey& Exchange::hmacKey(HashAlgorithm algorithm, const std::string& secret) const {
+    std::lock_guard<std::mutex> lock(keysMutex_);
+    auto& key = hmacKeys_[{algorithm, secret}];
+    if (!key) {
+        key = std::make_unique<const HmacKey>(algorithm, secret);
     }
+    return *key;
+}
 
-    std::ostringstream result;
-    if (digest == "hex") {
-        for (unsigned int i = 0; i < digest_len; i++) {
-            result << std::hex << std::setw(2) << std::setfill('0')
-                  << (int)digest_value[i];
-        }
-    } else if (digest == "base64") {
-        // TODO: Implement base64 encoding
-        throw NotSupported("Base64 encoding not implemented yet");
-    } else {
-        throw NotSupported("Unsupported digest format: " + digest);
+const Signer& Exchange::signer() const {
+    std::lock_guard<std::mutex> lock(keysMutex_);
+    auto& signer = signers_[config_.secret];
+    if (!signer) {
+        signer = createSigner(config_.secret);
     }
+    return *signer;
+}
 
-    return result.str();
+std::unique_ptr<Signer> Exchange::createSigner(const std::string& secret) const {
+    return std::make_unique<HmacSigner>(HashAlgorithm::Sha256, secret);
 }
 
 long long Exchange::milliseconds() const {
@@ -495,20 +655,101 @@ long long Exchange::parse8601(const std::string& datetime) {
 }
 
 Market Exchange::market(const std::string& symbol) {
-    if (markets.find(symbol) == markets.end()) {
-        throw ExchangeError("Market '" + symbol + "' does not exist");
+    auto registry = marketRegistry();
+    const Market* found = registry->bySymbol(symbol);
+    if (!found) {
+        throw BadSymbol("Market '" + symbol + "' does not exist");
     }
-    return markets[symbol];
+    return *found;
+}
+
+std::shared_ptr<const Market> Exchange::marketBySymbol(std::string_view symbol) const noexcept {
+    auto registry = marketRegistry();
+    const Market* found = registry->bySymbol(symbol);
+    return found ? std::shared_ptr<const Market>(registry, found) : nullptr;
+}
+
+std::shared_ptr<const Market> Exchange::marketById(std::string_view marketId) const noexcept {
+    auto registry = marketRegistry();
+    const Market* found = registry->byId(marketId);
+    // Aliasing constructor: shares the snapshot's ownership, no allocation
+    return found ? std::shared_ptr<const Market>(registry, found) : nullptr;
+}
+
+std::shared_ptr<const MarketRegistry> Exchange::marketRegistry() const {
+    return std::atomic_load_explicit(&markets_, std::memory_order_acquire);
+}
+
+std::size_t Exchange::onMarketsChanged(MarketsListener listener) {
+    std::lock_guard<std::mutex> lock(listenersMutex_);
+    marketsListeners_.emplace(nextListenerId_, std::move(listener));
+    return nextListenerId_++;
+}
+
+void Exchange::removeMarketsListener(std::size_t id) {
+    std::lock_guard<std::mutex> lock(listenersMutex_);
+    marketsListeners_.erase(id);
 }
 
 void Exchange::loadMarkets(bool reload) {
-    if (!markets.empty() && !reload) {
+    if (!marketRegistry()->empty() && !reload) {
         return;
     }
     json response = fetchMarkets();
+    std::vector<Market> list;
+    list.reserve(response.size());
     for (const auto& market : response) {
-        markets[market["symbol"]] = market;
-        markets_by_id[market["id"]] = market;
+        list.emplace_back() = market;
+    }
+    CountingMode precisionMode = CountingMode::DecimalPlaces;
+    PaddingMode paddingMode = PaddingMode::NoPadding;
+    const auto& descriptor = config_.json_rest;
+    if (table_) {
+        precisionMode = table_->precisionMode;
+        paddingMode = table_->paddingMode;
+    } else if (descriptor) {
+        if ((*descriptor)["precisionMode"].is_number_integer()) {
+            precisionMode = static_cast<CountingMode>((*descriptor)["precisionMode"].get<int>());
+        }
+        if ((*descriptor)["paddingMode"].is_number_integer()) {
+            paddingMode = static_cast<PaddingMode>((*descriptor)["paddingMode"].get<int>());
+        }
+    }
+    auto next = std::make_shared<const MarketRegistry>(std::move(list), precisionMode, paddingMode);
+
+    MarketChanges changes;
+    {
+        std::lock_guard<std::mutex> lock(marketsMutex_);
+        auto current = marketRegistry();
+        changes = MarketChanges::between(current, next);
+        if (changes.empty() && !current->empty()) {
+            // Nothing moved: keep the published snapshot
+            return;
+        }
+        // Readers holding the old snapshot keep it alive until they let go
+        std::atomic_store_explicit(&markets_, std::shared_ptr<const MarketRegistry>(next),
+                                   std::memory_order_release);
+
+        // Keyed copies for exchanges that still index the maps directly; they
+        // are rewritten in place and not safe to read during a reload, new code
+        // goes through market() or marketRegistry()
+        markets.clear();
+        markets_by_id.clear();
+        for (const auto& market : *next) {
+            markets.emplace(market.symbol, market);
+            markets_by_id.emplace(market.id, market);
+        }
+    }
+
+    std::vector<MarketsListener> listeners;
+    {
+        std::lock_guard<std::mutex> lock(listenersMutex_);
+        for (const auto& [id, listener] : marketsListeners_) {
+            listeners.push_back(listener);
+        }
+    }
+    for (const auto& listener : listeners) {
+        listener(changes);
     }
 }
 
@@ -530,7 +771,7 @@ double Exchange::safeNumber(const json& obj, const std::string& key, double defa
         }
         if (obj[key].is_string()) {
             try {
-                return std::stod(obj[key].get<std::string>());
+                return parseDouble(obj[key].get_ref<const std::string&>());
             } catch (...) {
                 return defaultValue;
             }
@@ -573,79 +814,117 @@ bool Exchange::safeBoolean(const json& obj, const std::string& key, bool default
 }
 
 std::string Exchange::symbol(const std::string& marketId) {
-    if (markets_by_id.find(marketId) == markets_by_id.end()) {
-        throw ExchangeError("Market ID '" + marketId + "' does not exist");
+    auto registry = marketRegistry();
+    const Market* found = registry->byId(marketId);
+    if (!found) {
+        throw BadSymbol("Market ID '" + marketId + "' does not exist");
     }
-    return markets_by_id[marketId].symbol;
+    return found->symbol;
 }
 
 std::string Exchange::amountToPrecision(const std::string& symbol, double amount) {
-    std::ostringstream ss;
-    ss << std::fixed << std::setprecision(8) << amount;
-    return ss.str();
+    char buffer[128];
+    return std::string(buffer, formatToPrecision(symbol, amount, RoundingMode::Truncate, true, buffer, buffer + sizeof(buffer)));
 }
 
 std::string Exchange::priceToPrecision(const std::string& symbol, double price) {
-    std::ostringstream ss;
-    ss << std::fixed << std::setprecision(8) << price;
-    return ss.str();
+    char buffer[128];
+    return std::string(buffer, formatToPrecision(symbol, price, RoundingMode::Round, false, buffer, buffer + sizeof(buffer)));
+}
+
+char* Exchange::priceToPrecision(std::string_view symbol, double price, char* first, char* last) const {
+    return formatToPrecision(symbol, price, RoundingMode::Round, false, first, last);
+}
+
+char* Exchange::amountToPrecision(std::string_view symbol, double amount, char* first, char* last) const {
+    return formatToPrecision(symbol, amount, RoundingMode::Truncate, true, first, last);
+}
+
+char* Exchange::formatToPrecision(std::string_view symbol, double value, RoundingMode rounding,
+                                  bool amount, char* first, char* last) const {
+    auto registry = marketRegistry();
+    MarketRegistry::Handle handle = registry->findSymbol(symbol);
+    if (handle == MarketRegistry::npos) {
+        throw BadSymbol("Market '" + std::string(symbol) + "' does not exist");
+    }
+    const MarketPrecision& precision = registry->precision(handle);
+    char* end = decimalToPrecision(first, last, value, rounding, amount ? precision.amount : precision.price);
+    if (!end && last - first >= 128) {
+        throw std::length_error("formatted value does not fit in 128 bytes");
+    }
+    return end;
 }
 
 std::string Exchange::feeToPrecision(const std::string& symbol, double fee) {
-    std::ostringstream ss;
-    ss << std::fixed << std::setprecision(8) << fee;
-    return ss.str();
+    char buffer[128];
+    return std::string(buffer, formatToPrecision(symbol, fee, RoundingMode::Round, false, buffer, buffer + sizeof(buffer)));
 }
 
 std::string Exchange::currencyToPrecision(const std::string& currency, double fee) {
-    std::ostringstream ss;
-    ss << std::fixed << std::setprecision(8) << fee;
-    return ss.str();
+    // No currency table yet, so currencies keep 8 decimal places
+    return decimalToPrecision(fee, RoundingMode::Round, PrecisionRule::decimalPlaces(8));
 }
 
 std::string Exchange::costToPrecision(const std::string& symbol, double cost) {
-    std::ostringstream ss;
-    ss << std::fixed << std::setprecision(8) << cost;
-    return ss.str();
+    char buffer[128];
+    return std::string(buffer, formatToPrecision(symbol, cost, RoundingMode::Truncate, false, buffer, buffer + sizeof(buffer)));
 }
 
 json Exchange::fetch(const std::string& url, const std::string& method,
                     const std::map<std::string, std::string>& headers,
-                    const std::string& body) {
-
-    std::string readBuffer;
-    if(curl_) {
-        struct curl_slist* curl_headers = nullptr;
-        std::map<std::string, std::string>::const_iterator it = headers.begin();
-        for (; it != headers.end(); ++it) {
-            curl_headers = curl_slist_append(curl_headers, (it->first + ": " + it->second).c_str());
-        }
-        curl_easy_setopt(curl_, CURLOPT_HTTPHEADER, curl_headers);
-        curl_easy_setopt(curl_, CURLOPT_URL, url.c_str());
-        curl_easy_setopt(curl_, CURLOPT_POSTFIELDS, body.c_str());
-        curl_easy_setopt(curl_, CURLOPT_WRITEFUNCTION, NULL);
-        curl_easy_setopt(curl_, CURLOPT_WRITEDATA, &readBuffer);
-        CURLcode res = curl_easy_perform(curl_);
-        long httpCode = 0;
-        curl_easy_getinfo(curl_, CURLINFO_RESPONSE_CODE, &httpCode);
-
-        if(res != CURLE_OK) {
-            std::cerr << "curl_easy_perform() failed: " << curl_easy_strerror(res) << std::endl;
-        } else if (httpCode != 200) {
-            std::cerr << "HTTP request failed with code: " << httpCode << std::endl;
-        } else {
-            try {
-                auto jsonResponse = nlohmann::json::parse(readBuffer);
-                // Process the JSON response (e.g., check order status)
-                std::cout << jsonResponse.dump(4) << std::endl;
-                return jsonResponse; // Pretty print
-            } catch (const nlohmann::json::parse_error& e) {
-                std::cerr << "JSON parse error: " << e.what() << std::endl;
-            }
-        }
-        curl_easy_cleanup(curl_);
+                    const std::string& body, double cost) {
+    std::string text = fetchBody(url, method, headers, body, cost);
+    try {
+        return json::parse(text);
+    } catch (const json::parse_error& e) {
+        throw BadResponse(id + " " + method + " " + url + " returned invalid JSON: " + e.what());
+    }
+}
+
+std::string Exchange::fetchBody(const std::string& url, const std::string& method,
+                                const std::map<std::string, std::string>& headers,
+                                const std::string& body, double cost) {
+    RateLimiter& limiter = rateLimiter();
+    if (enableRateLimit_) {
+        std::this_thread::sleep_for(limiter.reserve(cost));
+    }
+
+    HttpRequest request;
+    request.url = url;
+    request.method = method;
+    request.headers = headers;
+    request.body = body;
+
+    HttpResponse response = HttpClient::instance().perform(std::move(request));
+    lastRestRequestTimestamp = milliseconds();
+    checkResponse(method, url, response);
+    return std::move(response.body);
+}
+
+json Exchange::handleResponse(const std::string& method, const std::string& url, const HttpResponse& response) {
+    checkResponse(method, url, response);
+    try {
+        return json::parse(response.body);
+    } catch (const json::parse_error& e) {
+        throw BadResponse(id + " " + method + " " + url + " returned invalid JSON: " + e.what());
+    }
+}
+
+void Exchange::checkResponse(const std::string& method, const std::string& url, const HttpResponse& response) {
+    if (!response.error.empty()) {
+        throw NetworkError(id + " " + method + " " + url + " failed: " + response.error);
+    }
+    updateRateLimits(response);
+    if (response.status == 429) {
+        throw RateLimitExceeded(id + " " + method + " " + url + " returned HTTP 429: " + response.body);
+    }
+    if (response.status == 418) {
+        throw DDoSProtection(id + " " + method + " " + url + " returned HTTP 418: " + response.body);
+    }
+    if (response.status < 200 || response.status >= 300) {
+        throw ExchangeError(id + " " + method + " " + url + " returned HTTP " +
+                            std::to_string(response.status) + ": " + response.body);
     }
-    return json::parse(readBuffer);
 }
 
 json Exchange::omit(const json& params, const std::vector<std::string>& keys) {
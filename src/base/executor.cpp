@@ -0,0 +1,218 @@
+#include "ccxt/base/executor.h"
+#include <algorithm>
+
+namespace ccxt {
+
+namespace {
+
+std::mutex sharedMutex;
+Executor::Options sharedOptions;
+bool sharedStarted = false;
+
+thread_local const Executor* currentExecutor = nullptr;
+thread_local std::size_t currentWorker = 0;
+
+Executor::Options takeSharedOptions() {
+    std::lock_guard<std::mutex> lock(sharedMutex);
+    sharedStarted = true;
+    return sharedOptions;
+}
+
+void updateMax(std::atomic<std::uint64_t>& target, std::uint64_t value) {
+    std::uint64_t current = target.load();
+    while (value > current && !target.compare_exchange_weak(current, value)) {
+    }
+}
+
+std::uint64_t elapsedNanos(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to) {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count());
+}
+
+} // namespace
+
+Executor& Executor::instance() {
+    static Executor executor(takeSharedOptions());
+    return executor;
+}
+
+bool Executor::configure(const Options& options) {
+    std::lock_guard<std::mutex> lock(sharedMutex);
+    if (sharedStarted) {
+        return false;
+    }
+    sharedOptions = options;
+    return true;
+}
+
+Executor::Executor() : Executor(Options()) {}
+
+Executor::Executor(const Options& options) : options_(options) {
+    if (options_.threads == 0) {
+        options_.threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    if (options_.queueCapacity == 0) {
+        options_.queueCapacity = 1;
+    }
+    workers_.reserve(options_.threads);
+    for (std::size_t i = 0; i < options_.threads; ++i) {
+        workers_.push_back(std::make_unique<Worker>());
+    }
+    for (std::size_t i = 0; i < options_.threads; ++i) {
+        workers_[i]->thread = std::thread([this, i]() { run(i); });
+    }
+}
+
+Executor::~Executor() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    workAvailable_.notify_all();
+    spaceAvailable_.notify_all();
+    for (auto& worker : workers_) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+}
+
+bool Executor::onWorkerThread(std::size_t* index) const {
+    if (currentExecutor != this) {
+        return false;
+    }
+    if (index) {
+        *index = currentWorker;
+    }
+    return true;
+}
+
+void Executor::post(std::function<void()> fn) {
+    Task task{std::move(fn), Clock::now()};
+    enqueue(task, true);
+}
+
+bool Executor::tryPost(std::function<void()>& fn) {
+    Task task{std::move(fn), Clock::now()};
+    if (enqueue(task, false)) {
+        return true;
+    }
+    fn = std::move(task.fn);
+    return false;
+}
+
+bool Executor::enqueue(Task& task, bool blocking) {
+    std::size_t target = 0;
+    bool local = onWorkerThread(&target);
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (pending_.load() >= options_.queueCapacity) {
+            if (local) {
+                // Blocking a worker on its own pool could deadlock; run the task here instead
+                lock.unlock();
+                ++submitted_;
+                ++inlined_;
+                execute(task);
+                return true;
+            }
+            if (!blocking) {
+                ++rejected_;
+                return false;
+            }
+            spaceAvailable_.wait(lock, [this]() {
+                return stopping_ || pending_.load() < options_.queueCapacity;
+            });
+        }
+        ++submitted_;
+        if (!local) {
+            target = nextWorker_.fetch_add(1) % workers_.size();
+        }
+        {
+            std::lock_guard<std::mutex> workerLock(workers_[target]->mutex);
+            workers_[target]->tasks.push_back(std::move(task));
+        }
+        std::size_t depth = ++pending_;
+        std::size_t currentMax = maxQueueDepth_.load();
+        while (depth > currentMax && !maxQueueDepth_.compare_exchange_weak(currentMax, depth)) {
+        }
+    }
+    workAvailable_.notify_one();
+    return true;
+}
+
+bool Executor::tryPop(std::size_t index, Task& task) {
+    {
+        Worker& own = *workers_[index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            return true;
+        }
+    }
+    for (std::size_t offset = 1; offset < workers_.size(); ++offset) {
+        Worker& victim = *workers_[(index + offset) % workers_.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            ++stolen_;
+            return true;
+        }
+    }
+    return false;
+}
+
+void Executor::execute(Task& task) {
+    auto started = Clock::now();
+    std::uint64_t waited = elapsedNanos(task.enqueued, started);
+    queueNanos_ += waited;
+    updateMax(maxQueueNanos_, waited);
+
+    task.fn();
+
+    runNanos_ += elapsedNanos(started, Clock::now());
+    ++completed_;
+}
+
+void Executor::run(std::size_t index) {
+    currentExecutor = this;
+    currentWorker = index;
+    while (true) {
+        Task task;
+        if (tryPop(index, task)) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                --pending_;
+            }
+            spaceAvailable_.notify_one();
+            execute(task);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(mutex_);
+        workAvailable_.wait(lock, [this]() { return stopping_ || pending_.load() > 0; });
+        if (stopping_ && pending_.load() == 0) {
+            break;
+        }
+    }
+    currentExecutor = nullptr;
+}
+
+Executor::Metrics Executor::metrics() const {
+    Metrics result;
+    result.threads = workers_.size();
+    result.queueDepth = pending_.load();
+    result.maxQueueDepth = maxQueueDepth_.load();
+    result.submitted = submitted_.load();
+    result.completed = completed_.load();
+    result.stolen = stolen_.load();
+    result.inlined = inlined_.load();
+    result.rejected = rejected_.load();
+    if (result.completed > 0) {
+        result.avgQueueLatencyUs = queueNanos_.load() / 1000.0 / result.completed;
+        result.avgRunLatencyUs = runNanos_.load() / 1000.0 / result.completed;
+    }
+    result.maxQueueLatencyUs = maxQueueNanos_.load() / 1000.0;
+    return result;
+}
+
+} // namespace ccxt
@@ -0,0 +1,230 @@
+#include "ccxt/base/http_client.h"
+#include <algorithm>
+#include <cctype>
+#include <future>
+#include <memory>
+
+namespace ccxt {
+
+struct HttpClient::Transfer {
+    HttpRequest request;
+    HttpResponse response;
+    Callback callback;
+    curl_slist* headers = nullptr;
+};
+
+namespace {
+
+size_t writeCallback(char* data, size_t size, size_t nmemb, void* userdata) {
+    auto* body = static_cast<std::string*>(userdata);
+    body->append(data, size * nmemb);
+    return size * nmemb;
+}
+
+size_t headerCallback(char* data, size_t size, size_t nmemb, void* userdata) {
+    auto* headers = static_cast<std::map<std::string, std::string>*>(userdata);
+    std::string line(data, size * nmemb);
+    if (line.compare(0, 5, "HTTP/") == 0) {
+        // A new status line starts another response (redirect, 100 Continue)
+        headers->clear();
+        return size * nmemb;
+    }
+    auto colon = line.find(':');
+    if (colon != std::string::npos) {
+        std::string name = line.substr(0, colon);
+        std::transform(name.begin(), name.end(), name.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        auto begin = line.find_first_not_of(" \t", colon + 1);
+        auto end = line.find_last_not_of(" \t\r\n");
+        (*headers)[name] = begin == std::string::npos || end < begin ? "" : line.substr(begin, end - begin + 1);
+    }
+    return size * nmemb;
+}
+
+struct CurlGlobal {
+    CurlGlobal() { curl_global_init(CURL_GLOBAL_DEFAULT); }
+    ~CurlGlobal() { curl_global_cleanup(); }
+};
+
+} // namespace
+
+HttpClient& HttpClient::instance() {
+    static CurlGlobal global;
+    static HttpClient client;
+    return client;
+}
+
+HttpClient::HttpClient() : HttpClient(Options()) {}
+
+HttpClient::HttpClient(const Options& options) : options_(options) {
+    multi_ = curl_multi_init();
+    curl_multi_setopt(multi_, CURLMOPT_PIPELINING, options_.http2 ? CURLPIPE_MULTIPLEX : CURLPIPE_NOTHING);
+    curl_multi_setopt(multi_, CURLMOPT_MAX_HOST_CONNECTIONS, options_.maxConnectionsPerHost);
+    curl_multi_setopt(multi_, CURLMOPT_MAX_TOTAL_CONNECTIONS, options_.maxTotalConnections);
+    worker_ = std::thread([this]() { run(); });
+}
+
+HttpClient::~HttpClient() {
+    stopping_ = true;
+    wakeup();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+    for (CURL* easy : idleHandles_) {
+        curl_easy_cleanup(easy);
+    }
+    curl_multi_cleanup(multi_);
+}
+
+void HttpClient::asyncPerform(HttpRequest request, Callback callback) {
+    auto* transfer = new Transfer{std::move(request), HttpResponse(), std::move(callback)};
+    ++inFlight_;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_.push_back(transfer);
+    }
+    wakeup();
+}
+
+HttpResponse HttpClient::perform(HttpRequest request) {
+    auto promise = std::make_shared<std::promise<HttpResponse>>();
+    auto future = promise->get_future();
+    asyncPerform(std::move(request), [promise](HttpResponse response) {
+        promise->set_value(std::move(response));
+    });
+    return future.get();
+}
+
+void HttpClient::setMaxConnectionsPerHost(long maxConnections) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pendingMaxConnectionsPerHost_ = maxConnections;
+    }
+    wakeup();
+}
+
+void HttpClient::raiseMaxConnectionsPerHost(long maxConnections) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (maxConnections <= raisedMaxConnectionsPerHost_) {
+            return;
+        }
+        raisedMaxConnectionsPerHost_ = maxConnections;
+        pendingMaxConnectionsPerHost_ = maxConnections;
+    }
+    wakeup();
+}
+
+void HttpClient::wakeup() {
+    curl_multi_wakeup(multi_);
+}
+
+CURL* HttpClient::acquireHandle() {
+    if (!idleHandles_.empty()) {
+        CURL* easy = idleHandles_.back();
+        idleHandles_.pop_back();
+        curl_easy_reset(easy);
+        return easy;
+    }
+    return curl_easy_init();
+}
+
+void HttpClient::releaseHandle(CURL* easy) {
+    idleHandles_.push_back(easy);
+}
+
+void HttpClient::start(Transfer* transfer) {
+    CURL* easy = acquireHandle();
+    const HttpRequest& request = transfer->request;
+
+    for (const auto& [key, value] : request.headers) {
+        transfer->headers = curl_slist_append(transfer->headers, (key + ": " + value).c_str());
+    }
+    curl_easy_setopt(easy, CURLOPT_URL, request.url.c_str());
+    curl_easy_setopt(easy, CURLOPT_HTTPHEADER, transfer->headers);
+    curl_easy_setopt(easy, CURLOPT_WRITEFUNCTION, writeCallback);
+    curl_easy_setopt(easy, CURLOPT_WRITEDATA, &transfer->response.body);
+    curl_easy_setopt(easy, CURLOPT_HEADERFUNCTION, headerCallback);
+    curl_easy_setopt(easy, CURLOPT_HEADERDATA, &transfer->response.headers);
+    curl_easy_setopt(easy, CURLOPT_PRIVATE, transfer);
+    curl_easy_setopt(easy, CURLOPT_TIMEOUT_MS, request.timeoutMs);
+    curl_easy_setopt(easy, CURLOPT_NOSIGNAL, 1L);
+    curl_easy_setopt(easy, CURLOPT_TCP_KEEPALIVE, 1L);
+    curl_easy_setopt(easy, CURLOPT_ACCEPT_ENCODING, "");
+    if (options_.http2) {
+        curl_easy_setopt(easy, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+        // Wait for an existing connection to multiplex on rather than opening a new one
+        curl_easy_setopt(easy, CURLOPT_PIPEWAIT, 1L);
+    }
+
+    if (request.method == "GET") {
+        curl_easy_setopt(easy, CURLOPT_HTTPGET, 1L);
+    } else {
+        if (request.method != "POST") {
+            curl_easy_setopt(easy, CURLOPT_CUSTOMREQUEST, request.method.c_str());
+        }
+        if (!request.body.empty() || request.method == "POST") {
+            curl_easy_setopt(easy, CURLOPT_POSTFIELDSIZE, static_cast<long>(request.body.size()));
+            curl_easy_setopt(easy, CURLOPT_POSTFIELDS, request.body.c_str());
+        }
+    }
+
+    curl_multi_add_handle(multi_, easy);
+}
+
+void HttpClient::finish(CURL* easy, CURLcode result) {
+    Transfer* transfer = nullptr;
+    curl_easy_getinfo(easy, CURLINFO_PRIVATE, &transfer);
+    curl_easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &transfer->response.status);
+    if (result != CURLE_OK) {
+        transfer->response.error = curl_easy_strerror(result);
+    }
+    curl_multi_remove_handle(multi_, easy);
+    releaseHandle(easy);
+    curl_slist_free_all(transfer->headers);
+
+    std::unique_ptr<Transfer> owner(transfer);
+    --inFlight_;
+    if (owner->callback) {
+        owner->callback(std::move(owner->response));
+    }
+}
+
+void HttpClient::run() {
+    while (true) {
+        std::deque<Transfer*> batch;
+        long maxConnections = -1;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            batch.swap(pending_);
+            std::swap(maxConnections, pendingMaxConnectionsPerHost_);
+        }
+        if (maxConnections >= 0) {
+            options_.maxConnectionsPerHost = maxConnections;
+            curl_multi_setopt(multi_, CURLMOPT_MAX_HOST_CONNECTIONS, maxConnections);
+        }
+        for (Transfer* transfer : batch) {
+            start(transfer);
+        }
+
+        int running = 0;
+        curl_multi_perform(multi_, &running);
+
+        int queued = 0;
+        while (CURLMsg* msg = curl_multi_info_read(multi_, &queued)) {
+            if (msg->msg == CURLMSG_DONE) {
+                finish(msg->easy_handle, msg->data.result);
+            }
+        }
+
+        if (stopping_ && running == 0) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (pending_.empty()) {
+                break;
+            }
+        }
+        curl_multi_poll(multi_, nullptr, 0, 1000, nullptr);
+    }
+}
+
+} // namespace ccxt
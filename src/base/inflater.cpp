@@ -0,0 +1,72 @@
+#include "ccxt/base/inflater.h"
+#include "ccxt/base/errors.h"
+#include <algorithm>
+#include <stdexcept>
+#include <zlib.h>
+
+namespace ccxt {
+
+namespace {
+
+int windowBits(FrameCompression format) {
+    switch (format) {
+        case FrameCompression::Gzip: return 16 + MAX_WBITS;
+        case FrameCompression::Deflate: return -MAX_WBITS;
+        case FrameCompression::Zlib: return MAX_WBITS;
+        default: throw std::invalid_argument("Inflater: no compression to undo");
+    }
+}
+
+} // namespace
+
+void Inflater::StreamDeleter::operator()(z_stream_s* stream) const noexcept {
+    inflateEnd(stream);
+    delete stream;
+}
+
+Inflater::Inflater(FrameCompression format, std::size_t maxOutput) : format_(format), maxOutput_(maxOutput) {
+    int bits = windowBits(format);
+    auto* stream = new z_stream_s{};
+    if (inflateInit2(stream, bits) != Z_OK) {
+        delete stream;
+        throw std::bad_alloc();
+    }
+    stream_.reset(stream);
+    output_.resize(std::min<std::size_t>(16 * 1024, maxOutput_));
+}
+
+Inflater::~Inflater() = default;
+
+std::string_view Inflater::inflate(std::string_view input) {
+    z_stream_s& stream = *stream_;
+    inflateReset(&stream);
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+    stream.avail_in = static_cast<uInt>(input.size());
+    std::size_t produced = 0;
+    for (;;) {
+        stream.next_out = reinterpret_cast<Bytef*>(output_.data() + produced);
+        stream.avail_out = static_cast<uInt>(output_.size() - produced);
+        int result = ::inflate(&stream, Z_SYNC_FLUSH);
+        produced = output_.size() - stream.avail_out;
+        if (result == Z_STREAM_END) {
+            break;
+        }
+        if (result != Z_OK && result != Z_BUF_ERROR) {
+            throw BadResponse(std::string("inflate: ") + (stream.msg ? stream.msg : "corrupt input"));
+        }
+        if (stream.avail_out == 0) {
+            if (output_.size() >= maxOutput_) {
+                throw BadResponse("inflate: message exceeds " + std::to_string(maxOutput_) + " bytes");
+            }
+            output_.resize(std::min(2 * output_.size(), maxOutput_));
+            continue;
+        }
+        if (stream.avail_in == 0 && format_ == FrameCompression::Deflate) {
+            break;
+        }
+        throw BadResponse("inflate: truncated input");
+    }
+    return std::string_view(output_.data(), produced);
+}
+
+} // namespace ccxt
@@ -0,0 +1,314 @@
+#include "ccxt/base/json_arena.h"
+#include "ccxt/base/errors.h"
+#include "ccxt/base/number.h"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <functional>
+#include <new>
+#include <stdexcept>
+
+namespace ccxt {
+
+namespace {
+
+thread_local JsonArena* currentArena = nullptr;
+
+constexpr int maxDepth = 512;
+
+class ArenaParser {
+public:
+    ArenaParser(const char* begin, const char* end) : p_(begin), end_(end) {}
+
+    ArenaJson document() {
+        ArenaJson result = value(0);
+        skipSpace();
+        if (p_ != end_) {
+            fail("trailing characters");
+        }
+        return result;
+    }
+
+private:
+    [[noreturn]] void fail(const char* what) const {
+        throw BadResponse(std::string("malformed JSON: ") + what);
+    }
+
+    void skipSpace() {
+        while (p_ < end_ && (*p_ == ' ' || *p_ == '\n' || *p_ == '\r' || *p_ == '\t')) {
+            ++p_;
+        }
+    }
+
+    void expect(char c) {
+        skipSpace();
+        if (p_ >= end_ || *p_ != c) {
+            fail("unexpected character");
+        }
+        ++p_;
+    }
+
+    void literal(std::string_view word) {
+        if (std::string_view(p_, end_ - p_).substr(0, word.size()) != word) {
+            fail("invalid literal");
+        }
+        p_ += word.size();
+    }
+
+    ArenaJson value(int depth) {
+        if (depth > maxDepth) {
+            fail("nesting too deep");
+        }
+        skipSpace();
+        if (p_ >= end_) {
+            fail("missing value");
+        }
+        switch (*p_) {
+            case '{': return object(depth);
+            case '[': return array(depth);
+            case '"': return ArenaJson(string());
+            case 't': literal("true"); return ArenaJson(true);
+            case 'f': literal("false"); return ArenaJson(false);
+            case 'n': literal("null"); return ArenaJson(nullptr);
+            default: return number();
+        }
+    }
+
+    ArenaJson object(int depth) {
+        ++p_;
+        ArenaJson result = ArenaJson::object();
+        auto& members = result.get_ref<ArenaJson::object_t&>();
+        skipSpace();
+        if (p_ < end_ && *p_ == '}') {
+            ++p_;
+            return result;
+        }
+        for (;;) {
+            skipSpace();
+            if (p_ >= end_ || *p_ != '"') {
+                fail("expected a member name");
+            }
+            ArenaString key = string();
+            expect(':');
+            members[std::move(key)] = value(depth + 1);
+            skipSpace();
+            if (p_ < end_ && *p_ == ',') {
+                ++p_;
+                continue;
+            }
+            expect('}');
+            return result;
+        }
+    }
+
+    ArenaJson array(int depth) {
+        ++p_;
+        ArenaJson result = ArenaJson::array();
+        auto& elements = result.get_ref<ArenaJson::array_t&>();
+        skipSpace();
+        if (p_ < end_ && *p_ == ']') {
+            ++p_;
+            return result;
+        }
+        for (;;) {
+            elements.push_back(value(depth + 1));
+            skipSpace();
+            if (p_ < end_ && *p_ == ',') {
+                ++p_;
+                continue;
+            }
+            expect(']');
+            return result;
+        }
+    }
+
+    unsigned hex4() {
+        unsigned code = 0;
+        if (end_ - p_ < 4 || std::from_chars(p_, p_ + 4, code, 16).ptr != p_ + 4) {
+            fail("invalid \\u escape");
+        }
+        p_ += 4;
+        return code;
+    }
+
+    void appendUtf8(ArenaString& out, unsigned code) {
+        if (code < 0x80) {
+            out += static_cast<char>(code);
+        } else if (code < 0x800) {
+            out += static_cast<char>(0xC0 | (code >> 6));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        } else if (code < 0x10000) {
+            out += static_cast<char>(0xE0 | (code >> 12));
+            out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        } else {
+            out += static_cast<char>(0xF0 | (code >> 18));
+            out += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        }
+    }
+
+    // p_ is on the opening quote
+    ArenaString string() {
+        const char* start = ++p_;
+        while (p_ < end_ && *p_ != '"' && *p_ != '\\') {
+            ++p_;
+        }
+        if (p_ >= end_) {
+            fail("unterminated string");
+        }
+        ArenaString result(start, p_);
+        while (*p_ != '"') {
+            if (*p_ != '\\') {
+                result += *p_++;
+            } else if (++p_ >= end_) {
+                fail("dangling escape");
+            } else {
+                char c = *p_++;
+                switch (c) {
+                    case 'n': result += '\n'; break;
+                    case 't': result += '\t'; break;
+                    case 'r': result += '\r'; break;
+                    case 'b': result += '\b'; break;
+                    case 'f': result += '\f'; break;
+                    case 'u': {
+                        unsigned code = hex4();
+                        if (code >= 0xD800 && code < 0xDC00 && end_ - p_ >= 2 && p_[0] == '\\' && p_[1] == 'u') {
+                            p_ += 2;
+                            code = 0x10000 + ((code - 0xD800) << 10) + (hex4() - 0xDC00);
+                        }
+                        appendUtf8(result, code);
+                        break;
+                    }
+                    default: result += c; break;
+                }
+            }
+            if (p_ >= end_) {
+                fail("unterminated string");
+            }
+        }
+        ++p_;
+        return result;
+    }
+
+    // Non-negative integers are unsigned and negative ones signed, as in nlohmann's parser
+    ArenaJson number() {
+        const char* start = p_;
+        bool integral = true;
+        while (p_ < end_ && (std::isdigit(static_cast<unsigned char>(*p_)) || *p_ == '-' || *p_ == '+' ||
+                             *p_ == '.' || *p_ == 'e' || *p_ == 'E')) {
+            integral = integral && *p_ != '.' && *p_ != 'e' && *p_ != 'E';
+            ++p_;
+        }
+        if (p_ == start) {
+            fail("unexpected character");
+        }
+        if (integral) {
+            if (*start == '-') {
+                std::int64_t value = 0;
+                if (std::from_chars(start, p_, value).ptr == p_) {
+                    return ArenaJson(value);
+                }
+            } else {
+                std::uint64_t value = 0;
+                if (std::from_chars(start, p_, value).ptr == p_) {
+                    return ArenaJson(value);
+                }
+            }
+        }
+        double value = 0;
+        if (!tryParseDouble(std::string_view(start, p_ - start), value)) {
+            fail("invalid number");
+        }
+        return ArenaJson(value);
+    }
+
+    const char* p_;
+    const char* end_;
+};
+
+} // namespace
+
+JsonArena::JsonArena(std::size_t blockSize) : blockSize_(blockSize) {}
+
+void* JsonArena::allocate(std::size_t size, std::size_t alignment) {
+    for (; block_ < blocks_.size(); ++block_, offset_ = 0) {
+        Block& block = blocks_[block_];
+        std::uintptr_t base = reinterpret_cast<std::uintptr_t>(block.data.get());
+        std::size_t start = ((base + offset_ + alignment - 1) & ~(alignment - 1)) - base;
+        if (start + size <= block.size) {
+            offset_ = start + size;
+            used_ += size;
+            return block.data.get() + start;
+        }
+    }
+    // No kept block has room; oversized requests get a block of their own
+    std::size_t bytes = std::max(blockSize_, size + alignment);
+    blocks_.push_back(Block{std::unique_ptr<char[]>(new char[bytes]), bytes});
+    ++heapAllocations_;
+    block_ = blocks_.size() - 1;
+    offset_ = 0;
+    return allocate(size, alignment);
+}
+
+bool JsonArena::owns(const void* pointer) const noexcept {
+    auto address = static_cast<const char*>(pointer);
+    std::less<const char*> less;
+    for (const Block& block : blocks_) {
+        if (!less(address, block.data.get()) && less(address, block.data.get() + block.size)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void JsonArena::reset() noexcept {
+    block_ = 0;
+    offset_ = 0;
+    used_ = 0;
+}
+
+std::size_t JsonArena::capacity() const noexcept {
+    std::size_t total = 0;
+    for (const Block& block : blocks_) {
+        total += block.size;
+    }
+    return total;
+}
+
+JsonArena* JsonArena::current() noexcept {
+    return currentArena;
+}
+
+JsonArena::Scope::Scope(JsonArena& arena) noexcept : arena_(arena), previous_(currentArena) {
+    currentArena = &arena;
+}
+
+JsonArena::Scope::~Scope() {
+    currentArena = previous_;
+    arena_.reset();
+}
+
+const ArenaJson& parseArenaJson(std::string_view text) {
+    JsonArena* arena = JsonArena::current();
+    if (!arena) {
+        throw std::logic_error("parseArenaJson() called outside of a JsonArena::Scope");
+    }
+    ArenaJson document = ArenaParser(text.data(), text.data() + text.size()).document();
+    // The moved-from local is null and destroys without allocating
+    return *new (arena->allocate(sizeof(ArenaJson), alignof(ArenaJson))) ArenaJson(std::move(document));
+}
+
+double jsonDouble(const ArenaJson& value) {
+    if (value.is_string()) {
+        const auto& text = value.get_ref<const ArenaString&>();
+        return parseDouble(std::string_view(text.data(), text.size()));
+    }
+    if (value.is_number()) {
+        return value.get<double>();
+    }
+    throw std::invalid_argument("jsonDouble: expected a number or a numeric string, got " + std::string(value.type_name()));
+}
+
+} // namespace ccxt
@@ -0,0 +1,232 @@
+#include "ccxt/base/json_view.h"
+#include "ccxt/base/errors.h"
+#include "ccxt/base/number.h"
+#include <charconv>
+#include <stdexcept>
+
+namespace ccxt {
+
+namespace {
+
+bool isSpace(char c) {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+const char* skipSpace(const char* p, const char* end) {
+    while (p < end && isSpace(*p)) {
+        ++p;
+    }
+    return p;
+}
+
+// p points at an opening quote; returns the position after the closing one
+const char* skipString(const char* p, const char* end) {
+    for (++p; p < end; ++p) {
+        if (*p == '\\') {
+            ++p;
+        } else if (*p == '"') {
+            return p + 1;
+        }
+    }
+    throw BadResponse("malformed JSON: unterminated string");
+}
+
+const char* skipValue(const char* p, const char* end) {
+    if (p >= end) {
+        throw BadResponse("malformed JSON: missing value");
+    }
+    if (*p == '"') {
+        return skipString(p, end);
+    }
+    if (*p == '{' || *p == '[') {
+        int depth = 0;
+        while (p < end) {
+            char c = *p;
+            if (c == '"') {
+                p = skipString(p, end);
+                continue;
+            }
+            if (c == '{' || c == '[') {
+                ++depth;
+            } else if ((c == '}' || c == ']') && --depth == 0) {
+                return p + 1;
+            }
+            ++p;
+        }
+        throw BadResponse("malformed JSON: unterminated container");
+    }
+    while (p < end && *p != ',' && *p != '}' && *p != ']' && !isSpace(*p)) {
+        ++p;
+    }
+    return p;
+}
+
+void appendUtf8(std::string& out, unsigned codepoint) {
+    if (codepoint < 0x80) {
+        out += static_cast<char>(codepoint);
+    } else if (codepoint < 0x800) {
+        out += static_cast<char>(0xC0 | (codepoint >> 6));
+        out += static_cast<char>(0x80 | (codepoint & 0x3F));
+    } else if (codepoint < 0x10000) {
+        out += static_cast<char>(0xE0 | (codepoint >> 12));
+        out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (codepoint & 0x3F));
+    } else {
+        out += static_cast<char>(0xF0 | (codepoint >> 18));
+        out += static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (codepoint & 0x3F));
+    }
+}
+
+unsigned hex4(std::string_view text, std::size_t at) {
+    unsigned value = 0;
+    if (at + 4 > text.size() || std::from_chars(text.data() + at, text.data() + at + 4, value, 16).ptr != text.data() + at + 4) {
+        throw BadResponse("malformed JSON: invalid \\u escape");
+    }
+    return value;
+}
+
+} // namespace
+
+JsonView::JsonView(std::string_view text) {
+    const char* begin = skipSpace(text.data(), text.data() + text.size());
+    const char* end = text.data() + text.size();
+    while (end > begin && isSpace(end[-1])) {
+        --end;
+    }
+    raw_ = std::string_view(begin, end - begin);
+}
+
+bool JsonView::next(const char*& cursor, const char* end, std::string_view* key, std::string_view& value) {
+    cursor = skipSpace(cursor, end);
+    if (cursor < end && *cursor == ',') {
+        cursor = skipSpace(cursor + 1, end);
+    }
+    if (cursor >= end) {
+        return false;
+    }
+    if (key) {
+        if (*cursor != '"') {
+            throw BadResponse("malformed JSON: expected a member name");
+        }
+        const char* keyEnd = skipString(cursor, end);
+        *key = std::string_view(cursor + 1, keyEnd - cursor - 2);
+        cursor = skipSpace(keyEnd, end);
+        if (cursor >= end || *cursor != ':') {
+            throw BadResponse("malformed JSON: expected ':'");
+        }
+        cursor = skipSpace(cursor + 1, end);
+    }
+    const char* valueEnd = skipValue(cursor, end);
+    value = std::string_view(cursor, valueEnd - cursor);
+    cursor = valueEnd;
+    return true;
+}
+
+bool JsonView::isNumber() const noexcept {
+    return valid() && (raw_.front() == '-' || (raw_.front() >= '0' && raw_.front() <= '9'));
+}
+
+JsonView JsonView::operator[](std::string_view key) const {
+    if (!isObject()) {
+        return JsonView();
+    }
+    const char* cursor = raw_.data() + 1;
+    const char* end = raw_.data() + raw_.size() - 1;
+    std::string_view name;
+    for (std::string_view value; next(cursor, end, &name, value);) {
+        if (name == key) {
+            return JsonView(value, Trusted{});
+        }
+    }
+    return JsonView();
+}
+
+JsonView JsonView::operator[](std::size_t index) const {
+    if (!isArray()) {
+        return JsonView();
+    }
+    const char* cursor = raw_.data() + 1;
+    const char* end = raw_.data() + raw_.size() - 1;
+    for (std::string_view value; next(cursor, end, nullptr, value); --index) {
+        if (index == 0) {
+            return JsonView(value, Trusted{});
+        }
+    }
+    return JsonView();
+}
+
+std::string_view JsonView::stringView() const {
+    if (!isString() || raw_.size() < 2) {
+        throw std::invalid_argument("JsonView: not a string: " + std::string(raw_));
+    }
+    return raw_.substr(1, raw_.size() - 2);
+}
+
+std::string JsonView::string() const {
+    std::string_view text = stringView();
+    std::string result;
+    result.reserve(text.size());
+    for (std::size_t i = 0; i < text.size(); ++i) {
+        if (text[i] != '\\') {
+            result += text[i];
+            continue;
+        }
+        if (++i >= text.size()) {
+            throw BadResponse("malformed JSON: dangling escape");
+        }
+        switch (text[i]) {
+            case 'n': result += '\n'; break;
+            case 't': result += '\t'; break;
+            case 'r': result += '\r'; break;
+            case 'b': result += '\b'; break;
+            case 'f': result += '\f'; break;
+            case 'u': {
+                unsigned codepoint = hex4(text, i + 1);
+                i += 4;
+                if (codepoint >= 0xD800 && codepoint < 0xDC00 && i + 2 < text.size() && text[i + 1] == '\\' && text[i + 2] == 'u') {
+                    unsigned low = hex4(text, i + 3);
+                    codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+                    i += 6;
+                }
+                appendUtf8(result, codepoint);
+                break;
+            }
+            default: result += text[i]; break;
+        }
+    }
+    return result;
+}
+
+double JsonView::number() const {
+    if (isString()) {
+        return parseDouble(stringView());
+    }
+    if (isNumber()) {
+        return parseDouble(raw_);
+    }
+    throw std::invalid_argument("JsonView: expected a number or a numeric string, got " + std::string(raw_));
+}
+
+std::int64_t JsonView::integer() const {
+    std::string_view text = isString() ? stringView() : raw_;
+    std::int64_t value = 0;
+    auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (result.ec == std::errc() && result.ptr == text.data() + text.size()) {
+        return value;
+    }
+    return static_cast<std::int64_t>(number());
+}
+
+bool JsonView::boolean() const {
+    if (raw_ == "true") {
+        return true;
+    }
+    if (raw_ == "false") {
+        return false;
+    }
+    throw std::invalid_argument("JsonView: not a boolean: " + std::string(raw_));
+}
+
+} // namespace ccxt
@@ -0,0 +1,230 @@
+#include "ccxt/base/market_registry.h"
+#include "ccxt/base/errors.h"
+#include <algorithm>
+#include <unordered_map>
+
+namespace ccxt {
+
+namespace {
+
+PrecisionRule ruleOf(const std::optional<std::string>& value, CountingMode mode, PaddingMode padding) {
+    if (value) {
+        try {
+            Precise precision(*value);
+            if (mode == CountingMode::TickSize) {
+                if (precision.gt(Precise(0))) {
+                    return PrecisionRule::tickSize(precision, padding);
+                }
+            } else {
+                int digits = static_cast<int>(precision.toDouble());
+                return mode == CountingMode::SignificantDigits ? PrecisionRule::significantDigits(digits, padding)
+                                                               : PrecisionRule::decimalPlaces(digits, padding);
+            }
+        } catch (const std::exception&) {
+            // Not a number: treated as not reported
+        }
+    }
+    // Markets loaded without a precision keep the historical 8 decimals
+    return PrecisionRule::decimalPlaces(8, padding);
+}
+
+MarketPrecision precisionOf(const Market& market, CountingMode precisionMode, PaddingMode paddingMode) {
+    CountingMode mode = market.precisionMode.value_or(precisionMode);
+    return MarketPrecision{ruleOf(market.pricePrecision, mode, paddingMode),
+                           ruleOf(market.amountPrecision, mode, paddingMode)};
+}
+
+} // namespace
+
+MarketRegistry::MarketRegistry(std::vector<Market> markets, CountingMode precisionMode, PaddingMode paddingMode)
+    : markets_(std::move(markets)) {
+    if (markets_.size() >= npos) {
+        throw Error("too many markets for a 32-bit market handle");
+    }
+    // Power of two with a load factor of at most one half
+    std::size_t capacity = 8;
+    while (capacity < markets_.size() * 2) {
+        capacity <<= 1;
+    }
+    mask_ = capacity - 1;
+    symbolIndex_.resize(capacity);
+    precisions_.reserve(markets_.size());
+    for (Handle handle = 0; handle < markets_.size(); ++handle) {
+        insert(symbolIndex_, &Market::symbol, handle);
+        precisions_.push_back(precisionOf(markets_[handle], precisionMode, paddingMode));
+    }
+    buildIdIndex();
+}
+
+void MarketRegistry::buildIdIndex() {
+    std::unordered_map<std::string_view, Handle> distinct;
+    std::vector<std::pair<std::uint64_t, Handle>> keys;
+    for (Handle handle = 0; handle < markets_.size(); ++handle) {
+        if (distinct.emplace(markets_[handle].id, handle).second) {
+            keys.emplace_back(hash(markets_[handle].id), handle);
+        }
+    }
+    if (keys.empty()) {
+        return;
+    }
+    // Load factor between 0.4 and 0.8 and about four keys per bucket keep the
+    // seed search short even for tens of thousands of ids
+    for (std::size_t capacity = 8;; capacity <<= 1) {
+        if (capacity < keys.size() + keys.size() / 4) {
+            continue;
+        }
+        std::size_t bucketCount = 1;
+        while (bucketCount * 4 < keys.size()) {
+            bucketCount <<= 1;
+        }
+        std::vector<std::vector<std::size_t>> buckets(bucketCount);
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            buckets[(keys[i].first >> 32) & (bucketCount - 1)].push_back(i);
+        }
+        std::vector<std::size_t> order(bucketCount);
+        for (std::size_t i = 0; i < bucketCount; ++i) {
+            order[i] = i;
+        }
+        std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+            return buckets[a].size() > buckets[b].size();
+        });
+
+        std::size_t mask = capacity - 1;
+        std::vector<std::uint32_t> seeds(bucketCount, 0);
+        std::vector<Handle> slots(capacity, npos);
+        std::vector<std::size_t> placed;
+        bool complete = true;
+        for (std::size_t bucket : order) {
+            if (buckets[bucket].empty()) {
+                break;
+            }
+            bool found = false;
+            for (std::uint32_t seed = 0; seed < (1u << 16) && !found; ++seed) {
+                placed.clear();
+                found = true;
+                for (std::size_t key : buckets[bucket]) {
+                    std::size_t slot = displace(keys[key].first, seed, mask);
+                    if (slots[slot] != npos || std::find(placed.begin(), placed.end(), slot) != placed.end()) {
+                        found = false;
+                        break;
+                    }
+                    placed.push_back(slot);
+                }
+                if (found) {
+                    seeds[bucket] = seed;
+                    for (std::size_t i = 0; i < placed.size(); ++i) {
+                        slots[placed[i]] = keys[buckets[bucket][i]].second;
+                    }
+                }
+            }
+            if (!found) {
+                complete = false;
+                break;
+            }
+        }
+        if (complete) {
+            idSeeds_ = std::move(seeds);
+            idSlots_ = std::move(slots);
+            idMask_ = mask;
+            return;
+        }
+    }
+}
+
+std::uint64_t MarketRegistry::hash(std::string_view key) noexcept {
+    // FNV-1a: market ids and symbols are short, so this beats anything fancier
+    std::uint64_t value = 14695981039346656037ULL;
+    for (unsigned char c : key) {
+        value ^= c;
+        value *= 1099511628211ULL;
+    }
+    return value;
+}
+
+std::size_t MarketRegistry::displace(std::uint64_t hash, std::uint32_t seed, std::size_t mask) noexcept {
+    // splitmix64 finalizer over the key hash perturbed by the bucket seed
+    std::uint64_t value = hash ^ (static_cast<std::uint64_t>(seed) * 0x9E3779B97F4A7C15ULL);
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return static_cast<std::size_t>(value ^ (value >> 31)) & mask;
+}
+
+void MarketRegistry::insert(std::vector<Slot>& index, const std::string Market::*field, Handle handle) {
+    std::string_view key = markets_[handle].*field;
+    std::uint64_t value = hash(key);
+    auto tag = static_cast<std::uint32_t>(value >> 32);
+    for (std::size_t slot = value & mask_;; slot = (slot + 1) & mask_) {
+        if (index[slot].handle == npos) {
+            index[slot] = Slot{tag, handle};
+            return;
+        }
+        if (index[slot].hash == tag && markets_[index[slot].handle].*field == key) {
+            return;
+        }
+    }
+}
+
+MarketRegistry::Handle MarketRegistry::find(const std::vector<Slot>& index, std::string_view key,
+                                            const std::string Market::*field) const noexcept {
+    if (index.empty()) {
+        return npos;
+    }
+    std::uint64_t value = hash(key);
+    auto tag = static_cast<std::uint32_t>(value >> 32);
+    for (std::size_t slot = value & mask_;; slot = (slot + 1) & mask_) {
+        const Slot& entry = index[slot];
+        if (entry.handle == npos) {
+            return npos;
+        }
+        if (entry.hash == tag && markets_[entry.handle].*field == key) {
+            return entry.handle;
+        }
+    }
+}
+
+MarketRegistry::Handle MarketRegistry::findId(std::string_view id) const noexcept {
+    if (!idSlots_.empty()) {
+        std::uint64_t value = hash(id);
+        Handle handle = idSlots_[displace(value, idSeeds_[(value >> 32) & (idSeeds_.size() - 1)], idMask_)];
+        if (handle != npos && markets_[handle].id == id) {
+            return handle;
+        }
+    }
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return npos;
+}
+
+const Market* MarketRegistry::bySymbol(std::string_view symbol) const noexcept {
+    Handle handle = findSymbol(symbol);
+    return handle == npos ? nullptr : &markets_[handle];
+}
+
+const Market* MarketRegistry::byId(std::string_view id) const noexcept {
+    Handle handle = findId(id);
+    return handle == npos ? nullptr : &markets_[handle];
+}
+
+MarketChanges MarketChanges::between(std::shared_ptr<const MarketRegistry> previous,
+                                     std::shared_ptr<const MarketRegistry> current) {
+    MarketChanges changes;
+    changes.previous = previous ? std::move(previous) : std::make_shared<const MarketRegistry>();
+    changes.current = current ? std::move(current) : std::make_shared<const MarketRegistry>();
+    const MarketRegistry& before = *changes.previous;
+    const MarketRegistry& after = *changes.current;
+    for (MarketRegistry::Handle handle = 0; handle < after.size(); ++handle) {
+        MarketRegistry::Handle old = before.findSymbol(after[handle].symbol);
+        if (old == MarketRegistry::npos) {
+            changes.added.push_back(handle);
+        } else if (before[old] != after[handle]) {
+            changes.changed.push_back(handle);
+        }
+    }
+    for (MarketRegistry::Handle handle = 0; handle < before.size(); ++handle) {
+        if (after.findSymbol(before[handle].symbol) == MarketRegistry::npos) {
+            changes.removed.push_back(handle);
+        }
+    }
+    return changes;
+}
+
+} // namespace ccxt
@@ -0,0 +1,108 @@
+#include "ccxt/base/number.h"
+#include <charconv>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+namespace ccxt {
+
+namespace {
+
+std::string_view trimLeading(std::string_view text) {
+    std::size_t i = 0;
+    while (i < text.size() && (text[i] == ' ' || text[i] == '\t' || text[i] == '\n' || text[i] == '\r')) {
+        ++i;
+    }
+    // from_chars rejects a leading '+', stod accepts it
+    if (i < text.size() && text[i] == '+' && i + 1 < text.size() && text[i + 1] != '-') {
+        ++i;
+    }
+    return text.substr(i);
+}
+
+} // namespace
+
+bool tryParseDouble(std::string_view text, double& value) noexcept {
+    text = trimLeading(text);
+    auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+    return result.ec == std::errc();
+}
+
+double parseDouble(std::string_view text) {
+    std::string_view trimmed = trimLeading(text);
+    double value = 0.0;
+    auto result = std::from_chars(trimmed.data(), trimmed.data() + trimmed.size(), value);
+    if (result.ec == std::errc::invalid_argument) {
+        throw std::invalid_argument("parseDouble: not a number: '" + std::string(text) + "'");
+    }
+    if (result.ec == std::errc::result_out_of_range) {
+        throw std::out_of_range("parseDouble: out of range: '" + std::string(text) + "'");
+    }
+    return value;
+}
+
+std::int64_t parseScaled(std::string_view text, int decimals) {
+    text = trimLeading(text);
+    std::size_t i = 0;
+    bool negative = false;
+    if (i < text.size() && text[i] == '-') {
+        negative = true;
+        ++i;
+    }
+    // Accumulate as a negative number so that INT64_MIN stays representable
+    std::int64_t value = 0;
+    bool digits = false;
+    int fraction = -1;
+    for (; i < text.size(); ++i) {
+        char c = text[i];
+        if (c == '.' && fraction < 0) {
+            fraction = 0;
+            continue;
+        }
+        if (c < '0' || c > '9') {
+            break;
+        }
+        digits = true;
+        if (fraction >= decimals) {
+            continue;
+        }
+        if (value < (std::numeric_limits<std::int64_t>::min() + (c - '0')) / 10) {
+            throw std::out_of_range("parseScaled: out of range: '" + std::string(text) + "'");
+        }
+        value = value * 10 - (c - '0');
+        if (fraction >= 0) {
+            ++fraction;
+        }
+    }
+    // An exponent or any other trailing text would otherwise truncate the
+    // amount silently: "1e-5" is not 1
+    if (!digits || i < text.size()) {
+        throw std::invalid_argument("parseScaled: not a number: '" + std::string(text) + "'");
+    }
+    for (int pad = fraction < 0 ? decimals : decimals - fraction; pad > 0; --pad) {
+        if (value < std::numeric_limits<std::int64_t>::min() / 10) {
+            throw std::out_of_range("parseScaled: out of range: '" + std::string(text) + "'");
+        }
+        value *= 10;
+    }
+    if (!negative) {
+        if (value == std::numeric_limits<std::int64_t>::min()) {
+            throw std::out_of_range("parseScaled: out of range: '" + std::string(text) + "'");
+        }
+        value = -value;
+    }
+    return value;
+}
+
+double jsonDouble(const nlohmann::json& value) {
+    if (value.is_string()) {
+        return parseDouble(value.get_ref<const std::string&>());
+    }
+    if (value.is_number()) {
+        return value.get<double>();
+    }
+    throw std::invalid_argument("jsonDouble: expected a number or a numeric string, got " + std::string(value.type_name()));
+}
+
+} // namespace ccxt
@@ -1,56 +1,149 @@
 #include "ccxt/base/precise.h"
-#include <sstream>
-#include <iomanip>
+#include <charconv>
 #include <cmath>
-#include <algorithm>
-#include <regex>
+#include <stdexcept>
+#include <system_error>
 
 namespace ccxt {
 
-Precise::Precise(const std::string& str) : value(normalize(str)) {}
+namespace {
 
-Precise::Precise(const char* str) : value(normalize(std::string(str))) {}
+using Integer = Precise::Integer;
 
-Precise::Precise(int val) : value(std::to_string(val)) {}
+constexpr int maxDigits = 38;
+// Largest exponent parse() accepts. Far beyond any price or amount, and it
+// keeps decimals - exponent well inside int
+constexpr int maxExponent = 1000;
 
-Precise::Precise(long val) : value(std::to_string(val)) {}
+struct Powers {
+    Integer values[maxDigits + 1];
+    constexpr Powers() : values() {
+        values[0] = 1;
+        for (int i = 1; i <= maxDigits; ++i) {
+            values[i] = values[i - 1] * 10;
+        }
+    }
+};
+
+constexpr Powers powers;
+
+Integer magnitude(Integer value) {
+    return value < 0 ? -value : value;
+}
+
+} // namespace
+
+Precise::Precise(const std::string& str) : Precise(parse(str)) {}
+
+Precise::Precise(const char* str) : Precise(parse(str)) {}
+
+Precise::Precise(std::string_view str) : Precise(parse(str)) {}
+
+Precise::Precise(int val) : integer_(val) {}
+
+Precise::Precise(long val) : integer_(val) {}
 
 Precise::Precise(double val) {
-    std::stringstream ss;
-    ss << std::fixed << std::setprecision(20) << val;
-    value = normalize(ss.str());
-}
-
-std::string Precise::normalize(const std::string& string) {
-    std::string result = string;
-    
-    // Remove leading zeros
-    result = std::regex_replace(result, std::regex("^0+"), "");
-    
-    // Handle negative numbers
-    bool isNegative = false;
-    if (!result.empty() && result[0] == '-') {
-        isNegative = true;
-        result = result.substr(1);
-    }
-    
-    // Handle decimal point
-    size_t decimalPos = result.find('.');
-    if (decimalPos != std::string::npos) {
-        // Remove trailing zeros after decimal point
-        result = std::regex_replace(result, std::regex("0+$"), "");
-        // Remove decimal point if no decimals
-        if (result.back() == '.') {
-            result.pop_back();
+    if (!std::isfinite(val)) {
+        throw std::invalid_argument("Precise: non-finite number");
+    }
+    // Shortest representation that round-trips, so 0.1 stays 0.1
+    char buffer[32];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), val);
+    *this = parse(std::string_view(buffer, result.ptr - buffer));
+}
+
+Precise::Precise(Integer integer, int decimals) : integer_(integer), decimals_(decimals) {
+    if (decimals_ < 0) {
+        integer_ = scale(integer_, -decimals_);
+        decimals_ = 0;
+    }
+    normalize();
+}
+
+void Precise::normalize() {
+    if (integer_ == 0) {
+        decimals_ = 0;
+        return;
+    }
+    while (decimals_ > 0 && integer_ % 10 == 0) {
+        integer_ /= 10;
+        --decimals_;
+    }
+}
+
+Integer Precise::scale(Integer integer, int digits) {
+    while (digits > 0) {
+        int step = digits > maxDigits ? maxDigits : digits;
+        Integer result;
+        if (__builtin_mul_overflow(integer, powers.values[step], &result)) {
+            throw std::overflow_error("Precise: value exceeds 128-bit range");
         }
+        integer = result;
+        digits -= step;
+    }
+    return integer;
+}
+
+Precise Precise::parse(std::string_view string) {
+    std::size_t i = 0;
+    bool negative = false;
+    if (i < string.size() && (string[i] == '-' || string[i] == '+')) {
+        negative = string[i] == '-';
+        ++i;
     }
-    
-    // Handle empty or zero string
-    if (result.empty() || result == "0") {
-        return "0";
+    Integer integer = 0;
+    int decimals = 0;
+    // Zeros after the last significant digit are only counted, so that
+    // "1.000000000000000000000000000000000000000" does not overflow
+    int zeros = 0;
+    bool digits = false;
+    bool fraction = false;
+    for (; i < string.size(); ++i) {
+        char c = string[i];
+        if (c >= '0' && c <= '9') {
+            digits = true;
+            decimals += fraction;
+            if (c == '0') {
+                zeros += integer != 0;
+                continue;
+            }
+            integer = scale(integer, zeros);
+            zeros = 0;
+            if (__builtin_mul_overflow(integer, 10, &integer) || __builtin_add_overflow(integer, c - '0', &integer)) {
+                throw std::overflow_error("Precise: too many digits in " + std::string(string));
+            }
+        } else if (c == '.' && !fraction) {
+            fraction = true;
+        } else {
+            break;
+        }
     }
-    
-    return isNegative ? "-" + result : result;
+    decimals -= zeros;
+    if (!digits) {
+        if (string.empty()) {
+            return Precise(Integer(0), 0);
+        }
+        throw std::invalid_argument("Precise: invalid number " + std::string(string));
+    }
+    if (i < string.size() && (string[i] == 'e' || string[i] == 'E')) {
+        int exponent = 0;
+        const char* begin = string.data() + i + 1;
+        if (begin < string.data() + string.size() && *begin == '+') {
+            ++begin;
+        }
+        auto result = std::from_chars(begin, string.data() + string.size(), exponent);
+        if (result.ec != std::errc() || result.ptr != string.data() + string.size()) {
+            throw std::invalid_argument("Precise: invalid number " + std::string(string));
+        }
+        if (exponent > maxExponent || exponent < -maxExponent) {
+            throw std::overflow_error("Precise: exponent out of range in " + std::string(string));
+        }
+        decimals -= exponent;
+    } else if (i != string.size()) {
+        throw std::invalid_argument("Precise: invalid number " + std::string(string));
+    }
+    return Precise(negative ? -integer : integer, decimals);
 }
 
 Precise Precise::string_mul(const std::string& string1, const std::string& string2) {
@@ -98,88 +191,159 @@ int Precise::string_le(const std::string& string1, const std::string& string2) {
 }
 
 Precise Precise::mul(const Precise& other) const {
-    // Implement multiplication for arbitrary precision arithmetic
-    // This is a simplified implementation
-    double val1 = std::stod(value);
-    double val2 = std::stod(other.value);
-    return Precise(val1 * val2);
+    Integer result;
+    if (__builtin_mul_overflow(integer_, other.integer_, &result)) {
+        throw std::overflow_error("Precise: product exceeds 128-bit range");
+    }
+    return Precise(result, decimals_ + other.decimals_);
 }
 
 Precise Precise::div(const Precise& other, int precision) const {
-    // Implement division for arbitrary precision arithmetic
-    // This is a simplified implementation
-    if (other.value == "0") {
+    if (other.integer_ == 0) {
         throw std::runtime_error("Division by zero");
     }
-    double val1 = std::stod(value);
-    double val2 = std::stod(other.value);
-    return Precise(val1 / val2);
+    // (a / 10^da) / (b / 10^db) = a * 10^(precision - da + db) / b / 10^precision
+    int distance = precision - decimals_ + other.decimals_;
+    Integer numerator = integer_;
+    Integer denominator = other.integer_;
+    if (distance >= 0) {
+        numerator = scale(numerator, distance);
+    } else {
+        denominator = scale(denominator, -distance);
+    }
+    return Precise(numerator / denominator, precision);
 }
 
 Precise Precise::add(const Precise& other) const {
-    // Implement addition for arbitrary precision arithmetic
-    // This is a simplified implementation
-    double val1 = std::stod(value);
-    double val2 = std::stod(other.value);
-    return Precise(val1 + val2);
+    int decimals = decimals_ > other.decimals_ ? decimals_ : other.decimals_;
+    Integer result;
+    if (__builtin_add_overflow(scale(integer_, decimals - decimals_),
+                               scale(other.integer_, decimals - other.decimals_), &result)) {
+        throw std::overflow_error("Precise: sum exceeds 128-bit range");
+    }
+    return Precise(result, decimals);
 }
 
 Precise Precise::sub(const Precise& other) const {
-    // Implement subtraction for arbitrary precision arithmetic
-    // This is a simplified implementation
-    double val1 = std::stod(value);
-    double val2 = std::stod(other.value);
-    return Precise(val1 - val2);
+    return add(Precise(-other.integer_, other.decimals_));
 }
 
 Precise Precise::mod(const Precise& other) const {
-    // Implement modulo for arbitrary precision arithmetic
-    // This is a simplified implementation
-    if (other.value == "0") {
+    if (other.integer_ == 0) {
         throw std::runtime_error("Modulo by zero");
     }
-    double val1 = std::stod(value);
-    double val2 = std::stod(other.value);
-    return Precise(std::fmod(val1, val2));
+    int decimals = decimals_ > other.decimals_ ? decimals_ : other.decimals_;
+    // Truncated remainder: the sign follows the dividend, as in JavaScript
+    return Precise(scale(integer_, decimals - decimals_) % scale(other.integer_, decimals - other.decimals_), decimals);
 }
 
 Precise Precise::pow(const Precise& other) const {
-    // Implement power for arbitrary precision arithmetic
-    // This is a simplified implementation
-    double val1 = std::stod(value);
-    double val2 = std::stod(other.value);
-    return Precise(std::pow(val1, val2));
+    if (other.decimals_ != 0 || magnitude(other.integer_) > 1024) {
+        return Precise(std::pow(toDouble(), other.toDouble()));
+    }
+    Precise result(Integer(1), 0);
+    Precise base = *this;
+    for (Integer exponent = magnitude(other.integer_); exponent > 0; exponent >>= 1) {
+        if (exponent & 1) {
+            result = result.mul(base);
+        }
+        if (exponent > 1) {
+            base = base.mul(base);
+        }
+    }
+    return other.integer_ < 0 ? Precise(Integer(1), 0).div(result) : result;
+}
+
+int Precise::compare(const Precise& a, const Precise& b) {
+    if ((a.integer_ < 0) != (b.integer_ < 0)) {
+        return a.integer_ < 0 ? -1 : 1;
+    }
+    int decimals = a.decimals_ > b.decimals_ ? a.decimals_ : b.decimals_;
+    Integer left;
+    Integer right;
+    try {
+        left = scale(a.integer_, decimals - a.decimals_);
+        right = scale(b.integer_, decimals - b.decimals_);
+    } catch (const std::overflow_error&) {
+        // Only the operand with fewer decimals is scaled; overflowing means it
+        // has the larger magnitude
+        bool aLarger = a.decimals_ < b.decimals_;
+        bool negative = a.integer_ < 0;
+        return aLarger != negative ? 1 : -1;
+    }
+    return left < right ? -1 : (left > right ? 1 : 0);
 }
 
 bool Precise::eq(const Precise& other) const {
-    return value == other.value;
+    // Both sides are normalized, so equal values have equal representations
+    return integer_ == other.integer_ && decimals_ == other.decimals_;
 }
 
 bool Precise::gt(const Precise& other) const {
-    // This is a simplified implementation
-    double val1 = std::stod(value);
-    double val2 = std::stod(other.value);
-    return val1 > val2;
+    return compare(*this, other) > 0;
 }
 
 bool Precise::ge(const Precise& other) const {
-    return gt(other) || eq(other);
+    return compare(*this, other) >= 0;
 }
 
 bool Precise::lt(const Precise& other) const {
-    return !ge(other);
+    return compare(*this, other) < 0;
 }
 
 bool Precise::le(const Precise& other) const {
-    return !gt(other);
+    return compare(*this, other) <= 0;
+}
+
+char* Precise::toChars(char* first, char* last) const {
+    char digits[maxDigits + 2];
+    int count = 0;
+    Integer value = magnitude(integer_);
+    do {
+        digits[count++] = static_cast<char>('0' + static_cast<int>(value % 10));
+        value /= 10;
+    } while (value > 0);
+
+    int whole = count > decimals_ ? count - decimals_ : 0;
+    std::size_t length = (integer_ < 0) + (whole ? whole : 1) + (decimals_ ? decimals_ + 1 : 0);
+    if (static_cast<std::size_t>(last - first) < length) {
+        return nullptr;
+    }
+    char* out = first;
+    if (integer_ < 0) {
+        *out++ = '-';
+    }
+    if (whole == 0) {
+        *out++ = '0';
+    }
+    for (int i = count - 1; i >= decimals_; --i) {
+        *out++ = digits[i];
+    }
+    if (decimals_ > 0) {
+        *out++ = '.';
+        for (int i = decimals_ - 1; i >= 0; --i) {
+            *out++ = i < count ? digits[i] : '0';
+        }
+    }
+    return out;
 }
 
 std::string Precise::toString() const {
-    return value;
+    std::string result(maxDigits + 3 + static_cast<std::size_t>(decimals_), '\0');
+    char* end = toChars(result.data(), result.data() + result.size());
+    result.resize(end - result.data());
+    return result;
 }
 
 double Precise::toDouble() const {
-    return std::stod(value);
+    char buffer[64];
+    char* end = toChars(buffer, buffer + sizeof(buffer));
+    if (!end) {
+        return std::stod(toString());
+    }
+    double result = 0.0;
+    std::from_chars(buffer, end, result);
+    return result;
 }
 
 } // namespace ccxt
@@ -0,0 +1,130 @@
+#include "ccxt/base/prepared_request.h"
+#include <charconv>
+#include <stdexcept>
+
+namespace ccxt {
+
+namespace {
+
+bool needsEscape(char c) {
+    return c == '+' || c == '/' || c == '=';
+}
+
+// Percent-encodes the base64 characters of a signature written at text[start..]
+void escapeSignature(std::string& text, std::size_t start) {
+    std::size_t count = 0;
+    for (std::size_t i = start; i < text.size(); ++i) {
+        count += needsEscape(text[i]);
+    }
+    if (!count) {
+        return;
+    }
+    static constexpr char digits[] = "0123456789ABCDEF";
+    std::size_t from = text.size();
+    text.resize(from + 2 * count);
+    for (std::size_t to = text.size(); from > start;) {
+        char c = text[--from];
+        if (needsEscape(c)) {
+            text[--to] = digits[c & 15];
+            text[--to] = digits[(c >> 4) & 15];
+            text[--to] = '%';
+        } else {
+            text[--to] = c;
+        }
+    }
+}
+
+} // namespace
+
+PreparedRequest::PreparedRequest(std::string method, std::string url, std::map<std::string, std::string> headers,
+                                 std::string_view params, const Signer* signer, bool inBody,
+                                 std::string signatureKey)
+    : method_(std::move(method)), url_(std::move(url)), headers_(std::move(headers)), signer_(signer),
+      inBody_(inBody), signatureKey_(std::move(signatureKey)) {
+    std::string literal;
+    for (std::size_t i = 0; i < params.size(); ++i) {
+        if (params[i] == '}') {
+            throw std::invalid_argument("PreparedRequest: unmatched '}' in " + std::string(params));
+        }
+        if (params[i] != '{') {
+            literal += params[i];
+            continue;
+        }
+        std::size_t close = params.find('}', i);
+        if (close == std::string_view::npos || close == i + 1) {
+            throw std::invalid_argument("PreparedRequest: malformed placeholder in " + std::string(params));
+        }
+        Field field;
+        field.name = params.substr(i + 1, close - i - 1);
+        if (field.name.back() == '?') {
+            field.name.pop_back();
+            field.optional = true;
+            std::size_t amp = literal.rfind('&');
+            if (amp == std::string::npos) {
+                throw std::invalid_argument("PreparedRequest: optional {" + field.name + "?} must follow '&'");
+            }
+            field.key = literal.substr(amp);
+            literal.resize(amp);
+        }
+        field.prefix = std::move(literal);
+        field.value.reserve(32);
+        literal.clear();
+        fields_.push_back(std::move(field));
+        i = close;
+    }
+    suffix_ = std::move(literal);
+
+    if (!inBody_) {
+        url_ += url_.find('?') == std::string::npos ? '?' : '&';
+    }
+    std::string& text = inBody_ ? body_ : url_;
+    textStart_ = text.size();
+    std::size_t capacity = textStart_ + suffix_.size() + signatureKey_.size() + 256;
+    for (const Field& field : fields_) {
+        capacity += field.prefix.size() + field.key.size() + 32;
+    }
+    text.reserve(capacity);
+}
+
+std::size_t PreparedRequest::field(std::string_view name) const {
+    for (std::size_t i = 0; i < fields_.size(); ++i) {
+        if (fields_[i].name == name) {
+            return i;
+        }
+    }
+    throw std::invalid_argument("PreparedRequest: no field {" + std::string(name) + "}");
+}
+
+void PreparedRequest::set(std::size_t field, std::string_view value) {
+    fields_.at(field).value.assign(value.data(), value.size());
+}
+
+void PreparedRequest::set(std::size_t field, long long value) {
+    char buffer[24];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    set(field, std::string_view(buffer, result.ptr - buffer));
+}
+
+void PreparedRequest::render() {
+    std::string& text = inBody_ ? body_ : url_;
+    text.resize(textStart_);
+    for (const Field& field : fields_) {
+        text += field.prefix;
+        if (!field.optional || !field.value.empty()) {
+            text += field.key;
+            text += field.value;
+        }
+    }
+    text += suffix_;
+    if (signer_) {
+        std::size_t end = text.size();
+        text += '&';
+        text += signatureKey_;
+        text += '=';
+        std::size_t start = text.size();
+        signer_->appendSignature(std::string_view(text).substr(textStart_, end - textStart_), text);
+        escapeSignature(text, start);
+    }
+}
+
+} // namespace ccxt
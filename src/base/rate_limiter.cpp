@@ -0,0 +1,143 @@
+#include "ccxt/base/rate_limiter.h"
+#include "ccxt/base/errors.h"
+#include <algorithm>
+#include <map>
+
+namespace ccxt {
+
+namespace {
+
+std::mutex registryMutex;
+std::map<std::string, std::weak_ptr<RateLimiter>> registry;
+
+} // namespace
+
+std::shared_ptr<RateLimiter> RateLimiter::shared(const std::string& key, const Options& options) {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    auto& slot = registry[key];
+    auto limiter = slot.lock();
+    if (!limiter) {
+        limiter = std::make_shared<RateLimiter>(options);
+        slot = limiter;
+    }
+    return limiter;
+}
+
+RateLimiter::RateLimiter() : RateLimiter(Options()) {}
+
+RateLimiter::RateLimiter(const Options& options)
+    : options_(options), tokens_(options.capacity), rateLimit_(options.rateLimit), updated_(Clock::now()) {}
+
+void RateLimiter::refill(Clock::time_point now) const {
+    double elapsedMs = std::chrono::duration<double, std::milli>(now - updated_).count();
+    if (elapsedMs > 0 && rateLimit_ > 0) {
+        tokens_ = std::min(options_.capacity, tokens_ + elapsedMs / rateLimit_);
+    }
+    updated_ = now;
+    adapt(now);
+}
+
+void RateLimiter::adapt(Clock::time_point now) const {
+    double pace = 0.0;
+    for (auto it = windows_.begin(); it != windows_.end();) {
+        if (it->second.expires <= now) {
+            it = windows_.erase(it);
+            continue;
+        }
+        pace = std::max(pace, it->second.rateLimit);
+        ++it;
+    }
+    rateLimit_ = windows_.empty() ? options_.rateLimit : pace;
+}
+
+void RateLimiter::prune(Clock::time_point now) const {
+    while (!queue_.empty() && queue_.front() <= now) {
+        queue_.pop_front();
+    }
+}
+
+RateLimiter::Clock::duration RateLimiter::reserve(double cost) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto now = Clock::now();
+    refill(now);
+    prune(now);
+    if (queue_.size() >= options_.maxQueue) {
+        throw RateLimitExceeded("throttle queue is over maxQueue (" + std::to_string(options_.maxQueue) + ")");
+    }
+
+    auto release = now;
+    if (tokens_ < 0) {
+        release += std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double, std::milli>(-tokens_ * rateLimit_));
+    }
+    release = std::max(release, pausedUntil_);
+    if (!queue_.empty()) {
+        release = std::max(release, queue_.back());
+    }
+    if (release > now) {
+        queue_.push_back(release);
+    }
+    tokens_ -= cost;
+    return release - now;
+}
+
+void RateLimiter::pause(Clock::duration duration) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pausedUntil_ = std::max(pausedUntil_, Clock::now() + duration);
+}
+
+void RateLimiter::reportUsage(const std::string& window, double used, double limit,
+                              std::chrono::milliseconds interval, bool pace) {
+    if (limit <= 0 || interval.count() <= 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto now = Clock::now();
+    refill(now);
+
+    auto wallMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    double leftMs = static_cast<double>(interval.count() - wallMs % interval.count());
+    auto windowEnd = now + std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double, std::milli>(leftMs));
+
+    if (used >= limit) {
+        pausedUntil_ = std::max(pausedUntil_, windowEnd);
+        windows_.erase(window);
+    } else if (pace && options_.rateLimit > 0) {
+        // Server weight bought by one unit of cost when running at the configured pace
+        double weightPerCost = limit * options_.rateLimit / interval.count();
+        double remainingCost = (limit - used) / weightPerCost;
+        double floor = options_.minRateLimit > 0 ? options_.minRateLimit : options_.rateLimit;
+        windows_[window] = Window{std::max(floor, leftMs / remainingCost), windowEnd};
+    }
+    adapt(now);
+}
+
+double RateLimiter::tokens() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    refill(Clock::now());
+    return tokens_;
+}
+
+std::size_t RateLimiter::queueDepth() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    prune(Clock::now());
+    return queue_.size();
+}
+
+double RateLimiter::rateLimit() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    adapt(Clock::now());
+    return rateLimit_;
+}
+
+void RateLimiter::setRateLimit(double rateLimit) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto now = Clock::now();
+    refill(now);
+    options_.rateLimit = rateLimit;
+    adapt(now);
+}
+
+} // namespace ccxt
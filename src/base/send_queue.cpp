@@ -0,0 +1,80 @@
+#include "ccxt/base/send_queue.h"
+
+#include <iterator>
+
+namespace ccxt {
+
+SendQueue::SendQueue(std::size_t limit) : limit_(limit) {}
+
+void SendQueue::setMerger(Merger merger, std::size_t coalesceLimit) {
+    merger_ = std::move(merger);
+    coalesceLimit_ = coalesceLimit;
+}
+
+bool SendQueue::push(std::string frame, SendPriority priority) {
+    // Checked before merging, which never yields more than the two frames
+    if (bytes_ + frame.size() > limit_) {
+        return false;
+    }
+    auto& queue = priority == SendPriority::High ? high_ : normal_;
+    if (merger_ && !queue.empty() && frame.size() <= coalesceLimit_ && queue.back().size() <= coalesceLimit_) {
+        std::string& last = queue.back();
+        std::size_t before = last.size();
+        if (merger_(last, frame)) {
+            bytes_ = bytes_ - before + last.size();
+            return true;
+        }
+    }
+    bytes_ += frame.size();
+    queue.push_back(std::move(frame));
+    return true;
+}
+
+void SendQueue::pushFront(std::vector<std::string> frames) {
+    for (const auto& frame : frames) {
+        bytes_ += frame.size();
+    }
+    normal_.insert(normal_.begin(), std::make_move_iterator(frames.begin()), std::make_move_iterator(frames.end()));
+}
+
+const std::string* SendQueue::next() {
+    if (inFlight_) {
+        return nullptr;
+    }
+    inFlightPriority_ = high_.empty() ? SendPriority::Normal : SendPriority::High;
+    auto& queue = inFlightPriority_ == SendPriority::High ? high_ : normal_;
+    if (queue.empty()) {
+        return nullptr;
+    }
+    // Swapping keeps the capacity of the previous frame for a later one
+    writing_.swap(queue.front());
+    queue.pop_front();
+    inFlight_ = true;
+    return &writing_;
+}
+
+void SendQueue::pop() {
+    if (inFlight_) {
+        bytes_ -= writing_.size();
+        writing_.clear();
+        inFlight_ = false;
+    }
+}
+
+void SendQueue::requeue() {
+    if (inFlight_) {
+        // Still counted in bytes_
+        auto& queue = inFlightPriority_ == SendPriority::High ? high_ : normal_;
+        queue.emplace_front();
+        queue.front().swap(writing_);
+        inFlight_ = false;
+    }
+}
+
+void SendQueue::clear() {
+    high_.clear();
+    normal_.clear();
+    bytes_ = inFlight_ ? writing_.size() : 0;
+}
+
+} // namespace ccxt
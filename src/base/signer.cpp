@@ -0,0 +1,615 @@
+#include "ccxt/base/signer.h"
+#include "ccxt/base/errors.h"
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <openssl/bio.h>
+#include <openssl/bn.h>
+#include <openssl/core_names.h>
+#include <openssl/ec.h>
+#include <openssl/evp.h>
+#include <openssl/obj_mac.h>
+#include <openssl/pem.h>
+
+namespace ccxt {
+
+namespace {
+
+struct OpenSslFree {
+    void operator()(BIO* p) const { BIO_free(p); }
+    void operator()(BIGNUM* p) const { BN_free(p); }
+    void operator()(BN_CTX* p) const { BN_CTX_free(p); }
+    void operator()(EC_GROUP* p) const { EC_GROUP_free(p); }
+    void operator()(EC_POINT* p) const { EC_POINT_free(p); }
+    void operator()(ECDSA_SIG* p) const { ECDSA_SIG_free(p); }
+    void operator()(EVP_MD_CTX* p) const { EVP_MD_CTX_free(p); }
+    void operator()(EVP_PKEY_CTX* p) const { EVP_PKEY_CTX_free(p); }
+};
+
+template <typename T>
+using OpenSslPtr = std::unique_ptr<T, OpenSslFree>;
+
+using Digest = std::array<unsigned char, 32>;
+
+// DER-encoded ECDSA signatures are at most 72 bytes for 256-bit curves
+constexpr std::size_t maxDerSize = 80;
+
+const unsigned char* bytes(std::string_view text) {
+    return reinterpret_cast<const unsigned char*>(text.data());
+}
+
+void append(std::string& out, const Digest& digest) {
+    out.append(reinterpret_cast<const char*>(digest.data()), digest.size());
+}
+
+bool isPem(std::string_view key) {
+    return key.find("-----BEGIN") != std::string_view::npos;
+}
+
+EVP_PKEY* readPem(std::string_view text, int type, const char* what) {
+    std::string pem;
+    pem.reserve(text.size());
+    for (std::size_t i = 0; i < text.size(); ++i) {
+        if (text[i] == '\\' && i + 1 < text.size() && text[i + 1] == 'n') {
+            pem += '\n';
+            ++i;
+        } else {
+            pem += text[i];
+        }
+    }
+    OpenSslPtr<BIO> bio(BIO_new_mem_buf(pem.data(), static_cast<int>(pem.size())));
+    EVP_PKEY* key = bio ? PEM_read_bio_PrivateKey(bio.get(), nullptr, nullptr, nullptr) : nullptr;
+    if (!key || EVP_PKEY_get_base_id(key) != type) {
+        EVP_PKEY_free(key);
+        throw AuthenticationError(std::string("invalid ") + what + " private key");
+    }
+    return key;
+}
+
+EVP_PKEY* ed25519Key(std::string_view privateKey) {
+    if (isPem(privateKey)) {
+        return readPem(privateKey, EVP_PKEY_ED25519, "Ed25519");
+    }
+    std::string seed(privateKey);
+    try {
+        if (privateKey.size() == 64) {
+            seed = hexDecode(privateKey);
+        } else if (privateKey.size() == 44) {
+            seed = base64Decode(privateKey);
+        }
+    } catch (const std::invalid_argument&) {
+    }
+    EVP_PKEY* key = seed.size() == 32
+        ? EVP_PKEY_new_raw_private_key(EVP_PKEY_ED25519, nullptr, bytes(seed), seed.size())
+        : nullptr;
+    if (!key) {
+        throw AuthenticationError("invalid Ed25519 private key");
+    }
+    return key;
+}
+
+EVP_PKEY* es256Key(std::string_view pem) {
+    EVP_PKEY* key = readPem(pem, EVP_PKEY_EC, "ES256");
+    char curve[32] = {};
+    if (!EVP_PKEY_get_utf8_string_param(key, OSSL_PKEY_PARAM_GROUP_NAME, curve, sizeof(curve), nullptr) ||
+        std::string_view(curve) != "prime256v1") {
+        EVP_PKEY_free(key);
+        throw AuthenticationError("ES256 requires a P-256 private key");
+    }
+    return key;
+}
+
+const EC_GROUP* secp256k1() {
+    static const OpenSslPtr<EC_GROUP> group(EC_GROUP_new_by_curve_name(NID_secp256k1));
+    if (!group) {
+        throw NotSupported("secp256k1 is not available");
+    }
+    return group.get();
+}
+
+// Uncompressed SEC1 point of a 32-byte private key
+std::string secp256k1PublicKey(const std::array<unsigned char, 32>& secret) {
+    const EC_GROUP* group = secp256k1();
+    OpenSslPtr<BN_CTX> context(BN_CTX_secure_new());
+    OpenSslPtr<BIGNUM> scalar(BN_secure_new());
+    OpenSslPtr<EC_POINT> point(EC_POINT_new(group));
+    if (!context || !scalar || !point || !BN_bin2bn(secret.data(), 32, scalar.get())) {
+        throw std::bad_alloc();
+    }
+    BN_set_flags(scalar.get(), BN_FLG_CONSTTIME);
+    if (BN_is_zero(scalar.get()) || BN_cmp(scalar.get(), EC_GROUP_get0_order(group)) >= 0) {
+        throw AuthenticationError("invalid secp256k1 private key");
+    }
+    unsigned char encoded[65];
+    if (!EC_POINT_mul(group, point.get(), scalar.get(), nullptr, nullptr, context.get()) ||
+        EC_POINT_point2oct(group, point.get(), POINT_CONVERSION_UNCOMPRESSED, encoded, sizeof(encoded),
+                           context.get()) != sizeof(encoded)) {
+        throw ExchangeError("secp256k1 public key derivation failed");
+    }
+    return std::string(reinterpret_cast<const char*>(encoded), sizeof(encoded));
+}
+
+// Deterministic nonce candidates of RFC 6979, section 3.2, with HMAC-SHA256
+// for a 256-bit curve order
+class Rfc6979 {
+public:
+    Rfc6979(const Digest& secret, const Digest& hash) {
+        v_.fill(0x01);
+        k_.fill(0x00);
+        for (unsigned char separator : {0x00, 0x01}) {
+            std::string data = bytesOf(v_);
+            data += static_cast<char>(separator);
+            data += bytesOf(secret);
+            data += bytesOf(hash);
+            k_ = mac(data);
+            v_ = mac(bytesOf(v_));
+        }
+    }
+
+    const Digest& next() {
+        if (started_) {
+            k_ = mac(bytesOf(v_) + '\0');
+            v_ = mac(bytesOf(v_));
+        }
+        started_ = true;
+        v_ = mac(bytesOf(v_));
+        return v_;
+    }
+
+private:
+    static std::string bytesOf(const Digest& digest) {
+        return std::string(reinterpret_cast<const char*>(digest.data()), digest.size());
+    }
+
+    Digest mac(std::string_view data) const {
+        Digest result;
+        HmacKey(HashAlgorithm::Sha256, bytesOf(k_)).sign(data, result.data());
+        return result;
+    }
+
+    Digest v_;
+    Digest k_;
+    bool started_ = false;
+};
+
+OpenSslPtr<ECDSA_SIG> parseDer(const unsigned char* der, std::size_t size) {
+    OpenSslPtr<ECDSA_SIG> signature(d2i_ECDSA_SIG(nullptr, &der, static_cast<long>(size)));
+    if (!signature) {
+        throw ExchangeError("malformed ECDSA signature");
+    }
+    return signature;
+}
+
+// Uncompressed public key that made the signature (r, s) over digest with the
+// given parity of R's y coordinate: Q = r^-1 (sR - eG)
+std::string recoverPublicKey(const Digest& digest, const EthSignature& signature) {
+    int recoveryId = signature.v >= 27 ? signature.v - 27 : signature.v;
+    if (recoveryId != 0 && recoveryId != 1) {
+        throw std::invalid_argument("recoverAddress: invalid recovery id");
+    }
+    const EC_GROUP* group = secp256k1();
+    const BIGNUM* order = EC_GROUP_get0_order(group);
+    OpenSslPtr<BN_CTX> context(BN_CTX_new());
+    OpenSslPtr<BIGNUM> r(BN_bin2bn(signature.r.data(), 32, nullptr));
+    OpenSslPtr<BIGNUM> s(BN_bin2bn(signature.s.data(), 32, nullptr));
+    OpenSslPtr<BIGNUM> e(BN_bin2bn(digest.data(), 32, nullptr));
+    OpenSslPtr<BIGNUM> rInverse(BN_new());
+    OpenSslPtr<BIGNUM> u1(BN_new());
+    OpenSslPtr<BIGNUM> u2(BN_new());
+    OpenSslPtr<EC_POINT> R(EC_POINT_new(group));
+    OpenSslPtr<EC_POINT> Q(EC_POINT_new(group));
+    if (!context || !r || !s || !e || !rInverse || !u1 || !u2 || !R || !Q) {
+        throw std::bad_alloc();
+    }
+    if (BN_is_zero(r.get()) || BN_is_zero(s.get()) || BN_cmp(r.get(), order) >= 0 || BN_cmp(s.get(), order) >= 0 ||
+        !EC_POINT_set_compressed_coordinates(group, R.get(), r.get(), recoveryId, context.get()) ||
+        !BN_mod_inverse(rInverse.get(), r.get(), order, context.get()) ||
+        !BN_mod_mul(u1.get(), e.get(), rInverse.get(), order, context.get()) ||
+        !BN_mod_mul(u2.get(), s.get(), rInverse.get(), order, context.get())) {
+        throw std::invalid_argument("recoverAddress: invalid signature");
+    }
+    if (!BN_is_zero(u1.get())) {
+        BN_sub(u1.get(), order, u1.get());
+    }
+    unsigned char encoded[65];
+    if (!EC_POINT_mul(group, Q.get(), u1.get(), R.get(), u2.get(), context.get()) ||
+        EC_POINT_is_at_infinity(group, Q.get()) ||
+        EC_POINT_point2oct(group, Q.get(), POINT_CONVERSION_UNCOMPRESSED, encoded, sizeof(encoded),
+                           context.get()) != sizeof(encoded)) {
+        throw std::invalid_argument("recoverAddress: invalid signature");
+    }
+    return std::string(reinterpret_cast<const char*>(encoded), sizeof(encoded));
+}
+
+std::string addressOf(const std::string& publicKey) {
+    Digest hash = keccak256(std::string_view(publicKey).substr(1));
+    return "0x" + hexEncode(std::string_view(reinterpret_cast<const char*>(hash.data()) + 12, 20));
+}
+
+// 32-byte big-endian two's complement word of an integer given as a json
+// number, a decimal string or a 0x-prefixed hex string
+void appendInteger(std::string& out, const json& value, bool isSigned) {
+    unsigned char word[32] = {};
+    bool negative = false;
+    if (value.is_number_integer()) {
+        std::uint64_t magnitude = value.get<std::uint64_t>();
+        if (!value.is_number_unsigned() && value.get<std::int64_t>() < 0) {
+            negative = true;
+            magnitude = 0 - magnitude;
+        }
+        for (int i = 31; magnitude; --i, magnitude >>= 8) {
+            word[i] = static_cast<unsigned char>(magnitude);
+        }
+    } else if (value.is_string()) {
+        std::string_view text = value.get_ref<const std::string&>();
+        if (!text.empty() && text[0] == '-') {
+            negative = true;
+            text.remove_prefix(1);
+        }
+        if (text.size() > 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X')) {
+            std::string digits(text.substr(2));
+            std::string raw = hexDecode(digits.size() % 2 ? "0" + digits : digits);
+            if (raw.size() > 32) {
+                throw std::invalid_argument("eip712Hash: integer out of range");
+            }
+            std::copy(raw.begin(), raw.end(), word + 32 - raw.size());
+        } else {
+            if (text.empty()) {
+                throw std::invalid_argument("eip712Hash: empty integer");
+            }
+            for (char c : text) {
+                if (c < '0' || c > '9') {
+                    throw std::invalid_argument("eip712Hash: invalid integer " + value.get<std::string>());
+                }
+                unsigned carry = c - '0';
+                for (int i = 31; i >= 0; --i) {
+                    carry += word[i] * 10u;
+                    word[i] = static_cast<unsigned char>(carry);
+                    carry >>= 8;
+                }
+                if (carry) {
+                    throw std::invalid_argument("eip712Hash: integer out of range");
+                }
+            }
+        }
+    } else {
+        throw std::invalid_argument("eip712Hash: expected an integer, got " + std::string(value.type_name()));
+    }
+    if (negative) {
+        if (!isSigned) {
+            throw std::invalid_argument("eip712Hash: negative value for an unsigned type");
+        }
+        unsigned carry = 1;
+        for (int i = 31; i >= 0; --i) {
+            carry += static_cast<unsigned char>(~word[i]);
+            word[i] = static_cast<unsigned char>(carry);
+            carry >>= 8;
+        }
+    }
+    out.append(reinterpret_cast<const char*>(word), sizeof(word));
+}
+
+class TypedDataEncoder {
+public:
+    explicit TypedDataEncoder(const json& types) : types_(types) {}
+
+    Digest hashStruct(const std::string& type, const json& value) const {
+        std::string encoded;
+        append(encoded, keccak256(encodeType(type)));
+        for (const auto& field : types_.at(type)) {
+            const std::string& name = field.at("name").get_ref<const std::string&>();
+            if (!value.contains(name)) {
+                throw std::invalid_argument("eip712Hash: " + type + " is missing " + name);
+            }
+            encodeValue(encoded, field.at("type").get_ref<const std::string&>(), value.at(name));
+        }
+        return keccak256(encoded);
+    }
+
+private:
+    // The primary type followed by the types it references, sorted by name
+    std::string encodeType(const std::string& primary) const {
+        std::set<std::string> referenced;
+        collect(primary, referenced);
+        referenced.erase(primary);
+        std::string result = member(primary);
+        for (const auto& type : referenced) {
+            result += member(type);
+        }
+        return result;
+    }
+
+    std::string member(const std::string& type) const {
+        std::string result = type + "(";
+        bool first = true;
+        for (const auto& field : types_.at(type)) {
+            result += first ? "" : ",";
+            result += field.at("type").get<std::string>() + " " + field.at("name").get<std::string>();
+            first = false;
+        }
+        return result + ")";
+    }
+
+    void collect(const std::string& type, std::set<std::string>& found) const {
+        std::string base = type.substr(0, type.find('['));
+        if (!types_.contains(base) || !found.insert(base).second) {
+            return;
+        }
+        for (const auto& field : types_.at(base)) {
+            collect(field.at("type").get<std::string>(), found);
+        }
+    }
+
+    void encodeValue(std::string& out, const std::string& type, const json& value) const {
+        if (!type.empty() && type.back() == ']') {
+            std::string element = type.substr(0, type.rfind('['));
+            std::string items;
+            for (const auto& item : value) {
+                encodeValue(items, element, item);
+            }
+            append(out, keccak256(items));
+        } else if (types_.contains(type)) {
+            append(out, hashStruct(type, value));
+        } else if (type == "string") {
+            append(out, keccak256(value.get_ref<const std::string&>()));
+        } else if (type == "bytes") {
+            append(out, keccak256(hexDecode(value.get_ref<const std::string&>())));
+        } else if (type == "bool") {
+            out.append(31, '\0');
+            out += value.get<bool>() ? '\1' : '\0';
+        } else if (type == "address") {
+            std::string raw = hexDecode(value.get_ref<const std::string&>());
+            if (raw.size() != 20) {
+                throw std::invalid_argument("eip712Hash: invalid address " + value.get<std::string>());
+            }
+            out.append(12, '\0');
+            out += raw;
+        } else if (type.compare(0, 5, "bytes") == 0) {
+            std::string raw = hexDecode(value.get_ref<const std::string&>());
+            if (raw.size() > 32) {
+                throw std::invalid_argument("eip712Hash: " + type + " value too long");
+            }
+            out += raw;
+            out.append(32 - raw.size(), '\0');
+        } else if (type.compare(0, 4, "uint") == 0) {
+            appendInteger(out, value, false);
+        } else if (type.compare(0, 3, "int") == 0) {
+            appendInteger(out, value, true);
+        } else {
+            throw NotSupported("EIP-712 type " + type + " is not supported");
+        }
+    }
+
+    const json& types_;
+};
+
+json domainType(const json& domain) {
+    static const std::pair<const char*, const char*> fields[] = {
+        {"name", "string"}, {"version", "string"}, {"chainId", "uint256"},
+        {"verifyingContract", "address"}, {"salt", "bytes32"}
+    };
+    json result = json::array();
+    for (const auto& [name, type] : fields) {
+        if (domain.contains(name)) {
+            result.push_back({{"name", name}, {"type", type}});
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+HmacSigner::HmacSigner(HashAlgorithm algorithm, std::string_view secret, SignatureEncoding encoding)
+    : key_(algorithm, secret), encoding_(encoding) {}
+
+std::string HmacSigner::sign(std::string_view message) const {
+    return encoding_ == SignatureEncoding::Hex ? key_.hex(message) : key_.base64(message);
+}
+
+void HmacSigner::appendSignature(std::string_view message, std::string& out) const {
+    unsigned char digest[HmacKey::maxDigestSize];
+    std::size_t size = key_.sign(message, digest);
+    std::size_t start = out.size();
+    if (encoding_ == SignatureEncoding::Hex) {
+        out.resize(start + 2 * size);
+        hexEncode(digest, size, out.data() + start);
+    } else {
+        out.resize(start + base64EncodedSize(size));
+        base64Encode(digest, size, out.data() + start);
+    }
+}
+
+KeySigner::~KeySigner() {
+    EVP_PKEY_free(key_);
+}
+
+Ed25519Signer::Ed25519Signer(std::string_view privateKey) : KeySigner(ed25519Key(privateKey)) {}
+
+void Ed25519Signer::sign(std::string_view message, unsigned char* out) const {
+    OpenSslPtr<EVP_MD_CTX> context(EVP_MD_CTX_new());
+    std::size_t size = signatureSize;
+    if (!context || EVP_DigestSignInit(context.get(), nullptr, nullptr, nullptr, key_) != 1 ||
+        EVP_DigestSign(context.get(), out, &size, bytes(message), message.size()) != 1) {
+        throw ExchangeError("Ed25519 signing failed");
+    }
+}
+
+std::string Ed25519Signer::sign(std::string_view message) const {
+    unsigned char signature[signatureSize];
+    sign(message, signature);
+    std::string result(base64EncodedSize(signatureSize), '\0');
+    base64Encode(signature, signatureSize, result.data());
+    return result;
+}
+
+void Ed25519Signer::appendSignature(std::string_view message, std::string& out) const {
+    unsigned char signature[signatureSize];
+    sign(message, signature);
+    std::size_t start = out.size();
+    out.resize(start + base64EncodedSize(signatureSize));
+    base64Encode(signature, signatureSize, out.data() + start);
+}
+
+std::string Ed25519Signer::publicKey() const {
+    std::string result(32, '\0');
+    std::size_t size = result.size();
+    if (EVP_PKEY_get_raw_public_key(key_, reinterpret_cast<unsigned char*>(result.data()), &size) != 1) {
+        throw ExchangeError("Ed25519 public key export failed");
+    }
+    return result;
+}
+
+Es256Signer::Es256Signer(std::string_view pem) : KeySigner(es256Key(pem)) {}
+
+std::string Es256Signer::sign(std::string_view message) const {
+    OpenSslPtr<EVP_MD_CTX> context(EVP_MD_CTX_new());
+    unsigned char der[maxDerSize];
+    std::size_t size = sizeof(der);
+    if (!context || EVP_DigestSignInit(context.get(), nullptr, EVP_sha256(), nullptr, key_) != 1 ||
+        EVP_DigestSign(context.get(), der, &size, bytes(message), message.size()) != 1) {
+        throw ExchangeError("ES256 signing failed");
+    }
+    auto signature = parseDer(der, size);
+    unsigned char raw[64];
+    BN_bn2binpad(ECDSA_SIG_get0_r(signature.get()), raw, 32);
+    BN_bn2binpad(ECDSA_SIG_get0_s(signature.get()), raw + 32, 32);
+    std::string result(base64EncodedSize(sizeof(raw), false), '\0');
+    base64UrlEncode(raw, sizeof(raw), result.data());
+    return result;
+}
+
+std::string Es256Signer::jwt(json header, const json& claims) const {
+    if (!header.contains("alg")) {
+        header["alg"] = "ES256";
+    }
+    if (!header.contains("typ")) {
+        header["typ"] = "JWT";
+    }
+    std::string token = base64UrlEncode(header.dump()) + "." + base64UrlEncode(claims.dump());
+    return token + "." + sign(token);
+}
+
+std::string EthSignature::hex() const {
+    char out[2 + 2 * 65];
+    char* end = hexEncode(r.data(), r.size(), out + 2);
+    end = hexEncode(s.data(), s.size(), end);
+    unsigned char recovery = static_cast<unsigned char>(v);
+    end = hexEncode(&recovery, 1, end);
+    out[0] = '0';
+    out[1] = 'x';
+    return std::string(out, end);
+}
+
+Secp256k1Signer::Secp256k1Signer(std::string_view privateKey) {
+    std::string secret;
+    try {
+        secret = hexDecode(privateKey);
+    } catch (const std::invalid_argument&) {
+    }
+    if (secret.size() != secret_.size()) {
+        throw AuthenticationError("invalid secp256k1 private key");
+    }
+    std::copy(secret.begin(), secret.end(), secret_.begin());
+    OPENSSL_cleanse(secret.data(), secret.size());
+    address_ = addressOf(secp256k1PublicKey(secret_));
+}
+
+Secp256k1Signer::~Secp256k1Signer() {
+    OPENSSL_cleanse(secret_.data(), secret_.size());
+}
+
+// Signed here rather than through EVP_PKEY_sign, which neither makes low-s
+// signatures nor reports the parity of R: recovering it afterwards would cost
+// two more scalar multiplications on a curve OpenSSL has no fast path for
+EthSignature Secp256k1Signer::signDigest(const std::array<unsigned char, 32>& digest) const {
+    const EC_GROUP* group = secp256k1();
+    const BIGNUM* order = EC_GROUP_get0_order(group);
+    OpenSslPtr<BN_CTX> context(BN_CTX_secure_new());
+    OpenSslPtr<BIGNUM> d(BN_secure_new());
+    OpenSslPtr<BIGNUM> k(BN_secure_new());
+    OpenSslPtr<BIGNUM> kInverse(BN_secure_new());
+    OpenSslPtr<BIGNUM> e(BN_new());
+    OpenSslPtr<BIGNUM> x(BN_new());
+    OpenSslPtr<BIGNUM> y(BN_new());
+    OpenSslPtr<BIGNUM> r(BN_new());
+    OpenSslPtr<BIGNUM> s(BN_new());
+    OpenSslPtr<BIGNUM> half(BN_dup(order));
+    OpenSslPtr<EC_POINT> R(EC_POINT_new(group));
+    if (!context || !d || !k || !kInverse || !e || !x || !y || !r || !s || !half || !R ||
+        !BN_bin2bn(secret_.data(), 32, d.get()) || !BN_bin2bn(digest.data(), 32, e.get()) ||
+        !BN_nnmod(e.get(), e.get(), order, context.get()) || !BN_rshift1(half.get(), half.get())) {
+        throw std::bad_alloc();
+    }
+    BN_set_flags(d.get(), BN_FLG_CONSTTIME);
+    BN_set_flags(k.get(), BN_FLG_CONSTTIME);
+
+    Digest reduced;
+    BN_bn2binpad(e.get(), reduced.data(), 32);
+    Rfc6979 nonces(secret_, reduced);
+    for (;;) {
+        const Digest& candidate = nonces.next();
+        BN_bin2bn(candidate.data(), 32, k.get());
+        if (BN_is_zero(k.get()) || BN_cmp(k.get(), order) >= 0) {
+            continue;
+        }
+        if (!EC_POINT_mul(group, R.get(), k.get(), nullptr, nullptr, context.get()) ||
+            !EC_POINT_get_affine_coordinates(group, R.get(), x.get(), y.get(), context.get())) {
+            throw ExchangeError("secp256k1 signing failed");
+        }
+        // An x at or above the order would need recovery ids 2 and 3, which
+        // Ethereum does not encode; the chance is about 2^-128
+        if (BN_cmp(x.get(), order) >= 0) {
+            continue;
+        }
+        int recoveryId = BN_is_odd(y.get());
+        // s = k^-1 (e + r d)
+        if (!BN_copy(r.get(), x.get()) || !BN_mod_inverse(kInverse.get(), k.get(), order, context.get()) ||
+            !BN_mod_mul(s.get(), r.get(), d.get(), order, context.get()) ||
+            !BN_mod_add(s.get(), s.get(), e.get(), order, context.get()) ||
+            !BN_mod_mul(s.get(), s.get(), kInverse.get(), order, context.get())) {
+            throw ExchangeError("secp256k1 signing failed");
+        }
+        if (BN_is_zero(r.get()) || BN_is_zero(s.get())) {
+            continue;
+        }
+        if (BN_cmp(s.get(), half.get()) > 0) {
+            BN_sub(s.get(), order, s.get());
+            recoveryId ^= 1;
+        }
+        EthSignature signature;
+        BN_bn2binpad(r.get(), signature.r.data(), 32);
+        BN_bn2binpad(s.get(), signature.s.data(), 32);
+        signature.v = 27 + recoveryId;
+        return signature;
+    }
+}
+
+EthSignature Secp256k1Signer::signTypedData(const json& typedData) const {
+    return signDigest(eip712Hash(typedData));
+}
+
+std::string Secp256k1Signer::sign(std::string_view message) const {
+    return signDigest(keccak256(message)).hex();
+}
+
+std::array<unsigned char, 32> eip712Hash(const json& typedData) {
+    const json& domain = typedData.at("domain");
+    const json* types = &typedData.at("types");
+    json withDomain;
+    if (!types->contains("EIP712Domain")) {
+        withDomain = *types;
+        withDomain["EIP712Domain"] = domainType(domain);
+        types = &withDomain;
+    }
+    TypedDataEncoder encoder(*types);
+    std::string encoded("\x19\x01", 2);
+    append(encoded, encoder.hashStruct("EIP712Domain", domain));
+    append(encoded, encoder.hashStruct(typedData.at("primaryType").get<std::string>(), typedData.at("message")));
+    return keccak256(encoded);
+}
+
+std::string recoverAddress(const std::array<unsigned char, 32>& digest, const EthSignature& signature) {
+    return addressOf(recoverPublicKey(digest, signature));
+}
+
+} // namespace ccxt
@@ -0,0 +1,103 @@
+#include "ccxt/base/url_template.h"
+#include <array>
+
+namespace ccxt {
+
+namespace {
+
+constexpr std::array<bool, 256> makeUnreservedTable() {
+    std::array<bool, 256> table{};
+    for (int c = 0; c < 256; ++c) {
+        table[c] = (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') ||
+                   c == '-' || c == '.' || c == '_' || c == '~';
+    }
+    return table;
+}
+
+constexpr std::array<bool, 256> unreserved = makeUnreservedTable();
+constexpr char upperHex[] = "0123456789ABCDEF";
+
+void appendValue(std::string& out, const json& value, bool encode) {
+    if (value.is_string()) {
+        const std::string& text = value.get_ref<const std::string&>();
+        if (encode) {
+            appendPercentEncoded(out, text);
+        } else {
+            out += text;
+        }
+    } else if (encode) {
+        appendPercentEncoded(out, value.dump());
+    } else {
+        out += value.dump();
+    }
+}
+
+} // namespace
+
+char* percentEncode(std::string_view text, char* out) {
+    for (char c : text) {
+        auto byte = static_cast<unsigned char>(c);
+        if (unreserved[byte]) {
+            *out++ = c;
+        } else {
+            *out++ = '%';
+            *out++ = upperHex[byte >> 4];
+            *out++ = upperHex[byte & 15];
+        }
+    }
+    return out;
+}
+
+void appendPercentEncoded(std::string& out, std::string_view text) {
+    std::size_t start = out.size();
+    out.resize(start + 3 * text.size());
+    out.resize(percentEncode(text, out.data() + start) - out.data());
+}
+
+std::string percentEncode(std::string_view text) {
+    std::string result;
+    appendPercentEncoded(result, text);
+    return result;
+}
+
+UrlTemplate::UrlTemplate(std::string_view path) {
+    std::size_t start = 0;
+    for (;;) {
+        std::size_t open = path.find('{', start);
+        std::size_t close = open == std::string_view::npos ? open : path.find('}', open + 1);
+        if (close == std::string_view::npos) {
+            literals_.emplace_back(path.substr(start));
+            break;
+        }
+        literals_.emplace_back(path.substr(start, open - start));
+        names_.emplace_back(path.substr(open + 1, close - open - 1));
+        start = close + 1;
+    }
+    for (const auto& literal : literals_) {
+        size_ += literal.size();
+    }
+}
+
+void UrlTemplate::render(const json& params, std::string& out, bool encode) const {
+    out.reserve(out.size() + size_ + 16 * names_.size());
+    out += literals_[0];
+    for (std::size_t i = 0; i < names_.size(); ++i) {
+        auto value = params.is_object() ? params.find(names_[i]) : params.end();
+        if (value != params.end()) {
+            appendValue(out, *value, encode);
+        } else {
+            out += '{';
+            out += names_[i];
+            out += '}';
+        }
+        out += literals_[i + 1];
+    }
+}
+
+std::string UrlTemplate::render(const json& params, bool encode) const {
+    std::string result;
+    render(params, result, encode);
+    return result;
+}
+
+} // namespace ccxt
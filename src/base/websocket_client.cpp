@@ -1,90 +1,372 @@
 #include <ccxt/base/websocket_client.h>
+#include <ccxt/base/errors.h>
+#include <boost/asio/post.hpp>
+#include <algorithm>
+#include <cmath>
+#include <optional>
 
 namespace ccxt {
 
+namespace {
+
+double millisecondsBetween(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to) {
+    return std::chrono::duration<double, std::milli>(to - from).count();
+}
+
+} // namespace
+
+std::chrono::milliseconds reconnectDelay(const ReconnectPolicy& policy, std::uint32_t attempt, double random) {
+    double delay = policy.initialDelay.count() * std::pow(policy.multiplier, attempt > 0 ? attempt - 1 : 0);
+    delay = std::min(delay, static_cast<double>(policy.maxDelay.count()));
+    delay *= 1.0 - policy.jitter * random;
+    return std::chrono::milliseconds(static_cast<long long>(delay));
+}
+
 WebSocketClient::WebSocketClient(boost::asio::io_context& ioc, boost::asio::ssl::context& ctx)
-    : ws_(ioc, ctx), resolver_(ioc) {}
+    : ioc_(ioc), ctx_(ctx), ws_(std::make_shared<Stream>(ioc, ctx)), resolver_(ioc), reconnectTimer_(ioc),
+      watchdog_(ioc), heartbeatTimer_(ioc), random_(std::random_device{}()) {
+    buffer_.reserve(readBufferReserve_);
+    sendQueue_.setMerger([this](std::string& queued, const std::string& next) {
+        return mergeFrames(queued, next);
+    });
+}
 
 WebSocketClient::~WebSocketClient() {
-    close();
+    // No shared_from_this here, the last owner is already gone
+    if (ws_ && ws_->is_open()) {
+        boost::beast::error_code ec;
+        ws_->close(boost::beast::websocket::close_code::normal, ec);
+    }
 }
 
 void WebSocketClient::connect(const std::string& host, const std::string& port, const std::string& path) {
+    host_ = host;
+    port_ = port;
+    path_ = path.empty() ? "/" : path;
+    closing_ = false;
+    open();
+}
+
+void WebSocketClient::open() {
+    ws_ = std::make_shared<Stream>(ioc_, ctx_);
+    if (permessageDeflate_) {
+        boost::beast::websocket::permessage_deflate deflate;
+        deflate.client_enable = true;
+        ws_->set_option(deflate);
+    }
+    SSL_set_tlsext_host_name(ws_->next_layer().native_handle(), host_.c_str());
     auto self(shared_from_this());
-    resolver_.async_resolve(host, port,
-        [this, self](boost::beast::error_code ec, boost::asio::ip::tcp::resolver::results_type results) {
-            if (!ec) {
-                onResolve(ec, results);
+    resolver_.async_resolve(host_, port_,
+        [this, self, ws = ws_](boost::beast::error_code ec, boost::asio::ip::tcp::resolver::results_type results) {
+            if (ec) {
+                fail(ws);
+            } else {
+                onResolve(ws, results);
             }
         });
 }
 
-void WebSocketClient::onResolve(boost::beast::error_code ec, boost::asio::ip::tcp::resolver::results_type results) {
-    if (ec) return;
+void WebSocketClient::onResolve(const std::shared_ptr<Stream>& ws,
+                                boost::asio::ip::tcp::resolver::results_type results) {
+    if (ws != ws_) return;
     auto self(shared_from_this());
-    boost::asio::async_connect(ws_.next_layer().next_layer(), results.begin(), results.end(),
-        [this, self](const boost::system::error_code& ec, typename boost::asio::ip::tcp::resolver::iterator it) {
-            if (!ec) {
-                onConnect(ec, it->endpoint());
+    boost::asio::async_connect(ws->next_layer().next_layer(), results.begin(), results.end(),
+        [this, self, ws](const boost::system::error_code& ec, typename boost::asio::ip::tcp::resolver::iterator) {
+            if (ec) {
+                fail(ws);
+            } else {
+                onConnect(ws);
             }
         });
 }
 
-void WebSocketClient::onConnect(const boost::system::error_code& ec, const boost::asio::ip::tcp::endpoint& endpoint) {
-    if (ec) return;
+void WebSocketClient::onConnect(const std::shared_ptr<Stream>& ws) {
+    if (ws != ws_) return;
     auto self(shared_from_this());
-    ws_.next_layer().async_handshake(boost::asio::ssl::stream_base::client,
-        [this, self](boost::beast::error_code ec) {
-            if (!ec) {
-                onHandshake(ec);
+    ws->next_layer().async_handshake(boost::asio::ssl::stream_base::client,
+        [this, self, ws](boost::beast::error_code ec) {
+            if (ec) {
+                fail(ws);
+            } else {
+                onHandshake(ws);
             }
         });
 }
 
-void WebSocketClient::onHandshake(boost::beast::error_code ec) {
-    if (ec) return;
+void WebSocketClient::onHandshake(const std::shared_ptr<Stream>& ws) {
+    if (ws != ws_) return;
     auto self(shared_from_this());
-    ws_.async_handshake(ws_.next_layer().next_layer().remote_endpoint().address().to_string(), "",
-        [this, self](boost::beast::error_code ec) {
-            if (!ec) {
-                ws_.async_read(buffer_,
-                    [this, self](boost::beast::error_code ec, std::size_t bytes_transferred) {
-                        onRead(ec, bytes_transferred);
-                    });
+    ws->async_handshake(host_, path_, [this, self, ws](boost::beast::error_code ec) {
+        if (ec) {
+            fail(ws);
+            return;
+        }
+        if (ws != ws_) return;
+        auto now = std::chrono::steady_clock::now();
+        bool reconnected = false;
+        {
+            std::lock_guard<std::mutex> lock(metricsMutex_);
+            reconnected = metrics_.connects > 0;
+            if (reconnected) {
+                metrics_.lastRecoveryMs = millisecondsBetween(lostAt_, now);
+                metrics_.maxRecoveryMs = std::max(metrics_.maxRecoveryMs, metrics_.lastRecoveryMs);
+            }
+            metrics_.connected = true;
+            metrics_.attempts = 0;
+            ++metrics_.connects;
+        }
+        lastActivity_ = now;
+        if (!gapOpen_) {
+            // A gap is measured from here when nothing arrives before the loss
+            lastMessage_ = now;
+        }
+        // Pings and pongs count as activity for the watchdog on quiet streams
+        ws->control_callback([this](boost::beast::websocket::frame_type kind, boost::beast::string_view) {
+            lastActivity_ = std::chrono::steady_clock::now();
+            if (kind == boost::beast::websocket::frame_type::pong && pingOutstanding_ && !pingIsMessage_) {
+                onHeartbeatReply();
             }
         });
+        {
+            std::lock_guard<std::mutex> lock(sendMutex_);
+            if (reconnected) {
+                // Ahead of frames queued during the outage and past the limit,
+                // which a full queue would otherwise have refused
+                std::vector<std::string> frames;
+                frames.reserve(subscriptions_.size());
+                for (const auto& subscription : subscriptions_) {
+                    frames.push_back(subscription.second);
+                }
+                sendQueue_.pushFront(std::move(frames));
+            }
+            scheduleWrite();
+        }
+        if (reconnected) {
+            handleReconnect();
+        }
+        armWatchdog(ws);
+        pingOutstanding_ = false;
+        pingSentAt_ = now;
+        if (heartbeat_.interval.count() > 0) {
+            armHeartbeat(ws, now + heartbeat_.interval);
+        }
+        buffer_.consume(buffer_.size());
+        ws->async_read(buffer_, [this, self, ws](boost::beast::error_code ec, std::size_t bytes_transferred) {
+            onRead(ws, ec, bytes_transferred);
+        });
+    });
+}
+
+void WebSocketClient::fail(const std::shared_ptr<Stream>& ws, bool stale) {
+    if (ws != ws_ || closing_) return;
+    // Abort whatever is still pending on the dead stream; its completions
+    // are ignored from here on
+    ws_ = nullptr;
+    watchdog_.cancel();
+    heartbeatTimer_.cancel();
+    boost::beast::error_code ignored;
+    boost::beast::get_lowest_layer(*ws).close(ignored);
+
+    std::uint32_t attempt;
+    bool wasConnected;
+    {
+        std::lock_guard<std::mutex> lock(metricsMutex_);
+        wasConnected = metrics_.connected;
+        if (wasConnected) {
+            metrics_.connected = false;
+            ++metrics_.disconnects;
+            metrics_.staleFeeds += stale;
+        }
+        attempt = ++metrics_.attempts;
+    }
+    if (wasConnected) {
+        lostAt_ = std::chrono::steady_clock::now();
+        gapOpen_ = true;
+        handleDisconnect();
+    }
+    if (!policy_.enabled || (policy_.maxAttempts && attempt > policy_.maxAttempts)) {
+        return;
+    }
+    reconnectTimer_.expires_after(reconnectDelay(policy_, attempt, std::uniform_real_distribution<>(0.0, 1.0)(random_)));
+    reconnectTimer_.async_wait([this, self = shared_from_this()](boost::beast::error_code ec) {
+        if (!ec && !closing_) {
+            open();
+        }
+    });
+}
+
+void WebSocketClient::armWatchdog(const std::shared_ptr<Stream>& ws) {
+    if (policy_.staleAfter.count() <= 0) return;
+    // Checks a few times per period rather than re-arming on every message
+    watchdog_.expires_after(std::max(policy_.staleAfter / 4, std::chrono::milliseconds(1)));
+    watchdog_.async_wait([this, self = shared_from_this(), ws](boost::beast::error_code ec) {
+        if (ec || ws != ws_) return;
+        if (std::chrono::steady_clock::now() - lastActivity_ > policy_.staleAfter) {
+            fail(ws, true);
+        } else {
+            armWatchdog(ws);
+        }
+    });
+}
+
+void WebSocketClient::armHeartbeat(const std::shared_ptr<Stream>& ws, std::chrono::steady_clock::time_point at) {
+    heartbeatTimer_.expires_at(at);
+    heartbeatTimer_.async_wait([this, self = shared_from_this(), ws](boost::beast::error_code ec) {
+        if (ec || ws != ws_) return;
+        auto now = std::chrono::steady_clock::now();
+        bool timeout = heartbeat_.timeout.count() > 0;
+        if (pingOutstanding_ && timeout && now - pingSentAt_ >= heartbeat_.timeout) {
+            {
+                std::lock_guard<std::mutex> lock(metricsMutex_);
+                ++metrics_.heartbeatTimeouts;
+            }
+            fail(ws, true);
+            return;
+        }
+        if (!pingOutstanding_ && now - pingSentAt_ >= heartbeat_.interval) {
+            sendPing(ws);
+        }
+        // Next ping is due an interval after the last one, the reply to it by
+        // its timeout
+        auto next = pingSentAt_ + heartbeat_.interval;
+        if (pingOutstanding_ && timeout) {
+            next = std::min(next, pingSentAt_ + heartbeat_.timeout);
+        }
+        armHeartbeat(ws, next > now ? next : now + heartbeat_.interval);
+    });
+}
+
+void WebSocketClient::sendPing(const std::shared_ptr<Stream>& ws) {
+    std::string message = heartbeatMessage();
+    pingIsMessage_ = !message.empty();
+    pingOutstanding_ = true;
+    pingSentAt_ = std::chrono::steady_clock::now();
+    if (pingIsMessage_) {
+        send(std::move(message), SendPriority::High);
+    } else {
+        // A failed ping shows up in the read loop
+        ws->async_ping({}, [self = shared_from_this(), ws](boost::beast::error_code) {});
+    }
+    std::lock_guard<std::mutex> lock(metricsMutex_);
+    ++metrics_.pings;
+}
+
+void WebSocketClient::onHeartbeatReply() {
+    pingOutstanding_ = false;
+    double rtt = millisecondsBetween(pingSentAt_, std::chrono::steady_clock::now());
+    std::lock_guard<std::mutex> lock(metricsMutex_);
+    metrics_.lastRttMs = rtt;
+    metrics_.smoothedRttMs = metrics_.smoothedRttMs == 0.0 ? rtt : metrics_.smoothedRttMs + (rtt - metrics_.smoothedRttMs) / 8;
+}
+
+bool WebSocketClient::send(std::string message, SendPriority priority) {
+    std::lock_guard<std::mutex> lock(sendMutex_);
+    if (!sendQueue_.push(std::move(message), priority)) {
+        return false;
+    }
+    scheduleWrite();
+    return true;
 }
 
-void WebSocketClient::send(const std::string& message) {
+void WebSocketClient::scheduleWrite() {
+    if (!writing_ && !sendQueue_.empty()) {
+        // Beast allows one async_write at a time, started on the stream's executor
+        writing_ = true;
+        boost::asio::post(ioc_, [this, self = shared_from_this()] { startWrite(); });
+    }
+}
+
+void WebSocketClient::startWrite() {
+    std::lock_guard<std::mutex> lock(sendMutex_);
+    // Before the handshake frames wait in the queue, onHandshake flushes them
+    const std::string* frame = ws_ && ws_->is_open() ? sendQueue_.next() : nullptr;
+    if (!frame) {
+        writing_ = false;
+        return;
+    }
     auto self(shared_from_this());
-    ws_.async_write(boost::asio::buffer(message),
-        [this, self](boost::beast::error_code ec, std::size_t bytes_transferred) {
-            onWrite(ec, bytes_transferred);
+    ws_->async_write(boost::asio::buffer(*frame),
+        [this, self, ws = ws_](boost::beast::error_code ec, std::size_t bytes_transferred) {
+            onWrite(ws, ec, bytes_transferred);
         });
 }
 
-void WebSocketClient::onWrite(boost::beast::error_code ec, std::size_t bytes_transferred) {
-    if (ec) return;
-    // Handle write completion
+void WebSocketClient::onWrite(const std::shared_ptr<Stream>& ws, boost::beast::error_code ec,
+                              std::size_t bytes_transferred) {
+    // A failed write is reported by the read loop. Its frame, which send()
+    // accepted and may be an order, goes out again on the next connection
+    // with the frames still queued.
+    std::lock_guard<std::mutex> lock(sendMutex_);
+    writing_ = false;
+    if (ec) {
+        sendQueue_.requeue();
+        {
+            std::lock_guard<std::mutex> metricsLock(metricsMutex_);
+            ++metrics_.requeuedFrames;
+        }
+        // Writing again on the dead stream would only fail again
+        if (ws == ws_) return;
+    } else {
+        sendQueue_.pop();
+    }
+    scheduleWrite();
 }
 
-void WebSocketClient::onRead(boost::beast::error_code ec, std::size_t bytes_transferred) {
-    if (ec) return;
-    if (messageHandler_) {
-        messageHandler_(boost::beast::buffers_to_string(buffer_.data()));
+void WebSocketClient::onRead(const std::shared_ptr<Stream>& ws, boost::beast::error_code ec,
+                             std::size_t bytes_transferred) {
+    if (ec) {
+        fail(ws);
+        return;
+    }
+    if (ws != ws_) return;
+    auto now = std::chrono::steady_clock::now();
+    if (gapOpen_) {
+        gapOpen_ = false;
+        std::lock_guard<std::mutex> lock(metricsMutex_);
+        metrics_.lastGapMs = millisecondsBetween(lastMessage_, now);
+        metrics_.maxGapMs = std::max(metrics_.maxGapMs, metrics_.lastGapMs);
     }
-    buffer_.consume(bytes_transferred);
+    lastActivity_ = lastMessage_ = now;
+    // flat_buffer keeps the message contiguous, so it is handed out in place
+    // and the storage is reused by the next read
+    auto data = buffer_.cdata();
+    std::string_view message(static_cast<const char*>(data.data()), data.size());
+    bool valid = true;
+    if (inflater_) {
+        try {
+            message = inflater_->inflate(message);
+        } catch (const BadResponse&) {
+            valid = false;
+            std::lock_guard<std::mutex> lock(metricsMutex_);
+            ++metrics_.badFrames;
+        }
+    }
+    if (valid) {
+        dispatch(message);
+    }
+    buffer_.consume(buffer_.size());
     auto self(shared_from_this());
-    ws_.async_read(buffer_,
-        [this, self](boost::beast::error_code ec, std::size_t bytes_transferred) {
-            onRead(ec, bytes_transferred);
+    ws->async_read(buffer_,
+        [this, self, ws](boost::beast::error_code ec, std::size_t bytes_transferred) {
+            onRead(ws, ec, bytes_transferred);
         });
 }
 
 void WebSocketClient::close() {
-    auto self(shared_from_this());
-    ws_.async_close(boost::beast::websocket::close_code::normal,
-        boost::beast::bind_front_handler(&WebSocketClient::onClose, self));
+    boost::asio::post(ioc_, [this, self = shared_from_this()] {
+        closing_ = true;
+        reconnectTimer_.cancel();
+        watchdog_.cancel();
+        heartbeatTimer_.cancel();
+        resolver_.cancel();
+        if (ws_ && ws_->is_open()) {
+            ws_->async_close(boost::beast::websocket::close_code::normal,
+                boost::beast::bind_front_handler(&WebSocketClient::onClose, self));
+        } else if (ws_) {
+            boost::beast::error_code ignored;
+            boost::beast::get_lowest_layer(*ws_).close(ignored);
+        }
+    });
 }
 
 void WebSocketClient::onClose(boost::beast::error_code ec) {
@@ -96,4 +378,85 @@ void WebSocketClient::setMessageHandler(MessageHandler handler) {
     messageHandler_ = handler;
 }
 
+void WebSocketClient::setSendQueueLimit(std::size_t bytes) {
+    std::lock_guard<std::mutex> lock(sendMutex_);
+    sendQueue_.setLimit(bytes);
+}
+
+std::size_t WebSocketClient::sendQueueBytes() const {
+    std::lock_guard<std::mutex> lock(sendMutex_);
+    return sendQueue_.bytes();
+}
+
+void WebSocketClient::setReconnectPolicy(const ReconnectPolicy& policy) {
+    policy_ = policy;
+}
+
+void WebSocketClient::setHeartbeat(const HeartbeatPolicy& policy) {
+    heartbeat_ = policy;
+}
+
+void WebSocketClient::setFrameCompression(FrameCompression format, std::size_t maxMessageSize) {
+    inflater_ = format == FrameCompression::None ? nullptr : std::make_unique<Inflater>(format, maxMessageSize);
+}
+
+FrameCompression WebSocketClient::frameCompression() const {
+    return inflater_ ? inflater_->format() : FrameCompression::None;
+}
+
+WebSocketClient::Metrics WebSocketClient::metrics() const {
+    std::lock_guard<std::mutex> lock(metricsMutex_);
+    return metrics_;
+}
+
+void WebSocketClient::addSubscription(const std::string& key, std::string frame) {
+    std::lock_guard<std::mutex> lock(sendMutex_);
+    auto it = std::find_if(subscriptions_.begin(), subscriptions_.end(),
+                           [&](const auto& subscription) { return subscription.first == key; });
+    if (it != subscriptions_.end()) {
+        it->second = std::move(frame);
+    } else {
+        subscriptions_.emplace_back(key, std::move(frame));
+    }
+}
+
+void WebSocketClient::removeSubscription(const std::string& key) {
+    std::lock_guard<std::mutex> lock(sendMutex_);
+    subscriptions_.erase(std::remove_if(subscriptions_.begin(), subscriptions_.end(),
+                                        [&](const auto& subscription) { return subscription.first == key; }),
+                         subscriptions_.end());
+}
+
+void WebSocketClient::setJsonArena(bool enabled, std::size_t blockSize) {
+    arena_ = enabled ? std::make_unique<JsonArena>(blockSize) : nullptr;
+}
+
+void WebSocketClient::setReadBufferReserve(std::size_t bytes) {
+    readBufferReserve_ = bytes;
+    if (buffer_.capacity() > bytes && buffer_.size() == 0) {
+        buffer_.shrink_to_fit();
+    }
+    buffer_.reserve(bytes);
+}
+
+void WebSocketClient::dispatch(std::string_view message) {
+    if (pingOutstanding_ && pingIsMessage_ && isHeartbeatReply(message)) {
+        onHeartbeatReply();
+        return;
+    }
+    std::string reply = pingReply(message);
+    if (!reply.empty()) {
+        send(std::move(reply), SendPriority::High);
+        return;
+    }
+    std::optional<JsonArena::Scope> scope;
+    if (arena_) {
+        scope.emplace(*arena_);
+    }
+    handleMessage(message);
+    if (messageHandler_) {
+        messageHandler_(message);
+    }
+}
+
 } // namespace ccxt
@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/alpaca.h"
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -255,8 +256,8 @@ json alpaca::parseMarkets(const json& assets) const {
                 {"expiryDatetime", nullptr},
                 {"strike", nullptr},
                 {"optionType", nullptr},
-                {"taker", std::stod(asset["taker_fee"])},
-                {"maker", std::stod(asset["maker_fee"])},
+                {"taker", jsonDouble(asset["taker_fee"])},
+                {"maker", jsonDouble(asset["maker_fee"])},
                 {"percentage", true},
                 {"tierBased", false},
                 {"feeSide", "quote"},
@@ -494,18 +495,18 @@ json alpaca::parseOrder(const json& order, const std::optional<json>& market) co
     long long timestamp = parse8601(order["created_at"].get<std::string>());
     long long lastTradeTimestamp = order.contains("filled_at") ? parse8601(order["filled_at"].get<std::string>()) : 0;
     
-    double amount = std::stod(order["qty"].get<std::string>());
-    double filled = std::stod(order["filled_qty"].get<std::string>());
+    double amount = jsonDouble(order["qty"]);
+    double filled = jsonDouble(order["filled_qty"]);
     double remaining = amount - filled;
     
     double price = 0;
     if (order.contains("limit_price") && !order["limit_price"].is_null()) {
-        price = std::stod(order["limit_price"].get<std::string>());
+        price = jsonDouble(order["limit_price"]);
     }
     
     double cost = 0;
     if (filled > 0 && order.contains("filled_avg_price") && !order["filled_avg_price"].is_null()) {
-        cost = filled * std::stod(order["filled_avg_price"].get<std::string>());
+        cost = filled * jsonDouble(order["filled_avg_price"]);
     }
     
     return {
@@ -644,14 +645,14 @@ json alpaca::parseTrade(const json& trade, const std::optional<json>& market) co
     std::string side = trade["side"].get<std::string>();
     long long timestamp = parse8601(trade["transaction_time"].get<std::string>());
     
-    double price = std::stod(trade["price"].get<std::string>());
-    double amount = std::stod(trade["qty"].get<std::string>());
+    double price = jsonDouble(trade["price"]);
+    double amount = jsonDouble(trade["qty"]);
     double cost = price * amount;
     
     json fee = nullptr;
     if (trade.contains("commission")) {
         fee = {
-            {"cost", std::stod(trade["commission"].get<std::string>())},
+            {"cost", jsonDouble(trade["commission"])},
             {"currency", "USD"}  // Alpaca uses USD for commissions
         };
     }
@@ -704,7 +705,7 @@ json alpaca::fetchBalanceImpl() const {
     
     // Parse account balance
     if (response.contains("cash") && !response["cash"].is_null()) {
-        double cash = std::stod(response["cash"].get<std::string>());
+        double cash = jsonDouble(response["cash"]);
         result["USD"] = {
             {"free", cash},
             {"used", 0.0},
@@ -714,7 +715,7 @@ json alpaca::fetchBalanceImpl() const {
     
     // Parse portfolio value
     if (response.contains("portfolio_value") && !response["portfolio_value"].is_null()) {
-        double portfolioValue = std::stod(response["portfolio_value"].get<std::string>());
+        double portfolioValue = jsonDouble(response["portfolio_value"]);
         result["total"] = {
             {"USD", portfolioValue}
         };
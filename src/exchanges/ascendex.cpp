@@ -3,6 +3,7 @@
 #include <sstream>
 #include <iomanip>
 #include <openssl/hmac.h>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -273,32 +274,32 @@ json AscendEX::parseMarkets(const json& response, const std::string& type) const
             {"contract", type == "swap"},
             {"linear", type == "swap" ? true : nullptr},
             {"inverse", type == "swap" ? false : nullptr},
-            {"taker", std::stod(market["commissionReserveRate"].get<std::string>())},
-            {"maker", std::stod(market["commissionReserveRate"].get<std::string>())},
-            {"contractSize", type == "swap" ? std::stod(market["contractSize"].get<std::string>()) : nullptr},
+            {"taker", jsonDouble(market["commissionReserveRate"])},
+            {"maker", jsonDouble(market["commissionReserveRate"])},
+            {"contractSize", type == "swap" ? jsonDouble(market["contractSize"]) : nullptr},
             {"expiry", nullptr},
             {"expiryDatetime", nullptr},
             {"strike", nullptr},
             {"optionType", nullptr},
             {"precision", {
-                {"amount", std::stod(market["lotSize"].get<std::string>())},
-                {"price", std::stod(market["tickSize"].get<std::string>())}
+                {"amount", jsonDouble(market["lotSize"])},
+                {"price", jsonDouble(market["tickSize"])}
             }},
             {"limits", {
                 {"leverage", {
-                    {"min", type == "swap" ? std::stod(market["minLeverage"].get<std::string>()) : nullptr},
-                    {"max", type == "swap" ? std::stod(market["maxLeverage"].get<std::string>()) : nullptr}
+                    {"min", type == "swap" ? jsonDouble(market["minLeverage"]) : nullptr},
+                    {"max", type == "swap" ? jsonDouble(market["maxLeverage"]) : nullptr}
                 }},
                 {"amount", {
-                    {"min", std::stod(market["minQty"].get<std::string>())},
-                    {"max", std::stod(market["maxQty"].get<std::string>())}
+                    {"min", jsonDouble(market["minQty"])},
+                    {"max", jsonDouble(market["maxQty"])}
                 }},
                 {"price", {
-                    {"min", std::stod(market["tickSize"].get<std::string>())},
+                    {"min", jsonDouble(market["tickSize"])},
                     {"max", nullptr}
                 }},
                 {"cost", {
-                    {"min", std::stod(market["minNotional"].get<std::string>())},
+                    {"min", jsonDouble(market["minNotional"])},
                     {"max", nullptr}
                 }}
             }},
@@ -363,21 +364,21 @@ json AscendEX::parseTicker(const json& ticker, const std::optional<json>& market
         {"symbol", ticker["symbol"]},
         {"timestamp", timestamp},
         {"datetime", iso8601(timestamp)},
-        {"high", ticker.contains("h") ? std::stod(ticker["h"].get<std::string>()) : nullptr},
-        {"low", ticker.contains("l") ? std::stod(ticker["l"].get<std::string>()) : nullptr},
-        {"bid", ticker.contains("b") ? std::stod(ticker["b"].get<std::string>()) : nullptr},
-        {"bidVolume", ticker.contains("bs") ? std::stod(ticker["bs"].get<std::string>()) : nullptr},
-        {"ask", ticker.contains("a") ? std::stod(ticker["a"].get<std::string>()) : nullptr},
-        {"askVolume", ticker.contains("as") ? std::stod(ticker["as"].get<std::string>()) : nullptr},
+        {"high", ticker.contains("h") ? jsonDouble(ticker["h"]) : nullptr},
+        {"low", ticker.contains("l") ? jsonDouble(ticker["l"]) : nullptr},
+        {"bid", ticker.contains("b") ? jsonDouble(ticker["b"]) : nullptr},
+        {"bidVolume", ticker.contains("bs") ? jsonDouble(ticker["bs"]) : nullptr},
+        {"ask", ticker.contains("a") ? jsonDouble(ticker["a"]) : nullptr},
+        {"askVolume", ticker.contains("as") ? jsonDouble(ticker["as"]) : nullptr},
         {"vwap", nullptr},
-        {"open", ticker.contains("o") ? std::stod(ticker["o"].get<std::string>()) : nullptr},
-        {"close", ticker.contains("c") ? std::stod(ticker["c"].get<std::string>()) : nullptr},
-        {"last", ticker.contains("c") ? std::stod(ticker["c"].get<std::string>()) : nullptr},
+        {"open", ticker.contains("o") ? jsonDouble(ticker["o"]) : nullptr},
+        {"close", ticker.contains("c") ? jsonDouble(ticker["c"]) : nullptr},
+        {"last", ticker.contains("c") ? jsonDouble(ticker["c"]) : nullptr},
         {"previousClose", nullptr},
         {"change", nullptr},
         {"percentage", nullptr},
         {"average", nullptr},
-        {"baseVolume", ticker.contains("v") ? std::stod(ticker["v"].get<std::string>()) : nullptr},
+        {"baseVolume", ticker.contains("v") ? jsonDouble(ticker["v"]) : nullptr},
         {"quoteVolume", nullptr},
         {"info", ticker}
     };
@@ -417,9 +418,9 @@ json AscendEX::parseBalance(const json& response) const {
         std::string currencyId = balance["asset"].get<std::string>();
         std::string code = this->safeCurrencyCode(currencyId);
         std::string account = {
-            {"free", std::stod(balance["availableBalance"].get<std::string>())},
-            {"used", std::stod(balance["totalOrderBalance"].get<std::string>())},
-            {"total", std::stod(balance["totalBalance"].get<std::string>())}
+            {"free", jsonDouble(balance["availableBalance"])},
+            {"used", jsonDouble(balance["totalOrderBalance"])},
+            {"total", jsonDouble(balance["totalBalance"])}
         };
         result[code] = account;
     }
@@ -439,10 +440,10 @@ json AscendEX::parseMarginBalance(const json& response) const {
         std::string currencyId = balance["asset"].get<std::string>();
         std::string code = this->safeCurrencyCode(currencyId);
         std::string account = {
-            {"free", std::stod(balance["availableBalance"].get<std::string>())},
-            {"used", std::stod(balance["totalOrderBalance"].get<std::string>())},
-            {"total", std::stod(balance["totalBalance"].get<std::string>())},
-            {"debt", std::stod(balance["borrowed"].get<std::string>())}
+            {"free", jsonDouble(balance["availableBalance"])},
+            {"used", jsonDouble(balance["totalOrderBalance"])},
+            {"total", jsonDouble(balance["totalBalance"])},
+            {"debt", jsonDouble(balance["borrowed"])}
         };
         result[code] = account;
     }
@@ -462,9 +463,9 @@ json AscendEX::parseSwapBalance(const json& response) const {
         std::string currencyId = balance["collateralCurrency"].get<std::string>();
         std::string code = this->safeCurrencyCode(currencyId);
         std::string account = {
-            {"free", std::stod(balance["freeCollateral"].get<std::string>())},
-            {"used", std::stod(balance["totalCollateral"].get<std::string>()) - std::stod(balance["freeCollateral"].get<std::string>())},
-            {"total", std::stod(balance["totalCollateral"].get<std::string>())}
+            {"free", jsonDouble(balance["freeCollateral"])},
+            {"used", jsonDouble(balance["totalCollateral"]) - jsonDouble(balance["freeCollateral"])},
+            {"total", jsonDouble(balance["totalCollateral"])}
         };
         result[code] = account;
     }
@@ -557,24 +558,24 @@ json AscendEX::parseOrder(const json& order, const std::optional<json>& market)
     std::string side = order["side"].get<std::string>();
     std::string status = this->parseOrderStatus(order["status"].get<std::string>());
     
-    double amount = std::stod(order["orderQty"].get<std::string>());
-    double filled = std::stod(order["cumFilledQty"].get<std::string>());
+    double amount = jsonDouble(order["orderQty"]);
+    double filled = jsonDouble(order["cumFilledQty"]);
     double remaining = amount - filled;
     
     double price = 0;
     if (order.contains("orderPrice") && !order["orderPrice"].is_null()) {
-        price = std::stod(order["orderPrice"].get<std::string>());
+        price = jsonDouble(order["orderPrice"]);
     }
     
     double cost = 0;
     if (filled > 0 && order.contains("avgPx") && !order["avgPx"].is_null()) {
-        cost = filled * std::stod(order["avgPx"].get<std::string>());
+        cost = filled * jsonDouble(order["avgPx"]);
     }
     
     json fee = nullptr;
     if (order.contains("cumFee") && !order["cumFee"].is_null()) {
         fee = {
-            {"cost", std::stod(order["cumFee"].get<std::string>())},
+            {"cost", jsonDouble(order["cumFee"])},
             {"currency", order["feeAsset"].get<std::string>()}
         };
     }
@@ -768,14 +769,14 @@ json AscendEX::parseTrade(const json& trade, const std::optional<json>& market)
     std::string orderId = trade.contains("orderId") ? trade["orderId"].get<std::string>() : "";
     std::string symbol = trade["symbol"].get<std::string>();
     std::string side = trade["side"].get<std::string>();
-    double price = std::stod(trade["price"].get<std::string>());
-    double amount = std::stod(trade["size"].get<std::string>());
+    double price = jsonDouble(trade["price"]);
+    double amount = jsonDouble(trade["size"]);
     double cost = price * amount;
     
     json fee = nullptr;
     if (trade.contains("fee")) {
         fee = {
-            {"cost", std::stod(trade["fee"].get<std::string>())},
+            {"cost", jsonDouble(trade["fee"])},
             {"currency", trade["feeAsset"].get<std::string>()}
         };
     }
@@ -842,15 +843,15 @@ json AscendEX::parseOrderBook(const json& orderbook, const std::string& symbol,
     
     for (const auto& bid : orderbook["bids"]) {
         result["bids"].push_back({
-            std::stod(bid[0].get<std::string>()),  // price
-            std::stod(bid[1].get<std::string>())   // amount
+            jsonDouble(bid[0]),  // price
+            jsonDouble(bid[1])   // amount
         });
     }
     
     for (const auto& ask : orderbook["asks"]) {
         result["asks"].push_back({
-            std::stod(ask[0].get<std::string>()),  // price
-            std::stod(ask[1].get<std::string>())   // amount
+            jsonDouble(ask[0]),  // price
+            jsonDouble(ask[1])   // amount
         });
     }
     
@@ -889,11 +890,11 @@ json AscendEX::fetchOHLCVImpl(const std::string& symbol, const std::string& time
 json AscendEX::parseOHLCV(const json& ohlcv, const std::optional<json>& market) const {
     return {
         parse8601(ohlcv["t"].get<std::string>()),                 // timestamp
-        std::stod(ohlcv["o"].get<std::string>()),                // open
-        std::stod(ohlcv["h"].get<std::string>()),                // high
-        std::stod(ohlcv["l"].get<std::string>()),                // low
-        std::stod(ohlcv["c"].get<std::string>()),                // close
-        std::stod(ohlcv["v"].get<std::string>())                 // volume
+        jsonDouble(ohlcv["o"]),                // open
+        jsonDouble(ohlcv["h"]),                // high
+        jsonDouble(ohlcv["l"]),                // low
+        jsonDouble(ohlcv["c"]),                // close
+        jsonDouble(ohlcv["v"])                 // volume
     };
 }
 
@@ -1,4 +1,9 @@
 #include <ccxt/exchanges/binance.h>
+#include <ccxt/base/http_client.h>
+#include <ccxt/base/number.h>
+#include <ccxt/base/json_view.h>
+#include <ccxt/base/errors.h>
+#include <cctype>
 #include <chrono>
 #include <sstream>
 #include <iomanip>
@@ -10,59 +15,8 @@
 namespace ccxt {
 Binance::Binance(boost::asio::io_context& context, const Config& config)
     : Exchange(context, config) {
-    config_.loadRest("config/binance_rest.json");
-    config_.loadWs("config/binance_ws.json");
-  
-    // Initialize capabilities
-    this->has.emplace("CORS", true);
-    this->has.emplace("spot", true);
-    this->has.emplace("margin", true);
-    this->has.emplace("swap", true);
-    this->has.emplace("future", true);
-    this->has.emplace("option", false);
-    this->has.emplace("addMargin", true);
-    this->has.emplace("borrowCrossMargin", true);
-    this->has.emplace("borrowIsolatedMargin", true);
-    this->has.emplace("cancelAllOrders", true);
-    this->has.emplace("cancelOrder", true);
-    this->has.emplace("cancelOrders", true); // contract only
-    this->has.emplace("closeAllPositions", false);
-    this->has.emplace("closePosition", false); // exchange specific closePosition parameter for binance createOrder is not synonymous with how CCXT uses closePositions
-    this->has.emplace("createOrder", true);
-    this->has.emplace("createReduceOnlyOrder", true);
-    this->has.emplace("fetchBalance", true);
-    this->has.emplace("fetchBidsAsks", true);
-    this->has.emplace("fetchClosedOrders", true);
-    this->has.emplace("fetchCurrencies", true);
-    this->has.emplace("fetchDeposits", true);
-    this->has.emplace("fetchFundingRate", true);
-    this->has.emplace("fetchFundingRateHistory", true);
-    this->has.emplace("fetchFundingRates", true);
-    this->has.emplace("fetchIndexOHLCV", true);
-    this->has.emplace("fetchMarkets", true);
-    this->has.emplace("fetchMarkOHLCV", true);
-    this->has.emplace("fetchMyTrades", true);
-    this->has.emplace("fetchOHLCV", true);
-    this->has.emplace("fetchOpenOrders", true);
-    this->has.emplace("fetchOrder", true);
-    this->has.emplace("fetchOrders", true);
-    this->has.emplace("fetchOrderBook", true);
-    this->has.emplace("fetchPositions", true);
-    this->has.emplace("fetchPremiumIndexOHLCV", true);
-    this->has.emplace("fetchStatus", true);
-    this->has.emplace("fetchTicker", true);
-    this->has.emplace("fetchTickers", true);
-    this->has.emplace("fetchTime", true);
-    this->has.emplace("fetchTrades", true);
-    this->has.emplace("fetchTradingFee", true);
-    this->has.emplace("fetchTradingFees", true);
-    this->has.emplace("fetchTransactionFees", true);
-    this->has.emplace("fetchTransfers", true);
-    this->has.emplace("fetchWithdrawals", true);
-    this->has.emplace("setLeverage", true);
-    this->has.emplace("setMarginMode", true);
-    this->has.emplace("transfer", true);
-    this->has.emplace("withdraw", true);
+    // Capabilities, rate limit and timeframes from the generated binance descriptor table
+    useTable("binance");
 }
 
 void Binance::init() {
@@ -251,12 +205,14 @@ json Binance::fetchMarketsImpl() const {
 
 Market Binance::findMarket(const std::string& symbol) const {
     loadMarkets();
-    try {
-        return markets.at(symbol);
-    } catch (const std::out_of_range& e) {
-        throw std::runtime_error("Market '" + symbol + "' not found");
+    // Read from the published snapshot, not the legacy maps a reload rewrites
+    auto registry = marketRegistry();
+    const Market* market = registry->bySymbol(symbol);
+    if (!market) {
+        throw BadSymbol("Market '" + symbol + "' does not exist");
     }
-}    
+    return *market;
+}
 
 json Binance::fetchTickerImpl(const std::string& symbol) const {
     loadMarkets();
@@ -300,6 +256,210 @@ json Binance::fetchTradesImpl(const std::string& symbol, const std::optional<lon
     return this->parseTrade(response, market);
 }
 
+std::string Binance::publicUrl(const std::string& path) const {
+    return "https://" + (config_.hostname.empty() ? std::string("api.binance.com") : config_.hostname) + "/api/v3/" + path;
+}
+
+void Binance::fetchTickerTyped(const std::string& symbol, Ticker& ticker) {
+    const Market& market = this->market(symbol);
+    std::string body = fetchBody(publicUrl("ticker/24hr?symbol=" + market.id), "GET", {}, "",
+                                 endpointCost("public", "GET", "ticker/24hr", {{"symbol", market.id}}));
+    parseTickerInto(body, market, ticker);
+}
+
+void Binance::fetchOrderBookTyped(const std::string& symbol, OrderBook& orderBook, int limit) {
+    const Market& market = this->market(symbol);
+    std::string path = "depth?symbol=" + market.id;
+    json params = json::object();
+    if (limit > 0) {
+        path += "&limit=" + std::to_string(limit);
+        params["limit"] = limit;
+    }
+    std::string body = fetchBody(publicUrl(path), "GET", {}, "", endpointCost("public", "GET", "depth", params));
+    parseOrderBookInto(body, market, orderBook);
+}
+
+void Binance::fetchTradesTyped(const std::string& symbol, std::vector<Trade>& trades, int since, int limit) {
+    const Market& market = this->market(symbol);
+    // Only aggTrades can start at a timestamp, as in ccxt
+    std::string endpoint = since > 0 ? "aggTrades" : "trades";
+    std::string path = endpoint + "?symbol=" + market.id;
+    if (since > 0) {
+        path += "&startTime=" + std::to_string(since);
+    }
+    if (limit > 0) {
+        path += "&limit=" + std::to_string(limit);
+    }
+    std::string body = fetchBody(publicUrl(path), "GET", {}, "", endpointCost("public", "GET", endpoint));
+    parseTradesInto(body, market, trades);
+}
+
+std::optional<Exchange::AsyncRequest> Binance::fetchTickerRequest(const std::string& symbol, const json& params) {
+    Market market = this->market(symbol);
+    json query = {{"symbol", market.id}};
+    // Caller params go into the query and win over the defaults, as in ccxt's extend()
+    if (params.is_object()) {
+        query.update(params);
+    }
+    AsyncRequest request;
+    request.url = publicUrl("ticker/24hr?" + Exchange::urlencode(query));
+    request.cost = endpointCost("public", "GET", "ticker/24hr", query);
+    request.parse = [this, market](const json& response) { return parseTicker(response, market); };
+    return request;
+}
+
+std::optional<Exchange::AsyncRequest> Binance::fetchOrderBookRequest(const std::string& symbol, int limit,
+                                                                     const json& params) {
+    Market market = this->market(symbol);
+    json query = {{"symbol", market.id}};
+    if (limit > 0) {
+        query["limit"] = limit;
+    }
+    if (params.is_object()) {
+        query.update(params);
+    }
+    AsyncRequest request;
+    request.url = publicUrl("depth?" + Exchange::urlencode(query));
+    request.cost = endpointCost("public", "GET", "depth", query);
+    request.parse = [this, symbol, market](const json& response) { return parseOrderBook(response, symbol, market); };
+    return request;
+}
+
+std::optional<Exchange::AsyncRequest> Binance::fetchOHLCVRequest(const std::string& symbol, const std::string& timeframe,
+                                                                 int since, int limit, const json& params) {
+    Market market = this->market(symbol);
+    auto interval = timeframes.find(timeframe);
+    json query = {
+        {"symbol", market.id},
+        {"interval", interval != timeframes.end() ? interval->second : timeframe}
+    };
+    if (since > 0) {
+        query["startTime"] = since;
+    }
+    if (limit > 0) {
+        query["limit"] = limit;
+    }
+    if (params.is_object()) {
+        query.update(params);
+    }
+    AsyncRequest request;
+    request.url = publicUrl("klines?" + Exchange::urlencode(query));
+    request.cost = endpointCost("public", "GET", "klines", query);
+    request.parse = [this, market, timeframe](const json& response) {
+        json result = json::array();
+        for (const auto& row : response) {
+            result.push_back(parseOHLCV(row, market, timeframe));
+        }
+        return result;
+    };
+    return request;
+}
+
+void Binance::parseTickerInto(std::string_view body, const Market& market, Ticker& ticker) const {
+    JsonView response(body);
+    if (!response.isObject()) {
+        throw BadResponse(id + " ticker is not an object");
+    }
+    ticker = Ticker();
+    ticker.symbol = market.symbol;
+    // One pass over the members instead of a lookup per field
+    response.forEachMember([&](std::string_view key, const JsonView& value) {
+        if (key == "closeTime") ticker.timestamp = value.integer();
+        else if (key == "highPrice") ticker.high = value.number();
+        else if (key == "lowPrice") ticker.low = value.number();
+        else if (key == "bidPrice") ticker.bid = value.number();
+        else if (key == "bidQty") ticker.bidVolume = value.number();
+        else if (key == "askPrice") ticker.ask = value.number();
+        else if (key == "askQty") ticker.askVolume = value.number();
+        else if (key == "weightedAvgPrice") ticker.vwap = value.number();
+        else if (key == "openPrice") ticker.open = value.number();
+        else if (key == "lastPrice") ticker.last = ticker.close = ticker.lastPrice = value.number();
+        else if (key == "lastQty") ticker.lastQuantity = value.number();
+        else if (key == "prevClosePrice") ticker.previousClose = ticker.previousClosePrice = value.number();
+        else if (key == "priceChange") ticker.change = ticker.priceChange = value.number();
+        else if (key == "priceChangePercent") ticker.percentage = ticker.priceChangePercent = value.number();
+        else if (key == "volume") ticker.baseVolume = ticker.volume = value.number();
+        else if (key == "quoteVolume") ticker.quoteVolume = value.number();
+    });
+    ticker.average = (ticker.open + ticker.last) / 2;
+    ticker.datetime = this->iso8601(ticker.timestamp);
+}
+
+void Binance::parseOrderBookInto(std::string_view body, const Market& market, OrderBook& orderBook) const {
+    JsonView response(body);
+    if (!response.isObject()) {
+        throw BadResponse(id + " order book is not an object");
+    }
+    orderBook.symbol = market.symbol;
+    orderBook.timestamp = 0;
+    orderBook.nonce = 0;
+    // Levels are overwritten in place so that a reused book keeps its storage
+    auto readSide = [](const JsonView& levels, std::vector<std::vector<double>>& side) {
+        std::size_t count = 0;
+        levels.forEach([&](const JsonView& level) {
+            if (count == side.size()) {
+                side.emplace_back(2);
+            }
+            side[count].resize(2);
+            side[count][0] = level[0].number();
+            side[count][1] = level[1].number();
+            ++count;
+        });
+        side.resize(count);
+    };
+    response.forEachMember([&](std::string_view key, const JsonView& value) {
+        if (key == "lastUpdateId") orderBook.nonce = value.integer();
+        else if (key == "T") orderBook.timestamp = value.integer();
+        else if (key == "bids") readSide(value, orderBook.bids);
+        else if (key == "asks") readSide(value, orderBook.asks);
+    });
+    orderBook.datetime = orderBook.timestamp ? this->iso8601(orderBook.timestamp) : std::string();
+}
+
+void Binance::parseTradesInto(std::string_view body, const Market& market, std::vector<Trade>& trades) const {
+    JsonView response(body);
+    if (!response.isArray()) {
+        throw BadResponse(id + " trades are not an array");
+    }
+    std::size_t count = 0;
+    // Accepts both /trades and /aggTrades entries
+    response.forEach([&](const JsonView& entry) {
+        if (count == trades.size()) {
+            trades.emplace_back();
+        }
+        Trade& trade = trades[count++];
+        trade.id.clear();
+        trade.order.clear();
+        trade.info.clear();
+        trade.type.clear();
+        trade.takerOrMaker.clear();
+        trade.feeCurrency.clear();
+        trade.orderId.clear();
+        trade.timestamp = 0;
+        trade.price = 0;
+        trade.amount = 0;
+        trade.cost = 0;
+        trade.fee = 0;
+        trade.symbol = market.symbol;
+        bool buyerMaker = false;
+        entry.forEachMember([&](std::string_view key, const JsonView& value) {
+            if (key == "id" || key == "a") trade.id.assign(value.isString() ? value.stringView() : value.raw());
+            else if (key == "price" || key == "p") trade.price = value.number();
+            else if (key == "qty" || key == "q") trade.amount = value.number();
+            else if (key == "quoteQty") trade.cost = value.number();
+            else if (key == "time" || key == "T") trade.timestamp = value.integer();
+            else if (key == "isBuyerMaker" || key == "m") buyerMaker = value.boolean();
+        });
+        // The taker is the seller when the buyer made the book
+        trade.side = buyerMaker ? "sell" : "buy";
+        if (trade.cost == 0) {
+            trade.cost = trade.price * trade.amount;
+        }
+        trade.datetime = this->iso8601(trade.timestamp);
+    });
+    trades.resize(count);
+}
+
 json Binance::fetchOHLCVImpl(const std::string& symbol, const std::string& timeframe,
                           const std::optional<long long>& since,
                           const std::optional<int>& limit) const {
@@ -321,6 +481,69 @@ json Binance::fetchOHLCVImpl(const std::string& symbol, const std::string& timef
     return this->parseOHLCV(response, market, timeframe);
 }
 
+Binance::PreparedOrder Binance::prepareOrder(const std::string& symbol, const std::string& type,
+                                             const std::string& side, const std::string& timeInForce) {
+    const Market& market = this->market(symbol);
+    // Futures orders go to other endpoints with other parameters
+    if (!market.type.empty() && market.type != "spot") {
+        throw NotSupported(id + " prepareOrder() supports spot markets only, " + symbol + " is " + market.type);
+    }
+    std::string orderType = type;
+    std::string orderSide = side;
+    for (char& c : orderType) {
+        c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
+    for (char& c : orderSide) {
+        c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
+    // Stop and take-profit orders need a stopPrice the template has no field for
+    if (orderType != "LIMIT" && orderType != "LIMIT_MAKER" && orderType != "MARKET") {
+        throw NotSupported(id + " prepareOrder() does not support " + type + " orders");
+    }
+    bool limit = orderType != "MARKET";
+    std::string params = "symbol=" + market.id + "&side=" + orderSide + "&type=" + orderType;
+    // LIMIT_MAKER orders are post-only and reject a time in force
+    if (orderType == "LIMIT") {
+        params += "&timeInForce=" + timeInForce;
+    }
+    params += "&quantity={quantity}";
+    if (limit) {
+        params += "&price={price}";
+    }
+    params += "&newClientOrderId={newClientOrderId?}&timestamp={timestamp}";
+
+    PreparedRequest request("POST", publicUrl("order"),
+                            {{"X-MBX-APIKEY", config_.apiKey}, {"Content-Type", "application/x-www-form-urlencoded"}},
+                            params, &signer(), true);
+    std::size_t quantity = request.field("quantity");
+    std::size_t price = limit ? request.field("price") : std::string::npos;
+    std::size_t clientOrderId = request.field("newClientOrderId");
+    std::size_t timestamp = request.field("timestamp");
+    return PreparedOrder{symbol, std::move(request), endpointCost("private", "POST", "order"),
+                         quantity, price, clientOrderId, timestamp};
+}
+
+const PreparedRequest& Binance::renderOrder(PreparedOrder& order, double amount, double price,
+                                            std::string_view clientOrderId) const {
+    char buffer[128];
+    char* end = amountToPrecision(order.symbol, amount, buffer, buffer + sizeof(buffer));
+    order.request.set(order.quantity, std::string_view(buffer, end - buffer));
+    if (order.price != std::string::npos) {
+        end = priceToPrecision(order.symbol, price, buffer, buffer + sizeof(buffer));
+        order.request.set(order.price, std::string_view(buffer, end - buffer));
+    }
+    order.request.set(order.clientOrderId, clientOrderId);
+    order.request.set(order.timestamp, milliseconds());
+    order.request.render();
+    return order.request;
+}
+
+json Binance::createPreparedOrder(PreparedOrder& order, double amount, double price, std::string_view clientOrderId) {
+    const PreparedRequest& request = renderOrder(order, amount, price, clientOrderId);
+    json response = fetch(request.url(), request.method(), request.headers(), request.body(), order.cost);
+    return parseOrder(response, market(order.symbol));
+}
+
 // Trading API
 json Binance::createOrderImpl(const std::string& symbol, const std::string& type, const std::string& side,
                           double amount, const std::optional<double>& price) {
@@ -436,18 +659,28 @@ json Binance::parseTicker(const json& ticker, const Market& market) const {
 
 json Binance::parseOrderBook(const json& orderbook, const std::string& symbol, const Market& market) const {
     json result = json::object();
-    result["timestamp"] = orderbook["T"];
-    result["datetime"] = this->iso8601(orderbook["T"].get<long long>());
+    // Only the futures depth carries a transaction time
+    if (orderbook.contains("T")) {
+        result["timestamp"] = orderbook["T"];
+        result["datetime"] = this->iso8601(orderbook["T"].get<long long>());
+    } else {
+        result["timestamp"] = nullptr;
+        result["datetime"] = nullptr;
+    }
     result["nonce"] = orderbook["lastUpdateId"];
     
     json bids = json::array();
     json asks = json::array();
+    // Levels come as decimal strings
+    auto level = [](const json& value) {
+        return value.is_string() ? parseDouble(value.get_ref<const std::string&>()) : value.get<double>();
+    };
     
     for (const auto& bid : orderbook["bids"]) {
         if (bid.is_array() && bid.size() >= 2) {
             json bidEntry = json::array();
-            bidEntry.push_back(bid[0].get<double>());  // price
-            bidEntry.push_back(bid[1].get<double>());  // amount
+            bidEntry.push_back(level(bid[0]));  // price
+            bidEntry.push_back(level(bid[1]));  // amount
             bids.push_back(bidEntry);
         }
     }
@@ -455,8 +688,8 @@ json Binance::parseOrderBook(const json& orderbook, const std::string& symbol, c
     for (const auto& ask : orderbook["asks"]) {
         if (ask.is_array() && ask.size() >= 2) {
             json askEntry = json::array();
-            askEntry.push_back(ask[0].get<double>());  // price
-            askEntry.push_back(ask[1].get<double>());  // amount
+            askEntry.push_back(level(ask[0]));  // price
+            askEntry.push_back(level(ask[1]));  // amount
             asks.push_back(askEntry);
         }
     }
@@ -531,8 +764,8 @@ json Binance::parseBalance(const json& response) const {
     for (const auto& balance : response) {
         std::string currency = this->safeString(balance, "asset");
         if (!currency.empty()) {
-            double free = std::stod(this->safeString(balance, "free", "0"));
-            double used = std::stod(this->safeString(balance, "locked", "0"));
+            double free = parseDouble(this->safeString(balance, "free", "0"));
+            double used = parseDouble(this->safeString(balance, "locked", "0"));
             result[currency] = {
                 {"free", free},
                 {"used", used},
@@ -639,38 +872,67 @@ json Binance::parseDeposit(const json& deposit, const std::string& currency) con
     return this->parseTransaction(deposit, currency);
 }
 
+void Binance::updateRateLimits(const HttpResponse& response) {
+    Exchange::updateRateLimits(response);
+
+    // Server-side limits behind the X-MBX-USED-WEIGHT-* / X-MBX-ORDER-COUNT-* headers
+    static const std::map<std::string, double> limits = {
+        {"x-mbx-used-weight-1m", 6000},
+        {"x-mbx-order-count-10s", 100},
+        {"x-mbx-order-count-1d", 200000}
+    };
+    static const std::map<char, long long> units = {
+        {'s', 1000}, {'m', 60000}, {'h', 3600000}, {'d', 86400000}
+    };
+    for (const auto& [name, value] : response.headers) {
+        auto limit = limits.find(name);
+        if (limit == limits.end()) {
+            continue;
+        }
+        // The interval is encoded in the header name, e.g. "-10s"
+        auto dash = name.rfind('-');
+        auto unit = units.find(name.back());
+        if (unit == units.end()) {
+            continue;
+        }
+        long long count = std::atoll(name.substr(dash + 1, name.size() - dash - 2).c_str());
+        double used = std::atof(value.c_str());
+        // Weight governs every request, order counts only gate once exhausted
+        bool pace = name.compare(0, 18, "x-mbx-used-weight-") == 0;
+        rateLimiter().reportUsage(name, used, limit->second,
+                                  std::chrono::milliseconds(count * unit->second), pace);
+    }
+}
+
 // Helper methods
 std::string Binance::getTimestamp() const {
     return std::to_string(milliseconds());
 }
 
+// Hex signatures go into the query string as they are, base64 ones escaped
 std::string Binance::createSignature(const std::string& queryString) const {
-    EVP_MAC* mac = EVP_MAC_fetch(nullptr, "HMAC", nullptr);
-    EVP_MAC_CTX* ctx = EVP_MAC_CTX_new(mac);
-    
-    OSSL_PARAM params[] = {
-        OSSL_PARAM_construct_utf8_string("digest", (char*)"sha256", 6),
-        OSSL_PARAM_construct_end()
-    };
-    
-    EVP_MAC_init(ctx, (const unsigned char*)this->config_.secret.c_str(), this->config_.secret.length(), params);
-    EVP_MAC_update(ctx, (const unsigned char*)queryString.c_str(), queryString.length());
-    
-    unsigned char digest[EVP_MAX_MD_SIZE];
-    size_t digestLen = 0;
-    EVP_MAC_final(ctx, digest, &digestLen, sizeof(digest));
-    
-    EVP_MAC_CTX_free(ctx);
-    EVP_MAC_free(mac);
-    
-    std::string result;
-    for (size_t i = 0; i < digestLen; i++) {
-        char hex[3];
-        snprintf(hex, sizeof(hex), "%02x", digest[i]);
-        result += hex;
+    std::string signature = signer().sign(queryString);
+    if (signature.find_first_of("+/=") == std::string::npos) {
+        return signature;
     }
-    
-    return result;
+    std::string escaped;
+    escaped.reserve(signature.size() + 8);
+    for (char c : signature) {
+        switch (c) {
+            case '+': escaped += "%2B"; break;
+            case '/': escaped += "%2F"; break;
+            case '=': escaped += "%3D"; break;
+            default: escaped += c; break;
+        }
+    }
+    return escaped;
+}
+
+std::unique_ptr<Signer> Binance::createSigner(const std::string& secret) const {
+    if (secret.find("-----BEGIN") != std::string::npos) {
+        return std::make_unique<Ed25519Signer>(secret);
+    }
+    return Exchange::createSigner(secret);
 }
 
 std::string Binance::parseOrderType(const std::string& type) const {
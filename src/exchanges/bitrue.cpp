@@ -3,6 +3,7 @@
 #include <sstream>
 #include <iomanip>
 #include <openssl/hmac.h>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -311,7 +312,7 @@ json Bitrue::parseOrder(const json& order, const Market& market) {
     std::string remaining = nullptr;
     
     if (amount != nullptr && filled != nullptr) {
-        remaining = std::to_string(std::stod(amount) - std::stod(filled));
+        remaining = std::to_string(parseDouble(amount) - parseDouble(filled));
     }
     
     return {
@@ -3,6 +3,7 @@
 #include <sstream>
 #include <iomanip>
 #include <openssl/hmac.h>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -202,8 +203,8 @@ json Bybit::fetchBalance(const json& params) {
     
     for (const auto& balance : response["result"]["list"]) {
         std::string currency = balance["coin"];
-        double total = std::stod(balance["walletBalance"].get<std::string>());
-        double free = std::stod(balance["availableToWithdraw"].get<std::string>());
+        double total = jsonDouble(balance["walletBalance"]);
+        double free = jsonDouble(balance["availableToWithdraw"]);
         double used = total - free;
         
         result[currency] = {
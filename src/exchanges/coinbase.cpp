@@ -6,6 +6,7 @@
 #include <boost/asio.hpp>
 #include <boost/thread.hpp>
 #include <boost/bind/bind.hpp>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -131,15 +132,15 @@ json Coinbase::fetchMarkets(const json& params) {
             }},
             {"limits", {
                 {"amount", {
-                    {"min", std::stod(market["base_min_size"].get<std::string>())},
-                    {"max", std::stod(market["base_max_size"].get<std::string>())}
+                    {"min", jsonDouble(market["base_min_size"])},
+                    {"max", jsonDouble(market["base_max_size"])}
                 }},
                 {"price", {
-                    {"min", std::stod(market["quote_increment"].get<std::string>())}
+                    {"min", jsonDouble(market["quote_increment"])}
                 }},
                 {"cost", {
-                    {"min", std::stod(market["min_market_funds"].get<std::string>())},
-                    {"max", std::stod(market["max_market_funds"].get<std::string>())}
+                    {"min", jsonDouble(market["min_market_funds"])},
+                    {"max", jsonDouble(market["max_market_funds"])}
                 }}
             }},
             {"info", market}
@@ -159,8 +160,8 @@ json Coinbase::fetchBalance(const json& params) {
     
     for (const auto& balance : response) {
         std::string currency = balance["currency"];
-        double available = std::stod(balance["available"].get<std::string>());
-        double hold = std::stod(balance["hold"].get<std::string>());
+        double available = jsonDouble(balance["available"]);
+        double hold = jsonDouble(balance["hold"]);
         double total = available + hold;
         
         if (total > 0) {
@@ -232,25 +233,37 @@ std::string Coinbase::getTimestamp() {
     return std::to_string(std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count());
 }
 
+std::unique_ptr<Signer> Coinbase::createSigner(const std::string& secret) const {
+    // Advanced Trade keys are EC private keys that sign a JWT per request
+    if (secret.find("-----BEGIN") != std::string::npos) {
+        return std::make_unique<Es256Signer>(secret);
+    }
+    // Legacy secrets are issued base64 encoded, decoded here once per secret
+    return std::make_unique<HmacSigner>(HashAlgorithm::Sha256, base64Decode(secret), SignatureEncoding::Base64);
+}
+
 std::string Coinbase::createSignature(const std::string& timestamp, const std::string& method,
                                const std::string& requestPath, const std::string& body) {
-    std::string message = timestamp + method + requestPath + body;
-    
-    unsigned char* hmac = nullptr;
-    unsigned int hmacLen = 0;
-    
-    HMAC_CTX* ctx = HMAC_CTX_new();
-    HMAC_Init_ex(ctx, base64_decode(secret).c_str(), base64_decode(secret).length(), EVP_sha256(), nullptr);
-    HMAC_Update(ctx, (unsigned char*)message.c_str(), message.length());
-    HMAC_Final(ctx, hmac, &hmacLen);
-    HMAC_CTX_free(ctx);
-    
-    return base64_encode(hmac, hmacLen);
+    return signer().sign(timestamp + method + requestPath + body);
 }
 
 std::map<std::string, std::string> Coinbase::getAuthHeaders(const std::string& method,
                                                 const std::string& requestPath,
                                                 const std::string& body) {
+    if (const auto* es256 = dynamic_cast<const Es256Signer*>(&signer())) {
+        // Coinbase Developer Platform JWT, valid for two minutes and bound to
+        // this request's method and path
+        long long now = milliseconds() / 1000;
+        json header = {{"kid", config_.apiKey}, {"nonce", uuid()}};
+        json claims = {
+            {"sub", config_.apiKey},
+            {"iss", "cdp"},
+            {"nbf", now},
+            {"exp", now + 120},
+            {"uri", method + " api.coinbase.com" + requestPath}
+        };
+        return {{"Authorization", "Bearer " + es256->jwt(std::move(header), claims)}};
+    }
     std::string timestamp = getTimestamp();
     std::string signature = createSignature(timestamp, method, requestPath, body);
     
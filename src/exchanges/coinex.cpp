@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/coinex.h"
+#include "ccxt/base/executor.h"
 #include <ctime>
 #include <sstream>
 #include <iomanip>
@@ -162,7 +163,7 @@ nlohmann::json CoinEx::fetch_markets() {
 }
 
 std::future<nlohmann::json> CoinEx::fetch_markets_async() {
-    return std::async(std::launch::async, [this]() { return fetch_markets(); });
+    return Executor::instance().submit([this]() { return fetch_markets(); });
 }
 
 nlohmann::json CoinEx::create_order(const std::string& symbol, const std::string& type,
@@ -190,7 +191,7 @@ std::future<nlohmann::json> CoinEx::create_order_async(const std::string& symbol
                                              const std::string& side,
                                              double amount,
                                              double price) {
-    return std::async(std::launch::async, [this, symbol, type, side, amount, price]() {
+    return Executor::instance().submit([this, symbol, type, side, amount, price]() {
         return create_order(symbol, type, side, amount, price);
     });
 }
@@ -208,7 +209,7 @@ nlohmann::json CoinEx::cancel_order(const std::string& id, const std::string& sy
 }
 
 std::future<nlohmann::json> CoinEx::cancel_order_async(const std::string& id, const std::string& symbol) {
-    return std::async(std::launch::async, [this, id, symbol]() { return cancel_order(id, symbol); });
+    return Executor::instance().submit([this, id, symbol]() { return cancel_order(id, symbol); });
 }
 
 nlohmann::json CoinEx::fetch_balance() {
@@ -218,7 +219,7 @@ nlohmann::json CoinEx::fetch_balance() {
 }
 
 std::future<nlohmann::json> CoinEx::fetch_balance_async() {
-    return std::async(std::launch::async, [this]() { return fetch_balance(); });
+    return Executor::instance().submit([this]() { return fetch_balance(); });
 }
 
 std::string CoinEx::sign(const std::string& path, const std::string& api,
@@ -316,15 +317,15 @@ std::string CoinEx::get_tonce() {
 }
 
 std::future<nlohmann::json> CoinEx::fetch_ticker_async(const std::string& symbol) {
-    return std::async(std::launch::async, [this, symbol]() { return fetch_ticker(symbol); });
+    return Executor::instance().submit([this, symbol]() { return fetch_ticker(symbol); });
 }
 
 std::future<nlohmann::json> CoinEx::fetch_order_book_async(const std::string& symbol, int limit) {
-    return std::async(std::launch::async, [this, symbol, limit]() { return fetch_order_book(symbol, limit); });
+    return Executor::instance().submit([this, symbol, limit]() { return fetch_order_book(symbol, limit); });
 }
 
 std::future<nlohmann::json> CoinEx::fetch_trades_async(const std::string& symbol, long since, int limit) {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+    return Executor::instance().submit([this, symbol, since, limit]() {
         return fetch_trades(symbol, since, limit);
     });
 }
@@ -333,55 +334,55 @@ std::future<nlohmann::json> CoinEx::fetch_ohlcv_async(const std::string& symbol,
                                                  const std::string& timeframe,
                                                  long since,
                                                  int limit) {
-    return std::async(std::launch::async, [this, symbol, timeframe, since, limit]() {
+    return Executor::instance().submit([this, symbol, timeframe, since, limit]() {
         return fetch_ohlcv(symbol, timeframe, since, limit);
     });
 }
 
 std::future<nlohmann::json> CoinEx::cancel_all_orders_async(const std::string& symbol) {
-    return std::async(std::launch::async, [this, symbol]() { return cancel_all_orders(symbol); });
+    return Executor::instance().submit([this, symbol]() { return cancel_all_orders(symbol); });
 }
 
 std::future<nlohmann::json> CoinEx::fetch_order_async(const std::string& id, const std::string& symbol) {
-    return std::async(std::launch::async, [this, id, symbol]() { return fetch_order(id, symbol); });
+    return Executor::instance().submit([this, id, symbol]() { return fetch_order(id, symbol); });
 }
 
 std::future<nlohmann::json> CoinEx::fetch_orders_async(const std::string& symbol, long since, int limit) {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+    return Executor::instance().submit([this, symbol, since, limit]() {
         return fetch_orders(symbol, since, limit);
     });
 }
 
 std::future<nlohmann::json> CoinEx::fetch_open_orders_async(const std::string& symbol, long since, int limit) {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+    return Executor::instance().submit([this, symbol, since, limit]() {
         return fetch_open_orders(symbol, since, limit);
     });
 }
 
 std::future<nlohmann::json> CoinEx::fetch_closed_orders_async(const std::string& symbol, long since, int limit) {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+    return Executor::instance().submit([this, symbol, since, limit]() {
         return fetch_closed_orders(symbol, since, limit);
     });
 }
 
 std::future<nlohmann::json> CoinEx::fetch_my_trades_async(const std::string& symbol, long since, int limit) {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+    return Executor::instance().submit([this, symbol, since, limit]() {
         return fetch_my_trades(symbol, since, limit);
     });
 }
 
 std::future<nlohmann::json> CoinEx::fetch_deposit_address_async(const std::string& code) {
-    return std::async(std::launch::async, [this, code]() { return fetch_deposit_address(code); });
+    return Executor::instance().submit([this, code]() { return fetch_deposit_address(code); });
 }
 
 std::future<nlohmann::json> CoinEx::fetch_deposits_async(const std::string& code, long since, int limit) {
-    return std::async(std::launch::async, [this, code, since, limit]() {
+    return Executor::instance().submit([this, code, since, limit]() {
         return fetch_deposits(code, since, limit);
     });
 }
 
 std::future<nlohmann::json> CoinEx::fetch_withdrawals_async(const std::string& code, long since, int limit) {
-    return std::async(std::launch::async, [this, code, since, limit]() {
+    return Executor::instance().submit([this, code, since, limit]() {
         return fetch_withdrawals(code, since, limit);
     });
 }
@@ -391,13 +392,13 @@ std::future<nlohmann::json> CoinEx::withdraw_async(const std::string& code,
                                               const std::string& address,
                                               const std::string& tag,
                                               const nlohmann::json& params) {
-    return std::async(std::launch::async, [this, code, amount, address, tag, params]() {
+    return Executor::instance().submit([this, code, amount, address, tag, params]() {
         return withdraw(code, amount, address, tag, params);
     });
 }
 
 std::future<nlohmann::json> CoinEx::fetch_margin_balance_async() {
-    return std::async(std::launch::async, [this]() { return fetch_margin_balance(); });
+    return Executor::instance().submit([this]() { return fetch_margin_balance(); });
 }
 
 std::future<nlohmann::json> CoinEx::create_margin_order_async(const std::string& symbol,
@@ -405,7 +406,7 @@ std::future<nlohmann::json> CoinEx::create_margin_order_async(const std::string&
                                                  const std::string& side,
                                                  double amount,
                                                  double price) {
-    return std::async(std::launch::async, [this, symbol, type, side, amount, price]() {
+    return Executor::instance().submit([this, symbol, type, side, amount, price]() {
         return create_margin_order(symbol, type, side, amount, price);
     });
 }
@@ -413,7 +414,7 @@ std::future<nlohmann::json> CoinEx::create_margin_order_async(const std::string&
 std::future<nlohmann::json> CoinEx::borrow_margin_async(const std::string& code,
                                              double amount,
                                              const std::string& symbol) {
-    return std::async(std::launch::async, [this, code, amount, symbol]() {
+    return Executor::instance().submit([this, code, amount, symbol]() {
         return borrow_margin(code, amount, symbol);
     });
 }
@@ -421,7 +422,7 @@ std::future<nlohmann::json> CoinEx::borrow_margin_async(const std::string& code,
 std::future<nlohmann::json> CoinEx::repay_margin_async(const std::string& code,
                                              double amount,
                                              const std::string& symbol) {
-    return std::async(std::launch::async, [this, code, amount, symbol]() {
+    return Executor::instance().submit([this, code, amount, symbol]() {
         return repay_margin(code, amount, symbol);
     });
 }
@@ -430,7 +431,7 @@ std::future<nlohmann::json> CoinEx::fetch_async(const std::string& url,
                                              const std::string& method,
                                              const std::map<std::string, std::string>& headers,
                                              const std::string& body) {
-    return std::async(std::launch::async, [this, url, method, headers, body]() {
+    return Executor::instance().submit([this, url, method, headers, body]() {
         return fetch(url, method, headers, body);
     });
 }
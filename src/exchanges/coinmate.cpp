@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/coinmate.h"
+#include "ccxt/base/executor.h"
 #include <openssl/hmac.h>
 
 namespace ccxt {
@@ -253,93 +254,93 @@ Json coinmate::fetchDepositsWithdrawalsImpl(const std::optional<std::string>& co
 // Async Methods
 // Market Data
 AsyncPullType coinmate::fetchMarketsAsync() const {
-    return std::async(std::launch::async, [this]() {
+    return Executor::instance().submit([this]() {
         return this->fetchMarketsImpl();
     });
 }
 
 AsyncPullType coinmate::fetchTickerAsync(const std::string& symbol) const {
-    return std::async(std::launch::async, [this, symbol]() {
+    return Executor::instance().submit([this, symbol]() {
         return this->fetchTickerImpl(symbol);
     });
 }
 
 AsyncPullType coinmate::fetchTickersAsync(const std::vector<std::string>& symbols) const {
-    return std::async(std::launch::async, [this, symbols]() {
+    return Executor::instance().submit([this, symbols]() {
         return this->fetchTickersImpl(symbols);
     });
 }
 
 AsyncPullType coinmate::fetchOrderBookAsync(const std::string& symbol, const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, symbol, limit]() {
+    return Executor::instance().submit([this, symbol, limit]() {
         return this->fetchOrderBookImpl(symbol, limit);
     });
 }
 
 AsyncPullType coinmate::fetchTradesAsync(const std::string& symbol, const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, symbol, limit]() {
+    return Executor::instance().submit([this, symbol, limit]() {
         return this->fetchTradesImpl(symbol, limit);
     });
 }
 
 AsyncPullType coinmate::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe, const std::optional<long long>& since, const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, symbol, timeframe, since, limit]() {
+    return Executor::instance().submit([this, symbol, timeframe, since, limit]() {
         return this->fetchOHLCVImpl(symbol, timeframe, since, limit);
     });
 }
 
 // Trading
 AsyncPullType coinmate::createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side, double amount, const std::optional<double>& price) {
-    return std::async(std::launch::async, [this, symbol, type, side, amount, price]() {
+    return Executor::instance().submit([this, symbol, type, side, amount, price]() {
         return this->createOrderImpl(symbol, type, side, amount, price);
     });
 }
 
 AsyncPullType coinmate::cancelOrderAsync(const std::string& id, const std::string& symbol) {
-    return std::async(std::launch::async, [this, id, symbol]() {
+    return Executor::instance().submit([this, id, symbol]() {
         return this->cancelOrderImpl(id, symbol);
     });
 }
 
 AsyncPullType coinmate::fetchOrderAsync(const std::string& id, const std::string& symbol) const {
-    return std::async(std::launch::async, [this, id, symbol]() {
+    return Executor::instance().submit([this, id, symbol]() {
         return this->fetchOrderImpl(id, symbol);
     });
 }
 
 AsyncPullType coinmate::fetchOrdersAsync(const std::string& symbol, const std::optional<long long>& since, const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+    return Executor::instance().submit([this, symbol, since, limit]() {
         return this->fetchOrdersImpl(symbol, since, limit);
     });
 }
 
 AsyncPullType coinmate::fetchOpenOrdersAsync(const std::string& symbol, const std::optional<long long>& since, const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+    return Executor::instance().submit([this, symbol, since, limit]() {
         return this->fetchOpenOrdersImpl(symbol, since, limit);
     });
 }
 
 AsyncPullType coinmate::fetchClosedOrdersAsync(const std::string& symbol, const std::optional<long long>& since, const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+    return Executor::instance().submit([this, symbol, since, limit]() {
         return this->fetchClosedOrdersImpl(symbol, since, limit);
     });
 }
 
 AsyncPullType coinmate::fetchMyTradesAsync(const std::string& symbol, const std::optional<long long>& since, const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+    return Executor::instance().submit([this, symbol, since, limit]() {
         return this->fetchMyTradesImpl(symbol, since, limit);
     });
 }
 
 // Account
 AsyncPullType coinmate::fetchBalanceAsync() const {
-    return std::async(std::launch::async, [this]() {
+    return Executor::instance().submit([this]() {
         return this->fetchBalanceImpl();
     });
 }
 
 AsyncPullType coinmate::fetchDepositsWithdrawalsAsync(const std::optional<std::string>& code, const std::optional<long long>& since, const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, code, since, limit]() {
+    return Executor::instance().submit([this, code, since, limit]() {
         return this->fetchDepositsWithdrawalsImpl(code, since, limit);
     });
 }
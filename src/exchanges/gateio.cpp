@@ -3,6 +3,7 @@
 #include <sstream>
 #include <iomanip>
 #include <openssl/hmac.h>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -241,10 +242,10 @@ json GateIO::fetchBalance(const json& params) {
     
     for (const auto& balance : response) {
         std::string currency = balance["currency"];
-        double total = std::stod(balance["available"].get<std::string>()) + 
-                      std::stod(balance["locked"].get<std::string>());
-        double free = std::stod(balance["available"].get<std::string>());
-        double used = std::stod(balance["locked"].get<std::string>());
+        double total = jsonDouble(balance["available"]) + 
+                      jsonDouble(balance["locked"]);
+        double free = jsonDouble(balance["available"]);
+        double used = jsonDouble(balance["locked"]);
         
         result[currency] = {
             {"free", free},
@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/hashkey.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <sstream>
 #include <iomanip>
@@ -76,93 +77,93 @@ nlohmann::json Hashkey::fetch_ticker(const std::string& symbol) {
 
 // Async implementations
 std::future<nlohmann::json> Hashkey::fetch_markets_async() {
-    return std::async(std::launch::async, [this]() {
+    return Executor::instance().submit([this]() {
         return this->fetch_markets();
     });
 }
 
 std::future<nlohmann::json> Hashkey::fetch_ticker_async(const std::string& symbol) {
-    return std::async(std::launch::async, [this, symbol]() {
+    return Executor::instance().submit([this, symbol]() {
         return this->fetch_ticker(symbol);
     });
 }
 
 std::future<nlohmann::json> Hashkey::fetch_tickers_async(const std::vector<std::string>& symbols) {
-    return std::async(std::launch::async, [this, symbols]() {
+    return Executor::instance().submit([this, symbols]() {
         return this->fetch_tickers(symbols);
     });
 }
 
 std::future<nlohmann::json> Hashkey::fetch_order_book_async(const std::string& symbol, int limit) {
-    return std::async(std::launch::async, [this, symbol, limit]() {
+    return Executor::instance().submit([this, symbol, limit]() {
         return this->fetch_order_book(symbol, limit);
     });
 }
 
 std::future<nlohmann::json> Hashkey::fetch_trades_async(const std::string& symbol, int limit) {
-    return std::async(std::launch::async, [this, symbol, limit]() {
+    return Executor::instance().submit([this, symbol, limit]() {
         return this->fetch_trades(symbol, limit);
     });
 }
 
 std::future<nlohmann::json> Hashkey::fetch_balance_async() {
-    return std::async(std::launch::async, [this]() {
+    return Executor::instance().submit([this]() {
         return this->fetch_balance();
     });
 }
 
 std::future<nlohmann::json> Hashkey::fetch_ohlcv_async(const std::string& symbol, const std::string& timeframe,
                                                       long since, int limit) {
-    return std::async(std::launch::async, [this, symbol, timeframe, since, limit]() {
+    return Executor::instance().submit([this, symbol, timeframe, since, limit]() {
         return this->fetch_ohlcv(symbol, timeframe, since, limit);
     });
 }
 
 std::future<nlohmann::json> Hashkey::create_order_async(const std::string& symbol, const std::string& type,
                                                        const std::string& side, double amount, double price) {
-    return std::async(std::launch::async, [this, symbol, type, side, amount, price]() {
+    return Executor::instance().submit([this, symbol, type, side, amount, price]() {
         return this->create_order(symbol, type, side, amount, price);
     });
 }
 
 std::future<nlohmann::json> Hashkey::cancel_order_async(const std::string& id, const std::string& symbol) {
-    return std::async(std::launch::async, [this, id, symbol]() {
+    return Executor::instance().submit([this, id, symbol]() {
         return this->cancel_order(id, symbol);
     });
 }
 
 std::future<nlohmann::json> Hashkey::cancel_all_orders_async(const std::string& symbol) {
-    return std::async(std::launch::async, [this, symbol]() {
+    return Executor::instance().submit([this, symbol]() {
         return this->cancel_all_orders(symbol);
     });
 }
 
 std::future<nlohmann::json> Hashkey::fetch_order_async(const std::string& id, const std::string& symbol) {
-    return std::async(std::launch::async, [this, id, symbol]() {
+    return Executor::instance().submit([this, id, symbol]() {
         return this->fetch_order(id, symbol);
     });
 }
 
 std::future<nlohmann::json> Hashkey::fetch_orders_async(const std::string& symbol, int limit) {
-    return std::async(std::launch::async, [this, symbol, limit]() {
+    return Executor::instance().submit([this, symbol, limit]() {
         return this->fetch_orders(symbol, limit);
     });
 }
 
 std::future<nlohmann::json> Hashkey::fetch_open_orders_async(const std::string& symbol, int limit) {
-    return std::async(std::launch::async, [this, symbol, limit]() {
+    return Executor::instance().submit([this, symbol, limit]() {
         return this->fetch_open_orders(symbol, limit);
     });
 }
 
 std::future<nlohmann::json> Hashkey::fetch_closed_orders_async(const std::string& symbol, int limit) {
-    return std::async(std::launch::async, [this, symbol, limit]() {
+    return Executor::instance().submit([this, symbol, limit]() {
         return this->fetch_closed_orders(symbol, limit);
     });
 }
 
 std::future<nlohmann::json> Hashkey::fetch_my_trades_async(const std::string& symbol, int since, int limit) {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+    return Executor::instance().submit([this, symbol, since, limit]() {
         return this->fetch_my_trades(symbol, since, limit);
     });
 }
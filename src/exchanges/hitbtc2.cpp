@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/hitbtc2.h"
+#include "ccxt/base/executor.h"
 #include <ctime>
 #include <sstream>
 #include <iomanip>
@@ -220,112 +221,112 @@ std::string HitBTC2::sign(const std::string& path, const std::string& api,
 
 // Async implementations
 std::future<nlohmann::json> HitBTC2::fetch_markets_async() {
-    return std::async(std::launch::async, [this]() {
+    return Executor::instance().submit([this]() {
         return this->fetch_markets();
     });
 }
 
 std::future<nlohmann::json> HitBTC2::fetch_ticker_async(const std::string& symbol) {
-    return std::async(std::launch::async, [this, symbol]() {
+    return Executor::instance().submit([this, symbol]() {
         return this->fetch_ticker(symbol);
     });
 }
 
 std::future<nlohmann::json> HitBTC2::fetch_tickers_async(const std::vector<std::string>& symbols) {
-    return std::async(std::launch::async, [this, symbols]() {
+    return Executor::instance().submit([this, symbols]() {
         return this->fetch_tickers(symbols);
     });
 }
 
 std::future<nlohmann::json> HitBTC2::fetch_order_book_async(const std::string& symbol, int limit) {
-    return std::async(std::launch::async, [this, symbol, limit]() {
+    return Executor::instance().submit([this, symbol, limit]() {
         return this->fetch_order_book(symbol, limit);
     });
 }
 
 std::future<nlohmann::json> HitBTC2::fetch_trades_async(const std::string& symbol, int since, int limit) {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+    return Executor::instance().submit([this, symbol, since, limit]() {
         return this->fetch_trades(symbol, since, limit);
     });
 }
 
 std::future<nlohmann::json> HitBTC2::fetch_ohlcv_async(const std::string& symbol, const std::string& timeframe,
                                                      int since, int limit) {
-    return std::async(std::launch::async, [this, symbol, timeframe, since, limit]() {
+    return Executor::instance().submit([this, symbol, timeframe, since, limit]() {
         return this->fetch_ohlcv(symbol, timeframe, since, limit);
     });
 }
 
 std::future<nlohmann::json> HitBTC2::create_order_async(const std::string& symbol, const std::string& type,
                                                       const std::string& side, double amount, double price) {
-    return std::async(std::launch::async, [this, symbol, type, side, amount, price]() {
+    return Executor::instance().submit([this, symbol, type, side, amount, price]() {
         return this->create_order(symbol, type, side, amount, price);
     });
 }
 
 std::future<nlohmann::json> HitBTC2::cancel_order_async(const std::string& id, const std::string& symbol) {
-    return std::async(std::launch::async, [this, id, symbol]() {
+    return Executor::instance().submit([this, id, symbol]() {
         return this->cancel_order(id, symbol);
     });
 }
 
 std::future<nlohmann::json> HitBTC2::fetch_order_async(const std::string& id, const std::string& symbol) {
-    return std::async(std::launch::async, [this, id, symbol]() {
+    return Executor::instance().submit([this, id, symbol]() {
         return this->fetch_order(id, symbol);
     });
 }
 
 std::future<nlohmann::json> HitBTC2::fetch_orders_async(const std::string& symbol, int since, int limit) {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+    return Executor::instance().submit([this, symbol, since, limit]() {
         return this->fetch_orders(symbol, since, limit);
     });
 }
 
 std::future<nlohmann::json> HitBTC2::fetch_open_orders_async(const std::string& symbol, int since, int limit) {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+    return Executor::instance().submit([this, symbol, since, limit]() {
         return this->fetch_open_orders(symbol, since, limit);
     });
 }
 
 std::future<nlohmann::json> HitBTC2::fetch_closed_orders_async(const std::string& symbol, int since, int limit) {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+    return Executor::instance().submit([this, symbol, since, limit]() {
         return this->fetch_closed_orders(symbol, since, limit);
     });
 }
 
 std::future<nlohmann::json> HitBTC2::fetch_my_trades_async(const std::string& symbol, int since, int limit) {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+    return Executor::instance().submit([this, symbol, since, limit]() {
         return this->fetch_my_trades(symbol, since, limit);
     });
 }
 
 std::future<nlohmann::json> HitBTC2::fetch_balance_async() {
-    return std::async(std::launch::async, [this]() {
+    return Executor::instance().submit([this]() {
         return this->fetch_balance();
     });
 }
 
 std::future<nlohmann::json> HitBTC2::fetch_deposit_address_async(const std::string& code) {
-    return std::async(std::launch::async, [this, code]() {
+    return Executor::instance().submit([this, code]() {
         return this->fetch_deposit_address(code);
     });
 }
 
 std::future<nlohmann::json> HitBTC2::fetch_deposits_async(const std::string& code, int since, int limit) {
-    return std::async(std::launch::async, [this, code, since, limit]() {
+    return Executor::instance().submit([this, code, since, limit]() {
         return this->fetch_deposits(code, since, limit);
     });
 }
 
 std::future<nlohmann::json> HitBTC2::fetch_withdrawals_async(const std::string& code, int since, int limit) {
-    return std::async(std::launch::async, [this, code, since, limit]() {
+    return Executor::instance().submit([this, code, since, limit]() {
         return this->fetch_withdrawals(code, since, limit);
     });
 }
 
 std::future<nlohmann::json> HitBTC2::withdraw_async(const std::string& code, double amount, const std::string& address,
                                                  const std::string& tag, const nlohmann::json& params) {
-    return std::async(std::launch::async, [this, code, amount, address, tag, params]() {
+    return Executor::instance().submit([this, code, amount, address, tag, params]() {
         return this->withdraw(code, amount, address, tag, params);
     });
 }
@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/hollex.h"
+#include "ccxt/base/executor.h"
 #include <ctime>
 #include <sstream>
 #include <iomanip>
@@ -199,106 +200,106 @@ std::string Hollex::sign(const std::string& path, const std::string& api,
 
 // Async implementations
 std::future<nlohmann::json> Hollex::fetch_markets_async() {
-    return std::async(std::launch::async, [this]() {
+    return Executor::instance().submit([this]() {
         return this->fetch_markets();
     });
 }
 
 std::future<nlohmann::json> Hollex::fetch_ticker_async(const std::string& symbol) {
-    return std::async(std::launch::async, [this, symbol]() {
+    return Executor::instance().submit([this, symbol]() {
         return this->fetch_ticker(symbol);
     });
 }
 
 std::future<nlohmann::json> Hollex::fetch_order_book_async(const std::string& symbol, int limit) {
-    return std::async(std::launch::async, [this, symbol, limit]() {
+    return Executor::instance().submit([this, symbol, limit]() {
         return this->fetch_order_book(symbol, limit);
     });
 }
 
 std::future<nlohmann::json> Hollex::fetch_trades_async(const std::string& symbol, int since, int limit) {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+    return Executor::instance().submit([this, symbol, since, limit]() {
         return this->fetch_trades(symbol, since, limit);
     });
 }
 
 std::future<nlohmann::json> Hollex::fetch_ohlcv_async(const std::string& symbol, const std::string& timeframe,
                                                     int since, int limit) {
-    return std::async(std::launch::async, [this, symbol, timeframe, since, limit]() {
+    return Executor::instance().submit([this, symbol, timeframe, since, limit]() {
         return this->fetch_ohlcv(symbol, timeframe, since, limit);
     });
 }
 
 std::future<nlohmann::json> Hollex::create_order_async(const std::string& symbol, const std::string& type,
                                                      const std::string& side, double amount, double price) {
-    return std::async(std::launch::async, [this, symbol, type, side, amount, price]() {
+    return Executor::instance().submit([this, symbol, type, side, amount, price]() {
         return this->create_order(symbol, type, side, amount, price);
     });
 }
 
 std::future<nlohmann::json> Hollex::cancel_order_async(const std::string& id, const std::string& symbol) {
-    return std::async(std::launch::async, [this, id, symbol]() {
+    return Executor::instance().submit([this, id, symbol]() {
         return this->cancel_order(id, symbol);
     });
 }
 
 std::future<nlohmann::json> Hollex::fetch_order_async(const std::string& id, const std::string& symbol) {
-    return std::async(std::launch::async, [this, id, symbol]() {
+    return Executor::instance().submit([this, id, symbol]() {
         return this->fetch_order(id, symbol);
     });
 }
 
 std::future<nlohmann::json> Hollex::fetch_orders_async(const std::string& symbol, int since, int limit) {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+    return Executor::instance().submit([this, symbol, since, limit]() {
         return this->fetch_orders(symbol, since, limit);
     });
 }
 
 std::future<nlohmann::json> Hollex::fetch_open_orders_async(const std::string& symbol, int since, int limit) {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+    return Executor::instance().submit([this, symbol, since, limit]() {
         return this->fetch_open_orders(symbol, since, limit);
     });
 }
 
 std::future<nlohmann::json> Hollex::fetch_closed_orders_async(const std::string& symbol, int since, int limit) {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+    return Executor::instance().submit([this, symbol, since, limit]() {
         return this->fetch_closed_orders(symbol, since, limit);
     });
 }
 
 std::future<nlohmann::json> Hollex::fetch_my_trades_async(const std::string& symbol, int since, int limit) {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+    return Executor::instance().submit([this, symbol, since, limit]() {
         return this->fetch_my_trades(symbol, since, limit);
     });
 }
 
 std::future<nlohmann::json> Hollex::fetch_balance_async() {
-    return std::async(std::launch::async, [this]() {
+    return Executor::instance().submit([this]() {
         return this->fetch_balance();
     });
 }
 
 std::future<nlohmann::json> Hollex::fetch_deposit_address_async(const std::string& code) {
-    return std::async(std::launch::async, [this, code]() {
+    return Executor::instance().submit([this, code]() {
         return this->fetch_deposit_address(code);
     });
 }
 
 std::future<nlohmann::json> Hollex::fetch_deposits_async(const std::string& code, int since, int limit) {
-    return std::async(std::launch::async, [this, code, since, limit]() {
+    return Executor::instance().submit([this, code, since, limit]() {
         return this->fetch_deposits(code, since, limit);
     });
 }
 
 std::future<nlohmann::json> Hollex::fetch_withdrawals_async(const std::string& code, int since, int limit) {
-    return std::async(std::launch::async, [this, code, since, limit]() {
+    return Executor::instance().submit([this, code, since, limit]() {
         return this->fetch_withdrawals(code, since, limit);
     });
 }
 
 std::future<nlohmann::json> Hollex::withdraw_async(const std::string& code, double amount, const std::string& address,
                                                 const std::string& tag, const nlohmann::json& params) {
-    return std::async(std::launch::async, [this, code, amount, address, tag, params]() {
+    return Executor::instance().submit([this, code, amount, address, tag, params]() {
         return this->withdraw(code, amount, address, tag, params);
     });
 }
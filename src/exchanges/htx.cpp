@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/htx.h"
+#include "ccxt/base/executor.h"
 #include "../base/crypto.h"
 #include "../base/error.h"
 #include <sstream>
@@ -163,7 +164,7 @@ Order HTX::createOrder(const std::string& symbol, const std::string& type,
 
 // Async implementations
 std::future<OrderBook> HTX::fetchOrderBookAsync(const std::string& symbol, int limit, const Params& params) {
-    return std::async(std::launch::async, [this, symbol, limit, params]() {
+    return Executor::instance().submit([this, symbol, limit, params]() {
         return this->fetchOrderBook(symbol, limit, params);
     });
 }
@@ -171,7 +172,7 @@ std::future<OrderBook> HTX::fetchOrderBookAsync(const std::string& symbol, int l
 std::future<std::string> HTX::getSignatureAsync(const std::string& path, const std::string& method,
                                               const std::string& hostname, const Params& params,
                                               const std::string& timestamp) const {
-    return std::async(std::launch::async, [this, path, method, hostname, params, timestamp]() {
+    return Executor::instance().submit([this, path, method, hostname, params, timestamp]() {
         return this->getSignature(path, method, hostname, params, timestamp);
     });
 }
@@ -179,13 +180,13 @@ std::future<std::string> HTX::getSignatureAsync(const std::string& path, const s
 AsyncPullType HTX::signRequestAsync(const std::string& path, const std::string& api,
                                       const std::string& method, const Params& params,
                                       const json& headers, const std::string& body) {
-    return std::async(std::launch::async, [this, path, api, method, params, headers, body]() {
+    return Executor::instance().submit([this, path, api, method, params, headers, body]() {
         return this->signRequest(path, api, method, params, headers, body);
     });
 }
 
 std::future<Balance> HTX::fetchBalanceAsync(const Params& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return this->fetchBalance(params);
     });
 }
@@ -193,7 +194,7 @@ std::future<Balance> HTX::fetchBalanceAsync(const Params& params) {
 std::future<Order> HTX::createOrderAsync(const std::string& symbol, const std::string& type,
                                        const std::string& side, double amount, double price,
                                        const Params& params) {
-    return std::async(std::launch::async, [this, symbol, type, side, amount, price, params]() {
+    return Executor::instance().submit([this, symbol, type, side, amount, price, params]() {
         return this->createOrder(symbol, type, side, amount, price, params);
     });
 }
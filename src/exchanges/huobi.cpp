@@ -1,10 +1,12 @@
 #include "huobi.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <sstream>
 #include <iomanip>
 #include <algorithm>
 #include <base64.h>
 #include <future>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -103,11 +105,11 @@ json Huobi::fetchMarkets(const json& params) {
             }},
             {"limits", {
                 {"amount", {
-                    {"min", std::stod(market["min-order-amt"].get<std::string>())},
-                    {"max", std::stod(market["max-order-amt"].get<std::string>())}
+                    {"min", jsonDouble(market["min-order-amt"])},
+                    {"max", jsonDouble(market["max-order-amt"])}
                 }},
                 {"price", {
-                    {"min", std::stod(market["min-order-value"].get<std::string>())}
+                    {"min", jsonDouble(market["min-order-value"])}
                 }}
             }},
             {"info", market}
@@ -160,7 +162,7 @@ json Huobi::fetchBalance(const json& params) {
         std::transform(currency.begin(), currency.end(), currency.begin(), ::toupper);
         
         if (balance["type"] == "trade") {
-            double free = std::stod(balance["balance"].get<std::string>());
+            double free = jsonDouble(balance["balance"]);
             if (result.contains(currency)) {
                 result[currency]["free"] = free;
                 result[currency]["total"] = free + result[currency]["used"].get<double>();
@@ -172,7 +174,7 @@ json Huobi::fetchBalance(const json& params) {
                 };
             }
         } else if (balance["type"] == "frozen") {
-            double used = std::stod(balance["balance"].get<std::string>());
+            double used = jsonDouble(balance["balance"]);
             if (result.contains(currency)) {
                 result[currency]["used"] = used;
                 result[currency]["total"] = used + result[currency]["free"].get<double>();
@@ -300,44 +302,44 @@ std::string Huobi::getAccountId() {
 
 // Async implementations
 AsyncPullType Huobi::fetchMarketsAsync(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return this->fetchMarkets(params);
     });
 }
 
 AsyncPullType Huobi::fetchTickerAsync(const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, symbol, params]() {
+    return Executor::instance().submit([this, symbol, params]() {
         return this->fetchTicker(symbol, params);
     });
 }
 
 AsyncPullType Huobi::fetchTickersAsync(const std::vector<std::string>& symbols, const json& params) {
-    return std::async(std::launch::async, [this, symbols, params]() {
+    return Executor::instance().submit([this, symbols, params]() {
         return this->fetchTickers(symbols, params);
     });
 }
 
 AsyncPullType Huobi::fetchOrderBookAsync(const std::string& symbol, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, limit, params]() {
+    return Executor::instance().submit([this, symbol, limit, params]() {
         return this->fetchOrderBook(symbol, limit, params);
     });
 }
 
 AsyncPullType Huobi::fetchTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchTrades(symbol, since, limit, params);
     });
 }
 
 AsyncPullType Huobi::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe,
                                         int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, timeframe, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, timeframe, since, limit, params]() {
         return this->fetchOHLCV(symbol, timeframe, since, limit, params);
     });
 }
 
 AsyncPullType Huobi::fetchBalanceAsync(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return this->fetchBalance(params);
     });
 }
@@ -345,37 +347,37 @@ AsyncPullType Huobi::fetchBalanceAsync(const json& params) {
 AsyncPullType Huobi::createOrderAsync(const std::string& symbol, const std::string& type,
                                         const std::string& side, double amount,
                                         double price, const json& params) {
-    return std::async(std::launch::async, [this, symbol, type, side, amount, price, params]() {
+    return Executor::instance().submit([this, symbol, type, side, amount, price, params]() {
         return this->createOrder(symbol, type, side, amount, price, params);
     });
 }
 
 AsyncPullType Huobi::cancelOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, id, symbol, params]() {
+    return Executor::instance().submit([this, id, symbol, params]() {
         return this->cancelOrder(id, symbol, params);
     });
 }
 
 AsyncPullType Huobi::fetchOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, id, symbol, params]() {
+    return Executor::instance().submit([this, id, symbol, params]() {
         return this->fetchOrder(id, symbol, params);
     });
 }
 
 AsyncPullType Huobi::fetchOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchOrders(symbol, since, limit, params);
     });
 }
 
 AsyncPullType Huobi::fetchOpenOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchOpenOrders(symbol, since, limit, params);
     });
 }
 
 AsyncPullType Huobi::fetchClosedOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchClosedOrders(symbol, since, limit, params);
     });
 }
@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/huobijp.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <sstream>
 #include <iomanip>
@@ -269,44 +270,44 @@ HuobiJP::HuobiJP() {
 
 // Async implementations
 AsyncPullType huobijp::fetchMarketsAsync(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return this->fetchMarkets(params);
     });
 }
 
 AsyncPullType huobijp::fetchTickerAsync(const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, symbol, params]() {
+    return Executor::instance().submit([this, symbol, params]() {
         return this->fetchTicker(symbol, params);
     });
 }
 
 AsyncPullType huobijp::fetchTickersAsync(const std::vector<std::string>& symbols, const json& params) {
-    return std::async(std::launch::async, [this, symbols, params]() {
+    return Executor::instance().submit([this, symbols, params]() {
         return this->fetchTickers(symbols, params);
     });
 }
 
 AsyncPullType huobijp::fetchOrderBookAsync(const std::string& symbol, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, limit, params]() {
+    return Executor::instance().submit([this, symbol, limit, params]() {
         return this->fetchOrderBook(symbol, limit, params);
     });
 }
 
 AsyncPullType huobijp::fetchTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchTrades(symbol, since, limit, params);
     });
 }
 
 AsyncPullType huobijp::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe,
                                           int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, timeframe, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, timeframe, since, limit, params]() {
         return this->fetchOHLCV(symbol, timeframe, since, limit, params);
     });
 }
 
 AsyncPullType huobijp::fetchBalanceAsync(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return this->fetchBalance(params);
     });
 }
@@ -314,37 +315,37 @@ AsyncPullType huobijp::fetchBalanceAsync(const json& params) {
 AsyncPullType huobijp::createOrderAsync(const std::string& symbol, const std::string& type,
                                           const std::string& side, double amount,
                                           double price, const json& params) {
-    return std::async(std::launch::async, [this, symbol, type, side, amount, price, params]() {
+    return Executor::instance().submit([this, symbol, type, side, amount, price, params]() {
         return this->createOrder(symbol, type, side, amount, price, params);
     });
 }
 
 AsyncPullType huobijp::cancelOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, id, symbol, params]() {
+    return Executor::instance().submit([this, id, symbol, params]() {
         return this->cancelOrder(id, symbol, params);
     });
 }
 
 AsyncPullType huobijp::fetchOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, id, symbol, params]() {
+    return Executor::instance().submit([this, id, symbol, params]() {
         return this->fetchOrder(id, symbol, params);
     });
 }
 
 AsyncPullType huobijp::fetchOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchOrders(symbol, since, limit, params);
     });
 }
 
 AsyncPullType huobijp::fetchOpenOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchOpenOrders(symbol, since, limit, params);
     });
 }
 
 AsyncPullType huobijp::fetchClosedOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchClosedOrders(symbol, since, limit, params);
     });
 }
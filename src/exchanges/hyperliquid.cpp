@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/hyperliquid.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <sstream>
 #include <iomanip>
@@ -140,44 +141,44 @@ void hyperliquid::handleErrors(const std::string& code, const std::string& reaso
 
 // Async implementations
 AsyncPullType hyperliquid::fetchMarketsAsync(const Json& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return this->fetchMarkets(params);
     });
 }
 
 AsyncPullType hyperliquid::fetchTickerAsync(const std::string& symbol, const Json& params) {
-    return std::async(std::launch::async, [this, symbol, params]() {
+    return Executor::instance().submit([this, symbol, params]() {
         return this->fetchTicker(symbol, params);
     });
 }
 
 AsyncPullType hyperliquid::fetchTickersAsync(const std::vector<std::string>& symbols, const Json& params) {
-    return std::async(std::launch::async, [this, symbols, params]() {
+    return Executor::instance().submit([this, symbols, params]() {
         return this->fetchTickers(symbols, params);
     });
 }
 
 AsyncPullType hyperliquid::fetchOrderBookAsync(const std::string& symbol, int limit, const Json& params) {
-    return std::async(std::launch::async, [this, symbol, limit, params]() {
+    return Executor::instance().submit([this, symbol, limit, params]() {
         return this->fetchOrderBook(symbol, limit, params);
     });
 }
 
 AsyncPullType hyperliquid::fetchTradesAsync(const std::string& symbol, int since, int limit, const Json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchTrades(symbol, since, limit, params);
     });
 }
 
 AsyncPullType hyperliquid::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe,
                                               int since, int limit, const Json& params) {
-    return std::async(std::launch::async, [this, symbol, timeframe, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, timeframe, since, limit, params]() {
         return this->fetchOHLCV(symbol, timeframe, since, limit, params);
     });
 }
 
 AsyncPullType hyperliquid::fetchBalanceAsync(const Json& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return this->fetchBalance(params);
     });
 }
@@ -185,43 +186,43 @@ AsyncPullType hyperliquid::fetchBalanceAsync(const Json& params) {
 AsyncPullType hyperliquid::createOrderAsync(const std::string& symbol, const std::string& type,
                                               const std::string& side, double amount,
                                               double price, const Json& params) {
-    return std::async(std::launch::async, [this, symbol, type, side, amount, price, params]() {
+    return Executor::instance().submit([this, symbol, type, side, amount, price, params]() {
         return this->createOrder(symbol, type, side, amount, price, params);
     });
 }
 
 AsyncPullType hyperliquid::cancelOrderAsync(const std::string& id, const std::string& symbol, const Json& params) {
-    return std::async(std::launch::async, [this, id, symbol, params]() {
+    return Executor::instance().submit([this, id, symbol, params]() {
         return this->cancelOrder(id, symbol, params);
     });
 }
 
 AsyncPullType hyperliquid::fetchOrderAsync(const std::string& id, const std::string& symbol, const Json& params) {
-    return std::async(std::launch::async, [this, id, symbol, params]() {
+    return Executor::instance().submit([this, id, symbol, params]() {
         return this->fetchOrder(id, symbol, params);
     });
 }
 
 AsyncPullType hyperliquid::fetchOrdersAsync(const std::string& symbol, int since, int limit, const Json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchOrders(symbol, since, limit, params);
     });
 }
 
 AsyncPullType hyperliquid::fetchOpenOrdersAsync(const std::string& symbol, int since, int limit, const Json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchOpenOrders(symbol, since, limit, params);
     });
 }
 
 AsyncPullType hyperliquid::fetchClosedOrdersAsync(const std::string& symbol, int since, int limit, const Json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchClosedOrders(symbol, since, limit, params);
     });
 }
 
 AsyncPullType hyperliquid::fetchMyTradesAsync(const std::string& symbol, int since, int limit, const Json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchMyTrades(symbol, since, limit, params);
     });
 }
@@ -1,9 +1,11 @@
 #include "kraken.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <sstream>
 #include <iomanip>
 #include <base64.h>
 #include <future>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -64,31 +66,31 @@ void Kraken::initializeApiEndpoints() {
 
 // Async Market Data Methods
 AsyncPullType Kraken::fetchMarketsAsync(const Json& params) const {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return this->fetchMarketsImpl(params);
     });
 }
 
 AsyncPullType Kraken::fetchCurrenciesAsync(const Json& params) const {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return this->fetchCurrenciesImpl(params);
     });
 }
 
 AsyncPullType Kraken::fetchTickerAsync(const std::string& symbol, const Json& params) const {
-    return std::async(std::launch::async, [this, symbol, params]() {
+    return Executor::instance().submit([this, symbol, params]() {
         return this->fetchTickerImpl(symbol, params);
     });
 }
 
 AsyncPullType Kraken::fetchTickersAsync(const std::vector<std::string>& symbols, const Json& params) const {
-    return std::async(std::launch::async, [this, symbols, params]() {
+    return Executor::instance().submit([this, symbols, params]() {
         return this->fetchTickersImpl(symbols, params);
     });
 }
 
 AsyncPullType Kraken::fetchOrderBookAsync(const std::string& symbol, const std::optional<int>& limit, const Json& params) const {
-    return std::async(std::launch::async, [this, symbol, limit, params]() {
+    return Executor::instance().submit([this, symbol, limit, params]() {
         return this->fetchOrderBookImpl(symbol, limit, params);
     });
 }
@@ -96,14 +98,14 @@ AsyncPullType Kraken::fetchOrderBookAsync(const std::string& symbol, const std::
 AsyncPullType Kraken::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe,
                                         const std::optional<long long>& since, const std::optional<int>& limit,
                                         const Json& params) const {
-    return std::async(std::launch::async, [this, symbol, timeframe, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, timeframe, since, limit, params]() {
         return this->fetchOHLCVImpl(symbol, timeframe, since, limit, params);
     });
 }
 
 AsyncPullType Kraken::fetchTradesAsync(const std::string& symbol, const std::optional<long long>& since,
                                          const std::optional<int>& limit, const Json& params) const {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchTradesImpl(symbol, since, limit, params);
     });
 }
@@ -112,68 +114,68 @@ AsyncPullType Kraken::fetchTradesAsync(const std::string& symbol, const std::opt
 AsyncPullType Kraken::createOrderAsync(const std::string& symbol, const std::string& type,
                                          const std::string& side, double amount,
                                          const std::optional<double>& price, const Json& params) {
-    return std::async(std::launch::async, [this, symbol, type, side, amount, price, params]() {
+    return Executor::instance().submit([this, symbol, type, side, amount, price, params]() {
         return this->createOrderImpl(symbol, type, side, amount, price, params);
     });
 }
 
 AsyncPullType Kraken::cancelOrderAsync(const std::string& id, const std::string& symbol, const Json& params) {
-    return std::async(std::launch::async, [this, id, symbol, params]() {
+    return Executor::instance().submit([this, id, symbol, params]() {
         return this->cancelOrderImpl(id, symbol, params);
     });
 }
 
 AsyncPullType Kraken::fetchOrderAsync(const std::string& id, const std::string& symbol, const Json& params) const {
-    return std::async(std::launch::async, [this, id, symbol, params]() {
+    return Executor::instance().submit([this, id, symbol, params]() {
         return this->fetchOrderImpl(id, symbol, params);
     });
 }
 
 AsyncPullType Kraken::fetchOpenOrdersAsync(const std::string& symbol, const std::optional<long long>& since,
                                              const std::optional<int>& limit, const Json& params) const {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchOpenOrdersImpl(symbol, since, limit, params);
     });
 }
 
 AsyncPullType Kraken::fetchClosedOrdersAsync(const std::string& symbol, const std::optional<long long>& since,
                                                const std::optional<int>& limit, const Json& params) const {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchClosedOrdersImpl(symbol, since, limit, params);
     });
 }
 
 AsyncPullType Kraken::fetchMyTradesAsync(const std::string& symbol, const std::optional<long long>& since,
                                            const std::optional<int>& limit, const Json& params) const {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchMyTradesImpl(symbol, since, limit, params);
     });
 }
 
 // Async Account Methods
 AsyncPullType Kraken::fetchBalanceAsync(const Json& params) const {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return this->fetchBalanceImpl(params);
     });
 }
 
 AsyncPullType Kraken::fetchDepositAddressAsync(const std::string& code, const std::optional<std::string>& network,
                                                  const Json& params) const {
-    return std::async(std::launch::async, [this, code, network, params]() {
+    return Executor::instance().submit([this, code, network, params]() {
         return this->fetchDepositAddressImpl(code, network, params);
     });
 }
 
 AsyncPullType Kraken::fetchDepositsAsync(const std::optional<std::string>& code, const std::optional<long long>& since,
                                            const std::optional<int>& limit, const Json& params) const {
-    return std::async(std::launch::async, [this, code, since, limit, params]() {
+    return Executor::instance().submit([this, code, since, limit, params]() {
         return this->fetchDepositsImpl(code, since, limit, params);
     });
 }
 
 AsyncPullType Kraken::fetchWithdrawalsAsync(const std::optional<std::string>& code, const std::optional<long long>& since,
                                              const std::optional<int>& limit, const Json& params) const {
-    return std::async(std::launch::async, [this, code, since, limit, params]() {
+    return Executor::instance().submit([this, code, since, limit, params]() {
         return this->fetchWithdrawalsImpl(code, since, limit, params);
     });
 }
@@ -202,7 +204,7 @@ json Kraken::fetchMarkets(const json& params) {
             }},
             {"limits", {
                 {"amount", {
-                    {"min", std::stod(market["ordermin"].get<std::string>())}
+                    {"min", jsonDouble(market["ordermin"])}
                 }}
             }},
             {"info", market}
@@ -222,17 +224,17 @@ json Kraken::fetchTicker(const std::string& symbol, const json& params) {
         {"symbol", symbol},
         {"timestamp", nullptr},
         {"datetime", nullptr},
-        {"high", std::stod(ticker["h"][1].get<std::string>())},
-        {"low", std::stod(ticker["l"][1].get<std::string>())},
-        {"bid", std::stod(ticker["b"][0].get<std::string>())},
-        {"bidVolume", std::stod(ticker["b"][2].get<std::string>())},
-        {"ask", std::stod(ticker["a"][0].get<std::string>())},
-        {"askVolume", std::stod(ticker["a"][2].get<std::string>())},
-        {"vwap", std::stod(ticker["p"][1].get<std::string>())},
-        {"open", std::stod(ticker["o"].get<std::string>())},
-        {"close", std::stod(ticker["c"][0].get<std::string>())},
-        {"last", std::stod(ticker["c"][0].get<std::string>())},
-        {"baseVolume", std::stod(ticker["v"][1].get<std::string>())},
+        {"high", jsonDouble(ticker["h"][1])},
+        {"low", jsonDouble(ticker["l"][1])},
+        {"bid", jsonDouble(ticker["b"][0])},
+        {"bidVolume", jsonDouble(ticker["b"][2])},
+        {"ask", jsonDouble(ticker["a"][0])},
+        {"askVolume", jsonDouble(ticker["a"][2])},
+        {"vwap", jsonDouble(ticker["p"][1])},
+        {"open", jsonDouble(ticker["o"])},
+        {"close", jsonDouble(ticker["c"][0])},
+        {"last", jsonDouble(ticker["c"][0])},
+        {"baseVolume", jsonDouble(ticker["v"][1])},
         {"quoteVolume", nullptr},
         {"info", ticker}
     };
@@ -248,7 +250,7 @@ json Kraken::fetchBalance(const json& params) {
     
     for (const auto& [currency, balance] : response["result"].items()) {
         std::string commonCurrency = getCommonSymbol(currency);
-        double total = std::stod(balance.get<std::string>());
+        double total = jsonDouble(balance);
         
         result[commonCurrency] = {
             {"free", total},
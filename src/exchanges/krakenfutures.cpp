@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/krakenfutures.h"
+#include "ccxt/base/executor.h"
 #include "../base/crypto.h"
 #include "../base/error.h"
 #include <sstream>
@@ -156,110 +157,110 @@ void KrakenFutures::handleErrors(const json& response) {
 
 // Async implementations
 std::future<std::vector<Market>> KrakenFutures::fetchMarketsAsync(const Params& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return this->fetchMarkets(params);
     });
 }
 
 std::future<OrderBook> KrakenFutures::fetchOrderBookAsync(const std::string& symbol, int limit, const Params& params) {
-    return std::async(std::launch::async, [this, symbol, limit, params]() {
+    return Executor::instance().submit([this, symbol, limit, params]() {
         return this->fetchOrderBook(symbol, limit, params);
     });
 }
 
 std::future<Ticker> KrakenFutures::fetchTickerAsync(const std::string& symbol, const Params& params) {
-    return std::async(std::launch::async, [this, symbol, params]() {
+    return Executor::instance().submit([this, symbol, params]() {
         return this->fetchTicker(symbol, params);
     });
 }
 
 std::future<std::map<std::string, Ticker>> KrakenFutures::fetchTickersAsync(const std::vector<std::string>& symbols, const Params& params) {
-    return std::async(std::launch::async, [this, symbols, params]() {
+    return Executor::instance().submit([this, symbols, params]() {
         return this->fetchTickers(symbols, params);
     });
 }
 
 std::future<std::vector<Trade>> KrakenFutures::fetchTradesAsync(const std::string& symbol, int since, int limit, const Params& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchTrades(symbol, since, limit, params);
     });
 }
 
 std::future<std::vector<OHLCV>> KrakenFutures::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe, int since, int limit, const Params& params) {
-    return std::async(std::launch::async, [this, symbol, timeframe, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, timeframe, since, limit, params]() {
         return this->fetchOHLCV(symbol, timeframe, since, limit, params);
     });
 }
 
 std::future<Order> KrakenFutures::createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
                                                  double amount, double price, const Params& params) {
-    return std::async(std::launch::async, [this, symbol, type, side, amount, price, params]() {
+    return Executor::instance().submit([this, symbol, type, side, amount, price, params]() {
         return this->createOrder(symbol, type, side, amount, price, params);
     });
 }
 
 std::future<Order> KrakenFutures::cancelOrderAsync(const std::string& id, const std::string& symbol, const Params& params) {
-    return std::async(std::launch::async, [this, id, symbol, params]() {
+    return Executor::instance().submit([this, id, symbol, params]() {
         return this->cancelOrder(id, symbol, params);
     });
 }
 
 std::future<std::vector<Order>> KrakenFutures::fetchOpenOrdersAsync(const std::string& symbol, int since, int limit, const Params& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchOpenOrders(symbol, since, limit, params);
     });
 }
 
 std::future<std::vector<Order>> KrakenFutures::fetchClosedOrdersAsync(const std::string& symbol, int since, int limit, const Params& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchClosedOrders(symbol, since, limit, params);
     });
 }
 
 std::future<std::vector<Order>> KrakenFutures::fetchCanceledOrdersAsync(const std::string& symbol, int since, int limit, const Params& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchCanceledOrders(symbol, since, limit, params);
     });
 }
 
 std::future<Balance> KrakenFutures::fetchBalanceAsync(const Params& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return this->fetchBalance(params);
     });
 }
 
 std::future<std::vector<Position>> KrakenFutures::fetchPositionsAsync(const std::vector<std::string>& symbols, const Params& params) {
-    return std::async(std::launch::async, [this, symbols, params]() {
+    return Executor::instance().submit([this, symbols, params]() {
         return this->fetchPositions(symbols, params);
     });
 }
 
 std::future<Leverage> KrakenFutures::setLeverageAsync(int leverage, const std::string& symbol, const Params& params) {
-    return std::async(std::launch::async, [this, leverage, symbol, params]() {
+    return Executor::instance().submit([this, leverage, symbol, params]() {
         return this->setLeverage(leverage, symbol, params);
     });
 }
 
 std::future<std::vector<LeverageTier>> KrakenFutures::fetchLeverageTiersAsync(const std::vector<std::string>& symbols, const Params& params) {
-    return std::async(std::launch::async, [this, symbols, params]() {
+    return Executor::instance().submit([this, symbols, params]() {
         return this->fetchLeverageTiers(symbols, params);
     });
 }
 
 std::future<std::vector<FundingRate>> KrakenFutures::fetchFundingRatesAsync(const std::vector<std::string>& symbols, const Params& params) {
-    return std::async(std::launch::async, [this, symbols, params]() {
+    return Executor::instance().submit([this, symbols, params]() {
         return this->fetchFundingRates(symbols, params);
     });
 }
 
 std::future<FundingRate> KrakenFutures::fetchFundingRateAsync(const std::string& symbol, const Params& params) {
-    return std::async(std::launch::async, [this, symbol, params]() {
+    return Executor::instance().submit([this, symbol, params]() {
         return this->fetchFundingRate(symbol, params);
     });
 }
 
 std::future<std::vector<FundingRateHistory>> KrakenFutures::fetchFundingRateHistoryAsync(const std::string& symbol, int since, int limit, const Params& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchFundingRateHistory(symbol, since, limit, params);
     });
 }
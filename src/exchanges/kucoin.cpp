@@ -1,10 +1,12 @@
 #include "ccxt/exchanges/kucoin.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <sstream>
 #include <iomanip>
 #include <openssl/hmac.h>
 #include <openssl/sha.h>
 #include <base64.h>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -91,19 +93,19 @@ Ticker KuCoin::fetchTicker(const std::string& symbol, const Params& params) {
 // Asynchronous Methods Implementation
 
 std::future<std::vector<Market>> KuCoin::fetchMarketsAsync(const Params& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return fetchMarkets(params);
     });
 }
 
 std::future<OrderBook> KuCoin::fetchOrderBookAsync(const std::string& symbol, int limit, const Params& params) {
-    return std::async(std::launch::async, [this, symbol, limit, params]() {
+    return Executor::instance().submit([this, symbol, limit, params]() {
         return fetchOrderBook(symbol, limit, params);
     });
 }
 
 std::future<Ticker> KuCoin::fetchTickerAsync(const std::string& symbol, const Params& params) {
-    return std::async(std::launch::async, [this, symbol, params]() {
+    return Executor::instance().submit([this, symbol, params]() {
         return fetchTicker(symbol, params);
     });
 }
@@ -192,12 +194,12 @@ Market KuCoin::parseMarket(const json& market) {
     result.active = market["enableTrading"].get<bool>();
     
     // Add precision and limits
-    result.precision.amount = std::stod(market["baseIncrement"].get<std::string>());
-    result.precision.price = std::stod(market["priceIncrement"].get<std::string>());
+    result.precision.amount = jsonDouble(market["baseIncrement"]);
+    result.precision.price = jsonDouble(market["priceIncrement"]);
     
-    result.limits.amount.min = std::stod(market["baseMinSize"].get<std::string>());
-    result.limits.amount.max = std::stod(market["baseMaxSize"].get<std::string>());
-    result.limits.price.min = std::stod(market["priceIncrement"].get<std::string>());
+    result.limits.amount.min = jsonDouble(market["baseMinSize"]);
+    result.limits.amount.max = jsonDouble(market["baseMaxSize"]);
+    result.limits.price.min = jsonDouble(market["priceIncrement"]);
     result.limits.cost.min = result.limits.amount.min * result.limits.price.min;
     
     return result;
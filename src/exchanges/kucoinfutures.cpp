@@ -1,10 +1,12 @@
 #include "ccxt/exchanges/kucoinfutures.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <sstream>
 #include <iomanip>
 #include <openssl/hmac.h>
 #include <openssl/sha.h>
 #include <base64.h>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -214,44 +216,44 @@ MarginModification KuCoinFutures::setLeverage(int leverage, const std::string& s
 // Asynchronous Methods Implementation
 
 std::future<std::vector<Market>> KuCoinFutures::fetchMarketsAsync(const Params& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return fetchMarkets(params);
     });
 }
 
 std::future<OrderBook> KuCoinFutures::fetchOrderBookAsync(const std::string& symbol, int limit, const Params& params) {
-    return std::async(std::launch::async, [this, symbol, limit, params]() {
+    return Executor::instance().submit([this, symbol, limit, params]() {
         return fetchOrderBook(symbol, limit, params);
     });
 }
 
 std::future<Ticker> KuCoinFutures::fetchTickerAsync(const std::string& symbol, const Params& params) {
-    return std::async(std::launch::async, [this, symbol, params]() {
+    return Executor::instance().submit([this, symbol, params]() {
         return fetchTicker(symbol, params);
     });
 }
 
 std::future<std::vector<Trade>> KuCoinFutures::fetchTradesAsync(const std::string& symbol, int since, int limit, const Params& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return fetchTrades(symbol, since, limit, params);
     });
 }
 
 std::future<FundingRate> KuCoinFutures::fetchFundingRateAsync(const std::string& symbol, const Params& params) {
-    return std::async(std::launch::async, [this, symbol, params]() {
+    return Executor::instance().submit([this, symbol, params]() {
         return fetchFundingRate(symbol, params);
     });
 }
 
 std::future<Order> KuCoinFutures::createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
                                                   double amount, double price, const Params& params) {
-    return std::async(std::launch::async, [this, symbol, type, side, amount, price, params]() {
+    return Executor::instance().submit([this, symbol, type, side, amount, price, params]() {
         return createOrder(symbol, type, side, amount, price, params);
     });
 }
 
 std::future<Balance> KuCoinFutures::fetchBalanceAsync(const Params& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return fetchBalance(params);
     });
 }
@@ -285,15 +287,15 @@ Market KuCoinFutures::parseMarket(const json& market) {
     result.contract = true;
     result.inverse = market["isInverse"].get<bool>();
     result.linear = !result.inverse;
-    result.contractSize = std::stod(market["multiplier"].get<std::string>());
+    result.contractSize = jsonDouble(market["multiplier"]);
     
-    result.precision.amount = std::stod(market["lotSize"].get<std::string>());
-    result.precision.price = std::stod(market["tickSize"].get<std::string>());
+    result.precision.amount = jsonDouble(market["lotSize"]);
+    result.precision.price = jsonDouble(market["tickSize"]);
     
-    result.limits.amount.min = std::stod(market["minOrderQty"].get<std::string>());
-    result.limits.amount.max = std::stod(market["maxOrderQty"].get<std::string>());
-    result.limits.price.min = std::stod(market["tickSize"].get<std::string>());
-    result.limits.price.max = std::stod(market["maxPrice"].get<std::string>());
+    result.limits.amount.min = jsonDouble(market["minOrderQty"]);
+    result.limits.amount.max = jsonDouble(market["maxOrderQty"]);
+    result.limits.price.min = jsonDouble(market["tickSize"]);
+    result.limits.price.max = jsonDouble(market["maxPrice"]);
     result.limits.cost.min = result.limits.amount.min * result.limits.price.min;
     
     return result;
@@ -306,8 +308,8 @@ Trade KuCoinFutures::parseTrade(const json& trade, const Market* market) {
     result.datetime = iso8601(result.timestamp);
     result.symbol = market ? market->symbol : trade["symbol"].get<std::string>();
     result.side = trade["side"].get<std::string>();
-    result.price = std::stod(trade["price"].get<std::string>());
-    result.amount = std::stod(trade["size"].get<std::string>());
+    result.price = jsonDouble(trade["price"]);
+    result.amount = jsonDouble(trade["size"]);
     result.cost = result.price * result.amount;
     
     return result;
@@ -322,9 +324,9 @@ Order KuCoinFutures::parseOrder(const json& order, const Market* market) {
     result.symbol = market ? market->symbol : order["symbol"].get<std::string>();
     result.type = order["type"].get<std::string>();
     result.side = order["side"].get<std::string>();
-    result.price = std::stod(order["price"].get<std::string>());
-    result.amount = std::stod(order["size"].get<std::string>());
-    result.filled = std::stod(order["dealSize"].get<std::string>());
+    result.price = jsonDouble(order["price"]);
+    result.amount = jsonDouble(order["size"]);
+    result.filled = jsonDouble(order["dealSize"]);
     result.remaining = result.amount - result.filled;
     result.status = parseOrderStatus(order["status"].get<std::string>());
     
@@ -338,13 +340,13 @@ Position KuCoinFutures::parsePosition(const json& position, const Market* market
     result.timestamp = std::stoll(position["timestamp"].get<std::string>());
     result.datetime = iso8601(result.timestamp);
     result.side = position["side"].get<std::string>();
-    result.contracts = std::stod(position["currentQty"].get<std::string>());
-    result.contractSize = std::stod(position["multiplier"].get<std::string>());
-    result.entryPrice = std::stod(position["avgEntryPrice"].get<std::string>());
+    result.contracts = jsonDouble(position["currentQty"]);
+    result.contractSize = jsonDouble(position["multiplier"]);
+    result.entryPrice = jsonDouble(position["avgEntryPrice"]);
     result.leverage = std::stoi(position["leverage"].get<std::string>());
-    result.liquidationPrice = std::stod(position["liquidationPrice"].get<std::string>());
-    result.margin = std::stod(position["maintMargin"].get<std::string>());
-    result.notional = std::stod(position["positionValue"].get<std::string>());
+    result.liquidationPrice = jsonDouble(position["liquidationPrice"]);
+    result.margin = jsonDouble(position["maintMargin"]);
+    result.notional = jsonDouble(position["positionValue"]);
     
     return result;
 }
@@ -354,7 +356,7 @@ FundingRate KuCoinFutures::parseFundingRate(const json& fundingRate, const Marke
     result.symbol = market ? market->symbol : fundingRate["symbol"].get<std::string>();
     result.timestamp = std::stoll(fundingRate["timestamp"].get<std::string>());
     result.datetime = iso8601(result.timestamp);
-    result.rate = std::stod(fundingRate["value"].get<std::string>());
+    result.rate = jsonDouble(fundingRate["value"]);
     result.next = std::stoll(fundingRate["predictedValue"].get<std::string>());
     
     return result;
@@ -362,8 +364,8 @@ FundingRate KuCoinFutures::parseFundingRate(const json& fundingRate, const Marke
 
 Balance KuCoinFutures::parseBalance(const json& balance) {
     Balance result;
-    result.free = std::stod(balance["availableBalance"].get<std::string>());
-    result.used = std::stod(balance["frozenBalance"].get<std::string>());
+    result.free = jsonDouble(balance["availableBalance"]);
+    result.used = jsonDouble(balance["frozenBalance"]);
     result.total = result.free + result.used;
     
     return result;
@@ -1,4 +1,5 @@
 #include "lbank.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <sstream>
 #include <iomanip>
@@ -378,37 +379,37 @@ json Lbank::fetchOHLCV(const std::string& symbol, const std::string& timeframe,
 
 // Async Market Data API Implementation
 AsyncPullType Lbank::asyncFetchMarkets(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return fetchMarkets(params);
     });
 }
 
 AsyncPullType Lbank::asyncFetchTicker(const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, symbol, params]() {
+    return Executor::instance().submit([this, symbol, params]() {
         return fetchTicker(symbol, params);
     });
 }
 
 AsyncPullType Lbank::asyncFetchTickers(const std::vector<std::string>& symbols, const json& params) {
-    return std::async(std::launch::async, [this, symbols, params]() {
+    return Executor::instance().submit([this, symbols, params]() {
         return fetchTickers(symbols, params);
     });
 }
 
 AsyncPullType Lbank::asyncFetchOrderBook(const std::string& symbol, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, limit, params]() {
+    return Executor::instance().submit([this, symbol, limit, params]() {
         return fetchOrderBook(symbol, limit, params);
     });
 }
 
 AsyncPullType Lbank::asyncFetchTrades(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return fetchTrades(symbol, since, limit, params);
     });
 }
 
 AsyncPullType Lbank::asyncFetchOHLCV(const std::string& symbol, const std::string& timeframe, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, timeframe, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, timeframe, since, limit, params]() {
         return fetchOHLCV(symbol, timeframe, since, limit, params);
     });
 }
@@ -495,44 +496,44 @@ json Lbank::fetchClosedOrders(const std::string& symbol, int since, int limit, c
 
 // Async Trading API Implementation
 AsyncPullType Lbank::asyncFetchBalance(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return fetchBalance(params);
     });
 }
 
 AsyncPullType Lbank::asyncCreateOrder(const std::string& symbol, const std::string& type, const std::string& side,
                                       double amount, double price, const json& params) {
-    return std::async(std::launch::async, [this, symbol, type, side, amount, price, params]() {
+    return Executor::instance().submit([this, symbol, type, side, amount, price, params]() {
         return createOrder(symbol, type, side, amount, price, params);
     });
 }
 
 AsyncPullType Lbank::asyncCancelOrder(const std::string& id, const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, id, symbol, params]() {
+    return Executor::instance().submit([this, id, symbol, params]() {
         return cancelOrder(id, symbol, params);
     });
 }
 
 AsyncPullType Lbank::asyncFetchOrder(const std::string& id, const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, id, symbol, params]() {
+    return Executor::instance().submit([this, id, symbol, params]() {
         return fetchOrder(id, symbol, params);
     });
 }
 
 AsyncPullType Lbank::asyncFetchOrders(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return fetchOrders(symbol, since, limit, params);
     });
 }
 
 AsyncPullType Lbank::asyncFetchOpenOrders(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return fetchOpenOrders(symbol, since, limit, params);
     });
 }
 
 AsyncPullType Lbank::asyncFetchClosedOrders(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return fetchClosedOrders(symbol, since, limit, params);
     });
 }
@@ -623,31 +624,31 @@ json Lbank::withdraw(const std::string& code, double amount, const std::string&
 
 // Async Account API Implementation
 AsyncPullType Lbank::asyncFetchMyTrades(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return fetchMyTrades(symbol, since, limit, params);
     });
 }
 
 AsyncPullType Lbank::asyncFetchDeposits(const std::string& code, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, code, since, limit, params]() {
+    return Executor::instance().submit([this, code, since, limit, params]() {
         return fetchDeposits(code, since, limit, params);
     });
 }
 
 AsyncPullType Lbank::asyncFetchWithdrawals(const std::string& code, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, code, since, limit, params]() {
+    return Executor::instance().submit([this, code, since, limit, params]() {
         return fetchWithdrawals(code, since, limit, params);
     });
 }
 
 AsyncPullType Lbank::asyncFetchDepositAddress(const std::string& code, const json& params) {
-    return std::async(std::launch::async, [this, code, params]() {
+    return Executor::instance().submit([this, code, params]() {
         return fetchDepositAddress(code, params);
     });
 }
 
 AsyncPullType Lbank::asyncWithdraw(const std::string& code, double amount, const std::string& address, const std::string& tag, const json& params) {
-    return std::async(std::launch::async, [this, code, amount, address, tag, params]() {
+    return Executor::instance().submit([this, code, amount, address, tag, params]() {
         return withdraw(code, amount, address, tag, params);
     });
 }
@@ -687,37 +688,37 @@ json Lbank::fetchTime(const json& params) {
 
 // Async Additional Features Implementation
 AsyncPullType Lbank::asyncFetchCurrencies(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return fetchCurrencies(params);
     });
 }
 
 AsyncPullType Lbank::asyncFetchTradingFees(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return fetchTradingFees(params);
     });
 }
 
 AsyncPullType Lbank::asyncFetchFundingFees(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return fetchFundingFees(params);
     });
 }
 
 AsyncPullType Lbank::asyncFetchTransactionFees(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return fetchTransactionFees(params);
     });
 }
 
 AsyncPullType Lbank::asyncFetchSystemStatus(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return fetchSystemStatus(params);
     });
 }
 
 AsyncPullType Lbank::asyncFetchTime(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return fetchTime(params);
     });
 }
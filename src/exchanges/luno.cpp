@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/luno.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <sstream>
 #include <iomanip>
@@ -210,37 +211,37 @@ json Luno::fetchOHLCV(const std::string& symbol, const std::string& timeframe, i
 
 // Async Market Data API Implementation
 AsyncPullType Luno::asyncFetchMarkets(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return fetchMarkets(params);
     });
 }
 
 AsyncPullType Luno::asyncFetchTicker(const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, symbol, params]() {
+    return Executor::instance().submit([this, symbol, params]() {
         return fetchTicker(symbol, params);
     });
 }
 
 AsyncPullType Luno::asyncFetchTickers(const std::vector<std::string>& symbols, const json& params) {
-    return std::async(std::launch::async, [this, symbols, params]() {
+    return Executor::instance().submit([this, symbols, params]() {
         return fetchTickers(symbols, params);
     });
 }
 
 AsyncPullType Luno::asyncFetchOrderBook(const std::string& symbol, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, limit, params]() {
+    return Executor::instance().submit([this, symbol, limit, params]() {
         return fetchOrderBook(symbol, limit, params);
     });
 }
 
 AsyncPullType Luno::asyncFetchTrades(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return fetchTrades(symbol, since, limit, params);
     });
 }
 
 AsyncPullType Luno::asyncFetchOHLCV(const std::string& symbol, const std::string& timeframe, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, timeframe, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, timeframe, since, limit, params]() {
         return fetchOHLCV(symbol, timeframe, since, limit, params);
     });
 }
@@ -583,69 +584,69 @@ std::string Luno::getAccountId(const std::string& type, const std::string& curre
 
 // Async Account API Implementation
 AsyncPullType Luno::asyncFetchAccounts(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return fetchAccounts(params);
     });
 }
 
 AsyncPullType Luno::asyncFetchLedger(const std::string& code, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, code, since, limit, params]() {
+    return Executor::instance().submit([this, code, since, limit, params]() {
         return fetchLedger(code, since, limit, params);
     });
 }
 
 AsyncPullType Luno::asyncFetchTradingFee(const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, symbol, params]() {
+    return Executor::instance().submit([this, symbol, params]() {
         return fetchTradingFee(symbol, params);
     });
 }
 
 // Async Trading API Implementation
 AsyncPullType Luno::asyncFetchBalance(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return fetchBalance(params);
     });
 }
 
 AsyncPullType Luno::asyncCreateOrder(const std::string& symbol, const std::string& type, const std::string& side,
                                        double amount, double price, const json& params) {
-    return std::async(std::launch::async, [this, symbol, type, side, amount, price, params]() {
+    return Executor::instance().submit([this, symbol, type, side, amount, price, params]() {
         return createOrder(symbol, type, side, amount, price, params);
     });
 }
 
 AsyncPullType Luno::asyncCancelOrder(const std::string& id, const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, id, symbol, params]() {
+    return Executor::instance().submit([this, id, symbol, params]() {
         return cancelOrder(id, symbol, params);
     });
 }
 
 AsyncPullType Luno::asyncFetchOrder(const std::string& id, const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, id, symbol, params]() {
+    return Executor::instance().submit([this, id, symbol, params]() {
         return fetchOrder(id, symbol, params);
     });
 }
 
 AsyncPullType Luno::asyncFetchOrders(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return fetchOrders(symbol, since, limit, params);
     });
 }
 
 AsyncPullType Luno::asyncFetchOpenOrders(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return fetchOpenOrders(symbol, since, limit, params);
     });
 }
 
 AsyncPullType Luno::asyncFetchClosedOrders(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return fetchClosedOrders(symbol, since, limit, params);
     });
 }
 
 AsyncPullType Luno::asyncFetchMyTrades(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return fetchMyTrades(symbol, since, limit, params);
     });
 }
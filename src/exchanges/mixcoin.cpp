@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/mixcoin.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <thread>
 
@@ -416,7 +417,7 @@ std::string MixCoin::sign(const std::string& path, const std::string& api,
 // Async Methods Implementation
 #define IMPLEMENT_ASYNC_METHOD(name, ...) \
     AsyncPullType MixCoin::async##name(__VA_ARGS__) { \
-        return std::async(std::launch::async, [this](auto... params) { \
+        return Executor::instance().submit([this](auto... params) { \
             return this->name(params...); \
         }, __VA_ARGS__); \
     }
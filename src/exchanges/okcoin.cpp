@@ -1,4 +1,5 @@
 #include "okcoin.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <sstream>
 #include <iomanip>
@@ -318,13 +319,13 @@ json OKCoin::parseOrderStatus(const std::string& status) {
 
 // Async REST API methods
 json OKCoin::fetchTickerAsync(const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, symbol, params]() {
+    return Executor::instance().submit([this, symbol, params]() {
         return this->fetchTicker(symbol, params);
     });
 }
 
 json OKCoin::fetchBalanceAsync(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return this->fetchBalance(params);
     });
 }
@@ -332,69 +333,69 @@ json OKCoin::fetchBalanceAsync(const json& params) {
 json OKCoin::createOrderAsync(const std::string& symbol, const std::string& type,
                             const std::string& side, double amount,
                             double price, const json& params) {
-    return std::async(std::launch::async, [this, symbol, type, side, amount, price, params]() {
+    return Executor::instance().submit([this, symbol, type, side, amount, price, params]() {
         return this->createOrder(symbol, type, side, amount, price, params);
     });
 }
 
 json OKCoin::cancelOrderAsync(const std::string& id, const std::string& symbol,
                             const json& params) {
-    return std::async(std::launch::async, [this, id, symbol, params]() {
+    return Executor::instance().submit([this, id, symbol, params]() {
         return this->cancelOrder(id, symbol, params);
     });
 }
 
 json OKCoin::fetchOrderAsync(const std::string& id, const std::string& symbol,
                            const json& params) {
-    return std::async(std::launch::async, [this, id, symbol, params]() {
+    return Executor::instance().submit([this, id, symbol, params]() {
         return this->fetchOrder(id, symbol, params);
     });
 }
 
 json OKCoin::fetchOrdersAsync(const std::string& symbol, int since,
                             int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchOrders(symbol, since, limit, params);
     });
 }
 
 json OKCoin::fetchOpenOrdersAsync(const std::string& symbol, int since,
                                 int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchOpenOrders(symbol, since, limit, params);
     });
 }
 
 json OKCoin::fetchClosedOrdersAsync(const std::string& symbol, int since,
                                   int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchClosedOrders(symbol, since, limit, params);
     });
 }
 
 json OKCoin::fetchMyTradesAsync(const std::string& symbol, int since,
                                int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchMyTrades(symbol, since, limit, params);
     });
 }
 
 json OKCoin::fetchMarketsAsync(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return this->fetchMarkets(params);
     });
 }
 
 json OKCoin::fetchOrderBookAsync(const std::string& symbol, int limit,
                                const json& params) {
-    return std::async(std::launch::async, [this, symbol, limit, params]() {
+    return Executor::instance().submit([this, symbol, limit, params]() {
         return this->fetchOrderBook(symbol, limit, params);
     });
 }
 
 json OKCoin::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe,
                             int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, timeframe, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, timeframe, since, limit, params]() {
         return this->fetchOHLCV(symbol, timeframe, since, limit, params);
     });
 }
@@ -1,8 +1,12 @@
 #include "okx.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <sstream>
 #include <iomanip>
 #include <base64.h>
+#include "ccxt/base/number.h"
+#include "ccxt/base/json_view.h"
+#include "ccxt/base/errors.h"
 
 namespace ccxt {
 
@@ -92,11 +96,11 @@ json OKX::fetchMarkets(const json& params) {
             }},
             {"limits", {
                 {"amount", {
-                    {"min", std::stod(market["minSz"].get<std::string>())},
-                    {"max", std::stod(market["maxSz"].get<std::string>())}
+                    {"min", jsonDouble(market["minSz"])},
+                    {"max", jsonDouble(market["maxSz"])}
                 }},
                 {"price", {
-                    {"min", std::stod(market["tickSz"].get<std::string>())}
+                    {"min", jsonDouble(market["tickSz"])}
                 }}
             }},
             {"info", market}
@@ -116,8 +120,8 @@ json OKX::fetchBalance(const json& params) {
     
     for (const auto& balance : response["data"][0]["details"]) {
         std::string currency = balance["ccy"].get<std::string>();
-        double free = std::stod(balance["availBal"].get<std::string>());
-        double used = std::stod(balance["frozenBal"].get<std::string>());
+        double free = jsonDouble(balance["availBal"]);
+        double used = jsonDouble(balance["frozenBal"]);
         double total = free + used;
         
         if (total > 0) {
@@ -351,44 +355,178 @@ json OKX::setMarginMode(const std::string& marginMode, const std::string& symbol
 }
 
 json OKX::fetchMarketsAsync(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return this->fetchMarkets(params);
     });
 }
 
+namespace {
+
+// The "data" array of a v5 response, after checking its error code
+JsonView okxData(const std::string& exchangeId, const JsonView& response) {
+    JsonView code = response["code"];
+    if (code.isString() && code.stringView() != "0") {
+        throw ExchangeError(exchangeId + " " + response["msg"].string() + " (code " + code.string() + ")");
+    }
+    JsonView data = response["data"];
+    if (!data.isArray()) {
+        throw BadResponse(exchangeId + " response has no data array");
+    }
+    return data;
+}
+
+} // namespace
+
+void OKX::fetchTickerTyped(const std::string& symbol, Ticker& ticker) {
+    Market market = this->market(symbol);
+    std::string body = fetchBody("https://www.okx.com/api/v5/market/ticker?instId=" + market.id);
+    parseTickerInto(body, market, ticker);
+}
+
+void OKX::fetchOrderBookTyped(const std::string& symbol, OrderBook& orderBook, int limit) {
+    Market market = this->market(symbol);
+    std::string url = "https://www.okx.com/api/v5/market/books?instId=" + market.id;
+    if (limit > 0) {
+        url += "&sz=" + std::to_string(limit);
+    }
+    parseOrderBookInto(fetchBody(url), market, orderBook);
+}
+
+void OKX::fetchTradesTyped(const std::string& symbol, std::vector<Trade>& trades, int since, int limit) {
+    // The public trades endpoint only returns the most recent trades, since is ignored
+    Market market = this->market(symbol);
+    std::string url = "https://www.okx.com/api/v5/market/trades?instId=" + market.id;
+    if (limit > 0) {
+        url += "&limit=" + std::to_string(limit);
+    }
+    parseTradesInto(fetchBody(url), market, trades);
+}
+
+void OKX::parseTickerInto(std::string_view body, const Market& market, Ticker& ticker) const {
+    JsonView data = okxData(id, JsonView(body))[std::size_t(0)];
+    if (!data.isObject()) {
+        throw BadResponse(id + " ticker response is empty");
+    }
+    ticker = Ticker();
+    ticker.symbol = market.symbol;
+    data.forEachMember([&](std::string_view key, const JsonView& value) {
+        if (key == "ts") ticker.timestamp = value.integer();
+        else if (key == "last") ticker.last = ticker.close = ticker.lastPrice = value.number();
+        else if (key == "lastSz") ticker.lastQuantity = value.number();
+        else if (key == "askPx") ticker.ask = value.number();
+        else if (key == "askSz") ticker.askVolume = value.number();
+        else if (key == "bidPx") ticker.bid = value.number();
+        else if (key == "bidSz") ticker.bidVolume = value.number();
+        else if (key == "open24h") ticker.open = value.number();
+        else if (key == "high24h") ticker.high = value.number();
+        else if (key == "low24h") ticker.low = value.number();
+        else if (key == "vol24h") ticker.baseVolume = ticker.volume = value.number();
+        else if (key == "volCcy24h") ticker.quoteVolume = value.number();
+    });
+    ticker.change = ticker.priceChange = ticker.last - ticker.open;
+    if (ticker.open != 0) {
+        ticker.percentage = ticker.priceChangePercent = ticker.change / ticker.open * 100;
+    }
+    ticker.average = (ticker.open + ticker.last) / 2;
+    if (ticker.baseVolume != 0) {
+        ticker.vwap = ticker.quoteVolume / ticker.baseVolume;
+    }
+    ticker.datetime = this->iso8601(ticker.timestamp);
+}
+
+void OKX::parseOrderBookInto(std::string_view body, const Market& market, OrderBook& orderBook) const {
+    JsonView data = okxData(id, JsonView(body))[std::size_t(0)];
+    if (!data.isObject()) {
+        throw BadResponse(id + " order book response is empty");
+    }
+    orderBook.symbol = market.symbol;
+    orderBook.timestamp = 0;
+    orderBook.nonce = 0;
+    // Levels are [price, size, deprecated, order count]; only the first two are kept
+    auto readSide = [](const JsonView& levels, std::vector<std::vector<double>>& side) {
+        std::size_t count = 0;
+        levels.forEach([&](const JsonView& level) {
+            if (count == side.size()) {
+                side.emplace_back(2);
+            }
+            side[count].resize(2);
+            side[count][0] = level[0].number();
+            side[count][1] = level[1].number();
+            ++count;
+        });
+        side.resize(count);
+    };
+    data.forEachMember([&](std::string_view key, const JsonView& value) {
+        if (key == "ts") orderBook.timestamp = value.integer();
+        else if (key == "seqId") orderBook.nonce = value.integer();
+        else if (key == "bids") readSide(value, orderBook.bids);
+        else if (key == "asks") readSide(value, orderBook.asks);
+    });
+    orderBook.datetime = this->iso8601(orderBook.timestamp);
+}
+
+void OKX::parseTradesInto(std::string_view body, const Market& market, std::vector<Trade>& trades) const {
+    JsonView data = okxData(id, JsonView(body));
+    std::size_t count = 0;
+    data.forEach([&](const JsonView& entry) {
+        if (count == trades.size()) {
+            trades.emplace_back();
+        }
+        Trade& trade = trades[count++];
+        trade.order.clear();
+        trade.info.clear();
+        trade.type.clear();
+        trade.takerOrMaker.clear();
+        trade.feeCurrency.clear();
+        trade.orderId.clear();
+        trade.fee = 0;
+        trade.symbol = market.symbol;
+        entry.forEachMember([&](std::string_view key, const JsonView& value) {
+            if (key == "tradeId") trade.id.assign(value.stringView());
+            else if (key == "px") trade.price = value.number();
+            else if (key == "sz") trade.amount = value.number();
+            else if (key == "side") trade.side.assign(value.stringView());
+            else if (key == "ts") trade.timestamp = value.integer();
+        });
+        trade.cost = trade.price * trade.amount;
+        trade.datetime = this->iso8601(trade.timestamp);
+    });
+    trades.resize(count);
+}
+
 json OKX::fetchTickerAsync(const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, symbol, params]() {
+    return Executor::instance().submit([this, symbol, params]() {
         return this->fetchTicker(symbol, params);
     });
 }
 
 json OKX::fetchTickersAsync(const std::vector<std::string>& symbols, const json& params) {
-    return std::async(std::launch::async, [this, symbols, params]() {
+    return Executor::instance().submit([this, symbols, params]() {
         return this->fetchTickers(symbols, params);
     });
 }
 
 json OKX::fetchOrderBookAsync(const std::string& symbol, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, limit, params]() {
+    return Executor::instance().submit([this, symbol, limit, params]() {
         return this->fetchOrderBook(symbol, limit, params);
     });
 }
 
 json OKX::fetchTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchTrades(symbol, since, limit, params);
     });
 }
 
 json OKX::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe,
                          int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, timeframe, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, timeframe, since, limit, params]() {
         return this->fetchOHLCV(symbol, timeframe, since, limit, params);
     });
 }
 
 json OKX::fetchBalanceAsync(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::instance().submit([this, params]() {
         return this->fetchBalance(params);
     });
 }
@@ -396,91 +534,91 @@ json OKX::fetchBalanceAsync(const json& params) {
 json OKX::createOrderAsync(const std::string& symbol, const std::string& type,
                          const std::string& side, double amount,
                          double price, const json& params) {
-    return std::async(std::launch::async, [this, symbol, type, side, amount, price, params]() {
+    return Executor::instance().submit([this, symbol, type, side, amount, price, params]() {
         return this->createOrder(symbol, type, side, amount, price, params);
     });
 }
 
 json OKX::cancelOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, id, symbol, params]() {
+    return Executor::instance().submit([this, id, symbol, params]() {
         return this->cancelOrder(id, symbol, params);
     });
 }
 
 json OKX::fetchOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, id, symbol, params]() {
+    return Executor::instance().submit([this, id, symbol, params]() {
         return this->fetchOrder(id, symbol, params);
     });
 }
 
 json OKX::fetchOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchOrders(symbol, since, limit, params);
     });
 }
 
 json OKX::fetchOpenOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchOpenOrders(symbol, since, limit, params);
     });
 }
 
 json OKX::fetchClosedOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchClosedOrders(symbol, since, limit, params);
     });
 }
 
 json OKX::fetchMyTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchMyTrades(symbol, since, limit, params);
     });
 }
 
 json OKX::fetchLedgerAsync(const std::string& code, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, code, since, limit, params]() {
+    return Executor::instance().submit([this, code, since, limit, params]() {
         return this->fetchLedger(code, since, limit, params);
     });
 }
 
 json OKX::fetchDepositsAsync(const std::string& code, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, code, since, limit, params]() {
+    return Executor::instance().submit([this, code, since, limit, params]() {
         return this->fetchDeposits(code, since, limit, params);
     });
 }
 
 json OKX::fetchWithdrawalsAsync(const std::string& code, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, code, since, limit, params]() {
+    return Executor::instance().submit([this, code, since, limit, params]() {
         return this->fetchWithdrawals(code, since, limit, params);
     });
 }
 
 json OKX::fetchDepositAddressAsync(const std::string& code, const json& params) {
-    return std::async(std::launch::async, [this, code, params]() {
+    return Executor::instance().submit([this, code, params]() {
         return this->fetchDepositAddress(code, params);
     });
 }
 
 json OKX::fetchFundingRateAsync(const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, symbol, params]() {
+    return Executor::instance().submit([this, symbol, params]() {
         return this->fetchFundingRate(symbol, params);
     });
 }
 
 json OKX::fetchFundingRateHistoryAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::instance().submit([this, symbol, since, limit, params]() {
         return this->fetchFundingRateHistory(symbol, since, limit, params);
     });
 }
 
 json OKX::setLeverageAsync(int leverage, const std::string& symbol, const std::string& type, const json& params) {
-    return std::async(std::launch::async, [this, leverage, symbol, type, params]() {
+    return Executor::instance().submit([this, leverage, symbol, type, params]() {
         return this->setLeverage(leverage, symbol, type, params);
     });
 }
 
 json OKX::setMarginModeAsync(const std::string& marginMode, const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, marginMode, symbol, params]() {
+    return Executor::instance().submit([this, marginMode, symbol, params]() {
         return this->setMarginMode(marginMode, symbol, params);
     });
 }
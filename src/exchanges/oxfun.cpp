@@ -1,4 +1,5 @@
 #include "../../include/ccxt/exchanges/oxfun.h"
+#include "ccxt/base/executor.h"
 #include "../../include/ccxt/exchange_registry.h"
 
 namespace ccxt {
@@ -186,97 +187,97 @@ void oxfun::handleErrors(const std::string& code, const std::string& reason, con
 }
 
 AsyncPullType oxfun::fetchMarketsAsync() const {
-    return std::async(std::launch::async, [this]() {
+    return Executor::instance().submit([this]() {
         return this->fetchMarketsImpl();
     });
 }
 
 AsyncPullType oxfun::fetchCurrenciesAsync() const {
-    return std::async(std::launch::async, [this]() {
+    return Executor::instance().submit([this]() {
         return this->fetchCurrenciesImpl();
     });
 }
 
 AsyncPullType oxfun::fetchTickerAsync(const std::string& symbol) const {
-    return std::async(std::launch::async, [this, symbol]() {
+    return Executor::instance().submit([this, symbol]() {
         return this->fetchTickerImpl(symbol);
     });
 }
 
 AsyncPullType oxfun::fetchTickersAsync(const std::vector<std::string>& symbols) const {
-    return std::async(std::launch::async, [this, symbols]() {
+    return Executor::instance().submit([this, symbols]() {
         return this->fetchTickersImpl(symbols);
     });
 }
 
 AsyncPullType oxfun::fetchOrderBookAsync(const std::string& symbol, const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, symbol, limit]() {
+    return Executor::instance().submit([this, symbol, limit]() {
         return this->fetchOrderBookImpl(symbol, limit);
     });
 }
 
 AsyncPullType oxfun::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe, const std::optional<long long>& since, const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, symbol, timeframe, since, limit]() {
+    return Executor::instance().submit([this, symbol, timeframe, since, limit]() {
         return this->fetchOHLCVImpl(symbol, timeframe, since, limit);
     });
 }
 
 AsyncPullType oxfun::createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side, double amount, const std::optional<double>& price) {
-    return std::async(std::launch::async, [this, symbol, type, side, amount, price]() {
+    return Executor::instance().submit([this, symbol, type, side, amount, price]() {
         return this->createOrderImpl(symbol, type, side, amount, price);
     });
 }
 
 AsyncPullType oxfun::cancelOrderAsync(const std::string& id, const std::string& symbol) {
-    return std::async(std::launch::async, [this, id, symbol]() {
+    return Executor::instance().submit([this, id, symbol]() {
         return this->cancelOrderImpl(id, symbol);
     });
 }
 
 AsyncPullType oxfun::fetchOrderAsync(const std::string& id, const std::string& symbol) const {
-    return std::async(std::launch::async, [this, id, symbol]() {
+    return Executor::instance().submit([this, id, symbol]() {
         return this->fetchOrderImpl(id, symbol);
     });
 }
 
 AsyncPullType oxfun::fetchOpenOrdersAsync(const std::string& symbol, const std::optional<long long>& since, const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+    return Executor::instance().submit([this, symbol, since, limit]() {
         return this->fetchOpenOrdersImpl(symbol, since, limit);
     });
 }
 
 AsyncPullType oxfun::fetchClosedOrdersAsync(const std::string& symbol, const std::optional<long long>& since, const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+    return Executor::instance().submit([this, symbol, since, limit]() {
         return this->fetchClosedOrdersImpl(symbol, since, limit);
     });
 }
 
 AsyncPullType oxfun::fetchMyTradesAsync(const std::string& symbol, const std::optional<long long>& since, const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+    return Executor::instance().submit([this, symbol, since, limit]() {
         return this->fetchMyTradesImpl(symbol, since, limit);
     });
 }
 
 AsyncPullType oxfun::fetchBalanceAsync() const {
-    return std::async(std::launch::async, [this]() {
+    return Executor::instance().submit([this]() {
         return this->fetchBalanceImpl();
     });
 }
 
 AsyncPullType oxfun::fetchDepositAddressAsync(const std::string& code, const std::optional<std::string>& network) const {
-    return std::async(std::launch::async, [this, code, network]() {
+    return Executor::instance().submit([this, code, network]() {
         return this->fetchDepositAddressImpl(code, network);
     });
 }
 
 AsyncPullType oxfun::fetchDepositsAsync(const std::optional<std::string>& code, const std::optional<long long>& since, const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, code, since, limit]() {
+    return Executor::instance().submit([this, code, since, limit]() {
         return this->fetchDepositsImpl(code, since, limit);
     });
 }
 
 AsyncPullType oxfun::fetchWithdrawalsAsync(const std::optional<std::string>& code, const std::optional<long long>& since, const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, code, since, limit]() {
+    return Executor::instance().submit([this, code, since, limit]() {
         return this->fetchWithdrawalsImpl(code, since, limit);
     });
 }
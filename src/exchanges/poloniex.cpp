@@ -1,4 +1,5 @@
 #include "poloniex.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <sstream>
 #include <iomanip>
@@ -689,7 +690,7 @@ AsyncPullType poloniex::createOrderAsync(const std::string& symbol,
                                            const std::string& side,
                                            double amount,
                                            const std::optional<double>& price) {
-    return std::async(std::launch::async,
+    return Executor::instance().submit(
                      [this, symbol, type, side, amount, price]() {
                          return createOrderImpl(symbol, type, side, amount, price);
                      });
@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/poloniexfutures.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <iomanip>
 #include <sstream>
@@ -488,24 +489,24 @@ void poloniexfutures::handleErrors(const std::string& code, const std::string& r
 
 // Async implementations for market data
 AsyncPullType poloniexfutures::fetchMarketsAsync() const {
-    return std::async(std::launch::async, [this]() { return fetchMarketsImpl(); });
+    return Executor::instance().submit([this]() { return fetchMarketsImpl(); });
 }
 
 AsyncPullType poloniexfutures::fetchTimeAsync() const {
-    return std::async(std::launch::async, [this]() { return fetchTimeImpl(); });
+    return Executor::instance().submit([this]() { return fetchTimeImpl(); });
 }
 
 AsyncPullType poloniexfutures::fetchTickerAsync(const std::string& symbol) const {
-    return std::async(std::launch::async, [this, symbol]() { return fetchTickerImpl(symbol); });
+    return Executor::instance().submit([this, symbol]() { return fetchTickerImpl(symbol); });
 }
 
 AsyncPullType poloniexfutures::fetchTickersAsync(const std::vector<std::string>& symbols) const {
-    return std::async(std::launch::async, [this, symbols]() { return fetchTickersImpl(symbols); });
+    return Executor::instance().submit([this, symbols]() { return fetchTickersImpl(symbols); });
 }
 
 AsyncPullType poloniexfutures::fetchOrderBookAsync(const std::string& symbol,
                                                      const std::optional<int>& limit) const {
-    return std::async(std::launch::async,
+    return Executor::instance().submit(
                      [this, symbol, limit]() { return fetchOrderBookImpl(symbol, limit); });
 }
 
@@ -513,7 +514,7 @@ AsyncPullType poloniexfutures::fetchOHLCVAsync(const std::string& symbol,
                                                   const std::string& timeframe,
                                                   const std::optional<long long>& since,
                                                   const std::optional<int>& limit) const {
-    return std::async(std::launch::async,
+    return Executor::instance().submit(
                      [this, symbol, timeframe, since, limit]() {
                          return fetchOHLCVImpl(symbol, timeframe, since, limit);
                      });
@@ -522,7 +523,7 @@ AsyncPullType poloniexfutures::fetchOHLCVAsync(const std::string& symbol,
 AsyncPullType poloniexfutures::fetchTradesAsync(const std::string& symbol,
                                                    const std::optional<int>& limit,
                                                    const std::optional<long long>& since) const {
-    return std::async(std::launch::async,
+    return Executor::instance().submit(
                      [this, symbol, limit, since]() {
                          return fetchTradesImpl(symbol, limit, since);
                      });
@@ -2,6 +2,7 @@
 #include <iostream>
 #include <sstream>
 #include <chrono>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -107,7 +108,7 @@ void AlpacaWS::watchPositions() {
     subscribe("position_updates");
 }
 
-void AlpacaWS::handleMessage(const std::string& message) {
+void AlpacaWS::handleMessage(std::string_view message) {
     try {
         auto j = nlohmann::json::parse(message);
 
@@ -149,9 +150,9 @@ void AlpacaWS::handleTrade(const nlohmann::json& data, bool isPrivate) {
         {"symbol", data["S"]},
         {"type", nullptr},
         {"side", nullptr},
-        {"price", std::stod(data["p"])},
-        {"amount", std::stod(data["s"])},
-        {"cost", std::stod(data["p"]) * std::stod(data["s"])}
+        {"price", jsonDouble(data["p"])},
+        {"amount", jsonDouble(data["s"])},
+        {"cost", jsonDouble(data["p"]) * jsonDouble(data["s"])}
     };
 
     if (isPrivate) {
@@ -170,10 +171,10 @@ void AlpacaWS::handleQuote(const nlohmann::json& data) {
         {"symbol", data["S"]},
         {"timestamp", std::stoll(data["t"])},
         {"datetime", exchange_.iso8601(std::stoll(data["t"]))},
-        {"bid", std::stod(data["bp"])},
-        {"bidVolume", std::stod(data["bs"])},
-        {"ask", std::stod(data["ap"])},
-        {"askVolume", std::stod(data["as"])},
+        {"bid", jsonDouble(data["bp"])},
+        {"bidVolume", jsonDouble(data["bs"])},
+        {"ask", jsonDouble(data["ap"])},
+        {"askVolume", jsonDouble(data["as"])},
         {"vwap", nullptr},
         {"open", nullptr},
         {"close", nullptr},
@@ -192,11 +193,11 @@ void AlpacaWS::handleQuote(const nlohmann::json& data) {
 void AlpacaWS::handleBar(const nlohmann::json& data) {
     nlohmann::json parsedBar = {
         std::stoll(data["t"]),      // timestamp
-        std::stod(data["o"]),       // open
-        std::stod(data["h"]),       // high
-        std::stod(data["l"]),       // low
-        std::stod(data["c"]),       // close
-        std::stod(data["v"]),       // volume
+        jsonDouble(data["o"]),       // open
+        jsonDouble(data["h"]),       // high
+        jsonDouble(data["l"]),       // low
+        jsonDouble(data["c"]),       // close
+        jsonDouble(data["v"]),       // volume
     };
     emit("ohlcv", parsedBar);
 }
@@ -229,12 +230,12 @@ void AlpacaWS::handleOrder(const nlohmann::json& data) {
         {"symbol", order["symbol"]},
         {"type", order["type"]},
         {"side", order["side"]},
-        {"price", std::stod(order["limit_price"].get<std::string>())},
-        {"amount", std::stod(order["qty"])},
-        {"filled", std::stod(order["filled_qty"])},
-        {"remaining", std::stod(order["qty"]) - std::stod(order["filled_qty"])},
-        {"cost", std::stod(order["filled_avg_price"].get<std::string>()) * std::stod(order["filled_qty"])},
-        {"average", std::stod(order["filled_avg_price"].get<std::string>())},
+        {"price", jsonDouble(order["limit_price"])},
+        {"amount", jsonDouble(order["qty"])},
+        {"filled", jsonDouble(order["filled_qty"])},
+        {"remaining", jsonDouble(order["qty"]) - jsonDouble(order["filled_qty"])},
+        {"cost", jsonDouble(order["filled_avg_price"]) * jsonDouble(order["filled_qty"])},
+        {"average", jsonDouble(order["filled_avg_price"])},
         {"fee", nullptr}  // Alpaca doesn't provide fee information in real-time
     };
     emit("order", parsedOrder);
@@ -249,11 +250,11 @@ void AlpacaWS::handlePosition(const nlohmann::json& data) {
         {"long", data["side"] == "long"},
         {"short", data["side"] == "short"},
         {"side", data["side"]},
-        {"quantity", std::stod(data["qty"])},
-        {"price", std::stod(data["avg_entry_price"])},
-        {"cost", std::stod(data["market_value"])},
-        {"unrealizedPnl", std::stod(data["unrealized_pl"])},
-        {"realizedPnl", std::stod(data["realized_pl"])}
+        {"quantity", jsonDouble(data["qty"])},
+        {"price", jsonDouble(data["avg_entry_price"])},
+        {"cost", jsonDouble(data["market_value"])},
+        {"unrealizedPnl", jsonDouble(data["unrealized_pl"])},
+        {"realizedPnl", jsonDouble(data["realized_pl"])}
     };
     emit("position", parsedPosition);
 }
@@ -261,9 +262,9 @@ void AlpacaWS::handlePosition(const nlohmann::json& data) {
 void AlpacaWS::handleBalance(const nlohmann::json& data) {
     nlohmann::json parsedBalance = {
         {"info", data},
-        {"free", std::stod(data["cash"])},
-        {"used", std::stod(data["long_market_value"]) + std::stod(data["short_market_value"])},
-        {"total", std::stod(data["equity"])},
+        {"free", jsonDouble(data["cash"])},
+        {"used", jsonDouble(data["long_market_value"]) + jsonDouble(data["short_market_value"])},
+        {"total", jsonDouble(data["equity"])},
         {"currency", "USD"}
     };
     emit("balance", parsedBalance);
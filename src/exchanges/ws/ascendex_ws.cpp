@@ -2,14 +2,15 @@
 #include <iostream>
 #include <sstream>
 #include <chrono>
-#include <thread>
 #include <openssl/hmac.h>
 #include <iomanip>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
 AscendexWS::AscendexWS(boost::asio::io_context& ioc, boost::asio::ssl::context& ctx, Ascendex& exchange)
-    : WebSocketClient(ioc, ctx), exchange_(exchange), lastPingTimestamp_(0), pingInterval_(15000), authenticated_(false) {
+    : WebSocketClient(ioc, ctx), exchange_(exchange), authenticated_(false) {
+    setHeartbeat({std::chrono::seconds(15), std::chrono::seconds(10)});
     apiKey_ = exchange_.apiKey;
     apiSecret_ = exchange_.secret;
 }
@@ -94,21 +95,28 @@ void AscendexWS::unsubscribe(const std::string& channel, const std::vector<std::
     send(request.dump());
 }
 
-void AscendexWS::ping() {
+std::string AscendexWS::heartbeatMessage() {
     nlohmann::json ping = {
         {"op", "ping"},
         {"id", std::to_string(std::chrono::system_clock::now().time_since_epoch().count())}
     };
-    send(ping.dump());
+    return ping.dump();
 }
 
-void AscendexWS::startPingLoop() {
-    std::thread([this]() {
-        while (true) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(pingInterval_));
-            ping();
-        }
-    }).detach();
+bool AscendexWS::isHeartbeatReply(std::string_view message) const {
+    return message.find(R"("m":"pong")") != std::string_view::npos;
+}
+
+std::string AscendexWS::pingReply(std::string_view message) const {
+    if (message.find(R"("m":"ping")") == std::string_view::npos) {
+        return {};
+    }
+    auto j = nlohmann::json::parse(message);
+    nlohmann::json pong = {
+        {"op", "pong"},
+        {"id", j.value("id", "0")}
+    };
+    return pong.dump();
 }
 
 void AscendexWS::watchTicker(const std::string& symbol) {
@@ -147,27 +155,17 @@ void AscendexWS::watchPositions() {
     subscribe("position:futures", {}, true);
 }
 
-void AscendexWS::handleMessage(const std::string& message) {
+void AscendexWS::handleMessage(std::string_view message) {
     try {
         auto j = nlohmann::json::parse(message);
 
         if (j.contains("m")) {
             std::string method = j["m"];
 
-            if (method == "ping") {
-                nlohmann::json pong = {
-                    {"op", "pong"},
-                    {"id", j.value("id", "0")}
-                };
-                send(pong.dump());
-                return;
-            }
-
             if (method == "auth") {
                 authenticated_ = (j.value("code", 0) == 0);
                 if (authenticated_) {
                     emit("authenticated", j);
-                    startPingLoop();
                 } else {
                     emit("error", j);
                 }
@@ -208,14 +206,14 @@ void AscendexWS::handleTicker(const nlohmann::json& data) {
         {"datetime", exchange_.iso8601(data["t"])},
         {"high", nullptr},
         {"low", nullptr},
-        {"bid", std::stod(data["b"])},
-        {"bidVolume", std::stod(data["bq"])},
-        {"ask", std::stod(data["a"])},
-        {"askVolume", std::stod(data["aq"])},
+        {"bid", jsonDouble(data["b"])},
+        {"bidVolume", jsonDouble(data["bq"])},
+        {"ask", jsonDouble(data["a"])},
+        {"askVolume", jsonDouble(data["aq"])},
         {"vwap", nullptr},
         {"open", nullptr},
-        {"close", std::stod(data["a"])},  // Using ask as the close price
-        {"last", std::stod(data["a"])},   // Using ask as the last price
+        {"close", jsonDouble(data["a"])},  // Using ask as the close price
+        {"last", jsonDouble(data["a"])},   // Using ask as the last price
         {"previousClose", nullptr},
         {"change", nullptr},
         {"percentage", nullptr},
@@ -233,15 +231,15 @@ void AscendexWS::handleOrderBook(const nlohmann::json& data) {
 
     for (const auto& bid : data["bids"]) {
         bids.push_back({
-            std::stod(bid[0]),  // price
-            std::stod(bid[1])   // amount
+            jsonDouble(bid[0]),  // price
+            jsonDouble(bid[1])   // amount
         });
     }
 
     for (const auto& ask : data["asks"]) {
         asks.push_back({
-            std::stod(ask[0]),  // price
-            std::stod(ask[1])   // amount
+            jsonDouble(ask[0]),  // price
+            jsonDouble(ask[1])   // amount
         });
     }
 
@@ -267,9 +265,9 @@ void AscendexWS::handleTrade(const nlohmann::json& data) {
         {"symbol", data["s"]},
         {"type", nullptr},
         {"side", data["bm"] ? "buy" : "sell"},
-        {"price", std::stod(data["p"])},
-        {"amount", std::stod(data["q"])},
-        {"cost", std::stod(data["p"]) * std::stod(data["q"])}
+        {"price", jsonDouble(data["p"])},
+        {"amount", jsonDouble(data["q"])},
+        {"cost", jsonDouble(data["p"]) * jsonDouble(data["q"])}
     };
     emit("trade", parsedTrade);
 }
@@ -277,11 +275,11 @@ void AscendexWS::handleTrade(const nlohmann::json& data) {
 void AscendexWS::handleOHLCV(const nlohmann::json& data) {
     nlohmann::json parsedCandle = {
         data["t"],                    // timestamp
-        std::stod(data["o"]),        // open
-        std::stod(data["h"]),        // high
-        std::stod(data["l"]),        // low
-        std::stod(data["c"]),        // close
-        std::stod(data["v"])         // volume
+        jsonDouble(data["o"]),        // open
+        jsonDouble(data["h"]),        // high
+        jsonDouble(data["l"]),        // low
+        jsonDouble(data["c"]),        // close
+        jsonDouble(data["v"])         // volume
     };
     emit("ohlcv", parsedCandle);
 }
@@ -290,9 +288,9 @@ void AscendexWS::handleBalance(const nlohmann::json& data) {
     nlohmann::json parsedBalance = {
         {"info", data},
         {"currency", data["a"]},
-        {"free", std::stod(data["f"])},
-        {"used", std::stod(data["l"])},
-        {"total", std::stod(data["f"]) + std::stod(data["l"])}
+        {"free", jsonDouble(data["f"])},
+        {"used", jsonDouble(data["l"])},
+        {"total", jsonDouble(data["f"]) + jsonDouble(data["l"])}
     };
     emit("balance", parsedBalance);
 }
@@ -324,14 +322,14 @@ void AscendexWS::handleOrder(const nlohmann::json& data) {
         {"symbol", data["s"]},
         {"type", data["ot"]},
         {"side", data["sd"]},
-        {"price", std::stod(data["p"])},
-        {"amount", std::stod(data["q"])},
-        {"filled", std::stod(data["cf"])},
-        {"remaining", std::stod(data["q"]) - std::stod(data["cf"])},
-        {"cost", std::stod(data["cf"]) * std::stod(data["ap"])},
-        {"average", std::stod(data["ap"])},
+        {"price", jsonDouble(data["p"])},
+        {"amount", jsonDouble(data["q"])},
+        {"filled", jsonDouble(data["cf"])},
+        {"remaining", jsonDouble(data["q"]) - jsonDouble(data["cf"])},
+        {"cost", jsonDouble(data["cf"]) * jsonDouble(data["ap"])},
+        {"average", jsonDouble(data["ap"])},
         {"fee", {
-            {"cost", std::stod(data["fee"])},
+            {"cost", jsonDouble(data["fee"])},
             {"currency", data["feeAsset"]}
         }}
     };
@@ -348,11 +346,11 @@ void AscendexWS::handleMyTrade(const nlohmann::json& data) {
         {"symbol", data["s"]},
         {"type", data["ot"]},
         {"side", data["sd"]},
-        {"price", std::stod(data["p"])},
-        {"amount", std::stod(data["q"])},
-        {"cost", std::stod(data["p"]) * std::stod(data["q"])},
+        {"price", jsonDouble(data["p"])},
+        {"amount", jsonDouble(data["q"])},
+        {"cost", jsonDouble(data["p"]) * jsonDouble(data["q"])},
         {"fee", {
-            {"cost", std::stod(data["fee"])},
+            {"cost", jsonDouble(data["fee"])},
             {"currency", data["feeAsset"]}
         }}
     };
@@ -368,13 +366,13 @@ void AscendexWS::handlePosition(const nlohmann::json& data) {
         {"long", data["sd"] == "Buy"},
         {"short", data["sd"] == "Sell"},
         {"side", data["sd"]},
-        {"quantity", std::stod(data["pos"])},
-        {"unrealizedPnl", std::stod(data["upl"])},
-        {"leverage", std::stod(data["lever"])},
-        {"collateral", std::stod(data["col"])},
-        {"notional", std::stod(data["notional"])},
-        {"markPrice", std::stod(data["mp"])},
-        {"liquidationPrice", std::stod(data["liq"])}
+        {"quantity", jsonDouble(data["pos"])},
+        {"unrealizedPnl", jsonDouble(data["upl"])},
+        {"leverage", jsonDouble(data["lever"])},
+        {"collateral", jsonDouble(data["col"])},
+        {"notional", jsonDouble(data["notional"])},
+        {"markPrice", jsonDouble(data["mp"])},
+        {"liquidationPrice", jsonDouble(data["liq"])}
     };
     emit("position", parsedPosition);
 }
@@ -5,6 +5,7 @@
 #include <thread>
 #include <openssl/hmac.h>
 #include <iomanip>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -139,7 +140,7 @@ void BequantWS::watchMyTrades(const std::string& symbol) {
     subscribe("spot/trade", symbol);
 }
 
-void BequantWS::handleMessage(const std::string& message) {
+void BequantWS::handleMessage(std::string_view message) {
     try {
         auto j = nlohmann::json::parse(message);
 
@@ -180,22 +181,22 @@ void BequantWS::handleTicker(const nlohmann::json& data) {
         {"symbol", data["symbol"]},
         {"timestamp", data["timestamp"]},
         {"datetime", exchange_.iso8601(data["timestamp"])},
-        {"high", std::stod(data["high"])},
-        {"low", std::stod(data["low"])},
-        {"bid", std::stod(data["bid"])},
-        {"bidVolume", std::stod(data["bidSize"])},
-        {"ask", std::stod(data["ask"])},
-        {"askVolume", std::stod(data["askSize"])},
-        {"vwap", std::stod(data["volumeQuote"]) / std::stod(data["volume"])},
-        {"open", std::stod(data["open"])},
-        {"close", std::stod(data["last"])},
-        {"last", std::stod(data["last"])},
+        {"high", jsonDouble(data["high"])},
+        {"low", jsonDouble(data["low"])},
+        {"bid", jsonDouble(data["bid"])},
+        {"bidVolume", jsonDouble(data["bidSize"])},
+        {"ask", jsonDouble(data["ask"])},
+        {"askVolume", jsonDouble(data["askSize"])},
+        {"vwap", jsonDouble(data["volumeQuote"]) / jsonDouble(data["volume"])},
+        {"open", jsonDouble(data["open"])},
+        {"close", jsonDouble(data["last"])},
+        {"last", jsonDouble(data["last"])},
         {"previousClose", nullptr},
-        {"change", std::stod(data["last"]) - std::stod(data["open"])},
-        {"percentage", ((std::stod(data["last"]) - std::stod(data["open"])) / std::stod(data["open"])) * 100},
-        {"average", (std::stod(data["high"]) + std::stod(data["low"])) / 2},
-        {"baseVolume", std::stod(data["volume"])},
-        {"quoteVolume", std::stod(data["volumeQuote"])},
+        {"change", jsonDouble(data["last"]) - jsonDouble(data["open"])},
+        {"percentage", ((jsonDouble(data["last"]) - jsonDouble(data["open"])) / jsonDouble(data["open"])) * 100},
+        {"average", (jsonDouble(data["high"]) + jsonDouble(data["low"])) / 2},
+        {"baseVolume", jsonDouble(data["volume"])},
+        {"quoteVolume", jsonDouble(data["volumeQuote"])},
         {"info", data}
     };
     emit("ticker", parsedTicker);
@@ -207,15 +208,15 @@ void BequantWS::handleOrderBook(const nlohmann::json& data, bool isSnapshot) {
 
     for (const auto& bid : data["bid"]) {
         bids.push_back({
-            std::stod(bid["price"]),
-            std::stod(bid["size"])
+            jsonDouble(bid["price"]),
+            jsonDouble(bid["size"])
         });
     }
 
     for (const auto& ask : data["ask"]) {
         asks.push_back({
-            std::stod(ask["price"]),
-            std::stod(ask["size"])
+            jsonDouble(ask["price"]),
+            jsonDouble(ask["size"])
         });
     }
 
@@ -242,9 +243,9 @@ void BequantWS::handleTrade(const nlohmann::json& data) {
         {"symbol", data["symbol"]},
         {"type", nullptr},
         {"side", data["side"]},
-        {"price", std::stod(data["price"])},
-        {"amount", std::stod(data["quantity"])},
-        {"cost", std::stod(data["price"]) * std::stod(data["quantity"])}
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["quantity"])},
+        {"cost", jsonDouble(data["price"]) * jsonDouble(data["quantity"])}
     };
     emit("trade", parsedTrade);
 }
@@ -252,11 +253,11 @@ void BequantWS::handleTrade(const nlohmann::json& data) {
 void BequantWS::handleOHLCV(const nlohmann::json& data) {
     nlohmann::json parsedCandle = {
         data["timestamp"],
-        std::stod(data["open"]),
-        std::stod(data["high"]),
-        std::stod(data["low"]),
-        std::stod(data["close"]),
-        std::stod(data["volume"])
+        jsonDouble(data["open"]),
+        jsonDouble(data["high"]),
+        jsonDouble(data["low"]),
+        jsonDouble(data["close"]),
+        jsonDouble(data["volume"])
     };
     emit("ohlcv", parsedCandle);
 }
@@ -265,9 +266,9 @@ void BequantWS::handleBalance(const nlohmann::json& data) {
     for (const auto& [currency, balance] : data.items()) {
         nlohmann::json parsedBalance = {
             {"info", balance},
-            {"free", std::stod(balance["available"])},
-            {"used", std::stod(balance["reserved"])},
-            {"total", std::stod(balance["available"]) + std::stod(balance["reserved"])},
+            {"free", jsonDouble(balance["available"])},
+            {"used", jsonDouble(balance["reserved"])},
+            {"total", jsonDouble(balance["available"]) + jsonDouble(balance["reserved"])},
             {"currency", currency}
         };
         emit("balance", parsedBalance);
@@ -303,12 +304,12 @@ void BequantWS::handleOrder(const nlohmann::json& data) {
         {"symbol", data["symbol"]},
         {"type", data["type"]},
         {"side", data["side"]},
-        {"price", std::stod(data["price"])},
-        {"amount", std::stod(data["quantity"])},
-        {"filled", std::stod(data["cumQuantity"])},
-        {"remaining", std::stod(data["quantity"]) - std::stod(data["cumQuantity"])},
-        {"cost", std::stod(data["cumQuantity"]) * std::stod(data["price"])},
-        {"average", data.contains("avgPrice") ? std::stod(data["avgPrice"]) : 0.0},
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["quantity"])},
+        {"filled", jsonDouble(data["cumQuantity"])},
+        {"remaining", jsonDouble(data["quantity"]) - jsonDouble(data["cumQuantity"])},
+        {"cost", jsonDouble(data["cumQuantity"]) * jsonDouble(data["price"])},
+        {"average", data.contains("avgPrice") ? jsonDouble(data["avgPrice"]) : 0.0},
         {"fee", nullptr}  // Fee information not provided in real-time
     };
     emit("order", parsedOrder);
@@ -324,11 +325,11 @@ void BequantWS::handleMyTrade(const nlohmann::json& data) {
         {"symbol", data["symbol"]},
         {"type", data["type"]},
         {"side", data["side"]},
-        {"price", std::stod(data["price"])},
-        {"amount", std::stod(data["quantity"])},
-        {"cost", std::stod(data["price"]) * std::stod(data["quantity"])},
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["quantity"])},
+        {"cost", jsonDouble(data["price"]) * jsonDouble(data["quantity"])},
         {"fee", {
-            {"cost", std::stod(data["fee"])},
+            {"cost", jsonDouble(data["fee"])},
             {"currency", data["feeCurrency"]}
         }}
     };
@@ -5,6 +5,8 @@
 #include <chrono>
 #include <boost/crc.hpp>
 #include <boost/algorithm/string.hpp>
+#include "ccxt/base/number.h"
+#include "ccxt/base/errors.h"
 
 namespace ccxt {
 
@@ -44,68 +46,39 @@ std::string BinanceWS::getEndpoint() {
 
 void BinanceWS::authenticate() {
     // Get listen key from REST API
-    auto listenKey = "";//exchange_.getListenKey();
-    
-    nlohmann::json request = {
-        {"method", "SUBSCRIBE"},
-        {"params", {listenKey}},
-        {"id", nextRequestId_++}
-    };
-    
-    send(request.dump());
+    std::string listenKey = "";//exchange_.getListenKey();
+
+    // The user data stream is replayed after a reconnect like any other
+    subscribe(listenKey);
+    authenticated_ = true;
 }
 
-void BinanceWS::watchTicker(const std::string& symbol) {
-    auto market = exchange_.markets[symbol];
-    std::string stream = boost::algorithm::to_lower_copy(market.id) + "@ticker";
-    
+void BinanceWS::subscribe(const std::string& stream) {
     nlohmann::json request = {
         {"method", "SUBSCRIBE"},
         {"params", {stream}},
         {"id", nextRequestId_++}
     };
-    
-    send(request.dump());
+    std::string frame = request.dump();
+    addSubscription(stream, frame);
+    send(std::move(frame));
+}
+
+void BinanceWS::watchTicker(const std::string& symbol) {
+    subscribe(streamName(symbol, "@ticker"));
 }
 
 void BinanceWS::watchOrderBook(const std::string& symbol, const std::string& limit) {
-    auto market = exchange_.markets[symbol];
-    std::string stream = boost::algorithm::to_lower_copy(market.id) + "@depth" + (limit.empty() ? "" : limit);
-    
-    nlohmann::json request = {
-        {"method", "SUBSCRIBE"},
-        {"params", {stream}},
-        {"id", nextRequestId_++}
-    };
-    
-    send(request.dump());
+    subscribe(streamName(symbol, "@depth" + limit));
 }
 
 void BinanceWS::watchTrades(const std::string& symbol) {
-    auto market = exchange_.markets[symbol];
-    std::string stream = boost::algorithm::to_lower_copy(market.id) + "@trade";
-    
-    nlohmann::json request = {
-        {"method", "SUBSCRIBE"},
-        {"params", {stream}},
-        {"id", nextRequestId_++}
-    };
-    
-    send(request.dump());
+    subscribe(streamName(symbol, "@trade"));
 }
 
 void BinanceWS::watchOHLCV(const std::string& symbol, const std::string& timeframe) {
-    auto market = exchange_.markets[symbol];
     std::string interval = "1m";//exchange_.timeframes[timeframe];
-    std::string stream = boost::algorithm::to_lower_copy(market.id) + "@kline_" + interval;
-    
-    nlohmann::json request = {
-        {"method", "SUBSCRIBE"},
-        {"params", {stream}},
-        {"id", nextRequestId_++}
-    };
-    
-    send(request.dump());
+    subscribe(streamName(symbol, "@kline_" + interval));
 }
 
 void BinanceWS::watchBalance() {
@@ -136,16 +109,7 @@ void BinanceWS::watchMyTrades() {
 }
 
 void BinanceWS::watchMarkPrice(const std::string& symbol) {
-    auto market = exchange_.markets[symbol];
-    std::string stream = boost::algorithm::to_lower_copy(market.id) + "@markPrice";
-    
-    nlohmann::json request = {
-        {"method", "SUBSCRIBE"},
-        {"params", {stream}},
-        {"id", nextRequestId_++}
-    };
-    
-    send(request.dump());
+    subscribe(streamName(symbol, "@markPrice"));
 }
 
 void BinanceWS::watchPositions() {
@@ -157,8 +121,35 @@ void BinanceWS::watchPositions() {
     // after authentication
 }
 
-void BinanceWS::handleMessage(const std::string& message) {
+bool BinanceWS::mergeFrames(std::string& queued, const std::string& next) const {
+    auto last = nlohmann::json::parse(queued, nullptr, false);
+    auto request = nlohmann::json::parse(next, nullptr, false);
+    if (!last.is_object() || !request.is_object() || !last.contains("method") || !request.contains("method") ||
+        last["method"] != request["method"]) {
+        return false;
+    }
+    const auto& method = last["method"];
+    if ((method != "SUBSCRIBE" && method != "UNSUBSCRIBE") || !last["params"].is_array() ||
+        !request["params"].is_array()) {
+        return false;
+    }
+    // The merged request keeps the id of the first one
+    for (auto& param : request["params"]) {
+        last["params"].push_back(std::move(param));
+    }
+    queued = last.dump();
+    return true;
+}
+
+void BinanceWS::handleMessage(std::string_view message) {
     try {
+        if (lazyParsing() && handleMessageLazy(message)) {
+            return;
+        }
+        // Other messages are rare enough to be parsed a second time below
+        if (jsonArena() && handleMarketData(parseArenaJson(message))) {
+            return;
+        }
         auto j = nlohmann::json::parse(message);
         
         // Handle subscription responses
@@ -173,19 +164,8 @@ void BinanceWS::handleMessage(const std::string& message) {
         
         // Handle stream data
         if (j.contains("stream")) {
-            std::string stream = j["stream"];
-            auto data = j["data"];
-            
-            if (stream.find("@ticker") != std::string::npos) {
-                handleTicker(data);
-            } else if (stream.find("@depth") != std::string::npos) {
-                handleOrderBook(data);
-            } else if (stream.find("@trade") != std::string::npos) {
-                handleTrade(data);
-            } else if (stream.find("@kline") != std::string::npos) {
-                handleOHLCV(data);
-            } else if (stream.find("@markPrice") != std::string::npos) {
-                handleMarkPrice(data);
+            if (!handleMarketData(j) && j["stream"].get_ref<const std::string&>().find("@markPrice") != std::string::npos) {
+                handleMarkPrice(j["data"]);
             }
         }
         // Handle user data stream
@@ -208,64 +188,194 @@ void BinanceWS::handleMessage(const std::string& message) {
     }
 }
 
-void BinanceWS::handleTicker(const nlohmann::json& data) {
+bool BinanceWS::handleMessageLazy(std::string_view message) {
+    JsonView j(message);
+    JsonView stream = j["stream"];
+    if (!stream.isString()) {
+        return false;
+    }
+    std::string_view name = stream.stringView();
+    JsonView data = j["data"];
+    if (name.find("@ticker") != std::string_view::npos) {
+        handleTicker(data);
+    } else if (name.find("@depth") != std::string_view::npos) {
+        handleOrderBook(data);
+    } else if (name.find("@trade") != std::string_view::npos) {
+        handleTrade(data);
+    } else if (name.find("@kline") != std::string_view::npos) {
+        handleOHLCV(data);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+std::string BinanceWS::streamName(const std::string& symbol, std::string_view channel) const {
+    // Shares the registry snapshot rather than copying the Market out of it
+    auto market = exchange_.marketBySymbol(symbol);
+    if (!market) {
+        throw BadSymbol("Market '" + symbol + "' does not exist");
+    }
+    std::string stream = boost::algorithm::to_lower_copy(market->id);
+    stream += channel;
+    return stream;
+}
+
+std::string BinanceWS::resolveSymbol(std::string_view marketId) const {
+    auto market = exchange_.marketById(marketId);
+    return market ? market->symbol : std::string(marketId);
+}
+
+namespace {
+
+template <typename Json>
+std::string_view stringOf(const Json& value) {
+    const auto& text = value.template get_ref<const typename Json::string_t&>();
+    return std::string_view(text.data(), text.size());
+}
+
+} // namespace
+
+template <typename Json>
+bool BinanceWS::handleMarketData(const Json& message) {
+    auto stream = message.find("stream");
+    if (stream == message.end() || !stream->is_string()) {
+        return false;
+    }
+    std::string_view name = stringOf(*stream);
+    const Json& data = message.at("data");
+    if (name.find("@ticker") != std::string_view::npos) {
+        handleTicker(data);
+    } else if (name.find("@depth") != std::string_view::npos) {
+        handleOrderBook(data);
+    } else if (name.find("@trade") != std::string_view::npos) {
+        handleTrade(data);
+    } else if (name.find("@kline") != std::string_view::npos) {
+        handleOHLCV(data);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+template <typename Json>
+void BinanceWS::handleTicker(const Json& data) {
     Ticker ticker;
-    ticker.symbol = data["s"].get<std::string>();
-    ticker.high = std::stod(data["h"].get<std::string>());
-    ticker.low = std::stod(data["l"].get<std::string>());
-    ticker.bid = std::stod(data["b"].get<std::string>());
-    ticker.ask = std::stod(data["a"].get<std::string>());
-    ticker.last = std::stod(data["c"].get<std::string>());
-    ticker.volume = std::stod(data["v"].get<std::string>());
-    ticker.timestamp = data["E"].get<uint64_t>();
+    ticker.symbol = resolveSymbol(stringOf(data["s"]));
+    ticker.high = jsonDouble(data["h"]);
+    ticker.low = jsonDouble(data["l"]);
+    ticker.bid = jsonDouble(data["b"]);
+    ticker.ask = jsonDouble(data["a"]);
+    ticker.last = jsonDouble(data["c"]);
+    ticker.volume = jsonDouble(data["v"]);
+    ticker.timestamp = data["E"].template get<uint64_t>();
 
     //exchange_.emitTicker(ticker);
 }
 
-void BinanceWS::handleOrderBook(const nlohmann::json& data) {
+template <typename Json>
+void BinanceWS::handleOrderBook(const Json& data) {
     OrderBook orderBook;
-    orderBook.symbol = data["s"].get<std::string>();
-    orderBook.timestamp = data["E"].get<uint64_t>();
+    orderBook.symbol = resolveSymbol(stringOf(data["s"]));
+    orderBook.timestamp = data["E"].template get<uint64_t>();
 
     // Process bids
     for (const auto& bid : data["b"]) {
-        double price = std::stod(bid[0].get<std::string>());
-        double amount = std::stod(bid[1].get<std::string>());
-        orderBook.bids.emplace_back(price, amount);
+        double price = jsonDouble(bid[0]);
+        double amount = jsonDouble(bid[1]);
+        orderBook.bids.push_back({price, amount});
     }
 
     // Process asks
     for (const auto& ask : data["a"]) {
-        double price = std::stod(ask[0].get<std::string>());
-        double amount = std::stod(ask[1].get<std::string>());
-        orderBook.asks.emplace_back(price, amount);
+        double price = jsonDouble(ask[0]);
+        double amount = jsonDouble(ask[1]);
+        orderBook.asks.push_back({price, amount});
     }
 
     //exchange_.emitOrderBook(orderBook);
 }
 
-void BinanceWS::handleTrade(const nlohmann::json& data) {
+template <typename Json>
+void BinanceWS::handleTrade(const Json& data) {
     Trade trade;
-    trade.symbol = data["s"].get<std::string>();
-    trade.id = data["t"].get<std::string>();
-    trade.price = std::stod(data["p"].get<std::string>());
-    trade.amount = std::stod(data["q"].get<std::string>());
-    trade.timestamp = data["E"].get<uint64_t>();
-    trade.side = data["m"].get<bool>() ? "sell" : "buy";
+    trade.symbol = resolveSymbol(stringOf(data["s"]));
+    // Trade ids arrive as numbers
+    trade.id = data["t"].is_string() ? std::string(stringOf(data["t"])) : std::to_string(data["t"].template get<uint64_t>());
+    trade.price = jsonDouble(data["p"]);
+    trade.amount = jsonDouble(data["q"]);
+    trade.timestamp = data["E"].template get<uint64_t>();
+    trade.side = data["m"].template get<bool>() ? "sell" : "buy";
 
     //exchange_.emitTrade(trade);
 }
 
-void BinanceWS::handleOHLCV(const nlohmann::json& data) {
+template <typename Json>
+void BinanceWS::handleOHLCV(const Json& data) {
     OHLCV ohlcv;
     const auto& k = data["k"];
     
-    ohlcv.timestamp = k["t"].get<uint64_t>();
-    ohlcv.open = std::stod(k["o"].get<std::string>());
-    ohlcv.high = std::stod(k["h"].get<std::string>());
-    ohlcv.low = std::stod(k["l"].get<std::string>());
-    ohlcv.close = std::stod(k["c"].get<std::string>());
-    ohlcv.volume = std::stod(k["v"].get<std::string>());
+    ohlcv.timestamp = k["t"].template get<uint64_t>();
+    ohlcv.open = jsonDouble(k["o"]);
+    ohlcv.high = jsonDouble(k["h"]);
+    ohlcv.low = jsonDouble(k["l"]);
+    ohlcv.close = jsonDouble(k["c"]);
+    ohlcv.volume = jsonDouble(k["v"]);
+
+    //exchange_.emitOHLCV(ohlcv);
+}
+
+void BinanceWS::handleTicker(const JsonView& data) {
+    Ticker ticker;
+    ticker.symbol = resolveSymbol(data["s"].stringView());
+    ticker.high = data["h"].number();
+    ticker.low = data["l"].number();
+    ticker.bid = data["b"].number();
+    ticker.ask = data["a"].number();
+    ticker.last = data["c"].number();
+    ticker.volume = data["v"].number();
+    ticker.timestamp = data["E"].integer();
+
+    //exchange_.emitTicker(ticker);
+}
+
+void BinanceWS::handleOrderBook(const JsonView& data) {
+    OrderBook orderBook;
+    orderBook.symbol = resolveSymbol(data["s"].stringView());
+    orderBook.timestamp = data["E"].integer();
+
+    data["b"].forEach([&](const JsonView& bid) {
+        orderBook.bids.push_back({bid[0].number(), bid[1].number()});
+    });
+    data["a"].forEach([&](const JsonView& ask) {
+        orderBook.asks.push_back({ask[0].number(), ask[1].number()});
+    });
+
+    //exchange_.emitOrderBook(orderBook);
+}
+
+void BinanceWS::handleTrade(const JsonView& data) {
+    Trade trade;
+    trade.symbol = resolveSymbol(data["s"].stringView());
+    trade.id = data["t"].isString() ? data["t"].string() : std::string(data["t"].raw());
+    trade.price = data["p"].number();
+    trade.amount = data["q"].number();
+    trade.timestamp = data["E"].integer();
+    trade.side = data["m"].boolean() ? "sell" : "buy";
+
+    //exchange_.emitTrade(trade);
+}
+
+void BinanceWS::handleOHLCV(const JsonView& data) {
+    OHLCV ohlcv;
+    JsonView k = data["k"];
+
+    ohlcv.timestamp = k["t"].integer();
+    ohlcv.open = k["o"].number();
+    ohlcv.high = k["h"].number();
+    ohlcv.low = k["l"].number();
+    ohlcv.close = k["c"].number();
+    ohlcv.volume = k["v"].number();
 
     //exchange_.emitOHLCV(ohlcv);
 }
@@ -274,9 +384,9 @@ void BinanceWS::handleMarkPrice(const nlohmann::json& data) {
     try {
         MarkPrice markPrice;
         markPrice.symbol = data["s"].get<std::string>();
-        markPrice.markPrice = std::stod(data["p"].get<std::string>());
+        markPrice.markPrice = jsonDouble(data["p"]);
         markPrice.timestamp = data["E"].get<uint64_t>();
-        markPrice.fundingRate = data.contains("r") ? std::stod(data["r"].get<std::string>()) : 0.0;
+        markPrice.fundingRate = data.contains("r") ? jsonDouble(data["r"]) : 0.0;
         markPrice.nextFundingTime = data.contains("T") ? data["T"].get<uint64_t>() : 0;
 
         //exchange_.emitMarkPrice(markPrice);
@@ -289,8 +399,8 @@ void BinanceWS::handleBalance(const nlohmann::json& data) {
     try {
         Balance balance;
         balance.currency = data["a"].get<std::string>();
-        balance.free = std::stod(data["f"].get<std::string>());
-        balance.used = std::stod(data["l"].get<std::string>());
+        balance.free = jsonDouble(data["f"]);
+        balance.used = jsonDouble(data["l"]);
         balance.total = balance.free + balance.used;
         balance.timestamp = data["E"].get<uint64_t>();
 
@@ -308,9 +418,9 @@ void BinanceWS::handleOrder(const nlohmann::json& data) {
         order.symbol = data["s"].get<std::string>();
         order.side = data["S"].get<std::string>();
         order.type = data["o"].get<std::string>();
-        order.price = std::stod(data["p"].get<std::string>());
-        order.amount = std::stod(data["q"].get<std::string>());
-        order.filled = std::stod(data["z"].get<std::string>());
+        order.price = jsonDouble(data["p"]);
+        order.amount = jsonDouble(data["q"]);
+        order.filled = jsonDouble(data["z"]);
         order.remaining = order.amount - order.filled;
         order.status = data["X"].get<std::string>();
         order.timestamp = data["E"].get<uint64_t>();
@@ -326,12 +436,12 @@ void BinanceWS::handleMyTrade(const nlohmann::json& data) {
         Trade trade;
         trade.id = data["t"].get<std::string>();
         trade.orderId = data["i"].get<std::string>();
-        trade.symbol = data["s"].get<std::string>();
+        trade.symbol = resolveSymbol(data["s"].get_ref<const std::string&>());
         trade.side = data["S"].get<std::string>();
-        trade.price = std::stod(data["p"].get<std::string>());
-        trade.amount = std::stod(data["q"].get<std::string>());
+        trade.price = jsonDouble(data["p"]);
+        trade.amount = jsonDouble(data["q"]);
         trade.cost = trade.price * trade.amount;
-        trade.fee = std::stod(data["n"].get<std::string>());
+        trade.fee = jsonDouble(data["n"]);
         trade.feeCurrency = data["N"].get<std::string>();
         trade.timestamp = data["E"].get<uint64_t>();
 
@@ -346,10 +456,10 @@ void BinanceWS::handlePosition(const nlohmann::json& data) {
         Position position;
         position.symbol = data["s"].get<std::string>();
         position.side = data["ps"].get<std::string>();
-        position.amount = std::stod(data["pa"].get<std::string>());
-        position.entryPrice = std::stod(data["ep"].get<std::string>());
-        position.unrealizedPnl = std::stod(data["up"].get<std::string>());
-        position.leverage = std::stod(data["l"].get<std::string>());
+        position.amount = jsonDouble(data["pa"]);
+        position.entryPrice = jsonDouble(data["ep"]);
+        position.unrealizedPnl = jsonDouble(data["up"]);
+        position.leverage = jsonDouble(data["l"]);
         position.marginType = data["mt"].get<std::string>();
         position.timestamp = data["E"].get<uint64_t>();
 
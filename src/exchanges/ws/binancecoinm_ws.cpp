@@ -2,14 +2,14 @@
 #include <iostream>
 #include <sstream>
 #include <chrono>
-#include <thread>
 #include <openssl/hmac.h>
 #include <iomanip>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
 BinanceCoinMWS::BinanceCoinMWS(boost::asio::io_context& ioc, boost::asio::ssl::context& ctx, BinanceCoinM& exchange)
-    : WebSocketClient(ioc, ctx), exchange_(exchange), authenticated_(false), lastPingTimestamp_(0), pingInterval_(3000) {
+    : WebSocketClient(ioc, ctx), exchange_(exchange), authenticated_(false), listenKeyTimer_(ioc) {
     apiKey_ = exchange_.apiKey;
     apiSecret_ = exchange_.secret;
 }
@@ -51,16 +51,16 @@ void BinanceCoinMWS::listenKey() {
 }
 
 void BinanceCoinMWS::startListenKeyTimer() {
-    std::thread([this]() {
-        while (true) {
-            std::this_thread::sleep_for(std::chrono::minutes(30));
-            // Extend listenKey validity
-            nlohmann::json params = {
-                {"timestamp", exchange_.milliseconds()}
-            };
-            sign("/dapi/v1/listenKey", "PUT", params);
-        }
-    }).detach();
+    listenKeyTimer_.expires_after(std::chrono::minutes(30));
+    listenKeyTimer_.async_wait([this](boost::system::error_code ec) {
+        if (ec) return;
+        // Extend listenKey validity
+        nlohmann::json params = {
+            {"timestamp", exchange_.milliseconds()}
+        };
+        sign("/dapi/v1/listenKey", "PUT", params);
+        startListenKeyTimer();
+    });
 }
 
 void BinanceCoinMWS::authenticate() {
@@ -98,20 +98,6 @@ void BinanceCoinMWS::unsubscribe(const std::string& channel, const std::string&
     send(request.dump());
 }
 
-void BinanceCoinMWS::ping() {
-    nlohmann::json ping = {{"op", "ping"}};
-    send(ping.dump());
-}
-
-void BinanceCoinMWS::startPingLoop() {
-    std::thread([this]() {
-        while (true) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(pingInterval_));
-            ping();
-        }
-    }).detach();
-}
-
 std::string BinanceCoinMWS::getSymbol(const std::string& market) const {
     return market;  // Implement proper symbol conversion if needed
 }
@@ -167,7 +153,7 @@ void BinanceCoinMWS::watchPositions(const std::string& symbol) {
     subscribe(listenKey_);
 }
 
-void BinanceCoinMWS::handleMessage(const std::string& message) {
+void BinanceCoinMWS::handleMessage(std::string_view message) {
     try {
         auto j = nlohmann::json::parse(message);
 
@@ -205,22 +191,22 @@ void BinanceCoinMWS::handleTicker(const nlohmann::json& data) {
         {"symbol", data["s"]},
         {"timestamp", data["E"]},
         {"datetime", exchange_.iso8601(data["E"])},
-        {"high", std::stod(data["h"])},
-        {"low", std::stod(data["l"])},
-        {"bid", std::stod(data["b"])},
-        {"bidVolume", std::stod(data["B"])},
-        {"ask", std::stod(data["a"])},
-        {"askVolume", std::stod(data["A"])},
-        {"vwap", std::stod(data["w"])},
-        {"open", std::stod(data["o"])},
-        {"close", std::stod(data["c"])},
-        {"last", std::stod(data["c"])},
-        {"previousClose", std::stod(data["x"])},
-        {"change", std::stod(data["p"])},
-        {"percentage", std::stod(data["P"])},
+        {"high", jsonDouble(data["h"])},
+        {"low", jsonDouble(data["l"])},
+        {"bid", jsonDouble(data["b"])},
+        {"bidVolume", jsonDouble(data["B"])},
+        {"ask", jsonDouble(data["a"])},
+        {"askVolume", jsonDouble(data["A"])},
+        {"vwap", jsonDouble(data["w"])},
+        {"open", jsonDouble(data["o"])},
+        {"close", jsonDouble(data["c"])},
+        {"last", jsonDouble(data["c"])},
+        {"previousClose", jsonDouble(data["x"])},
+        {"change", jsonDouble(data["p"])},
+        {"percentage", jsonDouble(data["P"])},
         {"average", nullptr},
-        {"baseVolume", std::stod(data["v"])},
-        {"quoteVolume", std::stod(data["q"])},
+        {"baseVolume", jsonDouble(data["v"])},
+        {"quoteVolume", jsonDouble(data["q"])},
         {"info", data}
     };
     emit("ticker", parsedTicker);
@@ -232,15 +218,15 @@ void BinanceCoinMWS::handleOrderBook(const nlohmann::json& data, bool isSnapshot
 
     for (const auto& bid : data["b"]) {
         bids.push_back({
-            std::stod(bid[0]),  // price
-            std::stod(bid[1])   // amount
+            jsonDouble(bid[0]),  // price
+            jsonDouble(bid[1])   // amount
         });
     }
 
     for (const auto& ask : data["a"]) {
         asks.push_back({
-            std::stod(ask[0]),  // price
-            std::stod(ask[1])   // amount
+            jsonDouble(ask[0]),  // price
+            jsonDouble(ask[1])   // amount
         });
     }
 
@@ -267,9 +253,9 @@ void BinanceCoinMWS::handleTrade(const nlohmann::json& data) {
         {"symbol", data["s"]},
         {"type", nullptr},
         {"side", data["m"] ? "sell" : "buy"},
-        {"price", std::stod(data["p"])},
-        {"amount", std::stod(data["q"])},
-        {"cost", std::stod(data["p"]) * std::stod(data["q"])}
+        {"price", jsonDouble(data["p"])},
+        {"amount", jsonDouble(data["q"])},
+        {"cost", jsonDouble(data["p"]) * jsonDouble(data["q"])}
     };
     emit("trade", parsedTrade);
 }
@@ -278,11 +264,11 @@ void BinanceCoinMWS::handleOHLCV(const nlohmann::json& data) {
     auto k = data["k"];
     nlohmann::json parsedCandle = {
         k["t"],                     // timestamp
-        std::stod(k["o"]),         // open
-        std::stod(k["h"]),         // high
-        std::stod(k["l"]),         // low
-        std::stod(k["c"]),         // close
-        std::stod(k["v"])          // volume
+        jsonDouble(k["o"]),         // open
+        jsonDouble(k["h"]),         // high
+        jsonDouble(k["l"]),         // low
+        jsonDouble(k["c"]),         // close
+        jsonDouble(k["v"])          // volume
     };
     emit("ohlcv", parsedCandle);
 }
@@ -292,9 +278,9 @@ void BinanceCoinMWS::handleMarkPrice(const nlohmann::json& data) {
         {"symbol", data["s"]},
         {"timestamp", data["E"]},
         {"datetime", exchange_.iso8601(data["E"])},
-        {"markPrice", std::stod(data["p"])},
-        {"indexPrice", std::stod(data["i"])},
-        {"fundingRate", std::stod(data["r"])},
+        {"markPrice", jsonDouble(data["p"])},
+        {"indexPrice", jsonDouble(data["i"])},
+        {"fundingRate", jsonDouble(data["r"])},
         {"fundingTime", data["T"]},
         {"info", data}
     };
@@ -307,8 +293,8 @@ void BinanceCoinMWS::handleLiquidation(const nlohmann::json& data) {
         {"symbol", o["s"]},
         {"timestamp", data["E"]},
         {"datetime", exchange_.iso8601(data["E"])},
-        {"price", std::stod(o["p"])},
-        {"amount", std::stod(o["q"])},
+        {"price", jsonDouble(o["p"])},
+        {"amount", jsonDouble(o["q"])},
         {"side", o["S"].get<std::string>() == "BUY" ? "buy" : "sell"},
         {"type", "liquidation"},
         {"info", data}
@@ -324,9 +310,9 @@ void BinanceCoinMWS::handleAccountUpdate(const nlohmann::json& data) {
         for (const auto& balance : a["B"]) {
             nlohmann::json parsedBalance = {
                 {"currency", balance["a"]},
-                {"free", std::stod(balance["wb"])},
-                {"used", std::stod(balance["cw"])},
-                {"total", std::stod(balance["wb"]) + std::stod(balance["cw"])},
+                {"free", jsonDouble(balance["wb"])},
+                {"used", jsonDouble(balance["cw"])},
+                {"total", jsonDouble(balance["wb"]) + jsonDouble(balance["cw"])},
                 {"info", balance}
             };
             emit("balance", parsedBalance);
@@ -344,10 +330,10 @@ void BinanceCoinMWS::handleAccountUpdate(const nlohmann::json& data) {
                 {"long", position["ps"] == "LONG"},
                 {"short", position["ps"] == "SHORT"},
                 {"side", position["ps"]},
-                {"quantity", std::stod(position["pa"])},
-                {"unrealizedPnl", std::stod(position["up"])},
-                {"leverage", std::stod(position["l"])},
-                {"entryPrice", std::stod(position["ep"])}
+                {"quantity", jsonDouble(position["pa"])},
+                {"unrealizedPnl", jsonDouble(position["up"])},
+                {"leverage", jsonDouble(position["l"])},
+                {"entryPrice", jsonDouble(position["ep"])}
             };
             emit("position", parsedPosition);
         }
@@ -386,14 +372,14 @@ void BinanceCoinMWS::handleOrder(const nlohmann::json& data) {
         {"symbol", o["s"]},
         {"type", o["o"]},
         {"side", o["S"].get<std::string>() == "BUY" ? "buy" : "sell"},
-        {"price", std::stod(o["p"])},
-        {"amount", std::stod(o["q"])},
-        {"filled", std::stod(o["z"])},
-        {"remaining", std::stod(o["q"]) - std::stod(o["z"])},
-        {"cost", std::stod(o["z"]) * std::stod(o["ap"])},
-        {"average", std::stod(o["ap"])},
+        {"price", jsonDouble(o["p"])},
+        {"amount", jsonDouble(o["q"])},
+        {"filled", jsonDouble(o["z"])},
+        {"remaining", jsonDouble(o["q"]) - jsonDouble(o["z"])},
+        {"cost", jsonDouble(o["z"]) * jsonDouble(o["ap"])},
+        {"average", jsonDouble(o["ap"])},
         {"fee", {
-            {"cost", std::stod(o["n"])},
+            {"cost", jsonDouble(o["n"])},
             {"currency", o["N"]}
         }}
     };
@@ -410,11 +396,11 @@ void BinanceCoinMWS::handleMyTrade(const nlohmann::json& data) {
         {"symbol", data["s"]},
         {"type", data["o"]},
         {"side", data["S"].get<std::string>() == "BUY" ? "buy" : "sell"},
-        {"price", std::stod(data["L"])},
-        {"amount", std::stod(data["q"])},
-        {"cost", std::stod(data["L"]) * std::stod(data["q"])},
+        {"price", jsonDouble(data["L"])},
+        {"amount", jsonDouble(data["q"])},
+        {"cost", jsonDouble(data["L"]) * jsonDouble(data["q"])},
         {"fee", {
-            {"cost", std::stod(data["n"])},
+            {"cost", jsonDouble(data["n"])},
             {"currency", data["N"]}
         }}
     };
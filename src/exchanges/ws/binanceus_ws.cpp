@@ -2,14 +2,14 @@
 #include <iostream>
 #include <sstream>
 #include <chrono>
-#include <thread>
 #include <openssl/hmac.h>
 #include <iomanip>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
 BinanceUSWS::BinanceUSWS(boost::asio::io_context& ioc, boost::asio::ssl::context& ctx, BinanceUS& exchange)
-    : WebSocketClient(ioc, ctx), exchange_(exchange), authenticated_(false), lastPingTimestamp_(0), pingInterval_(3000) {
+    : WebSocketClient(ioc, ctx), exchange_(exchange), authenticated_(false), listenKeyTimer_(ioc) {
     apiKey_ = exchange_.apiKey;
     apiSecret_ = exchange_.secret;
 }
@@ -48,16 +48,16 @@ void BinanceUSWS::listenKey() {
 }
 
 void BinanceUSWS::startListenKeyTimer() {
-    std::thread([this]() {
-        while (true) {
-            std::this_thread::sleep_for(std::chrono::minutes(30));
-            // Extend listenKey validity
-            nlohmann::json params = {
-                {"timestamp", exchange_.milliseconds()}
-            };
-            sign("/api/v3/userDataStream", "PUT", params);
-        }
-    }).detach();
+    listenKeyTimer_.expires_after(std::chrono::minutes(30));
+    listenKeyTimer_.async_wait([this](boost::system::error_code ec) {
+        if (ec) return;
+        // Extend listenKey validity
+        nlohmann::json params = {
+            {"timestamp", exchange_.milliseconds()}
+        };
+        sign("/api/v3/userDataStream", "PUT", params);
+        startListenKeyTimer();
+    });
 }
 
 void BinanceUSWS::authenticate() {
@@ -95,20 +95,6 @@ void BinanceUSWS::unsubscribe(const std::string& channel, const std::string& sym
     send(request.dump());
 }
 
-void BinanceUSWS::ping() {
-    nlohmann::json ping = {{"op", "ping"}};
-    send(ping.dump());
-}
-
-void BinanceUSWS::startPingLoop() {
-    std::thread([this]() {
-        while (true) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(pingInterval_));
-            ping();
-        }
-    }).detach();
-}
-
 std::string BinanceUSWS::getSymbol(const std::string& market) const {
     return market;  // Implement proper symbol conversion if needed
 }
@@ -155,7 +141,7 @@ void BinanceUSWS::watchMyTrades(const std::string& symbol) {
     subscribe(listenKey_);
 }
 
-void BinanceUSWS::handleMessage(const std::string& message) {
+void BinanceUSWS::handleMessage(std::string_view message) {
     try {
         auto j = nlohmann::json::parse(message);
 
@@ -189,22 +175,22 @@ void BinanceUSWS::handleTicker(const nlohmann::json& data) {
         {"symbol", data["s"]},
         {"timestamp", data["E"]},
         {"datetime", exchange_.iso8601(data["E"])},
-        {"high", std::stod(data["h"])},
-        {"low", std::stod(data["l"])},
-        {"bid", std::stod(data["b"])},
-        {"bidVolume", std::stod(data["B"])},
-        {"ask", std::stod(data["a"])},
-        {"askVolume", std::stod(data["A"])},
-        {"vwap", std::stod(data["w"])},
-        {"open", std::stod(data["o"])},
-        {"close", std::stod(data["c"])},
-        {"last", std::stod(data["c"])},
-        {"previousClose", std::stod(data["x"])},
-        {"change", std::stod(data["p"])},
-        {"percentage", std::stod(data["P"])},
+        {"high", jsonDouble(data["h"])},
+        {"low", jsonDouble(data["l"])},
+        {"bid", jsonDouble(data["b"])},
+        {"bidVolume", jsonDouble(data["B"])},
+        {"ask", jsonDouble(data["a"])},
+        {"askVolume", jsonDouble(data["A"])},
+        {"vwap", jsonDouble(data["w"])},
+        {"open", jsonDouble(data["o"])},
+        {"close", jsonDouble(data["c"])},
+        {"last", jsonDouble(data["c"])},
+        {"previousClose", jsonDouble(data["x"])},
+        {"change", jsonDouble(data["p"])},
+        {"percentage", jsonDouble(data["P"])},
         {"average", nullptr},
-        {"baseVolume", std::stod(data["v"])},
-        {"quoteVolume", std::stod(data["q"])},
+        {"baseVolume", jsonDouble(data["v"])},
+        {"quoteVolume", jsonDouble(data["q"])},
         {"info", data}
     };
     emit("ticker", parsedTicker);
@@ -216,15 +202,15 @@ void BinanceUSWS::handleOrderBook(const nlohmann::json& data, bool isSnapshot) {
 
     for (const auto& bid : data["b"]) {
         bids.push_back({
-            std::stod(bid[0]),  // price
-            std::stod(bid[1])   // amount
+            jsonDouble(bid[0]),  // price
+            jsonDouble(bid[1])   // amount
         });
     }
 
     for (const auto& ask : data["a"]) {
         asks.push_back({
-            std::stod(ask[0]),  // price
-            std::stod(ask[1])   // amount
+            jsonDouble(ask[0]),  // price
+            jsonDouble(ask[1])   // amount
         });
     }
 
@@ -251,9 +237,9 @@ void BinanceUSWS::handleTrade(const nlohmann::json& data) {
         {"symbol", data["s"]},
         {"type", nullptr},
         {"side", data["m"] ? "sell" : "buy"},
-        {"price", std::stod(data["p"])},
-        {"amount", std::stod(data["q"])},
-        {"cost", std::stod(data["p"]) * std::stod(data["q"])}
+        {"price", jsonDouble(data["p"])},
+        {"amount", jsonDouble(data["q"])},
+        {"cost", jsonDouble(data["p"]) * jsonDouble(data["q"])}
     };
     emit("trade", parsedTrade);
 }
@@ -262,11 +248,11 @@ void BinanceUSWS::handleOHLCV(const nlohmann::json& data) {
     auto k = data["k"];
     nlohmann::json parsedCandle = {
         k["t"],                     // timestamp
-        std::stod(k["o"]),         // open
-        std::stod(k["h"]),         // high
-        std::stod(k["l"]),         // low
-        std::stod(k["c"]),         // close
-        std::stod(k["v"])          // volume
+        jsonDouble(k["o"]),         // open
+        jsonDouble(k["h"]),         // high
+        jsonDouble(k["l"]),         // low
+        jsonDouble(k["c"]),         // close
+        jsonDouble(k["v"])          // volume
     };
     emit("ohlcv", parsedCandle);
 }
@@ -275,9 +261,9 @@ void BinanceUSWS::handleOutboundAccountInfo(const nlohmann::json& data) {
     for (const auto& balance : data["B"]) {
         nlohmann::json parsedBalance = {
             {"currency", balance["a"]},
-            {"free", std::stod(balance["f"])},
-            {"used", std::stod(balance["l"])},
-            {"total", std::stod(balance["f"]) + std::stod(balance["l"])},
+            {"free", jsonDouble(balance["f"])},
+            {"used", jsonDouble(balance["l"])},
+            {"total", jsonDouble(balance["f"]) + jsonDouble(balance["l"])},
             {"info", balance}
         };
         emit("balance", parsedBalance);
@@ -317,14 +303,14 @@ void BinanceUSWS::handleExecutionReport(const nlohmann::json& data) {
         {"symbol", data["s"]},
         {"type", data["o"]},
         {"side", data["S"].get<std::string>() == "BUY" ? "buy" : "sell"},
-        {"price", std::stod(data["p"])},
-        {"amount", std::stod(data["q"])},
-        {"filled", std::stod(data["z"])},
-        {"remaining", std::stod(data["q"]) - std::stod(data["z"])},
-        {"cost", std::stod(data["z"]) * std::stod(data["L"])},
-        {"average", std::stod(data["L"])},
+        {"price", jsonDouble(data["p"])},
+        {"amount", jsonDouble(data["q"])},
+        {"filled", jsonDouble(data["z"])},
+        {"remaining", jsonDouble(data["q"]) - jsonDouble(data["z"])},
+        {"cost", jsonDouble(data["z"]) * jsonDouble(data["L"])},
+        {"average", jsonDouble(data["L"])},
         {"fee", {
-            {"cost", std::stod(data["n"])},
+            {"cost", jsonDouble(data["n"])},
             {"currency", data["N"]}
         }}
     };
@@ -341,11 +327,11 @@ void BinanceUSWS::handleExecutionReport(const nlohmann::json& data) {
             {"symbol", data["s"]},
             {"type", data["o"]},
             {"side", data["S"].get<std::string>() == "BUY" ? "buy" : "sell"},
-            {"price", std::stod(data["L"])},
-            {"amount", std::stod(data["l"])},
-            {"cost", std::stod(data["L"]) * std::stod(data["l"])},
+            {"price", jsonDouble(data["L"])},
+            {"amount", jsonDouble(data["l"])},
+            {"cost", jsonDouble(data["L"]) * jsonDouble(data["l"])},
             {"fee", {
-                {"cost", std::stod(data["n"])},
+                {"cost", jsonDouble(data["n"])},
                 {"currency", data["N"]}
             }}
         };
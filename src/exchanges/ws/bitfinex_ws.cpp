@@ -3,7 +3,9 @@
 #include <iostream>
 #include <sstream>
 #include <chrono>
+#include <algorithm>
 #include <openssl/hmac.h>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -68,7 +70,41 @@ void BitfinexWS::subscribe(const std::string& channel, const std::string& symbol
         }
     }
     
-    send(request.dump());
+    std::string frame = request.dump();
+    std::string key = channel + ":" + market.id;
+    if (params.contains("prec")) {
+        key += ":" + params["prec"].get<std::string>();
+    }
+    addSubscription(key, frame);
+    send(std::move(frame));
+}
+
+void BitfinexWS::subscribePrivate(const std::string& channel) {
+    nlohmann::json request = {
+        {"event", "subscribe"},
+        {"channel", channel}
+    };
+    std::string frame = request.dump();
+    {
+        std::lock_guard<std::mutex> lock(privateMutex_);
+        if (std::find(privateSubscriptions_.begin(), privateSubscriptions_.end(), frame) == privateSubscriptions_.end()) {
+            privateSubscriptions_.push_back(frame);
+        }
+    }
+    send(std::move(frame));
+}
+
+void BitfinexWS::handleDisconnect() {
+    channelMap_.clear();
+    authenticated_ = false;
+}
+
+void BitfinexWS::handleReconnect() {
+    std::lock_guard<std::mutex> lock(privateMutex_);
+    if (!privateSubscriptions_.empty()) {
+        resubscribeOnAuth_ = true;
+        authenticate();
+    }
 }
 
 void BitfinexWS::watchTicker(const std::string& symbol) {
@@ -94,12 +130,7 @@ void BitfinexWS::watchBalance() {
         authenticate();
     }
     
-    nlohmann::json request = {
-        {"event", "subscribe"},
-        {"channel", "wallet"}
-    };
-    
-    send(request.dump());
+    subscribePrivate("wallet");
 }
 
 void BitfinexWS::watchOrders() {
@@ -107,12 +138,7 @@ void BitfinexWS::watchOrders() {
         authenticate();
     }
     
-    nlohmann::json request = {
-        {"event", "subscribe"},
-        {"channel", "orders"}
-    };
-    
-    send(request.dump());
+    subscribePrivate("orders");
 }
 
 void BitfinexWS::watchMyTrades() {
@@ -120,12 +146,7 @@ void BitfinexWS::watchMyTrades() {
         authenticate();
     }
     
-    nlohmann::json request = {
-        {"event", "subscribe"},
-        {"channel", "trades"}
-    };
-    
-    send(request.dump());
+    subscribePrivate("trades");
 }
 
 void BitfinexWS::createOrder(const std::string& symbol, const std::string& type,
@@ -173,7 +194,7 @@ void BitfinexWS::cancelAllOrders() {
     send(request.dump());
 }
 
-void BitfinexWS::handleMessage(const std::string& message) {
+void BitfinexWS::handleMessage(std::string_view message) {
     try {
         auto j = nlohmann::json::parse(message);
         
@@ -186,6 +207,13 @@ void BitfinexWS::handleMessage(const std::string& message) {
                 } else if (event == "auth") {
                     if (j["status"] == "OK") {
                         authenticated_ = true;
+                        if (resubscribeOnAuth_) {
+                            resubscribeOnAuth_ = false;
+                            std::lock_guard<std::mutex> lock(privateMutex_);
+                            for (const auto& frame : privateSubscriptions_) {
+                                send(frame);
+                            }
+                        }
                         std::cout << "Successfully authenticated" << std::endl;
                     } else {
                         std::cerr << "Authentication failed: " << j["message"] << std::endl;
@@ -233,16 +261,16 @@ void BitfinexWS::handleTicker(int channelId, const nlohmann::json& data) {
         }
         
         Ticker ticker;
-        ticker.bid = std::stod(data[0].get<std::string>());
-        ticker.bidVolume = std::stod(data[1].get<std::string>());
-        ticker.ask = std::stod(data[2].get<std::string>());
-        ticker.askVolume = std::stod(data[3].get<std::string>());
-        ticker.dailyChange = std::stod(data[4].get<std::string>());
-        ticker.dailyChangePercentage = std::stod(data[5].get<std::string>());
-        ticker.last = std::stod(data[6].get<std::string>());
-        ticker.volume = std::stod(data[7].get<std::string>());
-        ticker.high = std::stod(data[8].get<std::string>());
-        ticker.low = std::stod(data[9].get<std::string>());
+        ticker.bid = jsonDouble(data[0]);
+        ticker.bidVolume = jsonDouble(data[1]);
+        ticker.ask = jsonDouble(data[2]);
+        ticker.askVolume = jsonDouble(data[3]);
+        ticker.dailyChange = jsonDouble(data[4]);
+        ticker.dailyChangePercentage = jsonDouble(data[5]);
+        ticker.last = jsonDouble(data[6]);
+        ticker.volume = jsonDouble(data[7]);
+        ticker.high = jsonDouble(data[8]);
+        ticker.low = jsonDouble(data[9]);
         ticker.timestamp = std::chrono::system_clock::now().time_since_epoch().count();
         
         exchange_.emitTicker(ticker);
@@ -258,9 +286,9 @@ void BitfinexWS::handleOrderBook(int channelId, const nlohmann::json& data) {
         if (data.is_array() && data[0].is_array()) {
             // Snapshot
             for (const auto& item : data) {
-                double price = std::stod(item[0].get<std::string>());
+                double price = jsonDouble(item[0]);
                 int count = item[1].get<int>();
-                double amount = std::stod(item[2].get<std::string>());
+                double amount = jsonDouble(item[2]);
                 
                 if (amount > 0) {
                     orderBook.bids.emplace_back(price, amount);
@@ -270,9 +298,9 @@ void BitfinexWS::handleOrderBook(int channelId, const nlohmann::json& data) {
             }
         } else {
             // Update
-            double price = std::stod(data[0].get<std::string>());
+            double price = jsonDouble(data[0]);
             int count = data[1].get<int>();
-            double amount = std::stod(data[2].get<std::string>());
+            double amount = jsonDouble(data[2]);
             
             if (count > 0) {
                 if (amount > 0) {
@@ -297,8 +325,8 @@ void BitfinexWS::handleTrade(int channelId, const nlohmann::json& data) {
             
             trade.id = std::to_string(tradeData[0].get<int64_t>());
             trade.timestamp = tradeData[1].get<int64_t>() * 1000;
-            trade.amount = std::stod(tradeData[2].get<std::string>());
-            trade.price = std::stod(tradeData[3].get<std::string>());
+            trade.amount = jsonDouble(tradeData[2]);
+            trade.price = jsonDouble(tradeData[3]);
             trade.side = trade.amount > 0 ? "buy" : "sell";
             trade.amount = std::abs(trade.amount);
             
@@ -316,8 +344,8 @@ void BitfinexWS::handleBalance(int channelId, const nlohmann::json& data) {
             
             Balance balance;
             balance.currency = balanceData[1].get<std::string>();
-            balance.total = std::stod(balanceData[2].get<std::string>());
-            balance.available = std::stod(balanceData[4].get<std::string>());
+            balance.total = jsonDouble(balanceData[2]);
+            balance.available = jsonDouble(balanceData[4]);
             balance.used = balance.total - balance.available;
             balance.timestamp = std::chrono::system_clock::now().time_since_epoch().count();
             
@@ -337,10 +365,10 @@ void BitfinexWS::handleOrder(int channelId, const nlohmann::json& data) {
             order.id = std::to_string(orderData[0].get<int64_t>());
             order.symbol = orderData[3].get<std::string>();
             order.timestamp = orderData[4].get<int64_t>() * 1000;
-            order.amount = std::stod(orderData[6].get<std::string>());
-            order.remaining = std::stod(orderData[7].get<std::string>());
+            order.amount = jsonDouble(orderData[6]);
+            order.remaining = jsonDouble(orderData[7]);
             order.filled = order.amount - order.remaining;
-            order.price = std::stod(orderData[16].get<std::string>());
+            order.price = jsonDouble(orderData[16]);
             order.status = order.remaining == 0 ? "closed" : "open";
             
             exchange_.emitOrder(order);
@@ -360,9 +388,9 @@ void BitfinexWS::handleMyTrade(int channelId, const nlohmann::json& data) {
             trade.orderId = std::to_string(tradeData[3].get<int64_t>());
             trade.timestamp = tradeData[2].get<int64_t>() * 1000;
             trade.symbol = tradeData[1].get<std::string>();
-            trade.amount = std::stod(tradeData[4].get<std::string>());
-            trade.price = std::stod(tradeData[5].get<std::string>());
-            trade.fee = std::stod(tradeData[9].get<std::string>());
+            trade.amount = jsonDouble(tradeData[4]);
+            trade.price = jsonDouble(tradeData[5]);
+            trade.fee = jsonDouble(tradeData[9]);
             trade.side = trade.amount > 0 ? "buy" : "sell";
             trade.amount = std::abs(trade.amount);
             
@@ -3,6 +3,7 @@
 #include <chrono>
 #include <sstream>
 #include <iomanip>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -338,14 +339,14 @@ void bitflyer_ws::initialize_order_book(const std::string& symbol) {
 void bitflyer_ws::update_order_book(const std::string& symbol, const json& delta) {
     json& orderbook = this->orderbooks[symbol];
     std::string side = delta["side"];
-    double price = std::stod(delta["price"].get<std::string>());
-    double amount = std::stod(delta["amount"].get<std::string>());
+    double price = jsonDouble(delta["price"]);
+    double amount = jsonDouble(delta["amount"]);
     
     auto& side_array = orderbook[side];
     bool found = false;
     
     for (auto it = side_array.begin(); it != side_array.end(); ++it) {
-        double entry_price = std::stod((*it)[0].get<std::string>());
+        double entry_price = jsonDouble((*it)[0]);
         if (entry_price == price) {
             if (amount == 0) {
                 side_array.erase(it);
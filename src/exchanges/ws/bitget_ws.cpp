@@ -4,6 +4,7 @@
 #include <sstream>
 #include <chrono>
 #include <boost/crc.hpp>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -140,7 +141,7 @@ void BitgetWS::unsubscribe(const std::string& channel, const std::string& instId
     send(request.dump());
 }
 
-void BitgetWS::handleMessage(const std::string& message) {
+void BitgetWS::handleMessage(std::string_view message) {
     try {
         auto j = nlohmann::json::parse(message);
         
@@ -209,22 +210,22 @@ void BitgetWS::handleTicker(const nlohmann::json& data) {
             {"symbol", ticker["instId"]},
             {"timestamp", std::stoll(ticker["ts"])},
             {"datetime", exchange_.iso8601(std::stoll(ticker["ts"]))},
-            {"high", std::stod(ticker["high24h"])},
-            {"low", std::stod(ticker["low24h"])},
-            {"bid", std::stod(ticker["bestBid"])},
-            {"bidVolume", std::stod(ticker["bidSz"])},
-            {"ask", std::stod(ticker["bestAsk"])},
-            {"askVolume", std::stod(ticker["askSz"])},
-            {"vwap", std::stod(ticker["vwap"])},
-            {"open", std::stod(ticker["open24h"])},
-            {"close", std::stod(ticker["last"])},
-            {"last", std::stod(ticker["last"])},
+            {"high", jsonDouble(ticker["high24h"])},
+            {"low", jsonDouble(ticker["low24h"])},
+            {"bid", jsonDouble(ticker["bestBid"])},
+            {"bidVolume", jsonDouble(ticker["bidSz"])},
+            {"ask", jsonDouble(ticker["bestAsk"])},
+            {"askVolume", jsonDouble(ticker["askSz"])},
+            {"vwap", jsonDouble(ticker["vwap"])},
+            {"open", jsonDouble(ticker["open24h"])},
+            {"close", jsonDouble(ticker["last"])},
+            {"last", jsonDouble(ticker["last"])},
             {"previousClose", nullptr},
-            {"change", std::stod(ticker["priceChange24h"])},
-            {"percentage", std::stod(ticker["priceChangePercent24h"])},
+            {"change", jsonDouble(ticker["priceChange24h"])},
+            {"percentage", jsonDouble(ticker["priceChangePercent24h"])},
             {"average", nullptr},
-            {"baseVolume", std::stod(ticker["baseVolume"])},
-            {"quoteVolume", std::stod(ticker["quoteVolume"])},
+            {"baseVolume", jsonDouble(ticker["baseVolume"])},
+            {"quoteVolume", jsonDouble(ticker["quoteVolume"])},
             {"info", ticker}
         };
         emit("ticker", parsedTicker);
@@ -241,8 +242,8 @@ void BitgetWS::handleOrderBook(const nlohmann::json& data) {
         if (book.contains("bids")) {
             for (const auto& bid : book["bids"]) {
                 bids.push_back({
-                    std::stod(bid[0]),  // price
-                    std::stod(bid[1])   // amount
+                    jsonDouble(bid[0]),  // price
+                    jsonDouble(bid[1])   // amount
                 });
             }
         }
@@ -250,8 +251,8 @@ void BitgetWS::handleOrderBook(const nlohmann::json& data) {
         if (book.contains("asks")) {
             for (const auto& ask : book["asks"]) {
                 asks.push_back({
-                    std::stod(ask[0]),  // price
-                    std::stod(ask[1])   // amount
+                    jsonDouble(ask[0]),  // price
+                    jsonDouble(ask[1])   // amount
                 });
             }
         }
@@ -281,9 +282,9 @@ void BitgetWS::handleTrade(const nlohmann::json& data) {
             {"symbol", trade["instId"]},
             {"type", nullptr},
             {"side", trade["side"]},
-            {"price", std::stod(trade["px"])},
-            {"amount", std::stod(trade["sz"])},
-            {"cost", std::stod(trade["px"]) * std::stod(trade["sz"])}
+            {"price", jsonDouble(trade["px"])},
+            {"amount", jsonDouble(trade["sz"])},
+            {"cost", jsonDouble(trade["px"]) * jsonDouble(trade["sz"])}
         };
         emit("trade", parsedTrade);
     }
@@ -293,11 +294,11 @@ void BitgetWS::handleOHLCV(const nlohmann::json& data) {
     for (const auto& candle : data) {
         nlohmann::json parsedCandle = {
             std::stoll(candle[0]),      // timestamp
-            std::stod(candle[1]),       // open
-            std::stod(candle[2]),       // high
-            std::stod(candle[3]),       // low
-            std::stod(candle[4]),       // close
-            std::stod(candle[5]),       // volume
+            jsonDouble(candle[1]),       // open
+            jsonDouble(candle[2]),       // high
+            jsonDouble(candle[3]),       // low
+            jsonDouble(candle[4]),       // close
+            jsonDouble(candle[5]),       // volume
         };
         emit("ohlcv", parsedCandle);
     }
@@ -309,10 +310,10 @@ void BitgetWS::handleBidsAsks(const nlohmann::json& data) {
             {"symbol", quote["instId"]},
             {"timestamp", std::stoll(quote["ts"])},
             {"datetime", exchange_.iso8601(std::stoll(quote["ts"]))},
-            {"bid", std::stod(quote["bid"])},
-            {"bidVolume", std::stod(quote["bidSz"])},
-            {"ask", std::stod(quote["ask"])},
-            {"askVolume", std::stod(quote["askSz"])},
+            {"bid", jsonDouble(quote["bid"])},
+            {"bidVolume", jsonDouble(quote["bidSz"])},
+            {"ask", jsonDouble(quote["ask"])},
+            {"askVolume", jsonDouble(quote["askSz"])},
             {"info", quote}
         };
         emit("bidsAsks", parsedQuote);
@@ -325,9 +326,9 @@ void BitgetWS::handleBalance(const nlohmann::json& data) {
             {"info", balance},
             {"type", balance["marginCoin"]},
             {"currency", balance["marginCoin"]},
-            {"total", std::stod(balance["equity"])},
-            {"used", std::stod(balance["locked"])},
-            {"free", std::stod(balance["available"])}
+            {"total", jsonDouble(balance["equity"])},
+            {"used", jsonDouble(balance["locked"])},
+            {"free", jsonDouble(balance["available"])}
         };
         emit("balance", parsedBalance);
     }
@@ -359,12 +360,12 @@ void BitgetWS::handleOrder(const nlohmann::json& data) {
             {"symbol", order["instId"]},
             {"type", order["ordType"]},
             {"side", order["side"]},
-            {"price", std::stod(order["px"])},
-            {"amount", std::stod(order["sz"])},
-            {"filled", std::stod(order["accFillSz"])},
-            {"remaining", std::stod(order["sz"]) - std::stod(order["accFillSz"])},
-            {"cost", std::stod(order["fillPx"]) * std::stod(order["accFillSz"])},
-            {"average", order.value("avgPx", "0") == "0" ? 0.0 : std::stod(order["avgPx"])},
+            {"price", jsonDouble(order["px"])},
+            {"amount", jsonDouble(order["sz"])},
+            {"filled", jsonDouble(order["accFillSz"])},
+            {"remaining", jsonDouble(order["sz"]) - jsonDouble(order["accFillSz"])},
+            {"cost", jsonDouble(order["fillPx"]) * jsonDouble(order["accFillSz"])},
+            {"average", order.value("avgPx", "0") == "0" ? 0.0 : jsonDouble(order["avgPx"])},
             {"fee", nullptr}  // Fee information not provided in order update
         };
         emit("order", parsedOrder);
@@ -382,11 +383,11 @@ void BitgetWS::handleMyTrade(const nlohmann::json& data) {
             {"symbol", trade["instId"]},
             {"type", trade["ordType"]},
             {"side", trade["side"]},
-            {"price", std::stod(trade["fillPx"])},
-            {"amount", std::stod(trade["fillSz"])},
-            {"cost", std::stod(trade["fillPx"]) * std::stod(trade["fillSz"])},
+            {"price", jsonDouble(trade["fillPx"])},
+            {"amount", jsonDouble(trade["fillSz"])},
+            {"cost", jsonDouble(trade["fillPx"]) * jsonDouble(trade["fillSz"])},
             {"fee", {
-                {"cost", std::stod(trade["fee"])},
+                {"cost", jsonDouble(trade["fee"])},
                 {"currency", trade["feeCcy"]}
             }}
         };
@@ -398,7 +399,7 @@ void BitgetWS::handlePosition(const nlohmann::json& data) {
     for (const auto& position : data) {
         std::string side = position["posSide"];
         if (side == "net") {
-            double pos = std::stod(position["pos"]);
+            double pos = jsonDouble(position["pos"]);
             side = (pos > 0) ? "long" : (pos < 0) ? "short" : "closed";
         }
 
@@ -408,19 +409,19 @@ void BitgetWS::handlePosition(const nlohmann::json& data) {
             {"timestamp", std::stoll(position["uTime"])},
             {"datetime", exchange_.iso8601(std::stoll(position["uTime"]))},
             {"side", side},
-            {"contracts", std::abs(std::stod(position["pos"]))},
-            {"contractSize", std::stod(position["contractSize"])},
-            {"entryPrice", std::stod(position["avgPx"])},
-            {"markPrice", std::stod(position["markPx"])},
-            {"notional", std::stod(position["notionalUsd"])},
-            {"leverage", std::stod(position["leverage"])},
-            {"collateral", std::stod(position["margin"])},
-            {"initialMargin", std::stod(position["imr"])},
-            {"maintenanceMargin", std::stod(position["mmr"])},
-            {"marginRatio", std::stod(position["mgnRatio"])},
-            {"percentage", std::stod(position["upl"])},
+            {"contracts", std::abs(jsonDouble(position["pos"]))},
+            {"contractSize", jsonDouble(position["contractSize"])},
+            {"entryPrice", jsonDouble(position["avgPx"])},
+            {"markPrice", jsonDouble(position["markPx"])},
+            {"notional", jsonDouble(position["notionalUsd"])},
+            {"leverage", jsonDouble(position["leverage"])},
+            {"collateral", jsonDouble(position["margin"])},
+            {"initialMargin", jsonDouble(position["imr"])},
+            {"maintenanceMargin", jsonDouble(position["mmr"])},
+            {"marginRatio", jsonDouble(position["mgnRatio"])},
+            {"percentage", jsonDouble(position["upl"])},
             {"marginMode", position["marginMode"]},
-            {"liquidationPrice", std::stod(position["liqPx"])}
+            {"liquidationPrice", jsonDouble(position["liqPx"])}
         };
         emit("position", parsedPosition);
     }
@@ -4,6 +4,7 @@
 #include <sstream>
 #include <chrono>
 #include <boost/crc.hpp>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -166,7 +167,7 @@ std::string BybitWS::sign(const std::string& payload) {
     return ss.str();
 }
 
-void BybitWS::handleMessage(const std::string& message) {
+void BybitWS::handleMessage(std::string_view message) {
     try {
         auto j = nlohmann::json::parse(message);
         
@@ -211,12 +212,12 @@ void BybitWS::handleMessage(const std::string& message) {
 void BybitWS::handleTicker(const nlohmann::json& data) {
     Ticker ticker;
     ticker.symbol = data["s"].get<std::string>();
-    ticker.high = std::stod(data["h"].get<std::string>());
-    ticker.low = std::stod(data["l"].get<std::string>());
-    ticker.bid = std::stod(data["b"].get<std::string>());
-    ticker.ask = std::stod(data["a"].get<std::string>());
-    ticker.last = std::stod(data["lp"].get<std::string>());
-    ticker.volume = std::stod(data["v"].get<std::string>());
+    ticker.high = jsonDouble(data["h"]);
+    ticker.low = jsonDouble(data["l"]);
+    ticker.bid = jsonDouble(data["b"]);
+    ticker.ask = jsonDouble(data["a"]);
+    ticker.last = jsonDouble(data["lp"]);
+    ticker.volume = jsonDouble(data["v"]);
     ticker.timestamp = data["t"].get<uint64_t>();
     
     exchange_.emitTicker(ticker);
@@ -232,15 +233,15 @@ void BybitWS::handleOrderBook(const nlohmann::json& data) {
     
     for (const auto& bid : bids) {
         orderBook.bids.emplace_back(
-            std::stod(bid[0].get<std::string>()),
-            std::stod(bid[1].get<std::string>())
+            jsonDouble(bid[0]),
+            jsonDouble(bid[1])
         );
     }
     
     for (const auto& ask : asks) {
         orderBook.asks.emplace_back(
-            std::stod(ask[0].get<std::string>()),
-            std::stod(ask[1].get<std::string>())
+            jsonDouble(ask[0]),
+            jsonDouble(ask[1])
         );
     }
     
@@ -251,8 +252,8 @@ void BybitWS::handleTrade(const nlohmann::json& data) {
     Trade trade;
     trade.symbol = data["s"].get<std::string>();
     trade.id = data["i"].get<std::string>();
-    trade.price = std::stod(data["p"].get<std::string>());
-    trade.amount = std::stod(data["v"].get<std::string>());
+    trade.price = jsonDouble(data["p"]);
+    trade.amount = jsonDouble(data["v"]);
     trade.side = data["S"].get<std::string>();
     trade.timestamp = data["t"].get<uint64_t>();
     
@@ -262,11 +263,11 @@ void BybitWS::handleTrade(const nlohmann::json& data) {
 void BybitWS::handleOHLCV(const nlohmann::json& data) {
     OHLCV ohlcv;
     ohlcv.timestamp = data["t"].get<uint64_t>();
-    ohlcv.open = std::stod(data["o"].get<std::string>());
-    ohlcv.high = std::stod(data["h"].get<std::string>());
-    ohlcv.low = std::stod(data["l"].get<std::string>());
-    ohlcv.close = std::stod(data["c"].get<std::string>());
-    ohlcv.volume = std::stod(data["v"].get<std::string>());
+    ohlcv.open = jsonDouble(data["o"]);
+    ohlcv.high = jsonDouble(data["h"]);
+    ohlcv.low = jsonDouble(data["l"]);
+    ohlcv.close = jsonDouble(data["c"]);
+    ohlcv.volume = jsonDouble(data["v"]);
     
     exchange_.emitOHLCV(ohlcv);
 }
@@ -275,8 +276,8 @@ void BybitWS::handleBalance(const nlohmann::json& data) {
     try {
         Balance balance;
         balance.currency = data["coin"].get<std::string>();
-        balance.free = std::stod(data["free"].get<std::string>());
-        balance.used = std::stod(data["locked"].get<std::string>());
+        balance.free = jsonDouble(data["free"]);
+        balance.used = jsonDouble(data["locked"]);
         balance.total = balance.free + balance.used;
         balance.timestamp = data["t"].get<uint64_t>();
         
@@ -293,9 +294,9 @@ void BybitWS::handleOrder(const nlohmann::json& data) {
         order.symbol = data["s"].get<std::string>();
         order.type = data["o"].get<std::string>();
         order.side = data["S"].get<std::string>();
-        order.price = std::stod(data["p"].get<std::string>());
-        order.amount = std::stod(data["q"].get<std::string>());
-        order.filled = std::stod(data["z"].get<std::string>());
+        order.price = jsonDouble(data["p"]);
+        order.amount = jsonDouble(data["q"]);
+        order.filled = jsonDouble(data["z"]);
         order.remaining = order.amount - order.filled;
         order.status = data["X"].get<std::string>();
         order.timestamp = data["t"].get<uint64_t>();
@@ -313,10 +314,10 @@ void BybitWS::handleMyTrade(const nlohmann::json& data) {
         trade.orderId = data["c"].get<std::string>();
         trade.symbol = data["s"].get<std::string>();
         trade.side = data["S"].get<std::string>();
-        trade.price = std::stod(data["p"].get<std::string>());
-        trade.amount = std::stod(data["q"].get<std::string>());
+        trade.price = jsonDouble(data["p"]);
+        trade.amount = jsonDouble(data["q"]);
         trade.cost = trade.price * trade.amount;
-        trade.fee = std::stod(data["n"].get<std::string>());
+        trade.fee = jsonDouble(data["n"]);
         trade.feeCurrency = data["N"].get<std::string>();
         trade.timestamp = data["t"].get<uint64_t>();
         
@@ -331,10 +332,10 @@ void BybitWS::handlePosition(const nlohmann::json& data) {
         Position position;
         position.symbol = data["s"].get<std::string>();
         position.side = data["S"].get<std::string>();
-        position.amount = std::stod(data["sz"].get<std::string>());
-        position.entryPrice = std::stod(data["ep"].get<std::string>());
-        position.unrealizedPnl = std::stod(data["up"].get<std::string>());
-        position.leverage = std::stod(data["l"].get<std::string>());
+        position.amount = jsonDouble(data["sz"]);
+        position.entryPrice = jsonDouble(data["ep"]);
+        position.unrealizedPnl = jsonDouble(data["up"]);
+        position.leverage = jsonDouble(data["l"]);
         position.marginType = data["mt"].get<std::string>();
         position.timestamp = data["t"].get<uint64_t>();
         
@@ -103,7 +103,7 @@ void CoinbaseWS::authenticate(const std::string& channel, const std::vector<std:
     send(auth.dump());
 }
 
-void CoinbaseWS::handleMessage(const std::string& message) {
+void CoinbaseWS::handleMessage(std::string_view message) {
     try {
         auto j = nlohmann::json::parse(message);
         
@@ -129,7 +129,7 @@ void CoinbaseInternationalWS::watchPositions(const std::vector<std::string>& sym
     subscribe("positions", "", true);
 }
 
-void CoinbaseInternationalWS::handleMessage(const std::string& message) {
+void CoinbaseInternationalWS::handleMessage(std::string_view message) {
     auto data = nlohmann::json::parse(message);
     auto type = data["type"].get<std::string>();
 
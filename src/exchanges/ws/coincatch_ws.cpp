@@ -166,7 +166,7 @@ std::string CoincatchWS::getInstId(const std::string& symbol) {
 }
 
 // Message Handlers
-void CoincatchWS::handleMessage(const std::string& message) {
+void CoincatchWS::handleMessage(std::string_view message) {
     try {
         nlohmann::json data = nlohmann::json::parse(message);
         
@@ -8,6 +8,7 @@
 #include <chrono>
 #include <ctime>
 #include <sstream>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -49,7 +50,7 @@ void CoincheckWS::watchTrades(const std::string& symbol, const std::map<std::str
     subscribe("trades", symbol);
 }
 
-void CoincheckWS::handleMessage(const std::string& message) {
+void CoincheckWS::handleMessage(std::string_view message) {
     auto data = nlohmann::json::parse(message);
     
     if (!data.is_array() || data.empty()) {
@@ -98,15 +99,15 @@ void CoincheckWS::handleOrderBookMessage(const nlohmann::json& data) {
     
     for (const auto& bid : orderBookData["bids"]) {
         orderbook.bids.push_back({
-            std::stod(bid[0].get<std::string>()),
-            std::stod(bid[1].get<std::string>())
+            jsonDouble(bid[0]),
+            jsonDouble(bid[1])
         });
     }
     
     for (const auto& ask : orderBookData["asks"]) {
         orderbook.asks.push_back({
-            std::stod(ask[0].get<std::string>()),
-            std::stod(ask[1].get<std::string>())
+            jsonDouble(ask[0]),
+            jsonDouble(ask[1])
         });
     }
     
@@ -168,8 +169,8 @@ Trade CoincheckWS::parseWsTrade(const nlohmann::json& trade, const Market* marke
     result.timestamp = timestamp;
     result.datetime = exchange_.iso8601(timestamp);
     result.symbol = symbol;
-    result.price = std::stod(trade[3].get<std::string>());
-    result.amount = std::stod(trade[4].get<std::string>());
+    result.price = jsonDouble(trade[3]);
+    result.amount = jsonDouble(trade[4]);
     result.side = trade[5].get<std::string>();
     result.cost = result.price * result.amount;
     
@@ -8,6 +8,7 @@
 #include <chrono>
 #include <ctime>
 #include <sstream>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -140,7 +141,7 @@ void CoinexWS::watchMyTrades(const std::string& symbol, const std::map<std::stri
     subscribe("deals", symbol, true);
 }
 
-void CoinexWS::handleMessage(const std::string& message) {
+void CoinexWS::handleMessage(std::string_view message) {
     auto data = nlohmann::json::parse(message);
     
     if (data.contains("error")) {
@@ -190,8 +191,8 @@ void CoinexWS::handleOrderBookMessage(const nlohmann::json& data) {
     if (orderBookData.contains("bids")) {
         for (const auto& bid : orderBookData["bids"]) {
             orderbook.bids.push_back({
-                std::stod(bid[0].get<std::string>()),
-                std::stod(bid[1].get<std::string>())
+                jsonDouble(bid[0]),
+                jsonDouble(bid[1])
             });
         }
     }
@@ -199,8 +200,8 @@ void CoinexWS::handleOrderBookMessage(const nlohmann::json& data) {
     if (orderBookData.contains("asks")) {
         for (const auto& ask : orderBookData["asks"]) {
             orderbook.asks.push_back({
-                std::stod(ask[0].get<std::string>()),
-                std::stod(ask[1].get<std::string>())
+                jsonDouble(ask[0]),
+                jsonDouble(ask[1])
             });
         }
     }
@@ -279,14 +280,14 @@ Ticker CoinexWS::parseWsTicker(const nlohmann::json& ticker, const Market* marke
     result.timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
         std::chrono::system_clock::now().time_since_epoch()).count();
     result.datetime = exchange_.iso8601(result.timestamp);
-    result.high = std::stod(ticker["high"].get<std::string>());
-    result.low = std::stod(ticker["low"].get<std::string>());
-    result.bid = std::stod(ticker["last"].get<std::string>());
-    result.ask = std::stod(ticker["last"].get<std::string>());
-    result.last = std::stod(ticker["last"].get<std::string>());
-    result.close = std::stod(ticker["close"].get<std::string>());
-    result.baseVolume = std::stod(ticker["volume"].get<std::string>());
-    result.quoteVolume = std::stod(ticker["value"].get<std::string>());
+    result.high = jsonDouble(ticker["high"]);
+    result.low = jsonDouble(ticker["low"]);
+    result.bid = jsonDouble(ticker["last"]);
+    result.ask = jsonDouble(ticker["last"]);
+    result.last = jsonDouble(ticker["last"]);
+    result.close = jsonDouble(ticker["close"]);
+    result.baseVolume = jsonDouble(ticker["volume"]);
+    result.quoteVolume = jsonDouble(ticker["value"]);
     
     return result;
 }
@@ -298,8 +299,8 @@ Trade CoinexWS::parseWsTrade(const nlohmann::json& trade, const Market* market)
     result.timestamp = std::stoll(trade["time"].get<std::string>()) * 1000;
     result.datetime = exchange_.iso8601(result.timestamp);
     result.side = trade["type"].get<std::string>();
-    result.price = std::stod(trade["price"].get<std::string>());
-    result.amount = std::stod(trade["amount"].get<std::string>());
+    result.price = jsonDouble(trade["price"]);
+    result.amount = jsonDouble(trade["amount"]);
     result.cost = result.price * result.amount;
     
     return result;
@@ -275,7 +275,7 @@ void CryptocomWS::unsubscribeMultiple(const std::string& channel, const std::vec
     send(request.dump());
 }
 
-void CryptocomWS::handleMessage(const std::string& message) {
+void CryptocomWS::handleMessage(std::string_view message) {
     auto j = nlohmann::json::parse(message);
 
     if (j.contains("method")) {
@@ -208,7 +208,7 @@ std::string DefxWS::getChannel(const std::string& channel, const std::string& sy
     return channel + "@" + symbol;
 }
 
-void DefxWS::handleMessage(const std::string& message) {
+void DefxWS::handleMessage(std::string_view message) {
     auto j = nlohmann::json::parse(message);
 
     if (j.contains("method")) {
@@ -257,7 +257,7 @@ int DeribitWS::getNextRequestId() {
     return requestId_++;
 }
 
-void DeribitWS::handleMessage(const std::string& message) {
+void DeribitWS::handleMessage(std::string_view message) {
     auto j = nlohmann::json::parse(message);
 
     if (j.contains("error")) {
@@ -181,7 +181,7 @@ int ExmoWS::getNextRequestId() {
     return requestId++;
 }
 
-void ExmoWS::handleMessage(const std::string& message) {
+void ExmoWS::handleMessage(std::string_view message) {
     auto j = nlohmann::json::parse(message);
 
     if (j.contains("event")) {
@@ -212,7 +212,7 @@ void GateWS::authenticate(const std::string& channel) {
     send(auth.dump());
 }
 
-void GateWS::handleMessage(const std::string& message) {
+void GateWS::handleMessage(std::string_view message) {
     try {
         auto j = nlohmann::json::parse(message);
         
@@ -128,7 +128,7 @@ void GeminiWS::authenticate() {
     send(request.dump());
 }
 
-void GeminiWS::handleMessage(const std::string& message) {
+void GeminiWS::handleMessage(std::string_view message) {
     auto j = nlohmann::json::parse(message);
     
     std::string type = j["type"].get<std::string>();
@@ -11,6 +11,7 @@
 #include <boost/asio/ssl/stream.hpp>
 #include <ctime>
 #include <sstream>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -188,7 +189,7 @@ int HashkeyWS::getNextRequestId() {
     return requestId++;
 }
 
-void HashkeyWS::handleMessage(const std::string& message) {
+void HashkeyWS::handleMessage(std::string_view message) {
     auto j = nlohmann::json::parse(message);
 
     if (j.contains("type")) {
@@ -286,7 +287,7 @@ Order HashkeyWS::parseWsOrder(const nlohmann::json& order, const Market* market)
     auto price = order["price"].get<std::string>();
     auto amount = order["quantity"].get<std::string>();
     auto filled = order["executedQty"].get<std::string>();
-    auto remaining = std::to_string(std::stod(amount) - std::stod(filled));
+    auto remaining = std::to_string(parseDouble(amount) - parseDouble(filled));
     auto status = exchange_.parseOrderStatus(order["status"].get<std::string>());
     auto clientOrderId = order.contains("clientOrderId") ? order["clientOrderId"].get<std::string>() : "";
 
@@ -322,7 +323,7 @@ Trade HashkeyWS::parseWsTrade(const nlohmann::json& trade, const Market* market)
     auto symbol = market ? market->symbol : getSymbol(marketId);
     auto price = trade["price"].get<std::string>();
     auto amount = trade["quantity"].get<std::string>();
-    auto cost = std::to_string(std::stod(price) * std::stod(amount));
+    auto cost = std::to_string(parseDouble(price) * parseDouble(amount));
     auto orderId = trade.contains("orderId") ? trade["orderId"].get<std::string>() : "";
 
     nlohmann::json fee;
@@ -11,6 +11,7 @@
 #include <boost/asio/ssl/stream.hpp>
 #include <ctime>
 #include <sstream>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -159,7 +160,7 @@ int HollexWS::getNextRequestId() {
     return requestId++;
 }
 
-void HollexWS::handleMessage(const std::string& message) {
+void HollexWS::handleMessage(std::string_view message) {
     auto j = nlohmann::json::parse(message);
 
     if (j.contains("event")) {
@@ -253,7 +254,7 @@ Order HollexWS::parseWsOrder(const nlohmann::json& order, const Market* market)
     auto price = order["price"].get<std::string>();
     auto amount = order["amount"].get<std::string>();
     auto filled = order["filled"].get<std::string>();
-    auto remaining = std::to_string(std::stod(amount) - std::stod(filled));
+    auto remaining = std::to_string(parseDouble(amount) - parseDouble(filled));
     auto status = exchange_.parseOrderStatus(order["status"].get<std::string>());
     auto clientOrderId = order.contains("clientOrderId") ? order["clientOrderId"].get<std::string>() : "";
 
@@ -289,7 +290,7 @@ Trade HollexWS::parseWsTrade(const nlohmann::json& trade, const Market* market)
     auto symbol = market ? market->symbol : getSymbol(marketId);
     auto price = trade["price"].get<std::string>();
     auto amount = trade["amount"].get<std::string>();
-    auto cost = std::to_string(std::stod(price) * std::stod(amount));
+    auto cost = std::to_string(parseDouble(price) * parseDouble(amount));
     auto orderId = trade.contains("orderId") ? trade["orderId"].get<std::string>() : "";
 
     nlohmann::json fee;
@@ -4,12 +4,14 @@
 #include <sstream>
 #include <chrono>
 #include <boost/crc.hpp>
-#include <gzip/decompress.hpp>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
 HuobiWS::HuobiWS(boost::asio::io_context& ioc, boost::asio::ssl::context& ctx, Huobi& exchange)
     : WebSocketClient(ioc, ctx), exchange_(exchange) {
+    // Every message arrives gzip-compressed
+    setFrameCompression(FrameCompression::Gzip);
     options_ = {
         {"watchOrderBookRate", 100},
         {"tradesLimit", 1000},
@@ -161,17 +163,22 @@ std::string HuobiWS::sign(const std::string& payload) {
     return ss.str();
 }
 
-void HuobiWS::handleMessage(const std::string& message) {
+std::string HuobiWS::pingReply(std::string_view message) const {
+    if (message.find(R"("ping":)") == std::string_view::npos) {
+        return {};
+    }
+    auto j = nlohmann::json::parse(message, nullptr, false);
+    if (j.is_discarded() || !j.contains("ping")) {
+        return {};
+    }
+    nlohmann::json pong = {{"pong", j["ping"]}};
+    return pong.dump();
+}
+
+void HuobiWS::handleMessage(std::string_view message) {
     try {
         auto j = nlohmann::json::parse(message);
         
-        // Handle ping-pong
-        if (j.contains("ping")) {
-            nlohmann::json pong = {{"pong", j["ping"]}};
-            send(pong.dump());
-            return;
-        }
-        
         // Handle authentication response
         if (j.contains("action") && j["action"] == "req" && j.contains("ch") && j["ch"] == "auth") {
             if (j["code"].get<int>() == 200) {
@@ -224,12 +231,12 @@ void HuobiWS::handleMessage(const std::string& message) {
 void HuobiWS::handleTicker(const nlohmann::json& data) {
     Ticker ticker;
     ticker.symbol = data["symbol"].get<std::string>();
-    ticker.high = std::stod(data["high"].get<std::string>());
-    ticker.low = std::stod(data["low"].get<std::string>());
-    ticker.bid = std::stod(data["bid"][0].get<std::string>());
-    ticker.ask = std::stod(data["ask"][0].get<std::string>());
-    ticker.last = std::stod(data["close"].get<std::string>());
-    ticker.volume = std::stod(data["vol"].get<std::string>());
+    ticker.high = jsonDouble(data["high"]);
+    ticker.low = jsonDouble(data["low"]);
+    ticker.bid = jsonDouble(data["bid"][0]);
+    ticker.ask = jsonDouble(data["ask"][0]);
+    ticker.last = jsonDouble(data["close"]);
+    ticker.volume = jsonDouble(data["vol"]);
     ticker.timestamp = data["ts"].get<uint64_t>();
     
     exchange_.emitTicker(ticker);
@@ -245,15 +252,15 @@ void HuobiWS::handleOrderBook(const nlohmann::json& data) {
     
     for (const auto& bid : bids) {
         orderBook.bids.emplace_back(
-            std::stod(bid[0].get<std::string>()),
-            std::stod(bid[1].get<std::string>())
+            jsonDouble(bid[0]),
+            jsonDouble(bid[1])
         );
     }
     
     for (const auto& ask : asks) {
         orderBook.asks.emplace_back(
-            std::stod(ask[0].get<std::string>()),
-            std::stod(ask[1].get<std::string>())
+            jsonDouble(ask[0]),
+            jsonDouble(ask[1])
         );
     }
     
@@ -270,8 +277,8 @@ void HuobiWS::handleTrade(const nlohmann::json& data) {
         Trade trade;
         trade.id = t["id"].get<std::string>();
         trade.symbol = data["symbol"].get<std::string>();
-        trade.price = std::stod(t["price"].get<std::string>());
-        trade.amount = std::stod(t["amount"].get<std::string>());
+        trade.price = jsonDouble(t["price"]);
+        trade.amount = jsonDouble(t["amount"]);
         trade.side = t["direction"].get<std::string>();
         trade.timestamp = t["ts"].get<uint64_t>();
         
@@ -282,11 +289,11 @@ void HuobiWS::handleTrade(const nlohmann::json& data) {
 void HuobiWS::handleOHLCV(const nlohmann::json& data) {
     OHLCV ohlcv;
     ohlcv.timestamp = data["id"].get<uint64_t>() * 1000;
-    ohlcv.open = std::stod(data["open"].get<std::string>());
-    ohlcv.high = std::stod(data["high"].get<std::string>());
-    ohlcv.low = std::stod(data["low"].get<std::string>());
-    ohlcv.close = std::stod(data["close"].get<std::string>());
-    ohlcv.volume = std::stod(data["vol"].get<std::string>());
+    ohlcv.open = jsonDouble(data["open"]);
+    ohlcv.high = jsonDouble(data["high"]);
+    ohlcv.low = jsonDouble(data["low"]);
+    ohlcv.close = jsonDouble(data["close"]);
+    ohlcv.volume = jsonDouble(data["vol"]);
     
     exchange_.emitOHLCV(ohlcv);
 }
@@ -295,8 +302,8 @@ void HuobiWS::handleBalance(const nlohmann::json& data) {
     try {
         Balance balance;
         balance.currency = data["currency"].get<std::string>();
-        balance.free = std::stod(data["available"].get<std::string>());
-        balance.used = std::stod(data["frozen"].get<std::string>());
+        balance.free = jsonDouble(data["available"]);
+        balance.used = jsonDouble(data["frozen"]);
         balance.total = balance.free + balance.used;
         balance.timestamp = data["ts"].get<uint64_t>();
         
@@ -313,9 +320,9 @@ void HuobiWS::handleOrder(const nlohmann::json& data) {
         order.symbol = data["symbol"].get<std::string>();
         order.type = data["type"].get<std::string>();
         order.side = data["side"].get<std::string>();
-        order.price = std::stod(data["price"].get<std::string>());
-        order.amount = std::stod(data["orderSize"].get<std::string>());
-        order.filled = std::stod(data["filledSize"].get<std::string>());
+        order.price = jsonDouble(data["price"]);
+        order.amount = jsonDouble(data["orderSize"]);
+        order.filled = jsonDouble(data["filledSize"]);
         order.remaining = order.amount - order.filled;
         order.status = data["orderStatus"].get<std::string>();
         order.timestamp = data["orderCreateTime"].get<uint64_t>();
@@ -333,10 +340,10 @@ void HuobiWS::handleMyTrade(const nlohmann::json& data) {
         trade.orderId = data["orderId"].get<std::string>();
         trade.symbol = data["symbol"].get<std::string>();
         trade.side = data["orderSide"].get<std::string>();
-        trade.price = std::stod(data["tradePrice"].get<std::string>());
-        trade.amount = std::stod(data["tradeVolume"].get<std::string>());
+        trade.price = jsonDouble(data["tradePrice"]);
+        trade.amount = jsonDouble(data["tradeVolume"]);
         trade.cost = trade.price * trade.amount;
-        trade.fee = std::stod(data["transactFee"].get<std::string>());
+        trade.fee = jsonDouble(data["transactFee"]);
         trade.feeCurrency = data["feeCurrency"].get<std::string>();
         trade.timestamp = data["tradeTime"].get<uint64_t>();
         
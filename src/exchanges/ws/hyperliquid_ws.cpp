@@ -7,6 +7,7 @@
 #include <boost/beast/ssl.hpp>
 #include <boost/beast/websocket.hpp>
 #include <boost/beast/websocket/ssl.hpp>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -171,17 +172,22 @@ std::string HyperliquidWS::getSymbol(const std::string& marketId) {
     return marketId;
 }
 
-void HyperliquidWS::handleMessage(const std::string& message) {
+std::string HyperliquidWS::pingReply(std::string_view message) const {
+    if (message.find(R"("ping":)") == std::string_view::npos) {
+        return {};
+    }
+    auto j = nlohmann::json::parse(message, nullptr, false);
+    if (j.is_discarded() || !j.contains("ping")) {
+        return {};
+    }
+    nlohmann::json pong = {{"pong", j["ping"]}};
+    return pong.dump();
+}
+
+void HyperliquidWS::handleMessage(std::string_view message) {
     try {
         auto j = nlohmann::json::parse(message);
 
-        // Handle ping-pong
-        if (j.contains("ping")) {
-            nlohmann::json pong = {{"pong", j["ping"]}};
-            send(pong.dump());
-            return;
-        }
-
         // Handle authentication response
         if (j.contains("op") && j["op"] == "auth") {
             if (j["success"].get<bool>()) {
@@ -239,12 +245,12 @@ void HyperliquidWS::handleTicker(const nlohmann::json& data) {
     try {
         Ticker ticker;
         ticker.symbol = getSymbol(data["symbol"].get<std::string>());
-        ticker.high = std::stod(data["high24h"].get<std::string>());
-        ticker.low = std::stod(data["low24h"].get<std::string>());
-        ticker.bid = std::stod(data["bestBid"].get<std::string>());
-        ticker.ask = std::stod(data["bestAsk"].get<std::string>());
-        ticker.last = std::stod(data["lastPrice"].get<std::string>());
-        ticker.volume = std::stod(data["volume24h"].get<std::string>());
+        ticker.high = jsonDouble(data["high24h"]);
+        ticker.low = jsonDouble(data["low24h"]);
+        ticker.bid = jsonDouble(data["bestBid"]);
+        ticker.ask = jsonDouble(data["bestAsk"]);
+        ticker.last = jsonDouble(data["lastPrice"]);
+        ticker.volume = jsonDouble(data["volume24h"]);
         ticker.timestamp = data["timestamp"].get<uint64_t>();
         
         exchange_.emitTicker(ticker);
@@ -264,15 +270,15 @@ void HyperliquidWS::handleOrderBook(const nlohmann::json& data) {
         
         for (const auto& bid : bids) {
             orderBook.bids.emplace_back(
-                std::stod(bid[0].get<std::string>()),
-                std::stod(bid[1].get<std::string>())
+                jsonDouble(bid[0]),
+                jsonDouble(bid[1])
             );
         }
         
         for (const auto& ask : asks) {
             orderBook.asks.emplace_back(
-                std::stod(ask[0].get<std::string>()),
-                std::stod(ask[1].get<std::string>())
+                jsonDouble(ask[0]),
+                jsonDouble(ask[1])
             );
         }
         
@@ -287,8 +293,8 @@ void HyperliquidWS::handleTrade(const nlohmann::json& data) {
         Trade trade;
         trade.id = data["id"].get<std::string>();
         trade.symbol = getSymbol(data["symbol"].get<std::string>());
-        trade.price = std::stod(data["price"].get<std::string>());
-        trade.amount = std::stod(data["size"].get<std::string>());
+        trade.price = jsonDouble(data["price"]);
+        trade.amount = jsonDouble(data["size"]);
         trade.side = data["side"].get<std::string>();
         trade.timestamp = data["timestamp"].get<uint64_t>();
         
@@ -302,11 +308,11 @@ void HyperliquidWS::handleOHLCV(const nlohmann::json& data) {
     try {
         OHLCV ohlcv;
         ohlcv.timestamp = data["timestamp"].get<uint64_t>();
-        ohlcv.open = std::stod(data["open"].get<std::string>());
-        ohlcv.high = std::stod(data["high"].get<std::string>());
-        ohlcv.low = std::stod(data["low"].get<std::string>());
-        ohlcv.close = std::stod(data["close"].get<std::string>());
-        ohlcv.volume = std::stod(data["volume"].get<std::string>());
+        ohlcv.open = jsonDouble(data["open"]);
+        ohlcv.high = jsonDouble(data["high"]);
+        ohlcv.low = jsonDouble(data["low"]);
+        ohlcv.close = jsonDouble(data["close"]);
+        ohlcv.volume = jsonDouble(data["volume"]);
         
         exchange_.emitOHLCV(ohlcv);
     } catch (const std::exception& e) {
@@ -336,9 +342,9 @@ void HyperliquidWS::handleBalance(const nlohmann::json& data) {
     try {
         Balance balance;
         balance.currency = data["currency"].get<std::string>();
-        balance.free = std::stod(data["available"].get<std::string>());
-        balance.used = std::stod(data["used"].get<std::string>());
-        balance.total = std::stod(data["total"].get<std::string>());
+        balance.free = jsonDouble(data["available"]);
+        balance.used = jsonDouble(data["used"]);
+        balance.total = jsonDouble(data["total"]);
         balance.timestamp = data["timestamp"].get<uint64_t>();
         
         exchange_.emitBalance(balance);
@@ -354,9 +360,9 @@ void HyperliquidWS::handleOrder(const nlohmann::json& data) {
         order.symbol = getSymbol(data["symbol"].get<std::string>());
         order.type = data["type"].get<std::string>();
         order.side = data["side"].get<std::string>();
-        order.price = std::stod(data["price"].get<std::string>());
-        order.amount = std::stod(data["size"].get<std::string>());
-        order.filled = std::stod(data["filled"].get<std::string>());
+        order.price = jsonDouble(data["price"]);
+        order.amount = jsonDouble(data["size"]);
+        order.filled = jsonDouble(data["filled"]);
         order.remaining = order.amount - order.filled;
         order.status = data["status"].get<std::string>();
         order.timestamp = data["timestamp"].get<uint64_t>();
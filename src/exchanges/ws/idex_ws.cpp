@@ -7,6 +7,7 @@
 #include <boost/beast/ssl.hpp>
 #include <boost/beast/websocket.hpp>
 #include <boost/beast/websocket/ssl.hpp>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -186,7 +187,7 @@ int IDEXWS::getNextRequestId() {
     return nextRequestId_++;
 }
 
-void IDEXWS::handleMessage(const std::string& message) {
+void IDEXWS::handleMessage(std::string_view message) {
     try {
         auto j = nlohmann::json::parse(message);
 
@@ -245,13 +246,13 @@ void IDEXWS::handleTicker(const nlohmann::json& data) {
     try {
         Ticker ticker;
         ticker.symbol = getSymbol(data["market"].get<std::string>());
-        ticker.high = std::stod(data["high24h"].get<std::string>());
-        ticker.low = std::stod(data["low24h"].get<std::string>());
-        ticker.bid = std::stod(data["bestBid"].get<std::string>());
-        ticker.ask = std::stod(data["bestAsk"].get<std::string>());
-        ticker.last = std::stod(data["lastPrice"].get<std::string>());
-        ticker.volume = std::stod(data["baseVolume24h"].get<std::string>());
-        ticker.quoteVolume = std::stod(data["quoteVolume24h"].get<std::string>());
+        ticker.high = jsonDouble(data["high24h"]);
+        ticker.low = jsonDouble(data["low24h"]);
+        ticker.bid = jsonDouble(data["bestBid"]);
+        ticker.ask = jsonDouble(data["bestAsk"]);
+        ticker.last = jsonDouble(data["lastPrice"]);
+        ticker.volume = jsonDouble(data["baseVolume24h"]);
+        ticker.quoteVolume = jsonDouble(data["quoteVolume24h"]);
         ticker.timestamp = data["timestamp"].get<uint64_t>();
         
         exchange_.emitTicker(ticker);
@@ -271,15 +272,15 @@ void IDEXWS::handleOrderBook(const nlohmann::json& data) {
         
         for (const auto& bid : bids) {
             orderBook.bids.emplace_back(
-                std::stod(bid["price"].get<std::string>()),
-                std::stod(bid["size"].get<std::string>())
+                jsonDouble(bid["price"]),
+                jsonDouble(bid["size"])
             );
         }
         
         for (const auto& ask : asks) {
             orderBook.asks.emplace_back(
-                std::stod(ask["price"].get<std::string>()),
-                std::stod(ask["size"].get<std::string>())
+                jsonDouble(ask["price"]),
+                jsonDouble(ask["size"])
             );
         }
         
@@ -298,15 +299,15 @@ void IDEXWS::handleTrade(const nlohmann::json& data) {
         Trade trade;
         trade.id = data["id"].get<std::string>();
         trade.symbol = getSymbol(data["market"].get<std::string>());
-        trade.price = std::stod(data["price"].get<std::string>());
-        trade.amount = std::stod(data["size"].get<std::string>());
+        trade.price = jsonDouble(data["price"]);
+        trade.amount = jsonDouble(data["size"]);
         trade.cost = trade.price * trade.amount;
         trade.side = data["side"].get<std::string>();
         trade.timestamp = data["timestamp"].get<uint64_t>();
         
         if (data.contains("fee")) {
             trade.fee = {
-                {"cost", std::stod(data["fee"]["amount"].get<std::string>())},
+                {"cost", jsonDouble(data["fee"]["amount"])},
                 {"currency", data["fee"]["currency"].get<std::string>()}
             };
         }
@@ -321,11 +322,11 @@ void IDEXWS::handleOHLCV(const nlohmann::json& data) {
     try {
         OHLCV ohlcv;
         ohlcv.timestamp = data["timestamp"].get<uint64_t>();
-        ohlcv.open = std::stod(data["open"].get<std::string>());
-        ohlcv.high = std::stod(data["high"].get<std::string>());
-        ohlcv.low = std::stod(data["low"].get<std::string>());
-        ohlcv.close = std::stod(data["close"].get<std::string>());
-        ohlcv.volume = std::stod(data["volume"].get<std::string>());
+        ohlcv.open = jsonDouble(data["open"]);
+        ohlcv.high = jsonDouble(data["high"]);
+        ohlcv.low = jsonDouble(data["low"]);
+        ohlcv.close = jsonDouble(data["close"]);
+        ohlcv.volume = jsonDouble(data["volume"]);
         
         exchange_.emitOHLCV(ohlcv);
     } catch (const std::exception& e) {
@@ -355,8 +356,8 @@ void IDEXWS::handleBalance(const nlohmann::json& data) {
     try {
         Balance balance;
         balance.currency = data["currency"].get<std::string>();
-        balance.free = std::stod(data["available"].get<std::string>());
-        balance.used = std::stod(data["held"].get<std::string>());
+        balance.free = jsonDouble(data["available"]);
+        balance.used = jsonDouble(data["held"]);
         balance.total = balance.free + balance.used;
         balance.timestamp = data["timestamp"].get<uint64_t>();
         
@@ -374,16 +375,16 @@ void IDEXWS::handleOrder(const nlohmann::json& data) {
         order.symbol = getSymbol(data["market"].get<std::string>());
         order.type = data["type"].get<std::string>();
         order.side = data["side"].get<std::string>();
-        order.price = std::stod(data["price"].get<std::string>());
-        order.amount = std::stod(data["size"].get<std::string>());
-        order.filled = std::stod(data["filled"].get<std::string>());
+        order.price = jsonDouble(data["price"]);
+        order.amount = jsonDouble(data["size"]);
+        order.filled = jsonDouble(data["filled"]);
         order.remaining = order.amount - order.filled;
         order.status = data["status"].get<std::string>();
         order.timestamp = data["timestamp"].get<uint64_t>();
         
         if (data.contains("fee")) {
             order.fee = {
-                {"cost", std::stod(data["fee"]["amount"].get<std::string>())},
+                {"cost", jsonDouble(data["fee"]["amount"])},
                 {"currency", data["fee"]["currency"].get<std::string>()}
             };
         }
@@ -402,14 +403,14 @@ void IDEXWS::handleMyTrade(const nlohmann::json& data) {
         trade.symbol = getSymbol(data["market"].get<std::string>());
         trade.type = data["type"].get<std::string>();
         trade.side = data["side"].get<std::string>();
-        trade.price = std::stod(data["price"].get<std::string>());
-        trade.amount = std::stod(data["size"].get<std::string>());
+        trade.price = jsonDouble(data["price"]);
+        trade.amount = jsonDouble(data["size"]);
         trade.cost = trade.price * trade.amount;
         trade.timestamp = data["timestamp"].get<uint64_t>();
         
         if (data.contains("fee")) {
             trade.fee = {
-                {"cost", std::stod(data["fee"]["amount"].get<std::string>())},
+                {"cost", jsonDouble(data["fee"]["amount"])},
                 {"currency", data["fee"]["currency"].get<std::string>()}
             };
         }
@@ -7,6 +7,7 @@
 #include <boost/beast/ssl.hpp>
 #include <boost/beast/websocket.hpp>
 #include <boost/beast/websocket/ssl.hpp>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -166,7 +167,7 @@ int IndependentReserveWS::getNextRequestId() {
     return nextRequestId_++;
 }
 
-void IndependentReserveWS::handleMessage(const std::string& message) {
+void IndependentReserveWS::handleMessage(std::string_view message) {
     try {
         auto j = nlohmann::json::parse(message);
 
@@ -240,10 +241,10 @@ void IndependentReserveWS::handleTicker(const nlohmann::json& data) {
     try {
         Ticker ticker;
         ticker.symbol = getSymbol(data["currencyPair"].get<std::string>());
-        ticker.bid = std::stod(data["bestBid"].get<std::string>());
-        ticker.ask = std::stod(data["bestAsk"].get<std::string>());
-        ticker.last = std::stod(data["lastPrice"].get<std::string>());
-        ticker.volume = std::stod(data["volume24h"].get<std::string>());
+        ticker.bid = jsonDouble(data["bestBid"]);
+        ticker.ask = jsonDouble(data["bestAsk"]);
+        ticker.last = jsonDouble(data["lastPrice"]);
+        ticker.volume = jsonDouble(data["volume24h"]);
         ticker.timestamp = data["timestamp"].get<uint64_t>();
         
         exchange_.emitTicker(ticker);
@@ -263,15 +264,15 @@ void IndependentReserveWS::handleOrderBook(const nlohmann::json& data) {
         
         for (const auto& bid : bids) {
             orderBook.bids.emplace_back(
-                std::stod(bid["price"].get<std::string>()),
-                std::stod(bid["volume"].get<std::string>())
+                jsonDouble(bid["price"]),
+                jsonDouble(bid["volume"])
             );
         }
         
         for (const auto& ask : asks) {
             orderBook.asks.emplace_back(
-                std::stod(ask["price"].get<std::string>()),
-                std::stod(ask["volume"].get<std::string>())
+                jsonDouble(ask["price"]),
+                jsonDouble(ask["volume"])
             );
         }
         
@@ -286,15 +287,15 @@ void IndependentReserveWS::handleTrade(const nlohmann::json& data) {
         Trade trade;
         trade.id = data["tradeId"].get<std::string>();
         trade.symbol = getSymbol(data["currencyPair"].get<std::string>());
-        trade.price = std::stod(data["price"].get<std::string>());
-        trade.amount = std::stod(data["volume"].get<std::string>());
+        trade.price = jsonDouble(data["price"]);
+        trade.amount = jsonDouble(data["volume"]);
         trade.cost = trade.price * trade.amount;
         trade.side = data["side"].get<std::string>();
         trade.timestamp = data["timestamp"].get<uint64_t>();
         
         if (data.contains("fee")) {
             trade.fee = {
-                {"cost", std::stod(data["fee"]["amount"].get<std::string>())},
+                {"cost", jsonDouble(data["fee"]["amount"])},
                 {"currency", data["fee"]["currency"].get<std::string>()}
             };
         }
@@ -317,8 +318,8 @@ void IndependentReserveWS::handleBalance(const nlohmann::json& data) {
     try {
         Balance balance;
         balance.currency = data["currency"].get<std::string>();
-        balance.free = std::stod(data["available"].get<std::string>());
-        balance.used = std::stod(data["reserved"].get<std::string>());
+        balance.free = jsonDouble(data["available"]);
+        balance.used = jsonDouble(data["reserved"]);
         balance.total = balance.free + balance.used;
         balance.timestamp = data["timestamp"].get<uint64_t>();
         
@@ -335,16 +336,16 @@ void IndependentReserveWS::handleOrder(const nlohmann::json& data) {
         order.symbol = getSymbol(data["currencyPair"].get<std::string>());
         order.type = data["type"].get<std::string>();
         order.side = data["side"].get<std::string>();
-        order.price = std::stod(data["price"].get<std::string>());
-        order.amount = std::stod(data["volume"].get<std::string>());
-        order.filled = std::stod(data["filledVolume"].get<std::string>());
+        order.price = jsonDouble(data["price"]);
+        order.amount = jsonDouble(data["volume"]);
+        order.filled = jsonDouble(data["filledVolume"]);
         order.remaining = order.amount - order.filled;
         order.status = data["status"].get<std::string>();
         order.timestamp = data["timestamp"].get<uint64_t>();
         
         if (data.contains("fee")) {
             order.fee = {
-                {"cost", std::stod(data["fee"]["amount"].get<std::string>())},
+                {"cost", jsonDouble(data["fee"]["amount"])},
                 {"currency", data["fee"]["currency"].get<std::string>()}
             };
         }
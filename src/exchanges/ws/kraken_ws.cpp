@@ -4,6 +4,7 @@
 #include <sstream>
 #include <chrono>
 #include <boost/crc.hpp>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -174,7 +175,7 @@ void KrakenWS::createOrder(const std::string& symbol, const std::string& type,
         request["price"] = std::to_string(price);
     }
     
-    send(request.dump());
+    send(request.dump(), SendPriority::High);
 }
 
 void KrakenWS::editOrder(const std::string& id, const std::string& symbol,
@@ -195,7 +196,7 @@ void KrakenWS::editOrder(const std::string& id, const std::string& symbol,
         request["price"] = std::to_string(price);
     }
     
-    send(request.dump());
+    send(request.dump(), SendPriority::High);
 }
 
 void KrakenWS::cancelOrder(const std::string& id) {
@@ -208,7 +209,7 @@ void KrakenWS::cancelOrder(const std::string& id) {
         {"orderid", id}
     };
     
-    send(request.dump());
+    send(request.dump(), SendPriority::High);
 }
 
 void KrakenWS::cancelAllOrders() {
@@ -220,10 +221,10 @@ void KrakenWS::cancelAllOrders() {
         {"event", "cancelAll"}
     };
     
-    send(request.dump());
+    send(request.dump(), SendPriority::High);
 }
 
-void KrakenWS::handleMessage(const std::string& message) {
+void KrakenWS::handleMessage(std::string_view message) {
     try {
         auto j = nlohmann::json::parse(message);
         
@@ -281,13 +282,13 @@ void KrakenWS::handleTicker(const nlohmann::json& data) {
     try {
         Ticker ticker;
         ticker.symbol = data["p"][0];
-        ticker.bid = std::stod(data["b"][0].get<std::string>());
-        ticker.ask = std::stod(data["a"][0].get<std::string>());
-        ticker.last = std::stod(data["c"][0].get<std::string>());
-        ticker.volume = std::stod(data["v"][1].get<std::string>());
-        ticker.high = std::stod(data["h"][1].get<std::string>());
-        ticker.low = std::stod(data["l"][1].get<std::string>());
-        ticker.vwap = std::stod(data["p"][1].get<std::string>());
+        ticker.bid = jsonDouble(data["b"][0]);
+        ticker.ask = jsonDouble(data["a"][0]);
+        ticker.last = jsonDouble(data["c"][0]);
+        ticker.volume = jsonDouble(data["v"][1]);
+        ticker.high = jsonDouble(data["h"][1]);
+        ticker.low = jsonDouble(data["l"][1]);
+        ticker.vwap = jsonDouble(data["p"][1]);
         ticker.timestamp = std::chrono::system_clock::now().time_since_epoch().count();
         
         exchange_.emitTicker(ticker);
@@ -304,8 +305,8 @@ void KrakenWS::handleOrderBook(const nlohmann::json& data) {
         if (data.contains("bs")) {
             for (const auto& bid : data["bs"]) {
                 orderBook.bids.emplace_back(
-                    std::stod(bid[0].get<std::string>()),
-                    std::stod(bid[1].get<std::string>())
+                    jsonDouble(bid[0]),
+                    jsonDouble(bid[1])
                 );
             }
         }
@@ -313,8 +314,8 @@ void KrakenWS::handleOrderBook(const nlohmann::json& data) {
         if (data.contains("as")) {
             for (const auto& ask : data["as"]) {
                 orderBook.asks.emplace_back(
-                    std::stod(ask[0].get<std::string>()),
-                    std::stod(ask[1].get<std::string>())
+                    jsonDouble(ask[0]),
+                    jsonDouble(ask[1])
                 );
             }
         }
@@ -330,8 +331,8 @@ void KrakenWS::handleTrade(const nlohmann::json& data) {
         for (const auto& t : data) {
             Trade trade;
             trade.symbol = data["p"][0];
-            trade.price = std::stod(t[0].get<std::string>());
-            trade.amount = std::stod(t[1].get<std::string>());
+            trade.price = jsonDouble(t[0]);
+            trade.amount = jsonDouble(t[1]);
             trade.timestamp = std::stoll(t[2].get<std::string>()) * 1000;
             trade.side = t[3] == "b" ? "buy" : "sell";
             trade.type = t[4] == "l" ? "limit" : "market";
@@ -347,11 +348,11 @@ void KrakenWS::handleOHLCV(const nlohmann::json& data) {
     try {
         OHLCV ohlcv;
         ohlcv.timestamp = std::stoll(data[0].get<std::string>()) * 1000;
-        ohlcv.open = std::stod(data[1].get<std::string>());
-        ohlcv.high = std::stod(data[2].get<std::string>());
-        ohlcv.low = std::stod(data[3].get<std::string>());
-        ohlcv.close = std::stod(data[4].get<std::string>());
-        ohlcv.volume = std::stod(data[6].get<std::string>());
+        ohlcv.open = jsonDouble(data[1]);
+        ohlcv.high = jsonDouble(data[2]);
+        ohlcv.low = jsonDouble(data[3]);
+        ohlcv.close = jsonDouble(data[4]);
+        ohlcv.volume = jsonDouble(data[6]);
         
         exchange_.emitOHLCV(ohlcv);
     } catch (const std::exception& e) {
@@ -364,7 +365,7 @@ void KrakenWS::handleBalance(const nlohmann::json& data) {
         for (const auto& [currency, value] : data.items()) {
             Balance balance;
             balance.currency = currency;
-            balance.free = std::stod(value.get<std::string>());
+            balance.free = jsonDouble(value);
             balance.used = 0.0;  // Kraken doesn't provide used balance in WS
             balance.total = balance.free;
             balance.timestamp = std::chrono::system_clock::now().time_since_epoch().count();
@@ -384,9 +385,9 @@ void KrakenWS::handleOrder(const nlohmann::json& data) {
             order.symbol = orderData["descr"]["pair"].get<std::string>();
             order.type = orderData["descr"]["ordertype"].get<std::string>();
             order.side = orderData["descr"]["type"].get<std::string>();
-            order.price = std::stod(orderData["descr"]["price"].get<std::string>());
-            order.amount = std::stod(orderData["vol"].get<std::string>());
-            order.filled = std::stod(orderData["vol_exec"].get<std::string>());
+            order.price = jsonDouble(orderData["descr"]["price"]);
+            order.amount = jsonDouble(orderData["vol"]);
+            order.filled = jsonDouble(orderData["vol_exec"]);
             order.remaining = order.amount - order.filled;
             order.status = orderData["status"].get<std::string>();
             order.timestamp = std::stoll(orderData["opentm"].get<std::string>()) * 1000;
@@ -407,10 +408,10 @@ void KrakenWS::handleMyTrade(const nlohmann::json& data) {
             trade.symbol = tradeData["pair"].get<std::string>();
             trade.type = tradeData["ordertype"].get<std::string>();
             trade.side = tradeData["type"].get<std::string>();
-            trade.price = std::stod(tradeData["price"].get<std::string>());
-            trade.amount = std::stod(tradeData["vol"].get<std::string>());
+            trade.price = jsonDouble(tradeData["price"]);
+            trade.amount = jsonDouble(tradeData["vol"]);
             trade.cost = trade.price * trade.amount;
-            trade.fee = std::stod(tradeData["fee"].get<std::string>());
+            trade.fee = jsonDouble(tradeData["fee"]);
             trade.timestamp = std::stoll(tradeData["time"].get<std::string>()) * 1000;
             
             exchange_.emitMyTrade(trade);
@@ -8,6 +8,7 @@
 #include <boost/beast/websocket.hpp>
 #include <boost/beast/websocket/ssl.hpp>
 #include <openssl/hmac.h>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -249,7 +250,7 @@ std::string KrakenFuturesWS::getSymbol(const std::string& marketId) {
     return marketId;
 }
 
-void KrakenFuturesWS::handleMessage(const std::string& message) {
+void KrakenFuturesWS::handleMessage(std::string_view message) {
     try {
         auto j = nlohmann::json::parse(message);
 
@@ -305,12 +306,12 @@ void KrakenFuturesWS::handleTicker(const nlohmann::json& data) {
     try {
         Ticker ticker;
         ticker.symbol = getSymbol(data["product_id"].get<std::string>());
-        ticker.bid = std::stod(data["bid"].get<std::string>());
-        ticker.ask = std::stod(data["ask"].get<std::string>());
-        ticker.last = std::stod(data["last"].get<std::string>());
-        ticker.volume = std::stod(data["volume24h"].get<std::string>());
-        ticker.high = std::stod(data["high24h"].get<std::string>());
-        ticker.low = std::stod(data["low24h"].get<std::string>());
+        ticker.bid = jsonDouble(data["bid"]);
+        ticker.ask = jsonDouble(data["ask"]);
+        ticker.last = jsonDouble(data["last"]);
+        ticker.volume = jsonDouble(data["volume24h"]);
+        ticker.high = jsonDouble(data["high24h"]);
+        ticker.low = jsonDouble(data["low24h"]);
         ticker.timestamp = data["time"].get<uint64_t>();
 
         exchange_.emitTicker(ticker);
@@ -328,8 +329,8 @@ void KrakenFuturesWS::handleOrderBook(const nlohmann::json& data) {
         if (data.contains("bids")) {
             for (const auto& bid : data["bids"]) {
                 orderBook.bids.emplace_back(
-                    std::stod(bid[0].get<std::string>()),
-                    std::stod(bid[1].get<std::string>())
+                    jsonDouble(bid[0]),
+                    jsonDouble(bid[1])
                 );
             }
         }
@@ -337,8 +338,8 @@ void KrakenFuturesWS::handleOrderBook(const nlohmann::json& data) {
         if (data.contains("asks")) {
             for (const auto& ask : data["asks"]) {
                 orderBook.asks.emplace_back(
-                    std::stod(ask[0].get<std::string>()),
-                    std::stod(ask[1].get<std::string>())
+                    jsonDouble(ask[0]),
+                    jsonDouble(ask[1])
                 );
             }
         }
@@ -354,8 +355,8 @@ void KrakenFuturesWS::handleTrade(const nlohmann::json& data) {
         Trade trade;
         trade.symbol = getSymbol(data["product_id"].get<std::string>());
         trade.id = data["uid"].get<std::string>();
-        trade.price = std::stod(data["price"].get<std::string>());
-        trade.amount = std::stod(data["size"].get<std::string>());
+        trade.price = jsonDouble(data["price"]);
+        trade.amount = jsonDouble(data["size"]);
         trade.cost = trade.price * trade.amount;
         trade.side = data["side"].get<std::string>();
         trade.timestamp = data["time"].get<uint64_t>();
@@ -370,11 +371,11 @@ void KrakenFuturesWS::handleOHLCV(const nlohmann::json& data) {
     try {
         OHLCV ohlcv;
         ohlcv.timestamp = data["time"].get<uint64_t>();
-        ohlcv.open = std::stod(data["open"].get<std::string>());
-        ohlcv.high = std::stod(data["high"].get<std::string>());
-        ohlcv.low = std::stod(data["low"].get<std::string>());
-        ohlcv.close = std::stod(data["close"].get<std::string>());
-        ohlcv.volume = std::stod(data["volume"].get<std::string>());
+        ohlcv.open = jsonDouble(data["open"]);
+        ohlcv.high = jsonDouble(data["high"]);
+        ohlcv.low = jsonDouble(data["low"]);
+        ohlcv.close = jsonDouble(data["close"]);
+        ohlcv.volume = jsonDouble(data["volume"]);
 
         exchange_.emitOHLCV(ohlcv);
     } catch (const std::exception& e) {
@@ -386,7 +387,7 @@ void KrakenFuturesWS::handleMarkPrice(const nlohmann::json& data) {
     try {
         MarkPrice markPrice;
         markPrice.symbol = getSymbol(data["product_id"].get<std::string>());
-        markPrice.price = std::stod(data["markPrice"].get<std::string>());
+        markPrice.price = jsonDouble(data["markPrice"]);
         markPrice.timestamp = data["time"].get<uint64_t>();
 
         exchange_.emitMarkPrice(markPrice);
@@ -399,7 +400,7 @@ void KrakenFuturesWS::handleFundingRate(const nlohmann::json& data) {
     try {
         FundingRate fundingRate;
         fundingRate.symbol = getSymbol(data["product_id"].get<std::string>());
-        fundingRate.rate = std::stod(data["fundingRate"].get<std::string>());
+        fundingRate.rate = jsonDouble(data["fundingRate"]);
         fundingRate.timestamp = data["time"].get<uint64_t>();
         fundingRate.nextTimestamp = data["nextFundingTime"].get<uint64_t>();
 
@@ -414,9 +415,9 @@ void KrakenFuturesWS::handleBalance(const nlohmann::json& data) {
         for (const auto& [currency, value] : data["balances"].items()) {
             Balance balance;
             balance.currency = currency;
-            balance.free = std::stod(value["available"].get<std::string>());
-            balance.used = std::stod(value["initial_margin"].get<std::string>());
-            balance.total = std::stod(value["total"].get<std::string>());
+            balance.free = jsonDouble(value["available"]);
+            balance.used = jsonDouble(value["initial_margin"]);
+            balance.total = jsonDouble(value["total"]);
             balance.timestamp = data["time"].get<uint64_t>();
 
             exchange_.emitBalance(balance);
@@ -433,16 +434,16 @@ void KrakenFuturesWS::handleOrder(const nlohmann::json& data) {
         order.symbol = getSymbol(data["product_id"].get<std::string>());
         order.type = data["order_type"].get<std::string>();
         order.side = data["side"].get<std::string>();
-        order.price = std::stod(data["limit_price"].get<std::string>());
-        order.amount = std::stod(data["size"].get<std::string>());
-        order.filled = std::stod(data["filled"].get<std::string>());
+        order.price = jsonDouble(data["limit_price"]);
+        order.amount = jsonDouble(data["size"]);
+        order.filled = jsonDouble(data["filled"]);
         order.remaining = order.amount - order.filled;
         order.status = data["status"].get<std::string>();
         order.timestamp = data["time"].get<uint64_t>();
 
         if (data.contains("fee")) {
             order.fee = {
-                {"cost", std::stod(data["fee"]["amount"].get<std::string>())},
+                {"cost", jsonDouble(data["fee"]["amount"])},
                 {"currency", data["fee"]["currency"].get<std::string>()}
             };
         }
@@ -461,14 +462,14 @@ void KrakenFuturesWS::handleMyTrade(const nlohmann::json& data) {
         trade.symbol = getSymbol(data["product_id"].get<std::string>());
         trade.type = data["order_type"].get<std::string>();
         trade.side = data["side"].get<std::string>();
-        trade.price = std::stod(data["price"].get<std::string>());
-        trade.amount = std::stod(data["size"].get<std::string>());
+        trade.price = jsonDouble(data["price"]);
+        trade.amount = jsonDouble(data["size"]);
         trade.cost = trade.price * trade.amount;
         trade.timestamp = data["time"].get<uint64_t>();
 
         if (data.contains("fee")) {
             trade.fee = {
-                {"cost", std::stod(data["fee"]["amount"].get<std::string>())},
+                {"cost", jsonDouble(data["fee"]["amount"])},
                 {"currency", data["fee"]["currency"].get<std::string>()}
             };
         }
@@ -483,14 +484,14 @@ void KrakenFuturesWS::handlePosition(const nlohmann::json& data) {
     try {
         Position position;
         position.symbol = getSymbol(data["product_id"].get<std::string>());
-        position.size = std::stod(data["size"].get<std::string>());
+        position.size = jsonDouble(data["size"]);
         position.side = data["side"].get<std::string>();
-        position.entryPrice = std::stod(data["entry_price"].get<std::string>());
-        position.markPrice = std::stod(data["mark_price"].get<std::string>());
-        position.liquidationPrice = std::stod(data["liquidation_price"].get<std::string>());
-        position.margin = std::stod(data["initial_margin"].get<std::string>());
-        position.leverage = std::stod(data["leverage"].get<std::string>());
-        position.unrealizedPnl = std::stod(data["unrealized_pnl"].get<std::string>());
+        position.entryPrice = jsonDouble(data["entry_price"]);
+        position.markPrice = jsonDouble(data["mark_price"]);
+        position.liquidationPrice = jsonDouble(data["liquidation_price"]);
+        position.margin = jsonDouble(data["initial_margin"]);
+        position.leverage = jsonDouble(data["leverage"]);
+        position.unrealizedPnl = jsonDouble(data["unrealized_pnl"]);
         position.timestamp = data["time"].get<uint64_t>();
 
         exchange_.emitPosition(position);
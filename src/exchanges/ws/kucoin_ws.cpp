@@ -3,7 +3,7 @@
 #include <iostream>
 #include <sstream>
 #include <chrono>
-#include <thread>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -37,6 +37,7 @@ void KucoinWS::negotiate(bool privateChannel) {
                 if (server.contains("pingTimeout")) {
                     pingTimeout_ = server["pingTimeout"];
                 }
+                setHeartbeat({std::chrono::milliseconds(pingInterval_), std::chrono::milliseconds(pingTimeout_)});
             }
         }
     } catch (const std::exception& e) {
@@ -44,12 +45,28 @@ void KucoinWS::negotiate(bool privateChannel) {
     }
 }
 
-void KucoinWS::ping() {
+std::string KucoinWS::heartbeatMessage() {
     nlohmann::json pingMessage = {
         {"id", std::to_string(std::chrono::system_clock::now().time_since_epoch().count())},
         {"type", "ping"}
     };
-    send(pingMessage.dump());
+    return pingMessage.dump();
+}
+
+bool KucoinWS::isHeartbeatReply(std::string_view message) const {
+    return message.find(R"("type":"pong")") != std::string_view::npos;
+}
+
+std::string KucoinWS::pingReply(std::string_view message) const {
+    if (message.find(R"("type":"ping")") == std::string_view::npos) {
+        return {};
+    }
+    auto j = nlohmann::json::parse(message);
+    nlohmann::json pongMessage = {
+        {"id", j["id"]},
+        {"type", "pong"}
+    };
+    return pongMessage.dump();
 }
 
 void KucoinWS::authenticate() {
@@ -141,29 +158,12 @@ void KucoinWS::watchMyTrades() {
     subscribe("/spot/matches", {{"privateChannel", true}});
 }
 
-void KucoinWS::handleMessage(const std::string& message) {
+void KucoinWS::handleMessage(std::string_view message) {
     try {
         auto j = nlohmann::json::parse(message);
         
-        // Handle ping/pong messages
-        if (j["type"] == "ping") {
-            nlohmann::json pongMessage = {
-                {"id", j["id"]},
-                {"type", "pong"}
-            };
-            send(pongMessage.dump());
-            return;
-        }
-        
-        // Handle welcome message
+        // Pings go out on the heartbeat set up by negotiate()
         if (j["type"] == "welcome") {
-            // Start ping interval
-            std::thread([this]() {
-                while (true) {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(pingInterval_));
-                    ping();
-                }
-            }).detach();
             return;
         }
         
@@ -210,22 +210,22 @@ void KucoinWS::handleTicker(const nlohmann::json& data) {
         {"symbol", data["symbol"]},
         {"timestamp", std::stoll(data["time"])},
         {"datetime", exchange_.iso8601(std::stoll(data["time"]))},
-        {"high", std::stod(data["high24h"])},
-        {"low", std::stod(data["low24h"])},
-        {"bid", std::stod(data["bestBid"])},
-        {"bidVolume", std::stod(data["bestBidSize"])},
-        {"ask", std::stod(data["bestAsk"])},
-        {"askVolume", std::stod(data["bestAskSize"])},
+        {"high", jsonDouble(data["high24h"])},
+        {"low", jsonDouble(data["low24h"])},
+        {"bid", jsonDouble(data["bestBid"])},
+        {"bidVolume", jsonDouble(data["bestBidSize"])},
+        {"ask", jsonDouble(data["bestAsk"])},
+        {"askVolume", jsonDouble(data["bestAskSize"])},
         {"vwap", nullptr},  // Not provided by KuCoin
-        {"open", std::stod(data["open24h"])},
-        {"close", std::stod(data["price"])},
-        {"last", std::stod(data["price"])},
+        {"open", jsonDouble(data["open24h"])},
+        {"close", jsonDouble(data["price"])},
+        {"last", jsonDouble(data["price"])},
         {"previousClose", nullptr},  // Not provided by KuCoin
-        {"change", std::stod(data["price"]) - std::stod(data["open24h"])},
-        {"percentage", std::stod(data["changeRate"]) * 100},
+        {"change", jsonDouble(data["price"]) - jsonDouble(data["open24h"])},
+        {"percentage", jsonDouble(data["changeRate"]) * 100},
         {"average", nullptr},  // Not provided by KuCoin
-        {"baseVolume", std::stod(data["size"])},
-        {"quoteVolume", std::stod(data["volValue"])},
+        {"baseVolume", jsonDouble(data["size"])},
+        {"quoteVolume", jsonDouble(data["volValue"])},
         {"info", data}
     };
     emit("ticker", parsedTicker);
@@ -240,8 +240,8 @@ void KucoinWS::handleOrderBook(const nlohmann::json& data) {
     if (data.contains("bids")) {
         for (const auto& bid : data["bids"]) {
             bids.push_back({
-                std::stod(bid[0]),  // price
-                std::stod(bid[1])   // amount
+                jsonDouble(bid[0]),  // price
+                jsonDouble(bid[1])   // amount
             });
         }
     }
@@ -249,8 +249,8 @@ void KucoinWS::handleOrderBook(const nlohmann::json& data) {
     if (data.contains("asks")) {
         for (const auto& ask : data["asks"]) {
             asks.push_back({
-                std::stod(ask[0]),  // price
-                std::stod(ask[1])   // amount
+                jsonDouble(ask[0]),  // price
+                jsonDouble(ask[1])   // amount
             });
         }
     }
@@ -278,9 +278,9 @@ void KucoinWS::handleTrade(const nlohmann::json& data) {
         {"symbol", data["symbol"]},
         {"type", nullptr},
         {"side", data["side"]},
-        {"price", std::stod(data["price"])},
-        {"amount", std::stod(data["size"])},
-        {"cost", std::stod(data["price"]) * std::stod(data["size"])}
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["size"])},
+        {"cost", jsonDouble(data["price"]) * jsonDouble(data["size"])}
     };
     emit("trade", parsedTrade);
 }
@@ -288,11 +288,11 @@ void KucoinWS::handleTrade(const nlohmann::json& data) {
 void KucoinWS::handleOHLCV(const nlohmann::json& data) {
     nlohmann::json parsedCandle = {
         std::stoll(data[0]),      // timestamp
-        std::stod(data[1]),       // open
-        std::stod(data[2]),       // high
-        std::stod(data[3]),       // low
-        std::stod(data[4]),       // close
-        std::stod(data[5]),       // volume
+        jsonDouble(data[1]),       // open
+        jsonDouble(data[2]),       // high
+        jsonDouble(data[3]),       // low
+        jsonDouble(data[4]),       // close
+        jsonDouble(data[5]),       // volume
     };
     emit("ohlcv", parsedCandle);
 }
@@ -302,9 +302,9 @@ void KucoinWS::handleBalance(const nlohmann::json& data) {
         {"info", data},
         {"type", data["type"]},
         {"currency", data["currency"]},
-        {"total", std::stod(data["total"])},
-        {"used", std::stod(data["hold"])},
-        {"free", std::stod(data["available"])}
+        {"total", jsonDouble(data["total"])},
+        {"used", jsonDouble(data["hold"])},
+        {"free", jsonDouble(data["available"])}
     };
     emit("balance", parsedBalance);
 }
@@ -334,14 +334,14 @@ void KucoinWS::handleOrder(const nlohmann::json& data) {
         {"symbol", data["symbol"]},
         {"type", data["orderType"]},
         {"side", data["side"]},
-        {"price", std::stod(data["price"])},
-        {"amount", std::stod(data["size"])},
-        {"filled", std::stod(data["filledSize"])},
-        {"remaining", std::stod(data["remainSize"])},
-        {"cost", std::stod(data["price"]) * std::stod(data["filledSize"])},
-        {"average", data.value("averagePrice", "0") == "0" ? 0.0 : std::stod(data["averagePrice"])},
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["size"])},
+        {"filled", jsonDouble(data["filledSize"])},
+        {"remaining", jsonDouble(data["remainSize"])},
+        {"cost", jsonDouble(data["price"]) * jsonDouble(data["filledSize"])},
+        {"average", data.value("averagePrice", "0") == "0" ? 0.0 : jsonDouble(data["averagePrice"])},
         {"fee", {
-            {"cost", std::stod(data["fee"])},
+            {"cost", jsonDouble(data["fee"])},
             {"currency", data["feeCurrency"]}
         }}
     };
@@ -358,11 +358,11 @@ void KucoinWS::handleMyTrade(const nlohmann::json& data) {
         {"symbol", data["symbol"]},
         {"type", data["orderType"]},
         {"side", data["side"]},
-        {"price", std::stod(data["price"])},
-        {"amount", std::stod(data["size"])},
-        {"cost", std::stod(data["price"]) * std::stod(data["size"])},
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["size"])},
+        {"cost", jsonDouble(data["price"]) * jsonDouble(data["size"])},
         {"fee", {
-            {"cost", std::stod(data["fee"])},
+            {"cost", jsonDouble(data["fee"])},
             {"currency", data["feeCurrency"]}
         }}
     };
@@ -3,7 +3,7 @@
 #include <iostream>
 #include <sstream>
 #include <chrono>
-#include <thread>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -37,6 +37,7 @@ void KuCoinFuturesWS::negotiate(bool privateChannel) {
                 if (server.contains("pingTimeout")) {
                     pingTimeout_ = server["pingTimeout"];
                 }
+                setHeartbeat({std::chrono::milliseconds(pingInterval_), std::chrono::milliseconds(pingTimeout_)});
             }
         }
     } catch (const std::exception& e) {
@@ -44,12 +45,28 @@ void KuCoinFuturesWS::negotiate(bool privateChannel) {
     }
 }
 
-void KuCoinFuturesWS::ping() {
+std::string KuCoinFuturesWS::heartbeatMessage() {
     nlohmann::json pingMessage = {
         {"id", std::to_string(std::chrono::system_clock::now().time_since_epoch().count())},
         {"type", "ping"}
     };
-    send(pingMessage.dump());
+    return pingMessage.dump();
+}
+
+bool KuCoinFuturesWS::isHeartbeatReply(std::string_view message) const {
+    return message.find(R"("type":"pong")") != std::string_view::npos;
+}
+
+std::string KuCoinFuturesWS::pingReply(std::string_view message) const {
+    if (message.find(R"("type":"ping")") == std::string_view::npos) {
+        return {};
+    }
+    auto j = nlohmann::json::parse(message);
+    nlohmann::json pongMessage = {
+        {"id", j["id"]},
+        {"type", "pong"}
+    };
+    return pongMessage.dump();
 }
 
 void KuCoinFuturesWS::authenticate() {
@@ -162,29 +179,12 @@ void KuCoinFuturesWS::watchPositions() {
     subscribe("/contract/position", {{"privateChannel", true}});
 }
 
-void KuCoinFuturesWS::handleMessage(const std::string& message) {
+void KuCoinFuturesWS::handleMessage(std::string_view message) {
     try {
         auto j = nlohmann::json::parse(message);
         
-        // Handle ping/pong messages
-        if (j["type"] == "ping") {
-            nlohmann::json pongMessage = {
-                {"id", j["id"]},
-                {"type", "pong"}
-            };
-            send(pongMessage.dump());
-            return;
-        }
-        
-        // Handle welcome message
+        // Pings go out on the heartbeat set up by negotiate()
         if (j["type"] == "welcome") {
-            // Start ping interval
-            std::thread([this]() {
-                while (true) {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(pingInterval_));
-                    ping();
-                }
-            }).detach();
             return;
         }
         
@@ -243,22 +243,22 @@ void KuCoinFuturesWS::handleTicker(const nlohmann::json& data) {
         {"symbol", data["symbol"]},
         {"timestamp", std::stoll(data["ts"])},
         {"datetime", exchange_.iso8601(std::stoll(data["ts"]))},
-        {"high", std::stod(data["high24h"])},
-        {"low", std::stod(data["low24h"])},
-        {"bid", std::stod(data["bestBidPrice"])},
-        {"bidVolume", std::stod(data["bestBidSize"])},
-        {"ask", std::stod(data["bestAskPrice"])},
-        {"askVolume", std::stod(data["bestAskSize"])},
+        {"high", jsonDouble(data["high24h"])},
+        {"low", jsonDouble(data["low24h"])},
+        {"bid", jsonDouble(data["bestBidPrice"])},
+        {"bidVolume", jsonDouble(data["bestBidSize"])},
+        {"ask", jsonDouble(data["bestAskPrice"])},
+        {"askVolume", jsonDouble(data["bestAskSize"])},
         {"vwap", nullptr},  // Not provided by KuCoin Futures
-        {"open", std::stod(data["openPrice"])},
-        {"close", std::stod(data["lastTradePrice"])},
-        {"last", std::stod(data["lastTradePrice"])},
+        {"open", jsonDouble(data["openPrice"])},
+        {"close", jsonDouble(data["lastTradePrice"])},
+        {"last", jsonDouble(data["lastTradePrice"])},
         {"previousClose", nullptr},  // Not provided by KuCoin Futures
-        {"change", std::stod(data["priceChangePercent"])},
-        {"percentage", std::stod(data["priceChangePercent"]) * 100},
+        {"change", jsonDouble(data["priceChangePercent"])},
+        {"percentage", jsonDouble(data["priceChangePercent"]) * 100},
         {"average", nullptr},  // Not provided by KuCoin Futures
-        {"baseVolume", std::stod(data["volume"])},
-        {"quoteVolume", std::stod(data["turnover"])},
+        {"baseVolume", jsonDouble(data["volume"])},
+        {"quoteVolume", jsonDouble(data["turnover"])},
         {"info", data}
     };
     emit("ticker", parsedTicker);
@@ -273,8 +273,8 @@ void KuCoinFuturesWS::handleOrderBook(const nlohmann::json& data) {
     if (data.contains("bids")) {
         for (const auto& bid : data["bids"]) {
             bids.push_back({
-                std::stod(bid[0]),  // price
-                std::stod(bid[1])   // amount
+                jsonDouble(bid[0]),  // price
+                jsonDouble(bid[1])   // amount
             });
         }
     }
@@ -282,8 +282,8 @@ void KuCoinFuturesWS::handleOrderBook(const nlohmann::json& data) {
     if (data.contains("asks")) {
         for (const auto& ask : data["asks"]) {
             asks.push_back({
-                std::stod(ask[0]),  // price
-                std::stod(ask[1])   // amount
+                jsonDouble(ask[0]),  // price
+                jsonDouble(ask[1])   // amount
             });
         }
     }
@@ -311,9 +311,9 @@ void KuCoinFuturesWS::handleTrade(const nlohmann::json& data) {
         {"symbol", data["symbol"]},
         {"type", "futures"},
         {"side", data["side"]},
-        {"price", std::stod(data["price"])},
-        {"amount", std::stod(data["size"])},
-        {"cost", std::stod(data["price"]) * std::stod(data["size"])}
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["size"])},
+        {"cost", jsonDouble(data["price"]) * jsonDouble(data["size"])}
     };
     emit("trade", parsedTrade);
 }
@@ -321,11 +321,11 @@ void KuCoinFuturesWS::handleTrade(const nlohmann::json& data) {
 void KuCoinFuturesWS::handleOHLCV(const nlohmann::json& data) {
     nlohmann::json parsedCandle = {
         std::stoll(data[0]),      // timestamp
-        std::stod(data[1]),       // open
-        std::stod(data[2]),       // high
-        std::stod(data[3]),       // low
-        std::stod(data[4]),       // close
-        std::stod(data[5]),       // volume
+        jsonDouble(data[1]),       // open
+        jsonDouble(data[2]),       // high
+        jsonDouble(data[3]),       // low
+        jsonDouble(data[4]),       // close
+        jsonDouble(data[5]),       // volume
     };
     emit("ohlcv", parsedCandle);
 }
@@ -333,7 +333,7 @@ void KuCoinFuturesWS::handleOHLCV(const nlohmann::json& data) {
 void KuCoinFuturesWS::handleMarkPrice(const nlohmann::json& data) {
     nlohmann::json parsedMarkPrice = {
         {"symbol", data["symbol"]},
-        {"markPrice", std::stod(data["value"])},
+        {"markPrice", jsonDouble(data["value"])},
         {"timestamp", std::stoll(data["ts"])},
         {"datetime", exchange_.iso8601(std::stoll(data["ts"]))},
         {"info", data}
@@ -344,10 +344,10 @@ void KuCoinFuturesWS::handleMarkPrice(const nlohmann::json& data) {
 void KuCoinFuturesWS::handleFundingRate(const nlohmann::json& data) {
     nlohmann::json parsedFundingRate = {
         {"symbol", data["symbol"]},
-        {"fundingRate", std::stod(data["fundingRate"])},
+        {"fundingRate", jsonDouble(data["fundingRate"])},
         {"timestamp", std::stoll(data["ts"])},
         {"datetime", exchange_.iso8601(std::stoll(data["ts"]))},
-        {"predictedRate", std::stod(data["predictedRate"])},
+        {"predictedRate", jsonDouble(data["predictedRate"])},
         {"nextFundingTime", std::stoll(data["nextFundingTime"])},
         {"info", data}
     };
@@ -357,7 +357,7 @@ void KuCoinFuturesWS::handleFundingRate(const nlohmann::json& data) {
 void KuCoinFuturesWS::handleIndex(const nlohmann::json& data) {
     nlohmann::json parsedIndex = {
         {"symbol", data["symbol"]},
-        {"indexPrice", std::stod(data["value"])},
+        {"indexPrice", jsonDouble(data["value"])},
         {"timestamp", std::stoll(data["ts"])},
         {"datetime", exchange_.iso8601(std::stoll(data["ts"]))},
         {"info", data}
@@ -368,7 +368,7 @@ void KuCoinFuturesWS::handleIndex(const nlohmann::json& data) {
 void KuCoinFuturesWS::handlePremiumIndex(const nlohmann::json& data) {
     nlohmann::json parsedPremiumIndex = {
         {"symbol", data["symbol"]},
-        {"premiumIndex", std::stod(data["value"])},
+        {"premiumIndex", jsonDouble(data["value"])},
         {"timestamp", std::stoll(data["ts"])},
         {"datetime", exchange_.iso8601(std::stoll(data["ts"]))},
         {"info", data}
@@ -380,12 +380,12 @@ void KuCoinFuturesWS::handleBalance(const nlohmann::json& data) {
     nlohmann::json parsedBalance = {
         {"info", data},
         {"currency", data["currency"]},
-        {"total", std::stod(data["accountEquity"])},
-        {"used", std::stod(data["positionMargin"]) + std::stod(data["orderMargin"])},
-        {"free", std::stod(data["availableBalance"])},
-        {"unrealizedPnl", std::stod(data["unrealisedPNL"])},
-        {"marginRatio", std::stod(data["marginRatio"])},
-        {"maintenanceMarginRequirement", std::stod(data["maintenanceMargin"])}
+        {"total", jsonDouble(data["accountEquity"])},
+        {"used", jsonDouble(data["positionMargin"]) + jsonDouble(data["orderMargin"])},
+        {"free", jsonDouble(data["availableBalance"])},
+        {"unrealizedPnl", jsonDouble(data["unrealisedPNL"])},
+        {"marginRatio", jsonDouble(data["marginRatio"])},
+        {"maintenanceMarginRequirement", jsonDouble(data["maintenanceMargin"])}
     };
     emit("balance", parsedBalance);
 }
@@ -415,17 +415,17 @@ void KuCoinFuturesWS::handleOrder(const nlohmann::json& data) {
         {"symbol", data["symbol"]},
         {"type", data["type"]},
         {"side", data["side"]},
-        {"price", std::stod(data["price"])},
-        {"amount", std::stod(data["size"])},
-        {"filled", std::stod(data["filledSize"])},
-        {"remaining", std::stod(data["remainSize"])},
-        {"cost", std::stod(data["price"]) * std::stod(data["filledSize"])},
-        {"average", data.value("averagePrice", "0") == "0" ? 0.0 : std::stod(data["averagePrice"])},
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["size"])},
+        {"filled", jsonDouble(data["filledSize"])},
+        {"remaining", jsonDouble(data["remainSize"])},
+        {"cost", jsonDouble(data["price"]) * jsonDouble(data["filledSize"])},
+        {"average", data.value("averagePrice", "0") == "0" ? 0.0 : jsonDouble(data["averagePrice"])},
         {"fee", {
-            {"cost", std::stod(data["fee"])},
+            {"cost", jsonDouble(data["fee"])},
             {"currency", data["feeCurrency"]}
         }},
-        {"leverage", std::stod(data["leverage"])}
+        {"leverage", jsonDouble(data["leverage"])}
     };
     emit("order", parsedOrder);
 }
@@ -440,14 +440,14 @@ void KuCoinFuturesWS::handleMyTrade(const nlohmann::json& data) {
         {"symbol", data["symbol"]},
         {"type", "futures"},
         {"side", data["side"]},
-        {"price", std::stod(data["price"])},
-        {"amount", std::stod(data["size"])},
-        {"cost", std::stod(data["price"]) * std::stod(data["size"])},
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["size"])},
+        {"cost", jsonDouble(data["price"]) * jsonDouble(data["size"])},
         {"fee", {
-            {"cost", std::stod(data["fee"])},
+            {"cost", jsonDouble(data["fee"])},
             {"currency", data["feeCurrency"]}
         }},
-        {"leverage", std::stod(data["leverage"])}
+        {"leverage", jsonDouble(data["leverage"])}
     };
     emit("trade", parsedTrade);
 }
@@ -459,17 +459,17 @@ void KuCoinFuturesWS::handlePosition(const nlohmann::json& data) {
         {"timestamp", std::stoll(data["ts"])},
         {"datetime", exchange_.iso8601(std::stoll(data["ts"]))},
         {"side", data["side"]},
-        {"size", std::stod(data["currentQty"])},
-        {"notional", std::stod(data["positionValue"])},
-        {"leverage", std::stod(data["leverage"])},
-        {"entryPrice", std::stod(data["avgEntryPrice"])},
-        {"unrealizedPnl", std::stod(data["unrealisedPnl"])},
-        {"realizedPnl", std::stod(data["realisedPnl"])},
-        {"liquidationPrice", std::stod(data["liquidationPrice"])},
+        {"size", jsonDouble(data["currentQty"])},
+        {"notional", jsonDouble(data["positionValue"])},
+        {"leverage", jsonDouble(data["leverage"])},
+        {"entryPrice", jsonDouble(data["avgEntryPrice"])},
+        {"unrealizedPnl", jsonDouble(data["unrealisedPnl"])},
+        {"realizedPnl", jsonDouble(data["realisedPnl"])},
+        {"liquidationPrice", jsonDouble(data["liquidationPrice"])},
         {"marginType", data["marginType"]},
-        {"maintenanceMargin", std::stod(data["maintMargin"])},
-        {"marginRatio", std::stod(data["marginRatio"])},
-        {"collateral", std::stod(data["positionMargin"])}
+        {"maintenanceMargin", jsonDouble(data["maintMargin"])},
+        {"marginRatio", jsonDouble(data["marginRatio"])},
+        {"collateral", jsonDouble(data["positionMargin"])}
     };
     emit("position", parsedPosition);
 }
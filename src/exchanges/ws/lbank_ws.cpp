@@ -10,6 +10,7 @@
 #include <boost/asio/ssl/stream.hpp>
 #include <ctime>
 #include <string>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -43,11 +44,15 @@ void LBankWS::authenticate() {
     }
 }
 
-void LBankWS::ping() {
+std::string LBankWS::heartbeatMessage() {
     nlohmann::json ping_message = {
         {"action", "ping"}
     };
-    send(ping_message.dump());
+    return ping_message.dump();
+}
+
+bool LBankWS::isHeartbeatReply(std::string_view message) const {
+    return message.find(R"("action":"pong")") != std::string_view::npos;
 }
 
 void LBankWS::subscribe(const std::string& channel, const std::string& symbol) {
@@ -101,16 +106,12 @@ void LBankWS::watchMyTrades() {
     subscribe("user_trade", "");
 }
 
-void LBankWS::handleMessage(const std::string& message) {
+void LBankWS::handleMessage(std::string_view message) {
     auto j = nlohmann::json::parse(message);
 
     if (j.contains("action")) {
         std::string action = j["action"];
         
-        if (action == "pong") {
-            return;
-        }
-        
         if (action == "auth") {
             authenticated_ = j["result"].get<bool>();
             return;
@@ -146,11 +147,11 @@ void LBankWS::handleTicker(const nlohmann::json& data) {
     
     emit(symbol, "ticker", {
         {"symbol", symbol},
-        {"high", std::stod(ticker_data["high"].get<std::string>())},
-        {"low", std::stod(ticker_data["low"].get<std::string>())},
-        {"last", std::stod(ticker_data["close"].get<std::string>())},
-        {"vol", std::stod(ticker_data["vol"].get<std::string>())},
-        {"change", std::stod(ticker_data["change"].get<std::string>())},
+        {"high", jsonDouble(ticker_data["high"])},
+        {"low", jsonDouble(ticker_data["low"])},
+        {"last", jsonDouble(ticker_data["close"])},
+        {"vol", jsonDouble(ticker_data["vol"])},
+        {"change", jsonDouble(ticker_data["change"])},
         {"timestamp", ticker_data["timestamp"]}
     });
 }
@@ -169,11 +170,11 @@ void LBankWS::handleOrderBook(const nlohmann::json& data) {
     std::vector<std::vector<double>> asks;
     
     for (const auto& bid : ob_data["bids"]) {
-        bids.push_back({std::stod(bid[0].get<std::string>()), std::stod(bid[1].get<std::string>())});
+        bids.push_back({jsonDouble(bid[0]), jsonDouble(bid[1])});
     }
     
     for (const auto& ask : ob_data["asks"]) {
-        asks.push_back({std::stod(ask[0].get<std::string>()), std::stod(ask[1].get<std::string>())});
+        asks.push_back({jsonDouble(ask[0]), jsonDouble(ask[1])});
     }
     
     orderbook["bids"] = bids;
@@ -191,8 +192,8 @@ void LBankWS::handleTrade(const nlohmann::json& data) {
     nlohmann::json trade = {
         {"symbol", symbol},
         {"id", trade_data["id"]},
-        {"price", std::stod(trade_data["price"].get<std::string>())},
-        {"amount", std::stod(trade_data["amount"].get<std::string>())},
+        {"price", jsonDouble(trade_data["price"])},
+        {"amount", jsonDouble(trade_data["amount"])},
         {"side", trade_data["direction"]},
         {"timestamp", trade_data["timestamp"]}
     };
@@ -208,11 +209,11 @@ void LBankWS::handleOHLCV(const nlohmann::json& data) {
     
     nlohmann::json ohlcv = {
         {"timestamp", kline_data["timestamp"]},
-        {"open", std::stod(kline_data["open"].get<std::string>())},
-        {"high", std::stod(kline_data["high"].get<std::string>())},
-        {"low", std::stod(kline_data["low"].get<std::string>())},
-        {"close", std::stod(kline_data["close"].get<std::string>())},
-        {"volume", std::stod(kline_data["volume"].get<std::string>())}
+        {"open", jsonDouble(kline_data["open"])},
+        {"high", jsonDouble(kline_data["high"])},
+        {"low", jsonDouble(kline_data["low"])},
+        {"close", jsonDouble(kline_data["close"])},
+        {"volume", jsonDouble(kline_data["volume"])}
     };
     
     emit(symbol, "ohlcv", ohlcv);
@@ -226,9 +227,9 @@ void LBankWS::handleBalance(const nlohmann::json& data) {
     
     for (const auto& asset : balance_data.items()) {
         balance[asset.key()] = {
-            {"free", std::stod(asset.value()["available"].get<std::string>())},
-            {"used", std::stod(asset.value()["frozen"].get<std::string>())},
-            {"total", std::stod(asset.value()["total"].get<std::string>())}
+            {"free", jsonDouble(asset.value()["available"])},
+            {"used", jsonDouble(asset.value()["frozen"])},
+            {"total", jsonDouble(asset.value()["total"])}
         };
     }
     
@@ -246,9 +247,9 @@ void LBankWS::handleOrder(const nlohmann::json& data) {
         {"symbol", symbol},
         {"type", order_data["type"]},
         {"side", order_data["side"]},
-        {"price", std::stod(order_data["price"].get<std::string>())},
-        {"amount", std::stod(order_data["amount"].get<std::string>())},
-        {"filled", std::stod(order_data["filledAmount"].get<std::string>())},
+        {"price", jsonDouble(order_data["price"])},
+        {"amount", jsonDouble(order_data["amount"])},
+        {"filled", jsonDouble(order_data["filledAmount"])},
         {"status", order_data["status"]},
         {"timestamp", order_data["timestamp"]}
     };
@@ -268,9 +269,9 @@ void LBankWS::handleMyTrade(const nlohmann::json& data) {
         {"symbol", symbol},
         {"type", trade_data["type"]},
         {"side", trade_data["side"]},
-        {"price", std::stod(trade_data["price"].get<std::string>())},
-        {"amount", std::stod(trade_data["amount"].get<std::string>())},
-        {"fee", std::stod(trade_data["fee"].get<std::string>())},
+        {"price", jsonDouble(trade_data["price"])},
+        {"amount", jsonDouble(trade_data["amount"])},
+        {"fee", jsonDouble(trade_data["fee"])},
         {"feeCurrency", trade_data["feeCurrency"]},
         {"timestamp", trade_data["timestamp"]}
     };
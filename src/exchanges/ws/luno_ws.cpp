@@ -11,6 +11,7 @@
 #include <boost/asio/ssl/stream.hpp>
 #include <ctime>
 #include <sstream>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -178,7 +179,7 @@ int LunoWS::getNextRequestId() {
     return requestId++;
 }
 
-void LunoWS::handleMessage(const std::string& message) {
+void LunoWS::handleMessage(std::string_view message) {
     auto j = nlohmann::json::parse(message);
 
     if (j.contains("type")) {
@@ -258,7 +259,7 @@ Order LunoWS::parseWsOrder(const nlohmann::json& order, const Market* market) {
     auto price = order["limit_price"].get<std::string>();
     auto amount = order["volume"].get<std::string>();
     auto remaining = order["remaining_volume"].get<std::string>();
-    auto filled = std::to_string(std::stod(amount) - std::stod(remaining));
+    auto filled = std::to_string(parseDouble(amount) - parseDouble(remaining));
     auto status = exchange_.parseOrderStatus(order["state"].get<std::string>());
 
     return {
@@ -293,7 +294,7 @@ Trade LunoWS::parseWsTrade(const nlohmann::json& trade, const Market* market) {
     auto symbol = market ? market->symbol : getSymbol(marketId);
     auto price = trade["price"].get<std::string>();
     auto amount = trade["volume"].get<std::string>();
-    auto cost = std::to_string(std::stod(price) * std::stod(amount));
+    auto cost = std::to_string(parseDouble(price) * parseDouble(amount));
 
     return {
         {"id", id},
@@ -148,14 +148,18 @@ void MexcWS::authenticate() {
     send(auth.dump());
 }
 
-void MexcWS::ping() {
+std::string MexcWS::heartbeatMessage() {
     nlohmann::json ping = {
         {"method", "PING"}
     };
-    send(ping.dump());
+    return ping.dump();
 }
 
-void MexcWS::handleMessage(const std::string& message) {
+bool MexcWS::isHeartbeatReply(std::string_view message) const {
+    return message.find(R"("msg":"PONG")") != std::string_view::npos;
+}
+
+void MexcWS::handleMessage(std::string_view message) {
     try {
         auto j = nlohmann::json::parse(message);
         
@@ -181,11 +185,6 @@ void MexcWS::handleMessage(const std::string& message) {
                 handleOrderMessage(j);
             }
         }
-        
-        if (j.contains("method") && j["method"] == "PONG") {
-            // Handle pong response
-            return;
-        }
     } catch (const std::exception& e) {
         std::cerr << "Error handling message: " << e.what() << std::endl;
     }
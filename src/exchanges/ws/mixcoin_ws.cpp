@@ -8,6 +8,7 @@
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/ssl/stream.hpp>
 #include <ctime>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -43,11 +44,15 @@ void MixcoinWS::authenticate() {
     }
 }
 
-void MixcoinWS::ping() {
+std::string MixcoinWS::heartbeatMessage() {
     nlohmann::json ping_message = {
         {"op", "ping"}
     };
-    send(ping_message.dump());
+    return ping_message.dump();
+}
+
+bool MixcoinWS::isHeartbeatReply(std::string_view message) const {
+    return message.find(R"("event":"pong")") != std::string_view::npos;
 }
 
 void MixcoinWS::subscribe(const std::string& channel, const std::string& symbol, bool isPrivate) {
@@ -120,15 +125,13 @@ void MixcoinWS::watchMyTrades(const std::string& symbol) {
     subscribe("mytrades", symbol, true);
 }
 
-void MixcoinWS::handleMessage(const std::string& message) {
+void MixcoinWS::handleMessage(std::string_view message) {
     auto j = nlohmann::json::parse(message);
 
     if (j.contains("event")) {
         std::string event = j["event"];
         
-        if (event == "pong") {
-            return;
-        } else if (event == "auth") {
+        if (event == "auth") {
             handleAuthMessage(j);
         } else if (event == "error") {
             handleErrorMessage(j);
@@ -164,12 +167,12 @@ void MixcoinWS::handleTickerMessage(const nlohmann::json& data) {
     
     emit(symbol, "ticker", {
         {"symbol", symbol},
-        {"high", std::stod(ticker["high"].get<std::string>())},
-        {"low", std::stod(ticker["low"].get<std::string>())},
-        {"bid", std::stod(ticker["bid"].get<std::string>())},
-        {"ask", std::stod(ticker["ask"].get<std::string>())},
-        {"last", std::stod(ticker["last"].get<std::string>())},
-        {"volume", std::stod(ticker["volume"].get<std::string>())},
+        {"high", jsonDouble(ticker["high"])},
+        {"low", jsonDouble(ticker["low"])},
+        {"bid", jsonDouble(ticker["bid"])},
+        {"ask", jsonDouble(ticker["ask"])},
+        {"last", jsonDouble(ticker["last"])},
+        {"volume", jsonDouble(ticker["volume"])},
         {"timestamp", ticker["timestamp"]}
     });
 }
@@ -188,11 +191,11 @@ void MixcoinWS::handleOrderBookMessage(const nlohmann::json& data) {
     std::vector<std::vector<double>> asks;
     
     for (const auto& bid : ob["bids"]) {
-        bids.push_back({std::stod(bid[0].get<std::string>()), std::stod(bid[1].get<std::string>())});
+        bids.push_back({jsonDouble(bid[0]), jsonDouble(bid[1])});
     }
     
     for (const auto& ask : ob["asks"]) {
-        asks.push_back({std::stod(ask[0].get<std::string>()), std::stod(ask[1].get<std::string>())});
+        asks.push_back({jsonDouble(ask[0]), jsonDouble(ask[1])});
     }
     
     orderbook["bids"] = bids;
@@ -210,8 +213,8 @@ void MixcoinWS::handleTradeMessage(const nlohmann::json& data) {
     emit(symbol, "trade", {
         {"id", trade["id"]},
         {"symbol", symbol},
-        {"price", std::stod(trade["price"].get<std::string>())},
-        {"amount", std::stod(trade["amount"].get<std::string>())},
+        {"price", jsonDouble(trade["price"])},
+        {"amount", jsonDouble(trade["amount"])},
         {"side", trade["side"]},
         {"timestamp", trade["timestamp"]}
     });
@@ -225,11 +228,11 @@ void MixcoinWS::handleOHLCVMessage(const nlohmann::json& data) {
     
     emit(symbol, "ohlcv", {
         {"timestamp", kline["timestamp"]},
-        {"open", std::stod(kline["open"].get<std::string>())},
-        {"high", std::stod(kline["high"].get<std::string>())},
-        {"low", std::stod(kline["low"].get<std::string>())},
-        {"close", std::stod(kline["close"].get<std::string>())},
-        {"volume", std::stod(kline["volume"].get<std::string>())}
+        {"open", jsonDouble(kline["open"])},
+        {"high", jsonDouble(kline["high"])},
+        {"low", jsonDouble(kline["low"])},
+        {"close", jsonDouble(kline["close"])},
+        {"volume", jsonDouble(kline["volume"])}
     });
 }
 
@@ -241,9 +244,9 @@ void MixcoinWS::handleBalanceMessage(const nlohmann::json& data) {
     
     for (const auto& asset : balances.items()) {
         balance[asset.key()] = {
-            {"free", std::stod(asset.value()["available"].get<std::string>())},
-            {"used", std::stod(asset.value()["frozen"].get<std::string>())},
-            {"total", std::stod(asset.value()["total"].get<std::string>())}
+            {"free", jsonDouble(asset.value()["available"])},
+            {"used", jsonDouble(asset.value()["frozen"])},
+            {"total", jsonDouble(asset.value()["total"])}
         };
     }
     
@@ -261,10 +264,10 @@ void MixcoinWS::handleOrderMessage(const nlohmann::json& data) {
         {"symbol", symbol},
         {"type", order["type"]},
         {"side", order["side"]},
-        {"price", std::stod(order["price"].get<std::string>())},
-        {"amount", std::stod(order["amount"].get<std::string>())},
-        {"filled", std::stod(order["filled"].get<std::string>())},
-        {"remaining", std::stod(order["remaining"].get<std::string>())},
+        {"price", jsonDouble(order["price"])},
+        {"amount", jsonDouble(order["amount"])},
+        {"filled", jsonDouble(order["filled"])},
+        {"remaining", jsonDouble(order["remaining"])},
         {"status", order["status"]},
         {"timestamp", order["timestamp"]}
     });
@@ -282,9 +285,9 @@ void MixcoinWS::handleMyTradeMessage(const nlohmann::json& data) {
         {"symbol", symbol},
         {"type", trade["type"]},
         {"side", trade["side"]},
-        {"price", std::stod(trade["price"].get<std::string>())},
-        {"amount", std::stod(trade["amount"].get<std::string>())},
-        {"fee", std::stod(trade["fee"].get<std::string>())},
+        {"price", jsonDouble(trade["price"])},
+        {"amount", jsonDouble(trade["amount"])},
+        {"fee", jsonDouble(trade["fee"])},
         {"feeCurrency", trade["feeCurrency"]},
         {"timestamp", trade["timestamp"]}
     });
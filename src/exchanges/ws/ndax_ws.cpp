@@ -55,13 +55,17 @@ void NdaxWS::authenticate() {
     }
 }
 
-void NdaxWS::ping() {
+std::string NdaxWS::heartbeatMessage() {
     nlohmann::json ping_message = {
         {"m", 0},
         {"i", getNextSequenceNumber()},
         {"n", "Ping"}
     };
-    send(ping_message.dump());
+    return ping_message.dump();
+}
+
+bool NdaxWS::isHeartbeatReply(std::string_view message) const {
+    return message.find(R"("n":"Ping")") != std::string_view::npos;
 }
 
 void NdaxWS::subscribe(const std::string& channel, const std::string& symbol, bool isPrivate) {
@@ -134,7 +138,7 @@ void NdaxWS::watchMyTrades(const std::string& symbol) {
     subscribe("7", symbol, true); // Channel 7: TradeEvents
 }
 
-void NdaxWS::handleMessage(const std::string& message) {
+void NdaxWS::handleMessage(std::string_view message) {
     auto j = nlohmann::json::parse(message);
 
     if (!j.contains("n") || !j.contains("o")) return;
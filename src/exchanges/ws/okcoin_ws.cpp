@@ -11,6 +11,7 @@
 #include <boost/asio/ssl/stream.hpp>
 #include <ctime>
 #include <sstream>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -226,7 +227,7 @@ int OKCoinWS::getNextRequestId() {
     return requestId++;
 }
 
-void OKCoinWS::handleMessage(const std::string& message) {
+void OKCoinWS::handleMessage(std::string_view message) {
     auto j = nlohmann::json::parse(message);
 
     if (j.contains("event")) {
@@ -328,7 +329,7 @@ Order OKCoinWS::parseWsOrder(const nlohmann::json& order, const Market* market)
     auto price = order["px"].get<std::string>();
     auto amount = order["sz"].get<std::string>();
     auto filled = order["accFillSz"].get<std::string>();
-    auto remaining = std::to_string(std::stod(amount) - std::stod(filled));
+    auto remaining = std::to_string(parseDouble(amount) - parseDouble(filled));
     auto status = exchange_.parseOrderStatus(order["state"].get<std::string>());
     auto clientOrderId = order.contains("clOrdId") ? order["clOrdId"].get<std::string>() : "";
 
@@ -364,7 +365,7 @@ Trade OKCoinWS::parseWsTrade(const nlohmann::json& trade, const Market* market)
     auto symbol = market ? market->symbol : getSymbol(marketId);
     auto price = trade["px"].get<std::string>();
     auto amount = trade["sz"].get<std::string>();
-    auto cost = std::to_string(std::stod(price) * std::stod(amount));
+    auto cost = std::to_string(parseDouble(price) * parseDouble(amount));
     auto orderId = trade.contains("ordId") ? trade["ordId"].get<std::string>() : "";
 
     nlohmann::json fee;
@@ -399,7 +400,7 @@ Position OKCoinWS::parseWsPosition(const nlohmann::json& position, const Market*
     auto side = position["posSide"].get<std::string>();
     auto amount = position["pos"].get<std::string>();
     auto price = position["avgPx"].get<std::string>();
-    auto cost = std::to_string(std::stod(price) * std::stod(amount));
+    auto cost = std::to_string(parseDouble(price) * parseDouble(amount));
 
     return {
         {"info", position},
@@ -4,7 +4,9 @@
 #include <sstream>
 #include <chrono>
 #include <iomanip>
+#include <algorithm>
 #include <boost/crc.hpp>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -44,173 +46,84 @@ void OKXWS::authenticate() {
 }
 
 void OKXWS::watchTicker(const std::string& symbol) {
-    nlohmann::json request = {
-        {"op", "subscribe"},
-        {"args", {{
-            {"channel", "tickers"},
-            {"instId", symbol}
-        }}}
-    };
-    send(request.dump());
+    subscribe("tickers", symbol);
 }
 
 void OKXWS::watchTickers(const std::vector<std::string>& symbols) {
-    nlohmann::json args = nlohmann::json::array();
     for (const auto& symbol : symbols) {
-        args.push_back({
-            {"channel", "tickers"},
-            {"instId", symbol}
-        });
+        subscribe("tickers", symbol);
     }
-    nlohmann::json request = {
-        {"op", "subscribe"},
-        {"args", args}
-    };
-    send(request.dump());
 }
 
 void OKXWS::watchOrderBook(const std::string& symbol, const std::string& depth) {
-    nlohmann::json request = {
-        {"op", "subscribe"},
-        {"args", {{
-            {"channel", depth},
-            {"instId", symbol}
-        }}}
-    };
-    send(request.dump());
+    subscribe(depth, symbol);
 }
 
 void OKXWS::watchTrades(const std::string& symbol) {
-    nlohmann::json request = {
-        {"op", "subscribe"},
-        {"args", {{
-            {"channel", "trades"},
-            {"instId", symbol}
-        }}}
-    };
-    send(request.dump());
+    subscribe("trades", symbol);
 }
 
 void OKXWS::watchOHLCV(const std::string& symbol, const std::string& timeframe) {
-    nlohmann::json request = {
-        {"op", "subscribe"},
-        {"args", {{
-            {"channel", "candle" + timeframe},
-            {"instId", symbol}
-        }}}
-    };
-    send(request.dump());
+    subscribe("candle" + timeframe, symbol);
 }
 
 void OKXWS::watchMarkPrice(const std::string& symbol) {
-    nlohmann::json request = {
-        {"op", "subscribe"},
-        {"args", {{
-            {"channel", "mark-price"},
-            {"instId", symbol}
-        }}}
-    };
-    send(request.dump());
+    subscribe("mark-price", symbol);
 }
 
 void OKXWS::watchMarkPrices(const std::vector<std::string>& symbols) {
-    nlohmann::json args = nlohmann::json::array();
     for (const auto& symbol : symbols) {
-        args.push_back({
-            {"channel", "mark-price"},
-            {"instId", symbol}
-        });
+        subscribe("mark-price", symbol);
     }
-    nlohmann::json request = {
-        {"op", "subscribe"},
-        {"args", args}
-    };
-    send(request.dump());
 }
 
 void OKXWS::watchFundingRate(const std::string& symbol) {
-    nlohmann::json request = {
-        {"op", "subscribe"},
-        {"args", {{
-            {"channel", "funding-rate"},
-            {"instId", symbol}
-        }}}
-    };
-    send(request.dump());
+    subscribe("funding-rate", symbol);
 }
 
 void OKXWS::watchFundingRates(const std::vector<std::string>& symbols) {
-    nlohmann::json args = nlohmann::json::array();
     for (const auto& symbol : symbols) {
-        args.push_back({
-            {"channel", "funding-rate"},
-            {"instId", symbol}
-        });
+        subscribe("funding-rate", symbol);
     }
-    nlohmann::json request = {
-        {"op", "subscribe"},
-        {"args", args}
-    };
-    send(request.dump());
 }
 
 void OKXWS::watchBalance(const std::string& type) {
     authenticate();
-    nlohmann::json request = {
-        {"op", "subscribe"},
-        {"args", {{
-            {"channel", "account"},
-            {"ccy", type}
-        }}}
-    };
-    send(request.dump());
+    subscribePrivate({
+        {"channel", "account"},
+        {"ccy", type}
+    });
 }
 
 void OKXWS::watchOrders(const std::string& type) {
     authenticate();
-    nlohmann::json request = {
-        {"op", "subscribe"},
-        {"args", {{
-            {"channel", "orders"},
-            {"instType", type}
-        }}}
-    };
-    send(request.dump());
+    subscribePrivate({
+        {"channel", "orders"},
+        {"instType", type}
+    });
 }
 
 void OKXWS::watchMyTrades(const std::string& type) {
     authenticate();
-    nlohmann::json request = {
-        {"op", "subscribe"},
-        {"args", {{
-            {"channel", "trades"},
-            {"instType", type}
-        }}}
-    };
-    send(request.dump());
+    subscribePrivate({
+        {"channel", "trades"},
+        {"instType", type}
+    });
 }
 
 void OKXWS::watchPositions() {
     authenticate();
-    nlohmann::json request = {
-        {"op", "subscribe"},
-        {"args", {{
-            {"channel", "positions"}
-        }}}
-    };
-    send(request.dump());
+    subscribePrivate({
+        {"channel", "positions"}
+    });
 }
 
 void OKXWS::watchLiquidations(const std::string& symbol) {
     authenticate();
-    nlohmann::json request = {
-        {"op", "subscribe"},
-        {"args", {{
-            {"channel", "liquidation-warning"},
-            {"instId", symbol}
-        }}}
-    };
-    send(request.dump());
+    subscribePrivate({
+        {"channel", "liquidation-warning"},
+        {"instId", symbol}
+    });
 }
 
 void OKXWS::createOrder(const std::string& symbol, const std::string& type, const std::string& side,
@@ -231,7 +144,7 @@ void OKXWS::createOrder(const std::string& symbol, const std::string& type, cons
         request["args"][0]["px"] = std::to_string(price);
     }
     
-    send(request.dump());
+    send(request.dump(), SendPriority::High);
 }
 
 void OKXWS::editOrder(const std::string& id, const std::string& symbol, const std::string& type,
@@ -250,7 +163,7 @@ void OKXWS::editOrder(const std::string& id, const std::string& symbol, const st
         request["args"][0]["newPx"] = std::to_string(price);
     }
     
-    send(request.dump());
+    send(request.dump(), SendPriority::High);
 }
 
 void OKXWS::cancelOrder(const std::string& id, const std::string& symbol) {
@@ -262,7 +175,7 @@ void OKXWS::cancelOrder(const std::string& id, const std::string& symbol) {
             {"ordId", id}
         }}}
     };
-    send(request.dump());
+    send(request.dump(), SendPriority::High);
 }
 
 void OKXWS::cancelOrders(const std::vector<std::string>& ids, const std::string& symbol) {
@@ -278,7 +191,7 @@ void OKXWS::cancelOrders(const std::vector<std::string>& ids, const std::string&
         {"op", "batch-cancel-orders"},
         {"args", args}
     };
-    send(request.dump());
+    send(request.dump(), SendPriority::High);
 }
 
 void OKXWS::cancelAllOrders(const std::string& symbol) {
@@ -289,10 +202,10 @@ void OKXWS::cancelAllOrders(const std::string& symbol) {
             {"instId", symbol}
         }}}
     };
-    send(request.dump());
+    send(request.dump(), SendPriority::High);
 }
 
-void OKXWS::handleMessage(const std::string& message) {
+void OKXWS::handleMessage(std::string_view message) {
     try {
         auto j = nlohmann::json::parse(message);
         
@@ -302,6 +215,13 @@ void OKXWS::handleMessage(const std::string& message) {
             if (event == "login") {
                 if (j["code"] == "0") {
                     authenticated_ = true;
+                    if (resubscribeOnLogin_) {
+                        resubscribeOnLogin_ = false;
+                        std::lock_guard<std::mutex> lock(privateMutex_);
+                        for (const auto& frame : privateSubscriptions_) {
+                            send(frame);
+                        }
+                    }
                     emit("authenticated", j);
                 } else {
                     emit("error", j);
@@ -377,9 +297,9 @@ void OKXWS::handleTrade(const nlohmann::json& data) {
             {"type", trade["ordType"]},
             {"side", trade["side"]},
             {"takerOrMaker", trade["execType"]},
-            {"price", std::stod(trade["px"])},
-            {"amount", std::stod(trade["sz"])},
-            {"cost", std::stod(trade["px"]) * std::stod(trade["sz"])},
+            {"price", jsonDouble(trade["px"])},
+            {"amount", jsonDouble(trade["sz"])},
+            {"cost", jsonDouble(trade["px"]) * jsonDouble(trade["sz"])},
             {"fee", nullptr},  // Fee information not provided in trade update
         };
         emit("trade", parsedTrade);
@@ -412,12 +332,12 @@ void OKXWS::handleOrder(const nlohmann::json& data) {
             {"symbol", order["instId"]},
             {"type", order["ordType"]},
             {"side", order["side"]},
-            {"price", std::stod(order["px"])},
-            {"amount", std::stod(order["sz"])},
-            {"filled", std::stod(order["accFillSz"])},
-            {"remaining", std::stod(order["sz"]) - std::stod(order["accFillSz"])},
-            {"cost", std::stod(order["px"]) * std::stod(order["accFillSz"])},
-            {"average", order.value("avgPx", "0") == "0" ? 0.0 : std::stod(order["avgPx"])},
+            {"price", jsonDouble(order["px"])},
+            {"amount", jsonDouble(order["sz"])},
+            {"filled", jsonDouble(order["accFillSz"])},
+            {"remaining", jsonDouble(order["sz"]) - jsonDouble(order["accFillSz"])},
+            {"cost", jsonDouble(order["px"]) * jsonDouble(order["accFillSz"])},
+            {"average", order.value("avgPx", "0") == "0" ? 0.0 : jsonDouble(order["avgPx"])},
             {"fee", nullptr},  // Fee information not provided in order update
         };
         emit("order", parsedOrder);
@@ -436,11 +356,11 @@ void OKXWS::handleMyTrade(const nlohmann::json& data) {
             {"type", trade["ordType"]},
             {"side", trade["side"]},
             {"takerOrMaker", trade["execType"]},
-            {"price", std::stod(trade["fillPx"])},
-            {"amount", std::stod(trade["fillSz"])},
-            {"cost", std::stod(trade["fillPx"]) * std::stod(trade["fillSz"])},
+            {"price", jsonDouble(trade["fillPx"])},
+            {"amount", jsonDouble(trade["fillSz"])},
+            {"cost", jsonDouble(trade["fillPx"]) * jsonDouble(trade["fillSz"])},
             {"fee", {
-                {"cost", std::stod(trade["fee"])},
+                {"cost", jsonDouble(trade["fee"])},
                 {"currency", trade["feeCcy"]},
             }},
         };
@@ -452,7 +372,7 @@ void OKXWS::handlePosition(const nlohmann::json& data) {
     for (const auto& position : data) {
         std::string side = position["posSide"];
         if (side == "net") {
-            double pos = std::stod(position["pos"]);
+            double pos = jsonDouble(position["pos"]);
             side = (pos > 0) ? "long" : (pos < 0) ? "short" : "closed";
         }
 
@@ -462,19 +382,19 @@ void OKXWS::handlePosition(const nlohmann::json& data) {
             {"timestamp", std::stoll(position["uTime"])},
             {"datetime", exchange_.iso8601(std::stoll(position["uTime"]))},
             {"side", side},
-            {"contracts", std::abs(std::stod(position["pos"]))},
-            {"contractSize", std::stod(position["ctVal"])},
-            {"entryPrice", std::stod(position["avgPx"])},
-            {"markPrice", std::stod(position["markPx"])},
-            {"notional", std::stod(position["notionalUsd"])},
-            {"leverage", std::stod(position["lever"])},
-            {"collateral", std::stod(position["margin"])},
-            {"initialMargin", std::stod(position["imr"])},
-            {"maintenanceMargin", std::stod(position["mmr"])},
-            {"marginRatio", std::stod(position["mgnRatio"])},
-            {"percentage", std::stod(position["upl"])},
+            {"contracts", std::abs(jsonDouble(position["pos"]))},
+            {"contractSize", jsonDouble(position["ctVal"])},
+            {"entryPrice", jsonDouble(position["avgPx"])},
+            {"markPrice", jsonDouble(position["markPx"])},
+            {"notional", jsonDouble(position["notionalUsd"])},
+            {"leverage", jsonDouble(position["lever"])},
+            {"collateral", jsonDouble(position["margin"])},
+            {"initialMargin", jsonDouble(position["imr"])},
+            {"maintenanceMargin", jsonDouble(position["mmr"])},
+            {"marginRatio", jsonDouble(position["mgnRatio"])},
+            {"percentage", jsonDouble(position["upl"])},
             {"marginMode", position["mgnMode"]},
-            {"liquidationPrice", std::stod(position["liqPx"])},
+            {"liquidationPrice", jsonDouble(position["liqPx"])},
         };
         emit("position", parsedPosition);
     }
@@ -489,12 +409,12 @@ void OKXWS::handleMyLiquidation(const nlohmann::json& data) {
             {"datetime", exchange_.iso8601(std::stoll(liquidation["ts"]))},
             {"type", "margin"},  // OKX only supports margin liquidations
             {"side", liquidation["posSide"]},
-            {"price", std::stod(liquidation["markPx"])},
-            {"amount", std::stod(liquidation["pos"])},
-            {"cost", std::stod(liquidation["notionalUsd"])},
+            {"price", jsonDouble(liquidation["markPx"])},
+            {"amount", jsonDouble(liquidation["pos"])},
+            {"cost", jsonDouble(liquidation["notionalUsd"])},
             {"marginMode", liquidation["mgnMode"]},
-            {"marginRatio", std::stod(liquidation["mgnRatio"])},
-            {"liquidationPrice", std::stod(liquidation["liqPx"])},
+            {"marginRatio", jsonDouble(liquidation["mgnRatio"])},
+            {"liquidationPrice", jsonDouble(liquidation["liqPx"])},
             {"warning", true}  // This is a liquidation warning
         };
         emit("liquidation", parsedLiquidation);
@@ -825,8 +745,8 @@ void OKXWS::handleLiquidations(const nlohmann::json& data) {
             {"datetime", exchange_.iso8601(liquidation["ts"].get<long long>())},
             {"type", liquidation["type"]},
             {"side", liquidation["side"]},
-            {"price", std::stod(liquidation["price"])},
-            {"amount", std::stod(liquidation["size"])},
+            {"price", jsonDouble(liquidation["price"])},
+            {"amount", jsonDouble(liquidation["size"])},
             {"marginMode", liquidation["mgnMode"]},
             {"marginRatio", exchange_.parseNumber(liquidation["mgnRatio"])},
             {"liquidationPrice", exchange_.parseNumber(liquidation["liqPx"])},
@@ -855,11 +775,9 @@ void OKXWS::subscribe(const std::string& channel, const std::string& instId,
         }
     }
 
-    // Store subscription for later use
-    std::string key = channel + ":" + instId;
-    subscriptions_[key] = request.dump();
-
-    send(request.dump());
+    std::string frame = request.dump();
+    addSubscription(channel + ":" + instId, frame);
+    send(std::move(frame));
 }
 
 void OKXWS::unsubscribe(const std::string& channel, const std::string& instId) {
@@ -871,22 +789,44 @@ void OKXWS::unsubscribe(const std::string& channel, const std::string& instId) {
         }}}
     };
 
-    // Remove subscription from storage
-    std::string key = channel + ":" + instId;
-    subscriptions_.erase(key);
-
+    removeSubscription(channel + ":" + instId);
     send(request.dump());
 }
 
-void OKXWS::watchMyLiquidations() {
-    authenticate();
+void OKXWS::subscribePrivate(const nlohmann::json& arg) {
     nlohmann::json request = {
         {"op", "subscribe"},
-        {"args", {{
-            {"channel", "liquidation-warning"}
-        }}}
+        {"args", {arg}}
     };
-    send(request.dump());
+    std::string frame = request.dump();
+    {
+        std::lock_guard<std::mutex> lock(privateMutex_);
+        if (std::find(privateSubscriptions_.begin(), privateSubscriptions_.end(), frame) == privateSubscriptions_.end()) {
+            privateSubscriptions_.push_back(frame);
+        }
+    }
+    send(std::move(frame));
+}
+
+void OKXWS::handleDisconnect() {
+    authenticated_ = false;
+}
+
+void OKXWS::handleReconnect() {
+    // Public channels are already queued; books restart from the snapshot
+    // OKX sends for each new subscription
+    std::lock_guard<std::mutex> lock(privateMutex_);
+    if (!privateSubscriptions_.empty()) {
+        resubscribeOnLogin_ = true;
+        authenticate();
+    }
+}
+
+void OKXWS::watchMyLiquidations() {
+    authenticate();
+    subscribePrivate({
+        {"channel", "liquidation-warning"}
+    });
 }
 
 } // namespace ccxt
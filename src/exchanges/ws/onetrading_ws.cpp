@@ -8,6 +8,7 @@
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/ssl/stream.hpp>
 #include <ctime>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -49,12 +50,16 @@ void OneTradingWS::authenticate() {
     }
 }
 
-void OneTradingWS::ping() {
+std::string OneTradingWS::heartbeatMessage() {
     nlohmann::json ping_message = {
         {"type", "ping"},
         {"seq", getNextSequenceNumber()}
     };
-    send(ping_message.dump());
+    return ping_message.dump();
+}
+
+bool OneTradingWS::isHeartbeatReply(std::string_view message) const {
+    return message.find(R"("type":"pong")") != std::string_view::npos;
 }
 
 void OneTradingWS::subscribe(const std::string& channel, const std::string& symbol, bool isPrivate) {
@@ -129,16 +134,14 @@ void OneTradingWS::watchMyTrades(const std::string& symbol) {
     subscribe("mytrades", symbol, true);
 }
 
-void OneTradingWS::handleMessage(const std::string& message) {
+void OneTradingWS::handleMessage(std::string_view message) {
     auto j = nlohmann::json::parse(message);
 
     if (!j.contains("type")) return;
 
     std::string type = j["type"];
     
-    if (type == "pong") {
-        return;
-    } else if (type == "auth") {
+    if (type == "auth") {
         handleAuthMessage(j["data"]);
     } else if (type == "error") {
         handleErrorMessage(j["data"]);
@@ -177,12 +180,12 @@ void OneTradingWS::handleTickerMessage(const nlohmann::json& data) {
     
     emit(symbol, "ticker", {
         {"symbol", symbol},
-        {"high", std::stod(data["high"].get<std::string>())},
-        {"low", std::stod(data["low"].get<std::string>())},
-        {"bid", std::stod(data["bid"].get<std::string>())},
-        {"ask", std::stod(data["ask"].get<std::string>())},
-        {"last", std::stod(data["last"].get<std::string>())},
-        {"volume", std::stod(data["volume"].get<std::string>())},
+        {"high", jsonDouble(data["high"])},
+        {"low", jsonDouble(data["low"])},
+        {"bid", jsonDouble(data["bid"])},
+        {"ask", jsonDouble(data["ask"])},
+        {"last", jsonDouble(data["last"])},
+        {"volume", jsonDouble(data["volume"])},
         {"timestamp", data["timestamp"]}
     });
 }
@@ -200,11 +203,11 @@ void OneTradingWS::handleOrderBookMessage(const nlohmann::json& data) {
     std::vector<std::vector<double>> asks;
     
     for (const auto& bid : data["bids"]) {
-        bids.push_back({std::stod(bid[0].get<std::string>()), std::stod(bid[1].get<std::string>())});
+        bids.push_back({jsonDouble(bid[0]), jsonDouble(bid[1])});
     }
     
     for (const auto& ask : data["asks"]) {
-        asks.push_back({std::stod(ask[0].get<std::string>()), std::stod(ask[1].get<std::string>())});
+        asks.push_back({jsonDouble(ask[0]), jsonDouble(ask[1])});
     }
     
     orderbook["bids"] = bids;
@@ -221,8 +224,8 @@ void OneTradingWS::handleTradeMessage(const nlohmann::json& data) {
     emit(symbol, "trade", {
         {"id", data["id"]},
         {"symbol", symbol},
-        {"price", std::stod(data["price"].get<std::string>())},
-        {"amount", std::stod(data["amount"].get<std::string>())},
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["amount"])},
         {"side", data["side"]},
         {"timestamp", data["timestamp"]}
     });
@@ -235,11 +238,11 @@ void OneTradingWS::handleOHLCVMessage(const nlohmann::json& data) {
     
     emit(symbol, "ohlcv", {
         {"timestamp", data["timestamp"]},
-        {"open", std::stod(data["open"].get<std::string>())},
-        {"high", std::stod(data["high"].get<std::string>())},
-        {"low", std::stod(data["low"].get<std::string>())},
-        {"close", std::stod(data["close"].get<std::string>())},
-        {"volume", std::stod(data["volume"].get<std::string>())}
+        {"open", jsonDouble(data["open"])},
+        {"high", jsonDouble(data["high"])},
+        {"low", jsonDouble(data["low"])},
+        {"close", jsonDouble(data["close"])},
+        {"volume", jsonDouble(data["volume"])}
     });
 }
 
@@ -250,9 +253,9 @@ void OneTradingWS::handleBalanceMessage(const nlohmann::json& data) {
     
     for (const auto& asset : data["balances"].items()) {
         balance[asset.key()] = {
-            {"free", std::stod(asset.value()["available"].get<std::string>())},
-            {"used", std::stod(asset.value()["locked"].get<std::string>())},
-            {"total", std::stod(asset.value()["total"].get<std::string>())}
+            {"free", jsonDouble(asset.value()["available"])},
+            {"used", jsonDouble(asset.value()["locked"])},
+            {"total", jsonDouble(asset.value()["total"])}
         };
     }
     
@@ -269,10 +272,10 @@ void OneTradingWS::handleOrderMessage(const nlohmann::json& data) {
         {"symbol", symbol},
         {"type", data["type"]},
         {"side", data["side"]},
-        {"price", std::stod(data["price"].get<std::string>())},
-        {"amount", std::stod(data["amount"].get<std::string>())},
-        {"filled", std::stod(data["filled"].get<std::string>())},
-        {"remaining", std::stod(data["remaining"].get<std::string>())},
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["amount"])},
+        {"filled", jsonDouble(data["filled"])},
+        {"remaining", jsonDouble(data["remaining"])},
         {"status", data["status"]},
         {"timestamp", data["timestamp"]}
     });
@@ -289,9 +292,9 @@ void OneTradingWS::handleMyTradeMessage(const nlohmann::json& data) {
         {"symbol", symbol},
         {"type", data["type"]},
         {"side", data["side"]},
-        {"price", std::stod(data["price"].get<std::string>())},
-        {"amount", std::stod(data["amount"].get<std::string>())},
-        {"fee", std::stod(data["fee"].get<std::string>())},
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["amount"])},
+        {"fee", jsonDouble(data["fee"])},
         {"feeCurrency", data["feeCurrency"]},
         {"timestamp", data["timestamp"]}
     });
@@ -8,6 +8,7 @@
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/ssl/stream.hpp>
 #include <ctime>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -48,12 +49,16 @@ void OxFunWS::authenticate() {
     }
 }
 
-void OxFunWS::ping() {
+std::string OxFunWS::heartbeatMessage() {
     nlohmann::json ping_message = {
         {"op", "ping"},
         {"ts", std::time(nullptr) * 1000}
     };
-    send(ping_message.dump());
+    return ping_message.dump();
+}
+
+bool OxFunWS::isHeartbeatReply(std::string_view message) const {
+    return message.find(R"("event":"pong")") != std::string_view::npos;
 }
 
 void OxFunWS::subscribe(const std::string& channel, const std::string& symbol, bool isPrivate) {
@@ -126,16 +131,14 @@ void OxFunWS::watchMyTrades(const std::string& symbol) {
     subscribe("mytrades", symbol, true);
 }
 
-void OxFunWS::handleMessage(const std::string& message) {
+void OxFunWS::handleMessage(std::string_view message) {
     auto j = nlohmann::json::parse(message);
 
     if (!j.contains("event")) return;
 
     std::string event = j["event"];
     
-    if (event == "pong") {
-        return;
-    } else if (event == "auth") {
+    if (event == "auth") {
         handleAuthMessage(j["data"]);
     } else if (event == "error") {
         handleErrorMessage(j["data"]);
@@ -174,12 +177,12 @@ void OxFunWS::handleTickerMessage(const nlohmann::json& data) {
     
     emit(symbol, "ticker", {
         {"symbol", symbol},
-        {"high", std::stod(data["high"].get<std::string>())},
-        {"low", std::stod(data["low"].get<std::string>())},
-        {"bid", std::stod(data["bid"].get<std::string>())},
-        {"ask", std::stod(data["ask"].get<std::string>())},
-        {"last", std::stod(data["last"].get<std::string>())},
-        {"volume", std::stod(data["volume"].get<std::string>())},
+        {"high", jsonDouble(data["high"])},
+        {"low", jsonDouble(data["low"])},
+        {"bid", jsonDouble(data["bid"])},
+        {"ask", jsonDouble(data["ask"])},
+        {"last", jsonDouble(data["last"])},
+        {"volume", jsonDouble(data["volume"])},
         {"timestamp", data["timestamp"]}
     });
 }
@@ -197,11 +200,11 @@ void OxFunWS::handleOrderBookMessage(const nlohmann::json& data) {
     std::vector<std::vector<double>> asks;
     
     for (const auto& bid : data["bids"]) {
-        bids.push_back({std::stod(bid[0].get<std::string>()), std::stod(bid[1].get<std::string>())});
+        bids.push_back({jsonDouble(bid[0]), jsonDouble(bid[1])});
     }
     
     for (const auto& ask : data["asks"]) {
-        asks.push_back({std::stod(ask[0].get<std::string>()), std::stod(ask[1].get<std::string>())});
+        asks.push_back({jsonDouble(ask[0]), jsonDouble(ask[1])});
     }
     
     orderbook["bids"] = bids;
@@ -218,8 +221,8 @@ void OxFunWS::handleTradeMessage(const nlohmann::json& data) {
     emit(symbol, "trade", {
         {"id", data["id"]},
         {"symbol", symbol},
-        {"price", std::stod(data["price"].get<std::string>())},
-        {"amount", std::stod(data["amount"].get<std::string>())},
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["amount"])},
         {"side", data["side"]},
         {"timestamp", data["timestamp"]}
     });
@@ -232,11 +235,11 @@ void OxFunWS::handleOHLCVMessage(const nlohmann::json& data) {
     
     emit(symbol, "ohlcv", {
         {"timestamp", data["timestamp"]},
-        {"open", std::stod(data["open"].get<std::string>())},
-        {"high", std::stod(data["high"].get<std::string>())},
-        {"low", std::stod(data["low"].get<std::string>())},
-        {"close", std::stod(data["close"].get<std::string>())},
-        {"volume", std::stod(data["volume"].get<std::string>())}
+        {"open", jsonDouble(data["open"])},
+        {"high", jsonDouble(data["high"])},
+        {"low", jsonDouble(data["low"])},
+        {"close", jsonDouble(data["close"])},
+        {"volume", jsonDouble(data["volume"])}
     });
 }
 
@@ -247,9 +250,9 @@ void OxFunWS::handleBalanceMessage(const nlohmann::json& data) {
     
     for (const auto& asset : data["balances"].items()) {
         balance[asset.key()] = {
-            {"free", std::stod(asset.value()["available"].get<std::string>())},
-            {"used", std::stod(asset.value()["locked"].get<std::string>())},
-            {"total", std::stod(asset.value()["total"].get<std::string>())}
+            {"free", jsonDouble(asset.value()["available"])},
+            {"used", jsonDouble(asset.value()["locked"])},
+            {"total", jsonDouble(asset.value()["total"])}
         };
     }
     
@@ -266,10 +269,10 @@ void OxFunWS::handleOrderMessage(const nlohmann::json& data) {
         {"symbol", symbol},
         {"type", data["type"]},
         {"side", data["side"]},
-        {"price", std::stod(data["price"].get<std::string>())},
-        {"amount", std::stod(data["amount"].get<std::string>())},
-        {"filled", std::stod(data["filled"].get<std::string>())},
-        {"remaining", std::stod(data["remaining"].get<std::string>())},
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["amount"])},
+        {"filled", jsonDouble(data["filled"])},
+        {"remaining", jsonDouble(data["remaining"])},
         {"status", data["status"]},
         {"timestamp", data["timestamp"]}
     });
@@ -286,9 +289,9 @@ void OxFunWS::handleMyTradeMessage(const nlohmann::json& data) {
         {"symbol", symbol},
         {"type", data["type"]},
         {"side", data["side"]},
-        {"price", std::stod(data["price"].get<std::string>())},
-        {"amount", std::stod(data["amount"].get<std::string>())},
-        {"fee", std::stod(data["fee"].get<std::string>())},
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["amount"])},
+        {"fee", jsonDouble(data["fee"])},
         {"feeCurrency", data["feeCurrency"]},
         {"timestamp", data["timestamp"]}
     });
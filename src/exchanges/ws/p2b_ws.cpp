@@ -8,6 +8,7 @@
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/ssl/stream.hpp>
 #include <ctime>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -49,13 +50,17 @@ void P2BWS::authenticate() {
     }
 }
 
-void P2BWS::ping() {
+std::string P2BWS::heartbeatMessage() {
     nlohmann::json ping_message = {
         {"method", "ping"},
         {"params", {}},
         {"id", getNextSequenceNumber()}
     };
-    send(ping_message.dump());
+    return ping_message.dump();
+}
+
+bool P2BWS::isHeartbeatReply(std::string_view message) const {
+    return message.find(R"("method":"pong")") != std::string_view::npos;
 }
 
 void P2BWS::subscribe(const std::string& channel, const std::string& symbol, bool isPrivate) {
@@ -130,15 +135,13 @@ void P2BWS::watchMyTrades(const std::string& symbol) {
     subscribe("mytrades", symbol, true);
 }
 
-void P2BWS::handleMessage(const std::string& message) {
+void P2BWS::handleMessage(std::string_view message) {
     auto j = nlohmann::json::parse(message);
 
     if (j.contains("method")) {
         std::string method = j["method"];
         
-        if (method == "pong") {
-            return;
-        } else if (method == "auth") {
+        if (method == "auth") {
             handleAuthMessage(j["result"]);
         } else if (method == "error") {
             handleErrorMessage(j["error"]);
@@ -176,13 +179,13 @@ void P2BWS::handleTickerMessage(const nlohmann::json& data) {
     
     emit(symbol, "ticker", {
         {"symbol", symbol},
-        {"high", std::stod(data["high"].get<std::string>())},
-        {"low", std::stod(data["low"].get<std::string>())},
-        {"last", std::stod(data["last"].get<std::string>())},
-        {"volume", std::stod(data["volume"].get<std::string>())},
-        {"quoteVolume", std::stod(data["quoteVolume"].get<std::string>())},
-        {"bid", std::stod(data["bid"].get<std::string>())},
-        {"ask", std::stod(data["ask"].get<std::string>())},
+        {"high", jsonDouble(data["high"])},
+        {"low", jsonDouble(data["low"])},
+        {"last", jsonDouble(data["last"])},
+        {"volume", jsonDouble(data["volume"])},
+        {"quoteVolume", jsonDouble(data["quoteVolume"])},
+        {"bid", jsonDouble(data["bid"])},
+        {"ask", jsonDouble(data["ask"])},
         {"timestamp", data["timestamp"]}
     });
 }
@@ -200,11 +203,11 @@ void P2BWS::handleOrderBookMessage(const nlohmann::json& data) {
     std::vector<std::vector<double>> asks;
     
     for (const auto& bid : data["bids"]) {
-        bids.push_back({std::stod(bid[0].get<std::string>()), std::stod(bid[1].get<std::string>())});
+        bids.push_back({jsonDouble(bid[0]), jsonDouble(bid[1])});
     }
     
     for (const auto& ask : data["asks"]) {
-        asks.push_back({std::stod(ask[0].get<std::string>()), std::stod(ask[1].get<std::string>())});
+        asks.push_back({jsonDouble(ask[0]), jsonDouble(ask[1])});
     }
     
     orderbook["bids"] = bids;
@@ -221,8 +224,8 @@ void P2BWS::handleTradeMessage(const nlohmann::json& data) {
     emit(symbol, "trade", {
         {"id", data["id"]},
         {"symbol", symbol},
-        {"price", std::stod(data["price"].get<std::string>())},
-        {"amount", std::stod(data["amount"].get<std::string>())},
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["amount"])},
         {"side", data["side"]},
         {"timestamp", data["timestamp"]}
     });
@@ -235,11 +238,11 @@ void P2BWS::handleOHLCVMessage(const nlohmann::json& data) {
     
     emit(symbol, "ohlcv", {
         {"timestamp", data["timestamp"]},
-        {"open", std::stod(data["open"].get<std::string>())},
-        {"high", std::stod(data["high"].get<std::string>())},
-        {"low", std::stod(data["low"].get<std::string>())},
-        {"close", std::stod(data["close"].get<std::string>())},
-        {"volume", std::stod(data["volume"].get<std::string>())}
+        {"open", jsonDouble(data["open"])},
+        {"high", jsonDouble(data["high"])},
+        {"low", jsonDouble(data["low"])},
+        {"close", jsonDouble(data["close"])},
+        {"volume", jsonDouble(data["volume"])}
     });
 }
 
@@ -250,9 +253,9 @@ void P2BWS::handleBalanceMessage(const nlohmann::json& data) {
     
     for (const auto& asset : data["balances"].items()) {
         balance[asset.key()] = {
-            {"free", std::stod(asset.value()["available"].get<std::string>())},
-            {"used", std::stod(asset.value()["locked"].get<std::string>())},
-            {"total", std::stod(asset.value()["total"].get<std::string>())}
+            {"free", jsonDouble(asset.value()["available"])},
+            {"used", jsonDouble(asset.value()["locked"])},
+            {"total", jsonDouble(asset.value()["total"])}
         };
     }
     
@@ -270,10 +273,10 @@ void P2BWS::handleOrderMessage(const nlohmann::json& data) {
         {"symbol", symbol},
         {"type", data["type"]},
         {"side", data["side"]},
-        {"price", std::stod(data["price"].get<std::string>())},
-        {"amount", std::stod(data["amount"].get<std::string>())},
-        {"filled", std::stod(data["filled"].get<std::string>())},
-        {"remaining", std::stod(data["remaining"].get<std::string>())},
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["amount"])},
+        {"filled", jsonDouble(data["filled"])},
+        {"remaining", jsonDouble(data["remaining"])},
         {"status", data["status"]},
         {"timestamp", data["timestamp"]}
     });
@@ -290,9 +293,9 @@ void P2BWS::handleMyTradeMessage(const nlohmann::json& data) {
         {"symbol", symbol},
         {"type", data["type"]},
         {"side", data["side"]},
-        {"price", std::stod(data["price"].get<std::string>())},
-        {"amount", std::stod(data["amount"].get<std::string>())},
-        {"fee", std::stod(data["fee"].get<std::string>())},
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["amount"])},
+        {"fee", jsonDouble(data["fee"])},
         {"feeCurrency", data["feeCurrency"]},
         {"timestamp", data["timestamp"]}
     });
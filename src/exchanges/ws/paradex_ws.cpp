@@ -10,6 +10,7 @@
 #include <ctime>
 #include <iomanip>
 #include <sstream>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -61,14 +62,18 @@ void ParadexWS::authenticate() {
     }
 }
 
-void ParadexWS::ping() {
+std::string ParadexWS::heartbeatMessage() {
     nlohmann::json ping_message = {
         {"type", "ping"},
         {"data", {
             {"ts", std::time(nullptr) * 1000}
         }}
     };
-    send(ping_message.dump());
+    return ping_message.dump();
+}
+
+bool ParadexWS::isHeartbeatReply(std::string_view message) const {
+    return message.find(R"("type":"pong")") != std::string_view::npos;
 }
 
 void ParadexWS::subscribe(const std::string& channel, const std::string& symbol, bool isPrivate) {
@@ -145,16 +150,14 @@ void ParadexWS::watchPositions(const std::string& symbol) {
     subscribe("positions", symbol, true);
 }
 
-void ParadexWS::handleMessage(const std::string& message) {
+void ParadexWS::handleMessage(std::string_view message) {
     auto j = nlohmann::json::parse(message);
 
     if (!j.contains("type")) return;
 
     std::string type = j["type"];
     
-    if (type == "pong") {
-        return;
-    } else if (type == "auth") {
+    if (type == "auth") {
         handleAuthMessage(j["data"]);
     } else if (type == "error") {
         handleErrorMessage(j["data"]);
@@ -195,13 +198,13 @@ void ParadexWS::handleTickerMessage(const nlohmann::json& data) {
     
     emit(symbol, "ticker", {
         {"symbol", symbol},
-        {"high", std::stod(data["high"].get<std::string>())},
-        {"low", std::stod(data["low"].get<std::string>())},
-        {"last", std::stod(data["last"].get<std::string>())},
-        {"bid", std::stod(data["bid"].get<std::string>())},
-        {"ask", std::stod(data["ask"].get<std::string>())},
-        {"volume", std::stod(data["volume"].get<std::string>())},
-        {"quoteVolume", std::stod(data["quoteVolume"].get<std::string>())},
+        {"high", jsonDouble(data["high"])},
+        {"low", jsonDouble(data["low"])},
+        {"last", jsonDouble(data["last"])},
+        {"bid", jsonDouble(data["bid"])},
+        {"ask", jsonDouble(data["ask"])},
+        {"volume", jsonDouble(data["volume"])},
+        {"quoteVolume", jsonDouble(data["quoteVolume"])},
         {"timestamp", data["timestamp"]}
     });
 }
@@ -220,11 +223,11 @@ void ParadexWS::handleOrderBookMessage(const nlohmann::json& data) {
     std::vector<std::vector<double>> asks;
     
     for (const auto& bid : data["bids"]) {
-        bids.push_back({std::stod(bid[0].get<std::string>()), std::stod(bid[1].get<std::string>())});
+        bids.push_back({jsonDouble(bid[0]), jsonDouble(bid[1])});
     }
     
     for (const auto& ask : data["asks"]) {
-        asks.push_back({std::stod(ask[0].get<std::string>()), std::stod(ask[1].get<std::string>())});
+        asks.push_back({jsonDouble(ask[0]), jsonDouble(ask[1])});
     }
     
     orderbook["bids"] = bids;
@@ -241,8 +244,8 @@ void ParadexWS::handleTradeMessage(const nlohmann::json& data) {
     emit(symbol, "trade", {
         {"id", data["id"]},
         {"symbol", symbol},
-        {"price", std::stod(data["price"].get<std::string>())},
-        {"amount", std::stod(data["amount"].get<std::string>())},
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["amount"])},
         {"side", data["side"]},
         {"timestamp", data["timestamp"]}
     });
@@ -255,11 +258,11 @@ void ParadexWS::handleOHLCVMessage(const nlohmann::json& data) {
     
     emit(symbol, "ohlcv", {
         {"timestamp", data["timestamp"]},
-        {"open", std::stod(data["open"].get<std::string>())},
-        {"high", std::stod(data["high"].get<std::string>())},
-        {"low", std::stod(data["low"].get<std::string>())},
-        {"close", std::stod(data["close"].get<std::string>())},
-        {"volume", std::stod(data["volume"].get<std::string>())}
+        {"open", jsonDouble(data["open"])},
+        {"high", jsonDouble(data["high"])},
+        {"low", jsonDouble(data["low"])},
+        {"close", jsonDouble(data["close"])},
+        {"volume", jsonDouble(data["volume"])}
     });
 }
 
@@ -270,9 +273,9 @@ void ParadexWS::handleBalanceMessage(const nlohmann::json& data) {
     
     for (const auto& asset : data["balances"].items()) {
         balance[asset.key()] = {
-            {"free", std::stod(asset.value()["available"].get<std::string>())},
-            {"used", std::stod(asset.value()["locked"].get<std::string>())},
-            {"total", std::stod(asset.value()["total"].get<std::string>())}
+            {"free", jsonDouble(asset.value()["available"])},
+            {"used", jsonDouble(asset.value()["locked"])},
+            {"total", jsonDouble(asset.value()["total"])}
         };
     }
     
@@ -290,10 +293,10 @@ void ParadexWS::handleOrderMessage(const nlohmann::json& data) {
         {"symbol", symbol},
         {"type", data["type"]},
         {"side", data["side"]},
-        {"price", std::stod(data["price"].get<std::string>())},
-        {"amount", std::stod(data["amount"].get<std::string>())},
-        {"filled", std::stod(data["filled"].get<std::string>())},
-        {"remaining", std::stod(data["remaining"].get<std::string>())},
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["amount"])},
+        {"filled", jsonDouble(data["filled"])},
+        {"remaining", jsonDouble(data["remaining"])},
         {"status", data["status"]},
         {"timestamp", data["timestamp"]}
     });
@@ -310,9 +313,9 @@ void ParadexWS::handleMyTradeMessage(const nlohmann::json& data) {
         {"symbol", symbol},
         {"type", data["type"]},
         {"side", data["side"]},
-        {"price", std::stod(data["price"].get<std::string>())},
-        {"amount", std::stod(data["amount"].get<std::string>())},
-        {"fee", std::stod(data["fee"].get<std::string>())},
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["amount"])},
+        {"fee", jsonDouble(data["fee"])},
         {"feeCurrency", data["feeCurrency"]},
         {"timestamp", data["timestamp"]}
     });
@@ -325,13 +328,13 @@ void ParadexWS::handlePositionMessage(const nlohmann::json& data) {
     
     emit(symbol, "position", {
         {"symbol", symbol},
-        {"size", std::stod(data["size"].get<std::string>())},
-        {"entryPrice", std::stod(data["entryPrice"].get<std::string>())},
-        {"markPrice", std::stod(data["markPrice"].get<std::string>())},
-        {"liquidationPrice", std::stod(data["liquidationPrice"].get<std::string>())},
-        {"margin", std::stod(data["margin"].get<std::string>())},
-        {"leverage", std::stod(data["leverage"].get<std::string>())},
-        {"unrealizedPnl", std::stod(data["unrealizedPnl"].get<std::string>())},
+        {"size", jsonDouble(data["size"])},
+        {"entryPrice", jsonDouble(data["entryPrice"])},
+        {"markPrice", jsonDouble(data["markPrice"])},
+        {"liquidationPrice", jsonDouble(data["liquidationPrice"])},
+        {"margin", jsonDouble(data["margin"])},
+        {"leverage", jsonDouble(data["leverage"])},
+        {"unrealizedPnl", jsonDouble(data["unrealizedPnl"])},
         {"timestamp", data["timestamp"]}
     });
 }
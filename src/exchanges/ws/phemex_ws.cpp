@@ -12,6 +12,7 @@
 #include <ctime>
 #include <sstream>
 #include <cmath>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -203,14 +204,14 @@ int PhemexWS::getNextRequestId() {
 }
 
 double PhemexWS::parseNumber(const std::string& value, double scale) {
-    return std::stod(value) / std::pow(10, scale);
+    return parseDouble(value) / std::pow(10, scale);
 }
 
 std::string PhemexWS::formatNumber(double value, double scale) {
     return std::to_string(static_cast<int64_t>(value * std::pow(10, scale)));
 }
 
-void PhemexWS::handleMessage(const std::string& message) {
+void PhemexWS::handleMessage(std::string_view message) {
     auto j = nlohmann::json::parse(message);
 
     if (j.contains("result")) {
@@ -315,7 +316,7 @@ Order PhemexWS::parseWsOrder(const nlohmann::json& order, const Market* market)
     auto price = formatNumber(parseNumber(order["price"].get<std::string>(), priceScale), priceScale);
     auto amount = formatNumber(parseNumber(order["orderQty"].get<std::string>(), amountScale), amountScale);
     auto filled = formatNumber(parseNumber(order["cumQty"].get<std::string>(), amountScale), amountScale);
-    auto remaining = std::to_string(std::stod(amount) - std::stod(filled));
+    auto remaining = std::to_string(parseDouble(amount) - parseDouble(filled));
     auto status = exchange_.parseOrderStatus(order["ordStatus"].get<std::string>());
     auto clientOrderId = order.contains("clOrdID") ? order["clOrdID"].get<std::string>() : "";
 
@@ -354,7 +355,7 @@ Trade PhemexWS::parseWsTrade(const nlohmann::json& trade, const Market* market)
 
     auto price = formatNumber(parseNumber(trade["price"].get<std::string>(), priceScale), priceScale);
     auto amount = formatNumber(parseNumber(trade["qty"].get<std::string>(), amountScale), amountScale);
-    auto cost = std::to_string(std::stod(price) * std::stod(amount));
+    auto cost = std::to_string(parseDouble(price) * parseDouble(amount));
     auto orderId = trade.contains("orderID") ? trade["orderID"].get<std::string>() : "";
 
     nlohmann::json fee;
@@ -392,7 +393,7 @@ Position PhemexWS::parseWsPosition(const nlohmann::json& position, const Market*
 
     auto contracts = formatNumber(parseNumber(position["size"].get<std::string>(), amountScale), amountScale);
     auto entryPrice = formatNumber(parseNumber(position["avgEntry"].get<std::string>(), priceScale), priceScale);
-    auto notional = std::to_string(std::stod(contracts) * std::stod(entryPrice));
+    auto notional = std::to_string(parseDouble(contracts) * parseDouble(entryPrice));
 
     return {
         {"info", position},
@@ -10,6 +10,7 @@
 #include <ctime>
 #include <iomanip>
 #include <sstream>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -62,12 +63,16 @@ void PoloniexWS::authenticate() {
     }
 }
 
-void PoloniexWS::ping() {
+std::string PoloniexWS::heartbeatMessage() {
     nlohmann::json ping_message = {
         {"event", "ping"},
         {"ts", std::time(nullptr) * 1000}
     };
-    send(ping_message.dump());
+    return ping_message.dump();
+}
+
+bool PoloniexWS::isHeartbeatReply(std::string_view message) const {
+    return message.find(R"("event":"pong")") != std::string_view::npos;
 }
 
 void PoloniexWS::subscribe(const std::string& channel, const std::string& symbol, bool isPrivate) {
@@ -144,15 +149,13 @@ void PoloniexWS::watchPositions(const std::string& symbol) {
     subscribe("positions", symbol, true);
 }
 
-void PoloniexWS::handleMessage(const std::string& message) {
+void PoloniexWS::handleMessage(std::string_view message) {
     auto j = nlohmann::json::parse(message);
 
     if (j.contains("event")) {
         std::string event = j["event"];
         
-        if (event == "pong") {
-            return;
-        } else if (event == "auth") {
+        if (event == "auth") {
             handleAuthMessage(j["data"]);
         } else if (event == "error") {
             handleErrorMessage(j["data"]);
@@ -192,14 +195,14 @@ void PoloniexWS::handleTickerMessage(const nlohmann::json& data) {
     
     emit(symbol, "ticker", {
         {"symbol", symbol},
-        {"high", std::stod(data["high24hr"].get<std::string>())},
-        {"low", std::stod(data["low24hr"].get<std::string>())},
-        {"last", std::stod(data["last"].get<std::string>())},
-        {"bid", std::stod(data["highestBid"].get<std::string>())},
-        {"ask", std::stod(data["lowestAsk"].get<std::string>())},
-        {"baseVolume", std::stod(data["baseVolume24hr"].get<std::string>())},
-        {"quoteVolume", std::stod(data["quoteVolume24hr"].get<std::string>())},
-        {"percentage", std::stod(data["percentChange"].get<std::string>())},
+        {"high", jsonDouble(data["high24hr"])},
+        {"low", jsonDouble(data["low24hr"])},
+        {"last", jsonDouble(data["last"])},
+        {"bid", jsonDouble(data["highestBid"])},
+        {"ask", jsonDouble(data["lowestAsk"])},
+        {"baseVolume", jsonDouble(data["baseVolume24hr"])},
+        {"quoteVolume", jsonDouble(data["quoteVolume24hr"])},
+        {"percentage", jsonDouble(data["percentChange"])},
         {"timestamp", data["timestamp"]}
     });
 }
@@ -218,11 +221,11 @@ void PoloniexWS::handleOrderBookMessage(const nlohmann::json& data) {
     std::vector<std::vector<double>> asks;
     
     for (const auto& bid : data["bids"]) {
-        bids.push_back({std::stod(bid[0].get<std::string>()), std::stod(bid[1].get<std::string>())});
+        bids.push_back({jsonDouble(bid[0]), jsonDouble(bid[1])});
     }
     
     for (const auto& ask : data["asks"]) {
-        asks.push_back({std::stod(ask[0].get<std::string>()), std::stod(ask[1].get<std::string>())});
+        asks.push_back({jsonDouble(ask[0]), jsonDouble(ask[1])});
     }
     
     orderbook["bids"] = bids;
@@ -239,8 +242,8 @@ void PoloniexWS::handleTradeMessage(const nlohmann::json& data) {
     emit(symbol, "trade", {
         {"id", data["id"]},
         {"symbol", symbol},
-        {"price", std::stod(data["price"].get<std::string>())},
-        {"amount", std::stod(data["amount"].get<std::string>())},
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["amount"])},
         {"side", data["side"]},
         {"timestamp", data["timestamp"]}
     });
@@ -253,11 +256,11 @@ void PoloniexWS::handleOHLCVMessage(const nlohmann::json& data) {
     
     emit(symbol, "ohlcv", {
         {"timestamp", data["timestamp"]},
-        {"open", std::stod(data["open"].get<std::string>())},
-        {"high", std::stod(data["high"].get<std::string>())},
-        {"low", std::stod(data["low"].get<std::string>())},
-        {"close", std::stod(data["close"].get<std::string>())},
-        {"volume", std::stod(data["volume"].get<std::string>())}
+        {"open", jsonDouble(data["open"])},
+        {"high", jsonDouble(data["high"])},
+        {"low", jsonDouble(data["low"])},
+        {"close", jsonDouble(data["close"])},
+        {"volume", jsonDouble(data["volume"])}
     });
 }
 
@@ -268,9 +271,9 @@ void PoloniexWS::handleBalanceMessage(const nlohmann::json& data) {
     
     for (const auto& asset : data["balances"].items()) {
         balance[asset.key()] = {
-            {"free", std::stod(asset.value()["available"].get<std::string>())},
-            {"used", std::stod(asset.value()["onOrders"].get<std::string>())},
-            {"total", std::stod(asset.value()["total"].get<std::string>())}
+            {"free", jsonDouble(asset.value()["available"])},
+            {"used", jsonDouble(asset.value()["onOrders"])},
+            {"total", jsonDouble(asset.value()["total"])}
         };
     }
     
@@ -288,10 +291,10 @@ void PoloniexWS::handleOrderMessage(const nlohmann::json& data) {
         {"symbol", symbol},
         {"type", data["type"]},
         {"side", data["side"]},
-        {"price", std::stod(data["rate"].get<std::string>())},
-        {"amount", std::stod(data["amount"].get<std::string>())},
-        {"filled", std::stod(data["filled"].get<std::string>())},
-        {"remaining", std::stod(data["remaining"].get<std::string>())},
+        {"price", jsonDouble(data["rate"])},
+        {"amount", jsonDouble(data["amount"])},
+        {"filled", jsonDouble(data["filled"])},
+        {"remaining", jsonDouble(data["remaining"])},
         {"status", data["status"]},
         {"timestamp", data["timestamp"]}
     });
@@ -308,9 +311,9 @@ void PoloniexWS::handleMyTradeMessage(const nlohmann::json& data) {
         {"symbol", symbol},
         {"type", data["type"]},
         {"side", data["side"]},
-        {"price", std::stod(data["rate"].get<std::string>())},
-        {"amount", std::stod(data["amount"].get<std::string>())},
-        {"fee", std::stod(data["fee"].get<std::string>())},
+        {"price", jsonDouble(data["rate"])},
+        {"amount", jsonDouble(data["amount"])},
+        {"fee", jsonDouble(data["fee"])},
         {"feeCurrency", data["feeCurrency"]},
         {"timestamp", data["timestamp"]}
     });
@@ -323,13 +326,13 @@ void PoloniexWS::handlePositionMessage(const nlohmann::json& data) {
     
     emit(symbol, "position", {
         {"symbol", symbol},
-        {"size", std::stod(data["amount"].get<std::string>())},
-        {"entryPrice", std::stod(data["avgCost"].get<std::string>())},
-        {"markPrice", std::stod(data["markPrice"].get<std::string>())},
-        {"liquidationPrice", std::stod(data["liquidationPrice"].get<std::string>())},
-        {"margin", std::stod(data["initialMargin"].get<std::string>())},
-        {"leverage", std::stod(data["leverage"].get<std::string>())},
-        {"unrealizedPnl", std::stod(data["unrealizedPnl"].get<std::string>())},
+        {"size", jsonDouble(data["amount"])},
+        {"entryPrice", jsonDouble(data["avgCost"])},
+        {"markPrice", jsonDouble(data["markPrice"])},
+        {"liquidationPrice", jsonDouble(data["liquidationPrice"])},
+        {"margin", jsonDouble(data["initialMargin"])},
+        {"leverage", jsonDouble(data["leverage"])},
+        {"unrealizedPnl", jsonDouble(data["unrealizedPnl"])},
         {"timestamp", data["timestamp"]}
     });
 }
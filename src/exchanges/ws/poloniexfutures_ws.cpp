@@ -10,6 +10,7 @@
 #include <ctime>
 #include <iomanip>
 #include <sstream>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -156,7 +157,7 @@ void PoloniexFuturesWS::watchLiquidations(const std::string& symbol) {
     subscribe("liquidations", symbol);
 }
 
-void PoloniexFuturesWS::handleMessage(const std::string& message) {
+void PoloniexFuturesWS::handleMessage(std::string_view message) {
     auto j = nlohmann::json::parse(message);
 
     if (j.contains("event")) {
@@ -210,14 +211,14 @@ void PoloniexFuturesWS::handleTickerMessage(const nlohmann::json& data) {
     
     emit(symbol, "ticker", {
         {"symbol", symbol},
-        {"high", std::stod(data["high24hr"].get<std::string>())},
-        {"low", std::stod(data["low24hr"].get<std::string>())},
-        {"last", std::stod(data["last"].get<std::string>())},
-        {"bid", std::stod(data["highestBid"].get<std::string>())},
-        {"ask", std::stod(data["lowestAsk"].get<std::string>())},
-        {"baseVolume", std::stod(data["baseVolume24hr"].get<std::string>())},
-        {"quoteVolume", std::stod(data["quoteVolume24hr"].get<std::string>())},
-        {"percentage", std::stod(data["percentChange"].get<std::string>())},
+        {"high", jsonDouble(data["high24hr"])},
+        {"low", jsonDouble(data["low24hr"])},
+        {"last", jsonDouble(data["last"])},
+        {"bid", jsonDouble(data["highestBid"])},
+        {"ask", jsonDouble(data["lowestAsk"])},
+        {"baseVolume", jsonDouble(data["baseVolume24hr"])},
+        {"quoteVolume", jsonDouble(data["quoteVolume24hr"])},
+        {"percentage", jsonDouble(data["percentChange"])},
         {"timestamp", data["timestamp"]}
     });
 }
@@ -236,11 +237,11 @@ void PoloniexFuturesWS::handleOrderBookMessage(const nlohmann::json& data) {
     std::vector<std::vector<double>> asks;
     
     for (const auto& bid : data["bids"]) {
-        bids.push_back({std::stod(bid[0].get<std::string>()), std::stod(bid[1].get<std::string>())});
+        bids.push_back({jsonDouble(bid[0]), jsonDouble(bid[1])});
     }
     
     for (const auto& ask : data["asks"]) {
-        asks.push_back({std::stod(ask[0].get<std::string>()), std::stod(ask[1].get<std::string>())});
+        asks.push_back({jsonDouble(ask[0]), jsonDouble(ask[1])});
     }
     
     orderbook["bids"] = bids;
@@ -257,8 +258,8 @@ void PoloniexFuturesWS::handleTradeMessage(const nlohmann::json& data) {
     emit(symbol, "trade", {
         {"id", data["id"]},
         {"symbol", symbol},
-        {"price", std::stod(data["price"].get<std::string>())},
-        {"amount", std::stod(data["amount"].get<std::string>())},
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["amount"])},
         {"side", data["side"]},
         {"timestamp", data["timestamp"]}
     });
@@ -271,11 +272,11 @@ void PoloniexFuturesWS::handleOHLCVMessage(const nlohmann::json& data) {
     
     emit(symbol, "ohlcv", {
         {"timestamp", data["timestamp"]},
-        {"open", std::stod(data["open"].get<std::string>())},
-        {"high", std::stod(data["high"].get<std::string>())},
-        {"low", std::stod(data["low"].get<std::string>())},
-        {"close", std::stod(data["close"].get<std::string>())},
-        {"volume", std::stod(data["volume"].get<std::string>())}
+        {"open", jsonDouble(data["open"])},
+        {"high", jsonDouble(data["high"])},
+        {"low", jsonDouble(data["low"])},
+        {"close", jsonDouble(data["close"])},
+        {"volume", jsonDouble(data["volume"])}
     });
 }
 
@@ -286,8 +287,8 @@ void PoloniexFuturesWS::handleMarkPriceMessage(const nlohmann::json& data) {
     
     emit(symbol, "markPrice", {
         {"symbol", symbol},
-        {"markPrice", std::stod(data["markPrice"].get<std::string>())},
-        {"indexPrice", std::stod(data["indexPrice"].get<std::string>())},
+        {"markPrice", jsonDouble(data["markPrice"])},
+        {"indexPrice", jsonDouble(data["indexPrice"])},
         {"timestamp", data["timestamp"]}
     });
 }
@@ -299,8 +300,8 @@ void PoloniexFuturesWS::handleFundingRateMessage(const nlohmann::json& data) {
     
     emit(symbol, "fundingRate", {
         {"symbol", symbol},
-        {"fundingRate", std::stod(data["fundingRate"].get<std::string>())},
-        {"estimatedRate", std::stod(data["estimatedRate"].get<std::string>())},
+        {"fundingRate", jsonDouble(data["fundingRate"])},
+        {"estimatedRate", jsonDouble(data["estimatedRate"])},
         {"nextFundingTime", data["nextFundingTime"]},
         {"timestamp", data["timestamp"]}
     });
@@ -313,9 +314,9 @@ void PoloniexFuturesWS::handleBalanceMessage(const nlohmann::json& data) {
     
     for (const auto& asset : data["balances"].items()) {
         balance[asset.key()] = {
-            {"free", std::stod(asset.value()["available"].get<std::string>())},
-            {"used", std::stod(asset.value()["frozen"].get<std::string>())},
-            {"total", std::stod(asset.value()["total"].get<std::string>())}
+            {"free", jsonDouble(asset.value()["available"])},
+            {"used", jsonDouble(asset.value()["frozen"])},
+            {"total", jsonDouble(asset.value()["total"])}
         };
     }
     
@@ -333,10 +334,10 @@ void PoloniexFuturesWS::handleOrderMessage(const nlohmann::json& data) {
         {"symbol", symbol},
         {"type", data["type"]},
         {"side", data["side"]},
-        {"price", std::stod(data["price"].get<std::string>())},
-        {"amount", std::stod(data["amount"].get<std::string>())},
-        {"filled", std::stod(data["filled"].get<std::string>())},
-        {"remaining", std::stod(data["remaining"].get<std::string>())},
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["amount"])},
+        {"filled", jsonDouble(data["filled"])},
+        {"remaining", jsonDouble(data["remaining"])},
         {"status", data["status"]},
         {"timestamp", data["timestamp"]}
     });
@@ -353,9 +354,9 @@ void PoloniexFuturesWS::handleMyTradeMessage(const nlohmann::json& data) {
         {"symbol", symbol},
         {"type", data["type"]},
         {"side", data["side"]},
-        {"price", std::stod(data["price"].get<std::string>())},
-        {"amount", std::stod(data["amount"].get<std::string>())},
-        {"fee", std::stod(data["fee"].get<std::string>())},
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["amount"])},
+        {"fee", jsonDouble(data["fee"])},
         {"feeCurrency", data["feeCurrency"]},
         {"timestamp", data["timestamp"]}
     });
@@ -368,14 +369,14 @@ void PoloniexFuturesWS::handlePositionMessage(const nlohmann::json& data) {
     
     emit(symbol, "position", {
         {"symbol", symbol},
-        {"size", std::stod(data["size"].get<std::string>())},
-        {"entryPrice", std::stod(data["entryPrice"].get<std::string>())},
-        {"markPrice", std::stod(data["markPrice"].get<std::string>())},
-        {"liquidationPrice", std::stod(data["liquidationPrice"].get<std::string>())},
-        {"margin", std::stod(data["margin"].get<std::string>())},
-        {"leverage", std::stod(data["leverage"].get<std::string>())},
-        {"unrealizedPnl", std::stod(data["unrealizedPnl"].get<std::string>())},
-        {"marginRatio", std::stod(data["marginRatio"].get<std::string>())},
+        {"size", jsonDouble(data["size"])},
+        {"entryPrice", jsonDouble(data["entryPrice"])},
+        {"markPrice", jsonDouble(data["markPrice"])},
+        {"liquidationPrice", jsonDouble(data["liquidationPrice"])},
+        {"margin", jsonDouble(data["margin"])},
+        {"leverage", jsonDouble(data["leverage"])},
+        {"unrealizedPnl", jsonDouble(data["unrealizedPnl"])},
+        {"marginRatio", jsonDouble(data["marginRatio"])},
         {"timestamp", data["timestamp"]}
     });
 }
@@ -388,8 +389,8 @@ void PoloniexFuturesWS::handleLiquidationMessage(const nlohmann::json& data) {
     emit(symbol, "liquidation", {
         {"symbol", symbol},
         {"side", data["side"]},
-        {"price", std::stod(data["price"].get<std::string>())},
-        {"amount", std::stod(data["amount"].get<std::string>())},
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["amount"])},
         {"timestamp", data["timestamp"]}
     });
 }
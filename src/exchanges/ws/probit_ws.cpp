@@ -10,6 +10,7 @@
 #include <ctime>
 #include <iomanip>
 #include <sstream>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -138,7 +139,7 @@ void ProbitWS::watchMyTrades(const std::string& symbol) {
     subscribe("trade_history", symbol, true);
 }
 
-void ProbitWS::handleMessage(const std::string& message) {
+void ProbitWS::handleMessage(std::string_view message) {
     auto j = nlohmann::json::parse(message);
 
     if (!j.contains("type")) return;
@@ -185,14 +186,14 @@ void ProbitWS::handleTickerMessage(const nlohmann::json& data) {
     
     emit(symbol, "ticker", {
         {"symbol", symbol},
-        {"high", std::stod(data["high"].get<std::string>())},
-        {"low", std::stod(data["low"].get<std::string>())},
-        {"last", std::stod(data["last"].get<std::string>())},
-        {"bid", std::stod(data["bid"].get<std::string>())},
-        {"ask", std::stod(data["ask"].get<std::string>())},
-        {"baseVolume", std::stod(data["base_volume"].get<std::string>())},
-        {"quoteVolume", std::stod(data["quote_volume"].get<std::string>())},
-        {"percentage", std::stod(data["change"].get<std::string>())},
+        {"high", jsonDouble(data["high"])},
+        {"low", jsonDouble(data["low"])},
+        {"last", jsonDouble(data["last"])},
+        {"bid", jsonDouble(data["bid"])},
+        {"ask", jsonDouble(data["ask"])},
+        {"baseVolume", jsonDouble(data["base_volume"])},
+        {"quoteVolume", jsonDouble(data["quote_volume"])},
+        {"percentage", jsonDouble(data["change"])},
         {"timestamp", data["timestamp"]}
     });
 }
@@ -210,11 +211,11 @@ void ProbitWS::handleOrderBookMessage(const nlohmann::json& data) {
     std::vector<std::vector<double>> asks;
     
     for (const auto& bid : data["bids"]) {
-        bids.push_back({std::stod(bid["price"].get<std::string>()), std::stod(bid["quantity"].get<std::string>())});
+        bids.push_back({jsonDouble(bid["price"]), jsonDouble(bid["quantity"])});
     }
     
     for (const auto& ask : data["asks"]) {
-        asks.push_back({std::stod(ask["price"].get<std::string>()), std::stod(ask["quantity"].get<std::string>())});
+        asks.push_back({jsonDouble(ask["price"]), jsonDouble(ask["quantity"])});
     }
     
     orderbook["bids"] = bids;
@@ -231,8 +232,8 @@ void ProbitWS::handleTradeMessage(const nlohmann::json& data) {
     emit(symbol, "trade", {
         {"id", data["id"]},
         {"symbol", symbol},
-        {"price", std::stod(data["price"].get<std::string>())},
-        {"amount", std::stod(data["quantity"].get<std::string>())},
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["quantity"])},
         {"side", data["side"]},
         {"timestamp", data["timestamp"]}
     });
@@ -245,11 +246,11 @@ void ProbitWS::handleOHLCVMessage(const nlohmann::json& data) {
     
     emit(symbol, "ohlcv", {
         {"timestamp", data["timestamp"]},
-        {"open", std::stod(data["open"].get<std::string>())},
-        {"high", std::stod(data["high"].get<std::string>())},
-        {"low", std::stod(data["low"].get<std::string>())},
-        {"close", std::stod(data["close"].get<std::string>())},
-        {"volume", std::stod(data["volume"].get<std::string>())}
+        {"open", jsonDouble(data["open"])},
+        {"high", jsonDouble(data["high"])},
+        {"low", jsonDouble(data["low"])},
+        {"close", jsonDouble(data["close"])},
+        {"volume", jsonDouble(data["volume"])}
     });
 }
 
@@ -260,9 +261,9 @@ void ProbitWS::handleBalanceMessage(const nlohmann::json& data) {
     
     for (const auto& asset : data["balances"].items()) {
         balance[asset.key()] = {
-            {"free", std::stod(asset.value()["available"].get<std::string>())},
-            {"used", std::stod(asset.value()["locked"].get<std::string>())},
-            {"total", std::stod(asset.value()["total"].get<std::string>())}
+            {"free", jsonDouble(asset.value()["available"])},
+            {"used", jsonDouble(asset.value()["locked"])},
+            {"total", jsonDouble(asset.value()["total"])}
         };
     }
     
@@ -280,10 +281,10 @@ void ProbitWS::handleOrderMessage(const nlohmann::json& data) {
         {"symbol", symbol},
         {"type", data["type"]},
         {"side", data["side"]},
-        {"price", std::stod(data["price"].get<std::string>())},
-        {"amount", std::stod(data["quantity"].get<std::string>())},
-        {"filled", std::stod(data["filled_quantity"].get<std::string>())},
-        {"remaining", std::stod(data["remaining_quantity"].get<std::string>())},
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["quantity"])},
+        {"filled", jsonDouble(data["filled_quantity"])},
+        {"remaining", jsonDouble(data["remaining_quantity"])},
         {"status", data["status"]},
         {"timestamp", data["timestamp"]}
     });
@@ -300,9 +301,9 @@ void ProbitWS::handleMyTradeMessage(const nlohmann::json& data) {
         {"symbol", symbol},
         {"type", data["type"]},
         {"side", data["side"]},
-        {"price", std::stod(data["price"].get<std::string>())},
-        {"amount", std::stod(data["quantity"].get<std::string>())},
-        {"fee", std::stod(data["fee"].get<std::string>())},
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["quantity"])},
+        {"fee", jsonDouble(data["fee"])},
         {"feeCurrency", data["fee_currency_id"]},
         {"timestamp", data["timestamp"]}
     });
@@ -132,7 +132,7 @@ void UpbitWS::watchMyTrades(const std::string& symbol) {
     subscribe("trade_history", normalizeSymbol(symbol), true);
 }
 
-void UpbitWS::handleMessage(const std::string& message) {
+void UpbitWS::handleMessage(std::string_view message) {
     auto j = nlohmann::json::parse(message);
 
     if (!j.contains("type")) return;
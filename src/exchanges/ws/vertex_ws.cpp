@@ -10,6 +10,7 @@
 #include <ctime>
 #include <iomanip>
 #include <sstream>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -54,7 +55,7 @@ void VertexWS::subscribeTrades(const std::string& symbol) {
     send(request.dump());
 }
 
-void VertexWS::handleMessage(const std::string& message) {
+void VertexWS::handleMessage(std::string_view message) {
     try {
         auto j = nlohmann::json::parse(message);
         
@@ -89,14 +90,14 @@ void VertexWS::handleTickerMessage(const nlohmann::json& data) {
     nlohmann::json ticker = {
         {"symbol", symbol},
         {"timestamp", tickerData["timestamp"]},
-        {"last", std::stod(tickerData["last"].get<std::string>())},
-        {"high", std::stod(tickerData["high"].get<std::string>())},
-        {"low", std::stod(tickerData["low"].get<std::string>())},
-        {"bid", std::stod(tickerData["bid"].get<std::string>())},
-        {"ask", std::stod(tickerData["ask"].get<std::string>())},
-        {"baseVolume", std::stod(tickerData["baseVolume"].get<std::string>())},
-        {"quoteVolume", std::stod(tickerData["quoteVolume"].get<std::string>())},
-        {"percentage", std::stod(tickerData["change24h"].get<std::string>()) * 100}
+        {"last", jsonDouble(tickerData["last"])},
+        {"high", jsonDouble(tickerData["high"])},
+        {"low", jsonDouble(tickerData["low"])},
+        {"bid", jsonDouble(tickerData["bid"])},
+        {"ask", jsonDouble(tickerData["ask"])},
+        {"baseVolume", jsonDouble(tickerData["baseVolume"])},
+        {"quoteVolume", jsonDouble(tickerData["quoteVolume"])},
+        {"percentage", jsonDouble(tickerData["change24h"]) * 100}
     };
     
     emit(symbol, "ticker", ticker);
@@ -117,8 +118,8 @@ void VertexWS::handleOrderBookMessage(const nlohmann::json& data) {
     for (const auto& bid : bookData["bids"]) {
         if (bid.size() >= 2) {
             bids.push_back({
-                std::stod(bid[0].get<std::string>()),  // price
-                std::stod(bid[1].get<std::string>())   // amount
+                jsonDouble(bid[0]),  // price
+                jsonDouble(bid[1])   // amount
             });
         }
     }
@@ -127,8 +128,8 @@ void VertexWS::handleOrderBookMessage(const nlohmann::json& data) {
     for (const auto& ask : bookData["asks"]) {
         if (ask.size() >= 2) {
             asks.push_back({
-                std::stod(ask[0].get<std::string>()),  // price
-                std::stod(ask[1].get<std::string>())   // amount
+                jsonDouble(ask[0]),  // price
+                jsonDouble(ask[1])   // amount
             });
         }
     }
@@ -158,9 +159,9 @@ void VertexWS::handleTradesMessage(const nlohmann::json& data) {
             {"timestamp", trade["timestamp"]},
             {"symbol", symbol},
             {"side", trade["side"]},
-            {"price", std::stod(trade["price"].get<std::string>())},
-            {"amount", std::stod(trade["amount"].get<std::string>())},
-            {"cost", std::stod(trade["cost"].get<std::string>())}
+            {"price", jsonDouble(trade["price"])},
+            {"amount", jsonDouble(trade["amount"])},
+            {"cost", jsonDouble(trade["cost"])}
         };
         
         emit(symbol, "trade", normalizedTrade);
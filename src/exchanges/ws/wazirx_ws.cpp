@@ -10,6 +10,7 @@
 #include <ctime>
 #include <iomanip>
 #include <sstream>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -133,7 +134,7 @@ void WazirXWS::watchMyTrades(const std::string& symbol) {
     subscribe("mytrades", symbol, true);
 }
 
-void WazirXWS::handleMessage(const std::string& message) {
+void WazirXWS::handleMessage(std::string_view message) {
     auto j = nlohmann::json::parse(message);
 
     if (!j.contains("stream")) return;
@@ -167,14 +168,14 @@ void WazirXWS::handleTickerMessage(const nlohmann::json& data) {
     
     emit(symbol, "ticker", {
         {"symbol", symbol},
-        {"high", std::stod(data["high"].get<std::string>())},
-        {"low", std::stod(data["low"].get<std::string>())},
-        {"last", std::stod(data["last_price"].get<std::string>())},
-        {"bid", std::stod(data["best_bid"].get<std::string>())},
-        {"ask", std::stod(data["best_ask"].get<std::string>())},
-        {"baseVolume", std::stod(data["volume"].get<std::string>())},
-        {"quoteVolume", std::stod(data["quote_volume"].get<std::string>())},
-        {"percentage", std::stod(data["price_change_percent"].get<std::string>())},
+        {"high", jsonDouble(data["high"])},
+        {"low", jsonDouble(data["low"])},
+        {"last", jsonDouble(data["last_price"])},
+        {"bid", jsonDouble(data["best_bid"])},
+        {"ask", jsonDouble(data["best_ask"])},
+        {"baseVolume", jsonDouble(data["volume"])},
+        {"quoteVolume", jsonDouble(data["quote_volume"])},
+        {"percentage", jsonDouble(data["price_change_percent"])},
         {"timestamp", data["timestamp"]}
     });
 }
@@ -191,15 +192,15 @@ void WazirXWS::handleOrderBookMessage(const nlohmann::json& data) {
     
     for (const auto& bid : data["bids"]) {
         bids.push_back({
-            std::stod(bid[0].get<std::string>()),  // price
-            std::stod(bid[1].get<std::string>())   // amount
+            jsonDouble(bid[0]),  // price
+            jsonDouble(bid[1])   // amount
         });
     }
     
     for (const auto& ask : data["asks"]) {
         asks.push_back({
-            std::stod(ask[0].get<std::string>()),  // price
-            std::stod(ask[1].get<std::string>())   // amount
+            jsonDouble(ask[0]),  // price
+            jsonDouble(ask[1])   // amount
         });
     }
     
@@ -216,8 +217,8 @@ void WazirXWS::handleTradeMessage(const nlohmann::json& data) {
     emit(symbol, "trade", {
         {"id", data["id"]},
         {"symbol", symbol},
-        {"price", std::stod(data["price"].get<std::string>())},
-        {"amount", std::stod(data["quantity"].get<std::string>())},
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["quantity"])},
         {"side", data["side"]},
         {"timestamp", data["timestamp"]}
     });
@@ -228,11 +229,11 @@ void WazirXWS::handleOHLCVMessage(const nlohmann::json& data) {
     
     emit(symbol, "ohlcv", {
         {"timestamp", data["timestamp"]},
-        {"open", std::stod(data["open"].get<std::string>())},
-        {"high", std::stod(data["high"].get<std::string>())},
-        {"low", std::stod(data["low"].get<std::string>())},
-        {"close", std::stod(data["close"].get<std::string>())},
-        {"volume", std::stod(data["volume"].get<std::string>())}
+        {"open", jsonDouble(data["open"])},
+        {"high", jsonDouble(data["high"])},
+        {"low", jsonDouble(data["low"])},
+        {"close", jsonDouble(data["close"])},
+        {"volume", jsonDouble(data["volume"])}
     });
 }
 
@@ -241,9 +242,9 @@ void WazirXWS::handleBalanceMessage(const nlohmann::json& data) {
     
     for (const auto& asset : data.items()) {
         balance[asset.key()] = {
-            {"free", std::stod(asset.value()["available"].get<std::string>())},
-            {"used", std::stod(asset.value()["locked"].get<std::string>())},
-            {"total", std::stod(asset.value()["total"].get<std::string>())}
+            {"free", jsonDouble(asset.value()["available"])},
+            {"used", jsonDouble(asset.value()["locked"])},
+            {"total", jsonDouble(asset.value()["total"])}
         };
     }
     
@@ -259,10 +260,10 @@ void WazirXWS::handleOrderMessage(const nlohmann::json& data) {
         {"symbol", symbol},
         {"type", data["type"]},
         {"side", data["side"]},
-        {"price", std::stod(data["price"].get<std::string>())},
-        {"amount", std::stod(data["quantity"].get<std::string>())},
-        {"filled", std::stod(data["executed_quantity"].get<std::string>())},
-        {"remaining", std::stod(data["remaining_quantity"].get<std::string>())},
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["quantity"])},
+        {"filled", jsonDouble(data["executed_quantity"])},
+        {"remaining", jsonDouble(data["remaining_quantity"])},
         {"status", data["status"]},
         {"timestamp", data["timestamp"]}
     });
@@ -277,9 +278,9 @@ void WazirXWS::handleMyTradeMessage(const nlohmann::json& data) {
         {"symbol", symbol},
         {"type", data["type"]},
         {"side", data["side"]},
-        {"price", std::stod(data["price"].get<std::string>())},
-        {"amount", std::stod(data["quantity"].get<std::string>())},
-        {"fee", std::stod(data["fee"].get<std::string>())},
+        {"price", jsonDouble(data["price"])},
+        {"amount", jsonDouble(data["quantity"])},
+        {"fee", jsonDouble(data["fee"])},
         {"feeCurrency", data["fee_currency"]},
         {"timestamp", data["timestamp"]}
     });
@@ -11,6 +11,7 @@
 #include <boost/asio/ssl/stream.hpp>
 #include <ctime>
 #include <sstream>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -166,7 +167,7 @@ int WhiteBitWS::getNextRequestId() {
     return requestId++;
 }
 
-void WhiteBitWS::handleMessage(const std::string& message) {
+void WhiteBitWS::handleMessage(std::string_view message) {
     auto j = nlohmann::json::parse(message);
 
     if (j.contains("method")) {
@@ -212,22 +213,22 @@ void WhiteBitWS::handleTickerMessage(const nlohmann::json& data) {
         {"symbol", symbol},
         {"timestamp", std::time(nullptr) * 1000},
         {"datetime", exchange_.iso8601(std::time(nullptr) * 1000)},
-        {"high", std::stod(tickerData["high"].get<std::string>())},
-        {"low", std::stod(tickerData["low"].get<std::string>())},
-        {"bid", std::stod(tickerData["bid"].get<std::string>())},
-        {"bidVolume", std::stod(tickerData["bidVolume"].get<std::string>())},
-        {"ask", std::stod(tickerData["ask"].get<std::string>())},
-        {"askVolume", std::stod(tickerData["askVolume"].get<std::string>())},
-        {"vwap", std::stod(tickerData["vwap"].get<std::string>())},
-        {"open", std::stod(tickerData["open"].get<std::string>())},
-        {"close", std::stod(tickerData["last"].get<std::string>())},
-        {"last", std::stod(tickerData["last"].get<std::string>())},
+        {"high", jsonDouble(tickerData["high"])},
+        {"low", jsonDouble(tickerData["low"])},
+        {"bid", jsonDouble(tickerData["bid"])},
+        {"bidVolume", jsonDouble(tickerData["bidVolume"])},
+        {"ask", jsonDouble(tickerData["ask"])},
+        {"askVolume", jsonDouble(tickerData["askVolume"])},
+        {"vwap", jsonDouble(tickerData["vwap"])},
+        {"open", jsonDouble(tickerData["open"])},
+        {"close", jsonDouble(tickerData["last"])},
+        {"last", jsonDouble(tickerData["last"])},
         {"previousClose", nullptr},
-        {"change", std::stod(tickerData["change"].get<std::string>())},
-        {"percentage", std::stod(tickerData["priceChange"].get<std::string>())},
-        {"average", std::stod(tickerData["average"].get<std::string>())},
-        {"baseVolume", std::stod(tickerData["volume"].get<std::string>())},
-        {"quoteVolume", std::stod(tickerData["quoteVolume"].get<std::string>())},
+        {"change", jsonDouble(tickerData["change"])},
+        {"percentage", jsonDouble(tickerData["priceChange"])},
+        {"average", jsonDouble(tickerData["average"])},
+        {"baseVolume", jsonDouble(tickerData["volume"])},
+        {"quoteVolume", jsonDouble(tickerData["quoteVolume"])},
         {"info", tickerData}
     };
     
@@ -245,15 +246,15 @@ void WhiteBitWS::handleOrderBookMessage(const nlohmann::json& data) {
     
     for (const auto& bid : bookData["bids"]) {
         bids.push_back({
-            std::stod(bid[0].get<std::string>()),  // price
-            std::stod(bid[1].get<std::string>())   // amount
+            jsonDouble(bid[0]),  // price
+            jsonDouble(bid[1])   // amount
         });
     }
     
     for (const auto& ask : bookData["asks"]) {
         asks.push_back({
-            std::stod(ask[0].get<std::string>()),  // price
-            std::stod(ask[1].get<std::string>())   // amount
+            jsonDouble(ask[0]),  // price
+            jsonDouble(ask[1])   // amount
         });
     }
     
@@ -289,11 +290,11 @@ void WhiteBitWS::handleOHLCVMessage(const nlohmann::json& data) {
     
     nlohmann::json ohlcv = {
         {"timestamp", std::stoll(kline["timestamp"].get<std::string>())},
-        {"open", std::stod(kline["open"].get<std::string>())},
-        {"high", std::stod(kline["high"].get<std::string>())},
-        {"low", std::stod(kline["low"].get<std::string>())},
-        {"close", std::stod(kline["close"].get<std::string>())},
-        {"volume", std::stod(kline["volume"].get<std::string>())}
+        {"open", jsonDouble(kline["open"])},
+        {"high", jsonDouble(kline["high"])},
+        {"low", jsonDouble(kline["low"])},
+        {"close", jsonDouble(kline["close"])},
+        {"volume", jsonDouble(kline["volume"])}
     };
     
     emit(symbol, "ohlcv", ohlcv);
@@ -308,9 +309,9 @@ void WhiteBitWS::handleBalanceMessage(const nlohmann::json& data) {
         auto value = balance.value();
         
         result[currency] = {
-            {"free", std::stod(value["available"].get<std::string>())},
-            {"used", std::stod(value["freeze"].get<std::string>())},
-            {"total", std::stod(value["available"].get<std::string>()) + std::stod(value["freeze"].get<std::string>())}
+            {"free", jsonDouble(value["available"])},
+            {"used", jsonDouble(value["freeze"])},
+            {"total", jsonDouble(value["available"]) + jsonDouble(value["freeze"])}
         };
     }
     
@@ -367,7 +368,7 @@ Order WhiteBitWS::parseWsOrder(const nlohmann::json& order, const Market* market
     auto price = order["price"].get<std::string>();
     auto amount = order["amount"].get<std::string>();
     auto filled = order["dealAmount"].get<std::string>();
-    auto remaining = std::to_string(std::stod(amount) - std::stod(filled));
+    auto remaining = std::to_string(parseDouble(amount) - parseDouble(filled));
     auto status = exchange_.parseOrderStatus(order["status"].get<std::string>());
     auto clientOrderId = order.contains("clientOrderId") ? order["clientOrderId"].get<std::string>() : "";
 
@@ -403,7 +404,7 @@ Trade WhiteBitWS::parseWsTrade(const nlohmann::json& trade, const Market* market
     auto symbol = market ? market->symbol : getSymbol(marketId);
     auto price = trade["price"].get<std::string>();
     auto amount = trade["amount"].get<std::string>();
-    auto cost = std::to_string(std::stod(price) * std::stod(amount));
+    auto cost = std::to_string(parseDouble(price) * parseDouble(amount));
     auto orderId = trade.contains("orderId") ? trade["orderId"].get<std::string>() : "";
 
     nlohmann::json fee;
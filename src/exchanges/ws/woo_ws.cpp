@@ -11,7 +11,6 @@
 #include <iomanip>
 #include <sstream>
 #include <chrono>
-#include <thread>
 
 namespace ccxt {
 
@@ -20,6 +19,7 @@ WooWS::WooWS(boost::asio::io_context& ioc, boost::asio::ssl::context& ctx, Woo&
     , exchange_(exchange)
     , authenticated_(false)
     , sequenceNumber_(1) {
+    setHeartbeat({std::chrono::seconds(10), std::chrono::seconds(10)});
     this->onMessage = [this](const std::string& message) {
         this->handleMessage(message);
     };
@@ -65,21 +65,27 @@ void WooWS::authenticate() {
     }
 }
 
-void WooWS::ping() {
+std::string WooWS::heartbeatMessage() {
     nlohmann::json ping_message = {
         {"event", "ping"},
         {"ts", std::time(nullptr) * 1000}
     };
-    send(ping_message.dump());
+    return ping_message.dump();
 }
 
-void WooWS::startPingLoop() {
-    std::thread([this]() {
-        while (true) {
-            ping();
-            std::this_thread::sleep_for(std::chrono::seconds(30));
-        }
-    }).detach();
+bool WooWS::isHeartbeatReply(std::string_view message) const {
+    return message.find(R"("event":"pong")") != std::string_view::npos;
+}
+
+std::string WooWS::pingReply(std::string_view message) const {
+    if (message.find(R"("event":"ping")") == std::string_view::npos) {
+        return {};
+    }
+    nlohmann::json pong_message = {
+        {"event", "pong"},
+        {"ts", std::time(nullptr) * 1000}
+    };
+    return pong_message.dump();
 }
 
 void WooWS::subscribe(const std::string& channel, const std::string& symbol, bool isPrivate) {
@@ -146,7 +152,7 @@ void WooWS::watchMyTrades(const std::string& symbol) {
     subscribe("execution", symbol, true);
 }
 
-void WooWS::handleMessage(const std::string& message) {
+void WooWS::handleMessage(std::string_view message) {
     auto j = nlohmann::json::parse(message);
 
     if (!j.contains("topic")) {
@@ -154,8 +160,6 @@ void WooWS::handleMessage(const std::string& message) {
             std::string event = j["event"];
             if (event == "auth") {
                 handleAuthMessage(j);
-            } else if (event == "pong") {
-                handlePongMessage(j);
             } else if (event == "error") {
                 handleErrorMessage(j);
             }
@@ -337,12 +341,7 @@ void WooWS::handleErrorMessage(const nlohmann::json& data) {
 void WooWS::handleAuthMessage(const nlohmann::json& data) {
     if (data.contains("success") && data["success"].get<bool>()) {
         authenticated_ = true;
-        startPingLoop();
     }
 }
 
-void WooWS::handlePongMessage(const nlohmann::json& data) {
-    // Handle pong response if needed
-}
-
 } // namespace ccxt
@@ -11,7 +11,7 @@
 #include <iomanip>
 #include <sstream>
 #include <chrono>
-#include <thread>
+#include "ccxt/base/number.h"
 
 namespace ccxt {
 
@@ -20,6 +20,7 @@ XTWS::XTWS(boost::asio::io_context& ioc, boost::asio::ssl::context& ctx, XT& exc
     , exchange_(exchange)
     , authenticated_(false)
     , sequenceNumber_(1) {
+    setHeartbeat({std::chrono::seconds(20), std::chrono::seconds(10)});
     this->onMessage = [this](const std::string& message) {
         this->handleMessage(message);
     };
@@ -69,22 +70,17 @@ void XTWS::authenticate() {
     }
 }
 
-void XTWS::ping() {
+std::string XTWS::heartbeatMessage() {
     nlohmann::json ping_message = {
         {"method", "ping"},
         {"params", {}},
         {"id", getNextSequenceNumber()}
     };
-    send(ping_message.dump());
+    return ping_message.dump();
 }
 
-void XTWS::startPingLoop() {
-    std::thread([this]() {
-        while (true) {
-            ping();
-            std::this_thread::sleep_for(std::chrono::seconds(20));
-        }
-    }).detach();
+bool XTWS::isHeartbeatReply(std::string_view message) const {
+    return message.find(R"("method":"pong")") != std::string_view::npos;
 }
 
 void XTWS::subscribe(const std::string& channel, const std::string& symbol, bool isPrivate) {
@@ -156,15 +152,13 @@ void XTWS::watchMyTrades(const std::string& symbol) {
     subscribe("trade", symbol, true);
 }
 
-void XTWS::handleMessage(const std::string& message) {
+void XTWS::handleMessage(std::string_view message) {
     auto j = nlohmann::json::parse(message);
 
     if (j.contains("method")) {
         std::string method = j["method"];
         if (method == "login") {
             handleAuthMessage(j);
-        } else if (method == "pong") {
-            handlePongMessage(j);
         }
         return;
     }
@@ -205,16 +199,16 @@ void XTWS::handleTickerMessage(const nlohmann::json& data) {
         {"symbol", symbol},
         {"timestamp", ticker["timestamp"]},
         {"datetime", exchange_.iso8601(ticker["timestamp"].get<int64_t>())},
-        {"high", std::stod(ticker["high"])},
-        {"low", std::stod(ticker["low"])},
-        {"bid", std::stod(ticker["bid"])},
-        {"ask", std::stod(ticker["ask"])},
-        {"last", std::stod(ticker["last"])},
-        {"close", std::stod(ticker["last"])},
-        {"baseVolume", std::stod(ticker["volume"])},
-        {"quoteVolume", std::stod(ticker["quoteVolume"])},
-        {"change", std::stod(ticker["change"])},
-        {"percentage", std::stod(ticker["percentage"])},
+        {"high", jsonDouble(ticker["high"])},
+        {"low", jsonDouble(ticker["low"])},
+        {"bid", jsonDouble(ticker["bid"])},
+        {"ask", jsonDouble(ticker["ask"])},
+        {"last", jsonDouble(ticker["last"])},
+        {"close", jsonDouble(ticker["last"])},
+        {"baseVolume", jsonDouble(ticker["volume"])},
+        {"quoteVolume", jsonDouble(ticker["quoteVolume"])},
+        {"change", jsonDouble(ticker["change"])},
+        {"percentage", jsonDouble(ticker["percentage"])},
         {"info", ticker}
     });
 }
@@ -228,15 +222,15 @@ void XTWS::handleOrderBookMessage(const nlohmann::json& data) {
     
     for (const auto& bid : book["bids"]) {
         bids.push_back({
-            std::stod(bid[0]),  // price
-            std::stod(bid[1])   // amount
+            jsonDouble(bid[0]),  // price
+            jsonDouble(bid[1])   // amount
         });
     }
     
     for (const auto& ask : book["asks"]) {
         asks.push_back({
-            std::stod(ask[0]),  // price
-            std::stod(ask[1])   // amount
+            jsonDouble(ask[0]),  // price
+            jsonDouble(ask[1])   // amount
         });
     }
     
@@ -261,9 +255,9 @@ void XTWS::handleTradeMessage(const nlohmann::json& data) {
             {"timestamp", t["timestamp"]},
             {"datetime", exchange_.iso8601(t["timestamp"].get<int64_t>())},
             {"side", t["side"]},
-            {"price", std::stod(t["price"])},
-            {"amount", std::stod(t["amount"])},
-            {"cost", std::stod(t["price"]) * std::stod(t["amount"])},
+            {"price", jsonDouble(t["price"])},
+            {"amount", jsonDouble(t["amount"])},
+            {"cost", jsonDouble(t["price"]) * jsonDouble(t["amount"])},
             {"info", t}
         });
     }
@@ -276,11 +270,11 @@ void XTWS::handleOHLCVMessage(const nlohmann::json& data) {
     emit(symbol, "ohlcv", {
         {"timestamp", kline["timestamp"]},
         {"datetime", exchange_.iso8601(kline["timestamp"].get<int64_t>())},
-        {"open", std::stod(kline["open"])},
-        {"high", std::stod(kline["high"])},
-        {"low", std::stod(kline["low"])},
-        {"close", std::stod(kline["close"])},
-        {"volume", std::stod(kline["volume"])}
+        {"open", jsonDouble(kline["open"])},
+        {"high", jsonDouble(kline["high"])},
+        {"low", jsonDouble(kline["low"])},
+        {"close", jsonDouble(kline["close"])},
+        {"volume", jsonDouble(kline["volume"])}
     });
 }
 
@@ -290,9 +284,9 @@ void XTWS::handleBalanceMessage(const nlohmann::json& data) {
     
     for (const auto& balance : balances.items()) {
         result[balance.key()] = {
-            {"free", std::stod(balance.value()["available"])},
-            {"used", std::stod(balance.value()["frozen"])},
-            {"total", std::stod(balance.value()["total"])}
+            {"free", jsonDouble(balance.value()["available"])},
+            {"used", jsonDouble(balance.value()["frozen"])},
+            {"total", jsonDouble(balance.value()["total"])}
         };
     }
     
@@ -309,10 +303,10 @@ void XTWS::handleOrderMessage(const nlohmann::json& data) {
         {"symbol", symbol},
         {"type", order["type"]},
         {"side", order["side"]},
-        {"price", std::stod(order["price"])},
-        {"amount", std::stod(order["amount"])},
-        {"filled", std::stod(order["filled"])},
-        {"remaining", std::stod(order["amount"]) - std::stod(order["filled"])},
+        {"price", jsonDouble(order["price"])},
+        {"amount", jsonDouble(order["amount"])},
+        {"filled", jsonDouble(order["filled"])},
+        {"remaining", jsonDouble(order["amount"]) - jsonDouble(order["filled"])},
         {"status", order["status"]},
         {"timestamp", order["timestamp"]},
         {"datetime", exchange_.iso8601(order["timestamp"].get<int64_t>())},
@@ -329,11 +323,11 @@ void XTWS::handleMyTradeMessage(const nlohmann::json& data) {
         {"order", trade["orderId"]},
         {"symbol", symbol},
         {"side", trade["side"]},
-        {"price", std::stod(trade["price"])},
-        {"amount", std::stod(trade["amount"])},
-        {"cost", std::stod(trade["price"]) * std::stod(trade["amount"])},
+        {"price", jsonDouble(trade["price"])},
+        {"amount", jsonDouble(trade["amount"])},
+        {"cost", jsonDouble(trade["price"]) * jsonDouble(trade["amount"])},
         {"fee", {
-            {"cost", std::stod(trade["fee"])},
+            {"cost", jsonDouble(trade["fee"])},
             {"currency", trade["feeCurrency"]}
         }},
         {"timestamp", trade["timestamp"]},
@@ -352,12 +346,7 @@ void XTWS::handleErrorMessage(const nlohmann::json& data) {
 void XTWS::handleAuthMessage(const nlohmann::json& data) {
     if (data.contains("result") && data["result"].get<bool>()) {
         authenticated_ = true;
-        startPingLoop();
     }
 }
 
-void XTWS::handlePongMessage(const nlohmann::json& data) {
-    // Handle pong response if needed
-}
-
 } // namespace ccxt
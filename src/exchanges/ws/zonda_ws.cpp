@@ -22,7 +22,7 @@ void ZondaWS::subscribeTrades(const std::string& symbol) {
     send(message);
 }
 
-void ZondaWS::handleMessage(const std::string& message) {
+void ZondaWS::handleMessage(std::string_view message) {
     // Parse the JSON message
     auto jsonMessage = nlohmann::json::parse(message);
 
@@ -0,0 +1,333 @@
+// Build-time generator turning config/<exchange>_rest.json and _ws.json into
+// constexpr tables (capability bitsets, endpoint weights, timeframes).
+//
+//   descriptor_gen <config dir> <output dir>
+//
+// writes <output dir>/ccxt/generated/capabilities.h and
+// <output dir>/descriptor_tables.cpp.
+
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace fs = std::filesystem;
+using json = nlohmann::json;
+
+namespace {
+
+struct Endpoint {
+    std::string api;
+    std::string method;
+    std::string path;
+    double cost = 1.0;
+    std::string altParam;
+    double altCost = 0.0;
+    std::vector<std::pair<double, double>> byLimit;
+};
+
+struct Exchange {
+    std::string id;
+    json rest;
+    json ws;
+};
+
+const std::set<std::string> keywords = {
+    "delete", "new", "default", "private", "public", "protected", "class", "struct",
+    "namespace", "template", "operator", "union", "register", "export"
+};
+
+std::string identifier(const std::string& name) {
+    return keywords.count(name) ? name + "_" : name;
+}
+
+std::string quote(const std::string& value) {
+    std::string result = "\"";
+    for (char c : value) {
+        if (c == '"' || c == '\\') {
+            result += '\\';
+        }
+        result += c;
+    }
+    return result + "\"";
+}
+
+std::string number(double value) {
+    std::ostringstream out;
+    out.precision(17);
+    out << value;
+    std::string text = out.str();
+    if (text.find_first_of(".e") == std::string::npos) {
+        text += ".0";
+    }
+    return text;
+}
+
+std::string toString(const json& value) {
+    return value.is_string() ? value.get<std::string>() : value.dump();
+}
+
+void collectEndpoints(const json& node, const std::string& api, std::vector<Endpoint>& out) {
+    static const std::set<std::string> verbs = {"get", "post", "put", "delete", "patch"};
+    if (!node.is_object()) {
+        return;
+    }
+    for (const auto& [key, value] : node.items()) {
+        std::string lower = key;
+        std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+        if (!verbs.count(lower)) {
+            collectEndpoints(value, api.empty() ? key : api + "." + key, out);
+            continue;
+        }
+        auto add = [&](const std::string& path, const json& weight) {
+            Endpoint endpoint{api, lower, path};
+            if (weight.is_number()) {
+                endpoint.cost = weight.get<double>();
+            } else if (weight.is_object()) {
+                if (weight.contains("cost") && weight["cost"].is_number()) {
+                    endpoint.cost = weight["cost"].get<double>();
+                }
+                for (const auto& [name, alt] : weight.items()) {
+                    // noSymbol / noCoin / noMarket ... apply when that param is absent
+                    if (name.size() > 2 && name.compare(0, 2, "no") == 0 && alt.is_number() &&
+                        name.find("And") == std::string::npos) {
+                        std::string param = name.substr(2);
+                        param[0] = static_cast<char>(std::tolower(static_cast<unsigned char>(param[0])));
+                        endpoint.altParam = param;
+                        endpoint.altCost = alt.get<double>();
+                    }
+                }
+                if (weight.contains("byLimit") && weight["byLimit"].is_array()) {
+                    for (const auto& tier : weight["byLimit"]) {
+                        endpoint.byLimit.emplace_back(tier[0].get<double>(), tier[1].get<double>());
+                    }
+                }
+            }
+            out.push_back(std::move(endpoint));
+        };
+        if (value.is_object()) {
+            for (const auto& [path, weight] : value.items()) {
+                add(path, weight);
+            }
+        } else if (value.is_array()) {
+            for (const auto& path : value) {
+                add(toString(path), json());
+            }
+        }
+    }
+}
+
+std::vector<std::uint64_t> bits(const std::vector<std::string>& names, const json& has,
+                                bool (*predicate)(const json&)) {
+    std::vector<std::uint64_t> words((names.size() + 63) / 64, 0);
+    if (!has.is_object()) {
+        return words;
+    }
+    for (std::size_t i = 0; i < names.size(); ++i) {
+        auto it = has.find(names[i]);
+        if (it != has.end() && predicate(*it)) {
+            words[i / 64] |= std::uint64_t(1) << (i % 64);
+        }
+    }
+    return words;
+}
+
+std::string bitset(const std::vector<std::uint64_t>& words) {
+    std::ostringstream out;
+    out << "{{";
+    for (std::size_t i = 0; i < words.size(); ++i) {
+        out << (i ? ", " : "") << "0x" << std::hex << words[i] << std::dec << "ULL";
+    }
+    out << "}}";
+    return out.str();
+}
+
+void writeIfChanged(const fs::path& path, const std::string& content) {
+    std::ifstream existing(path);
+    if (existing) {
+        std::stringstream current;
+        current << existing.rdbuf();
+        if (current.str() == content) {
+            return;
+        }
+    }
+    fs::create_directories(path.parent_path());
+    std::ofstream(path) << content;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        std::cerr << "usage: descriptor_gen <config dir> <output dir>" << std::endl;
+        return 1;
+    }
+    fs::path configDir = argv[1];
+    fs::path outputDir = argv[2];
+
+    std::map<std::string, Exchange> exchanges;
+    for (const auto& entry : fs::directory_iterator(configDir)) {
+        std::string name = entry.path().filename().string();
+        bool rest = name.size() > 10 && name.compare(name.size() - 10, 10, "_rest.json") == 0;
+        bool ws = name.size() > 8 && name.compare(name.size() - 8, 8, "_ws.json") == 0;
+        if (!rest && !ws) {
+            continue;
+        }
+        std::string id = name.substr(0, name.size() - (rest ? 10 : 8));
+        std::ifstream file(entry.path());
+        auto& exchange = exchanges[id];
+        exchange.id = id;
+        (rest ? exchange.rest : exchange.ws) = json::parse(file);
+    }
+
+    std::set<std::string> capabilitySet;
+    for (const auto& [id, exchange] : exchanges) {
+        for (const json* descriptor : {&exchange.rest, &exchange.ws}) {
+            if (descriptor->contains("has") && (*descriptor)["has"].is_object()) {
+                for (const auto& [name, value] : (*descriptor)["has"].items()) {
+                    capabilitySet.insert(name);
+                }
+            }
+        }
+    }
+    std::vector<std::string> capabilities(capabilitySet.begin(), capabilitySet.end());
+
+    std::ostringstream header;
+    header << "// Generated by tools/descriptor_gen.cpp from config/*.json, do not edit.\n"
+           << "#pragma once\n\n"
+           << "#include <cstdint>\n"
+           << "#include <string_view>\n\n"
+           << "namespace ccxt {\n\n"
+           << "enum class Capability : std::uint16_t {\n";
+    for (const auto& name : capabilities) {
+        header << "    " << identifier(name) << ",\n";
+    }
+    header << "    Count\n};\n\n"
+           << "inline constexpr std::string_view capabilityNames[] = {\n";
+    for (const auto& name : capabilities) {
+        header << "    " << quote(name) << ",\n";
+    }
+    header << "};\n\n} // namespace ccxt\n";
+    writeIfChanged(outputDir / "ccxt" / "generated" / "capabilities.h", header.str());
+
+    auto declared = [](const json&) { return true; };
+    auto enabled = [](const json& v) { return (v.is_boolean() && v.get<bool>()) || v == "emulated"; };
+    auto emulated = [](const json& v) { return v == "emulated"; };
+    auto unknown = [](const json& v) { return v.is_null(); };
+
+    std::ostringstream source;
+    source << "// Generated by tools/descriptor_gen.cpp from config/*.json, do not edit.\n"
+           << "#include \"ccxt/base/descriptor_tables.h\"\n"
+           << "#include <algorithm>\n\n"
+           << "namespace ccxt {\n\nnamespace {\n\n";
+
+    std::ostringstream tables;
+    for (auto& [id, exchange] : exchanges) {
+        std::vector<Endpoint> endpoints;
+        if (exchange.rest.contains("api")) {
+            collectEndpoints(exchange.rest["api"], "", endpoints);
+        }
+        std::sort(endpoints.begin(), endpoints.end(), [](const Endpoint& a, const Endpoint& b) {
+            return std::tie(a.api, a.method, a.path) < std::tie(b.api, b.method, b.path);
+        });
+        endpoints.erase(std::unique(endpoints.begin(), endpoints.end(), [](const Endpoint& a, const Endpoint& b) {
+            return std::tie(a.api, a.method, a.path) == std::tie(b.api, b.method, b.path);
+        }), endpoints.end());
+
+        std::string prefix = "t_" + id;
+        std::size_t limitCount = 0;
+        source << "constexpr LimitCost " << prefix << "_limits[] = {\n";
+        for (const auto& endpoint : endpoints) {
+            for (const auto& [limit, cost] : endpoint.byLimit) {
+                source << "    {" << number(limit) << ", " << number(cost) << "},\n";
+                ++limitCount;
+            }
+        }
+        if (limitCount == 0) {
+            source << "    {0.0, 0.0},\n";
+        }
+        source << "};\n\n";
+
+        source << "constexpr EndpointEntry " << prefix << "_endpoints[] = {\n";
+        std::size_t limitOffset = 0;
+        for (const auto& endpoint : endpoints) {
+            source << "    {" << quote(endpoint.api) << ", " << quote(endpoint.method) << ", " << quote(endpoint.path)
+                   << ", " << number(endpoint.cost) << ", " << quote(endpoint.altParam) << ", " << number(endpoint.altCost)
+                   << ", " << limitOffset << ", " << endpoint.byLimit.size() << "},\n";
+            limitOffset += endpoint.byLimit.size();
+        }
+        if (endpoints.empty()) {
+            source << "    {\"\", \"\", \"\", 1.0, \"\", 0.0, 0, 0},\n";
+        }
+        source << "};\n\n";
+
+        const json& timeframes = exchange.rest.contains("timeframes") ? exchange.rest["timeframes"]
+                               : exchange.ws.contains("timeframes") ? exchange.ws["timeframes"] : json();
+        std::size_t timeframeCount = 0;
+        source << "constexpr TimeframeEntry " << prefix << "_timeframes[] = {\n";
+        if (timeframes.is_object()) {
+            for (const auto& [unified, value] : timeframes.items()) {
+                if (!value.is_null()) {
+                    source << "    {" << quote(unified) << ", " << quote(toString(value)) << "},\n";
+                    ++timeframeCount;
+                }
+            }
+        }
+        if (timeframeCount == 0) {
+            source << "    {\"\", \"\"},\n";
+        }
+        source << "};\n\n";
+
+        const json& rest = exchange.rest;
+        const json& ws = exchange.ws;
+        const json& base = rest.is_object() ? rest : ws;
+        json restHas = rest.contains("has") ? rest["has"] : json();
+        json wsHas = ws.contains("has") ? ws["has"] : json();
+        double rateLimit = base.contains("rateLimit") && base["rateLimit"].is_number() ? base["rateLimit"].get<double>() : 2000.0;
+        bool enableRateLimit = !base.contains("enableRateLimit") || !base["enableRateLimit"].is_boolean() ||
+                               base["enableRateLimit"].get<bool>();
+        // ccxt's constants: DECIMAL_PLACES 2, SIGNIFICANT_DIGITS 3, TICK_SIZE 4;
+        // NO_PADDING 5, PAD_WITH_ZERO 6
+        int precisionMode = base.contains("precisionMode") && base["precisionMode"].is_number_integer()
+                          ? base["precisionMode"].get<int>() : 2;
+        int paddingMode = base.contains("paddingMode") && base["paddingMode"].is_number_integer()
+                        ? base["paddingMode"].get<int>() : 5;
+        const char* counting = precisionMode == 4 ? "CountingMode::TickSize"
+                             : precisionMode == 3 ? "CountingMode::SignificantDigits" : "CountingMode::DecimalPlaces";
+        const char* padding = paddingMode == 6 ? "PaddingMode::PadWithZero" : "PaddingMode::NoPadding";
+
+        tables << "    {" << quote(id) << ", " << number(rateLimit) << ", " << (enableRateLimit ? "true" : "false") << ", "
+               << counting << ", " << padding << ",\n"
+               << "     " << bitset(bits(capabilities, restHas, declared)) << ",\n"
+               << "     " << bitset(bits(capabilities, restHas, enabled)) << ",\n"
+               << "     " << bitset(bits(capabilities, restHas, emulated)) << ",\n"
+               << "     " << bitset(bits(capabilities, restHas, unknown)) << ",\n"
+               << "     " << bitset(bits(capabilities, wsHas, enabled)) << ",\n"
+               << "     " << prefix << "_endpoints, " << endpoints.size() << ", "
+               << prefix << "_limits, " << prefix << "_timeframes, " << timeframeCount << "},\n";
+    }
+
+    source << "// Sorted by id for binary search\n"
+           << "constexpr ExchangeTable tables[] = {\n" << tables.str() << "};\n\n"
+           << "} // namespace\n\n"
+           << "const ExchangeTable* exchangeTable(std::string_view id) {\n"
+           << "    auto it = std::lower_bound(std::begin(tables), std::end(tables), id,\n"
+           << "        [](const ExchangeTable& table, std::string_view key) { return table.id < key; });\n"
+           << "    return it != std::end(tables) && it->id == id ? &*it : nullptr;\n"
+           << "}\n\n"
+           << "std::size_t exchangeTableCount() {\n"
+           << "    return std::size(tables);\n"
+           << "}\n\n"
+           << "} // namespace ccxt\n";
+    writeIfChanged(outputDir / "descriptor_tables.cpp", source.str());
+    return 0;
+}